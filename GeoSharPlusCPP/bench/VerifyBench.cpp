@@ -0,0 +1,129 @@
+// Deserialization cost per verification policy on large MeshData / PointArrayData payloads.
+// Build with -DGSP_BUILD_BENCHMARKS=ON and run GSP_VerifyBench [vertexCount] [iterations].
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <span>
+#include <vector>
+
+#include "GeoSharPlusCPP/Core/Geometry.h"
+#include "GeoSharPlusCPP/Serialization/InteropMemory.h"
+#include "GeoSharPlusCPP/Serialization/Serializer.h"
+
+namespace GS = GeoSharPlusCPP::Serialization;
+using GeoSharPlusCPP::Mesh;
+using GeoSharPlusCPP::Vector3d;
+
+namespace {
+// Regular grid triangulated into two triangles per cell
+Mesh makeGridMesh(int side) {
+  Mesh mesh;
+  mesh.V.resize(static_cast<Eigen::Index>(side) * side, 3);
+  for (int y = 0; y < side; ++y) {
+    for (int x = 0; x < side; ++x) {
+      mesh.V.row(y * side + x) << x, y, 0.01 * ((x * y) % 7);
+    }
+  }
+
+  mesh.F.resize(2 * static_cast<Eigen::Index>(side - 1) * (side - 1), 3);
+  Eigen::Index f = 0;
+  for (int y = 0; y + 1 < side; ++y) {
+    for (int x = 0; x + 1 < side; ++x) {
+      const int v = y * side + x;
+      mesh.F.row(f++) << v, v + 1, v + side;
+      mesh.F.row(f++) << v + 1, v + side + 1, v + side;
+    }
+  }
+  return mesh;
+}
+
+// Median wall time of `fn` in microseconds
+template <typename Fn>
+double medianMicros(int iterations, Fn&& fn) {
+  std::vector<double> samples;
+  samples.reserve(iterations);
+  for (int i = 0; i < iterations; ++i) {
+    const auto start = std::chrono::steady_clock::now();
+    if (!fn()) {
+      std::fprintf(stderr, "deserialization failed\n");
+      std::exit(1);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    samples.push_back(std::chrono::duration<double, std::micro>(stop - start).count());
+  }
+  std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+  return samples[samples.size() / 2];
+}
+
+const char* policyName(GS::VerifyPolicy policy) {
+  switch (policy) {
+    case GS::VerifyPolicy::Full:
+      return "full";
+    case GS::VerifyPolicy::HeaderOnly:
+      return "header-only";
+    case GS::VerifyPolicy::Trusted:
+      return "trusted";
+  }
+  return "?";
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  const int vertexCount = argc > 1 ? std::atoi(argv[1]) : 1'000'000;
+  const int iterations = argc > 2 ? std::atoi(argv[2]) : 50;
+  const int side = std::max(2, static_cast<int>(std::sqrt(static_cast<double>(vertexCount))));
+
+  const Mesh mesh = makeGridMesh(side);
+  uint8_t* meshBuffer = nullptr;
+  int meshSize = 0;
+  if (!GS::serializeMesh(mesh, meshBuffer, meshSize)) {
+    std::fprintf(stderr, "serializeMesh failed\n");
+    return 1;
+  }
+
+  const std::vector<Vector3d> points(
+      reinterpret_cast<const Vector3d*>(mesh.V.data()),
+      reinterpret_cast<const Vector3d*>(mesh.V.data()) + mesh.V.rows());
+  uint8_t* pointBuffer = nullptr;
+  int pointSize = 0;
+  if (!GS::serializePointArray(points, pointBuffer, pointSize)) {
+    std::fprintf(stderr, "serializePointArray failed\n");
+    return 1;
+  }
+
+  std::printf("MeshData: %lld vertices, %lld faces, %.1f MB\n",
+              static_cast<long long>(mesh.V.rows()), static_cast<long long>(mesh.F.rows()),
+              meshSize / 1e6);
+  std::printf("PointArrayData: %zu points, %.1f MB\n", points.size(), pointSize / 1e6);
+  std::printf("median of %d runs, microseconds\n\n", iterations);
+  std::printf("%-12s %14s %14s %16s %16s\n", "policy", "MeshView", "Mesh (copy)",
+              "PointArray span", "PointArray copy");
+
+  for (auto policy :
+       {GS::VerifyPolicy::Full, GS::VerifyPolicy::HeaderOnly, GS::VerifyPolicy::Trusted}) {
+    GeoSharPlusCPP::MeshView view;
+    Mesh meshCopy;
+    std::span<const Vector3d> pointView;
+    std::vector<Vector3d> pointCopy;
+
+    const double meshViewUs = medianMicros(
+        iterations, [&] { return GS::deserializeMeshView(meshBuffer, meshSize, view, policy); });
+    const double meshCopyUs = medianMicros(
+        iterations, [&] { return GS::deserializeMesh(meshBuffer, meshSize, meshCopy, policy); });
+    const double pointViewUs = medianMicros(iterations, [&] {
+      return GS::deserializePointArray(pointBuffer, pointSize, pointView, policy);
+    });
+    const double pointCopyUs = medianMicros(iterations, [&] {
+      return GS::deserializePointArray(pointBuffer, pointSize, pointCopy, policy);
+    });
+
+    std::printf("%-12s %14.2f %14.2f %16.2f %16.2f\n", policyName(policy), meshViewUs,
+                meshCopyUs, pointViewUs, pointCopyUs);
+  }
+
+  GS::FreeInteropMemory(meshBuffer);
+  GS::FreeInteropMemory(pointBuffer);
+  return 0;
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <cstdint>
+#include <utility>
+
+#include "GeoSharPlusCPP/Core/Geometry.h"
+#include "GeoSharPlusCPP/Core/MathTypes.h"
+
+namespace GeoSharPlusCPP {
+// ! Axis-aligned bounds
+// Min and max corner of packed x, y, z rows (MatrixX3d, its maps and row blocks), reduced in
+// parallel chunks. Rows are read four at a time, so every lane of the running min/max holds
+// the same axis and the loop compiles to packed min/max instructions. NaN coordinates are
+// ignored; no points give a zero box. Resident meshes keep theirs (see findMesh).
+std::pair<Vector3d, Vector3d> alignedBounds(const Eigen::Ref<const MatrixX3d>& points);
+
+// ! Oriented bounding boxes
+// Box around points (or mesh vertices) in a frame of its own, for broad-phase tests and
+// packing, where axis-aligned boxes of rotated parts are loose.
+struct OrientedBox {
+  Vector3d center = Vector3d::Zero();
+  // Columns are the unit box axes, a right-handed frame
+  Eigen::Matrix3d axes = Eigen::Matrix3d::Identity();
+  // Half the box size along each axis
+  Vector3d halfExtents = Vector3d::Zero();
+
+  [[nodiscard]] double volume() const noexcept {
+    return 8.0 * halfExtents.prod();
+  }
+
+  // The axis-aligned box [min, max]
+  [[nodiscard]] static OrientedBox aligned(const Vector3d& min, const Vector3d& max);
+};
+
+enum class BoxFit : int32_t {
+  // World axes; resident meshes reuse the bounds computed when they were registered
+  Aligned = 0,
+  // Principal axes of the points (PCA); one covariance pass and one projection pass
+  Principal = 1,
+  // Each principal axis in turn is kept as the box height, and the rectangle of least area
+  // around the points projected along it is found with rotating calipers over their 2D
+  // convex hull. O(n log n); an approximation of the minimum-volume box that is tight for
+  // extrusions along a principal axis (walls, beams, slabs).
+  MinimumArea = 2,
+};
+
+// True for the values above; used to validate fits coming through the C ABI
+bool isValidBoxFit(int32_t fit);
+
+// Fitted boxes are never larger than the axis-aligned box: that one is returned instead when
+// it is smaller. Coordinates are taken relative to the box of the points, so results keep
+// their precision far from the origin.
+OrientedBox orientedBoundingBox(const Eigen::Ref<const MatrixX3d>& points,
+                                BoxFit fit = BoxFit::MinimumArea);
+OrientedBox orientedBoundingBox(const Mesh& mesh, BoxFit fit = BoxFit::MinimumArea);
+OrientedBox orientedBoundingBox(const MeshView& view, BoxFit fit = BoxFit::MinimumArea);
+// With the alignedBounds of `points` already known
+OrientedBox orientedBoundingBox(const Eigen::Ref<const MatrixX3d>& points,
+                                const std::pair<Vector3d, Vector3d>& bounds,
+                                BoxFit fit = BoxFit::MinimumArea);
+}  // namespace GeoSharPlusCPP
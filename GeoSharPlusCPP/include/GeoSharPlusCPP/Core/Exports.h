@@ -0,0 +1,308 @@
+#pragma once
+#include <cstdint>
+
+#include "GeoSharPlusCPP/Core/Macro.h"
+
+extern "C" {
+
+// ============================================
+// GeoSharPlus Library Exports
+// ============================================
+// Library-wide settings, callable from C# through GSP.Core.CoreBridge.
+// ============================================
+
+// --------------------------------
+// Buffer verification
+// --------------------------------
+// Sets the process-wide verification policy used by all deserializers:
+//   0 = full FlatBuffers verification (default)
+//   1 = header only (root offset, table header and vector bounds)
+//   2 = trusted (no checks; only for buffers produced by our own serializers)
+// Returns false for an unknown policy, leaving the current one unchanged.
+GSP_API bool GSP_CALL gsp_set_verify_policy(int32_t policy);
+
+// Returns the current process-wide verification policy.
+GSP_API int32_t GSP_CALL gsp_get_verify_policy();
+
+// --------------------------------
+// Chunked streams
+// --------------------------------
+// Payloads beyond the int-sized buffer ABI travel as chunked streams (see stream.fbs):
+// int64 length-prefixed frames, each holding one independently verifiable FlatBuffer.
+
+// Receives one frame (length prefix included); the bytes are only valid during the call.
+// Return false to abort the stream.
+typedef bool(GSP_CALL* gsp_frame_sink)(const uint8_t* frame, int64_t size, void* context);
+
+// Writes `count` points (x, y, z doubles) as a chunked stream of PointArrayData frames of
+// about `maxChunkBytes` each; <= 0 selects the 64 MB default.
+GSP_API bool GSP_CALL gsp_stream_write_points(const double* xyz,
+                                               int64_t count,
+                                               int64_t maxChunkBytes,
+                                               gsp_frame_sink sink,
+                                               void* context);
+
+// Incremental reader for point array and mesh streams. Feed it bytes in pieces of any size;
+// frames are decoded as they complete, using the process-wide verification policy.
+// The handle must be released with gsp_stream_reader_destroy.
+GSP_API void* GSP_CALL gsp_stream_reader_create();
+GSP_API void GSP_CALL gsp_stream_reader_destroy(void* reader);
+
+// Returns false on malformed data; the reader then stays failed.
+GSP_API bool GSP_CALL gsp_stream_reader_append(void* reader, const uint8_t* data, int64_t size);
+
+// True once every chunk announced by the header has been read.
+GSP_API bool GSP_CALL gsp_stream_reader_complete(void* reader);
+
+// Sizes of a complete stream; `faceCount` is 0 for point arrays.
+GSP_API bool GSP_CALL gsp_stream_reader_counts(void* reader,
+                                                int64_t* pointCount,
+                                                int64_t* faceCount,
+                                                int32_t* faceVertexCount);
+
+// Copy the result of a complete stream: `count` must match gsp_stream_reader_counts.
+// Points are x, y, z doubles; faces are `faceVertexCount` indices each.
+GSP_API bool GSP_CALL gsp_stream_reader_copy_points(void* reader, double* xyz, int64_t count);
+GSP_API bool GSP_CALL gsp_stream_reader_copy_faces(void* reader, int32_t* indices, int64_t count);
+
+// --------------------------------
+// Resident meshes
+// --------------------------------
+// A mesh uploaded once stays in native memory as a Mesh, addressed by a handle that
+// operations take and return instead of mesh buffers. Handles are never reused; 0 is invalid.
+// Every handle must be released with gsp_release.
+
+// Deserializes a MeshData buffer (using the process-wide verification policy) and keeps it.
+GSP_API bool GSP_CALL gsp_mesh_upload(const uint8_t* buffer, int size, uint64_t* handle);
+
+// Serializes a resident mesh; the caller frees the result like any other result buffer.
+GSP_API bool GSP_CALL gsp_mesh_download(uint64_t handle, uint8_t** outBuffer, int* outSize);
+
+// Releases a handle; false if it is unknown or already released.
+GSP_API bool GSP_CALL gsp_release(uint64_t handle);
+
+// Number of live handles and the bytes held by their meshes.
+GSP_API void GSP_CALL gsp_resident_stats(int64_t* handleCount, int64_t* residentBytes);
+
+// --------------------------------
+// Mass properties
+// --------------------------------
+// Area, volume, centroids and inertia tensor of every mesh of a MeshBatch buffer, returned as
+// a MassPropertiesBatch buffer (see massProperties.fbs) with one item per mesh, in order.
+// Meshes are measured in parallel. `summation` is 0 fast, 1 deterministic (bitwise identical
+// for any thread count) or 2 compensated (deterministic, and close to correctly rounded).
+// False for an unknown summation or if any mesh is invalid.
+GSP_API bool GSP_CALL gsp_mass_properties(const uint8_t* inBuffer,
+                                          int inSize,
+                                          int32_t summation,
+                                          uint8_t** outBuffer,
+                                          int* outSize);
+
+// --------------------------------
+// Bounding boxes
+// --------------------------------
+// One box per mesh of a MeshBatch buffer, per point array of a PointArrayBatch buffer or per
+// resident mesh, returned as a BoundingBoxBatch buffer (see boundingBox.fbs) in input order.
+// Items are fitted in parallel. `fit` is 0 axis-aligned, 1 principal axes (PCA) or 2 minimum
+// area (principal axes refined with rotating calipers; the tightest and slowest). Fitted boxes
+// are never larger than the axis-aligned one. Boxes of meshes enclose their vertices.
+// False for an unknown fit or an invalid buffer.
+GSP_API bool GSP_CALL gsp_mesh_bounding_boxes(const uint8_t* inBuffer,
+                                              int inSize,
+                                              int32_t fit,
+                                              uint8_t** outBuffer,
+                                              int* outSize);
+GSP_API bool GSP_CALL gsp_point_bounding_boxes(const uint8_t* inBuffer,
+                                               int inSize,
+                                               int32_t fit,
+                                               uint8_t** outBuffer,
+                                               int* outSize);
+
+// Axis-aligned boxes of resident meshes are computed once and kept with the mesh, so repeated
+// broad-phase queries only pay for the serialization. False if any handle is unknown.
+GSP_API bool GSP_CALL gsp_resident_bounding_boxes(const uint64_t* handles,
+                                                  int count,
+                                                  int32_t fit,
+                                                  uint8_t** outBuffer,
+                                                  int* outSize);
+
+// --------------------------------
+// Topology check and repair
+// --------------------------------
+// Checks a MeshData buffer for degenerate and duplicate faces, non-manifold edges and
+// vertices, unreferenced vertices, flipped neighbours and boundary loops in one parallel pass,
+// and returns a TopologyReport buffer (see topology.fbs). `repair` is a bit set: 1 removes
+// degenerate faces, 2 duplicate faces, 4 unreferenced vertices. When it is nonzero the repaired
+// mesh is returned as a MeshData buffer too; otherwise *meshBuffer is null. False if the mesh
+// fails Mesh::validate (an index out of range) or for an unknown repair bit.
+GSP_API bool GSP_CALL gsp_check_topology(const uint8_t* inBuffer,
+                                         int inSize,
+                                         int32_t repair,
+                                         uint8_t** reportBuffer,
+                                         int* reportSize,
+                                         uint8_t** meshBuffer,
+                                         int* meshSize);
+
+// --------------------------------
+// Mesh queries
+// --------------------------------
+// Closest-point, signed-distance and radius queries of the points of a PointArrayData buffer
+// against a resident mesh (see gsp_mesh_upload). The mesh's spatial index (see MeshBvh.h) is
+// built on the first query of the handle and reused until it is released; points are queried
+// in parallel, in Morton order for cache reuse. Quads and polygons are queried as triangle
+// fans. False for an unknown handle, a mesh that fails Mesh::validate, a negative or NaN
+// distance or an invalid buffer.
+
+// Closest point of the mesh to every point, returned as a MeshHitsData buffer (see
+// meshQuery.fbs). Points farther than `maxDistance` (which may be infinite) get face -1.
+GSP_API bool GSP_CALL gsp_mesh_closest_points(uint64_t handle,
+                                              const uint8_t* inBuffer,
+                                              int inSize,
+                                              double maxDistance,
+                                              uint8_t** outBuffer,
+                                              int* outSize);
+
+// gsp_mesh_closest_points with distances negated for points inside the mesh, which should be
+// closed and consistently oriented outward.
+GSP_API bool GSP_CALL gsp_mesh_signed_distances(uint64_t handle,
+                                                const uint8_t* inBuffer,
+                                                int inSize,
+                                                double maxDistance,
+                                                uint8_t** outBuffer,
+                                                int* outSize);
+
+// Faces within `radius` of every point, nearest first, returned as a FacesWithinData buffer
+// (see meshQuery.fbs).
+GSP_API bool GSP_CALL gsp_mesh_faces_within(uint64_t handle,
+                                            const uint8_t* inBuffer,
+                                            int inSize,
+                                            double radius,
+                                            uint8_t** outBuffer,
+                                            int* outSize);
+
+// --------------------------------
+// Result cache
+// --------------------------------
+// Exports that opt in memoize their results, keyed on a hash of their input buffer and
+// parameters. Hits return a fresh copy, freed by the caller as usual. The cache is off until a
+// budget is set.
+
+// Byte budget of the cache; 0 disables it and drops every entry. False if negative.
+GSP_API bool GSP_CALL gsp_cache_set_budget(int64_t bytes);
+
+// Drops every entry and resets the hit/miss counters.
+GSP_API void GSP_CALL gsp_cache_clear();
+
+// Hit/miss counters since the last clear, and the entries and bytes currently cached.
+GSP_API void GSP_CALL gsp_cache_stats(int64_t* hits,
+                                      int64_t* misses,
+                                      int64_t* entries,
+                                      int64_t* bytes);
+
+// --------------------------------
+// Performance counters
+// --------------------------------
+// Instrumented exports count their calls and bytes in and out, and keep latency histograms of
+// the whole call and of its deserialize, verify, compute, serialize and allocate phases.
+// Recording is off until enabled; builds without GSP_ENABLE_STATS never record.
+
+// Starts or stops recording; counters are kept while stopped.
+GSP_API void GSP_CALL gsp_set_stats_enabled(bool enabled);
+
+// Serializes the counters of every export called since the last reset as a StatsData buffer
+// (see stats.fbs); the caller frees it like any other result buffer.
+GSP_API bool GSP_CALL gsp_get_stats(uint8_t** outBuffer, int* outSize);
+
+// Zeroes every counter.
+GSP_API void GSP_CALL gsp_reset_stats();
+
+// --------------------------------
+// Tracing
+// --------------------------------
+// While tracing is on, the same exports record a timeline of their calls and phases on every
+// native thread, for loading into chrome://tracing or the Perfetto UI. Each thread keeps its
+// latest 32768 spans.
+
+// Starts or stops tracing; spans already recorded are kept while stopped.
+GSP_API void GSP_CALL gsp_trace_enable(bool enabled);
+
+// Writes the spans recorded since the last dump to `path` (UTF-8) as Chrome trace JSON and
+// drops them. False if the file cannot be written.
+GSP_API bool GSP_CALL gsp_trace_dump(const char* path);
+
+// --------------------------------
+// Interop memory accounting
+// --------------------------------
+// Opt-in bookkeeping of the result buffers handed to C#: live buffers and bytes with their
+// high-water mark, in total and per export. While it is on, result buffers must be freed with
+// gsp_free_buffer to leave the accounting; those freed otherwise are reported as leaked.
+
+// Sets the mode: 0 off (default), 1 counters, 2 counters plus every live buffer with the export
+// that allocated it. Switching off drops the records. False for other values.
+GSP_API bool GSP_CALL gsp_set_memory_tracking(int32_t mode);
+
+// Serializes the current records as a MemoryStats buffer (see memory.fbs); the caller frees it
+// like any other result buffer.
+GSP_API bool GSP_CALL gsp_memory_stats(uint8_t** outBuffer, int* outSize);
+
+// Frees a result buffer of any export; null is ignored.
+GSP_API void GSP_CALL gsp_free_buffer(void* buffer);
+
+// --------------------------------
+// Threading
+// --------------------------------
+// Parallel kernels and asynchronous jobs share one native thread pool.
+
+// Caps the pool at `count` threads; 0 restores the default of one per hardware thread.
+// Returns false for a negative count. Work already queued finishes on the previous threads.
+GSP_API bool GSP_CALL gsp_set_thread_count(int32_t count);
+
+// Returns the current number of pool threads.
+GSP_API int32_t GSP_CALL gsp_get_thread_count();
+
+// --------------------------------
+// Asynchronous jobs
+// --------------------------------
+// Runs any function with the (inBuffer, inSize, outBuffer, outSize) signature of the example
+// exports on a native worker thread, so the host's UI thread is not blocked. The input is
+// copied on submit. Job status values:
+//   -1 = unknown or released id, 0 = pending, 1 = running,
+//    2 = succeeded, 3 = failed, 4 = cancelled
+// Every job must be released with gsp_job_release.
+
+typedef bool(GSP_CALL* gsp_job_function)(const uint8_t* inBuffer,
+                                         int inSize,
+                                         uint8_t** outBuffer,
+                                         int* outSize);
+
+// Called once on a worker thread when the job succeeds, fails or is cancelled (also if it is
+// released first). It must not block on other jobs.
+typedef void(GSP_CALL* gsp_job_callback)(uint64_t job, int32_t status, void* userData);
+
+// Queues `fn` on a copy of the input; `callback` may be null.
+GSP_API bool GSP_CALL gsp_submit(gsp_job_function fn,
+                                  const uint8_t* inBuffer,
+                                  int inSize,
+                                  gsp_job_callback callback,
+                                  void* userData,
+                                  uint64_t* job);
+
+// Returns the job's current status.
+GSP_API int32_t GSP_CALL gsp_poll(uint64_t job);
+
+// Blocks until the job finishes or `timeoutMs` passes (< 0 waits indefinitely) and returns its
+// status then.
+GSP_API int32_t GSP_CALL gsp_wait(uint64_t job, int32_t timeoutMs);
+
+// Requests cancellation: a pending job never runs, a running job's result is discarded.
+// False if the job already finished.
+GSP_API bool GSP_CALL gsp_cancel(uint64_t job);
+
+// Hands over the result of a succeeded job, once; the caller frees it like any other result
+// buffer.
+GSP_API bool GSP_CALL gsp_job_result(uint64_t job, uint8_t** outBuffer, int* outSize);
+
+// Releases a job and any result not taken, cancelling it if it has not finished.
+GSP_API bool GSP_CALL gsp_job_release(uint64_t job);
+
+}  // extern "C"
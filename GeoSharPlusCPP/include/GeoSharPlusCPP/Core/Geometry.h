@@ -1,4 +1,11 @@
 #pragma once
+#include <cstdint>
+#include <new>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
 #include <vector>
 
 #include "MathTypes.h"
@@ -9,33 +16,257 @@ struct Polyline {
   [[nodiscard]] double length() const;
 };
 
+// Where a mesh attribute lives: one element per vertex, or per face in face order (rows of F,
+// or the CSR faces of a polygon mesh)
+enum class AttributeDomain : uint8_t { Vertex = 0, Face = 1 };
+
+// Component type of a mesh attribute
+enum class AttributeType : uint8_t { Float32 = 0, Float64 = 1, Int32 = 2, UInt8 = 3 };
+
+// One attribute element per row, one component per column
+template <typename T>
+using AttributeMatrix = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+template <typename T>
+constexpr AttributeType attributeTypeOf() {
+  if constexpr (std::is_same_v<T, float>) {
+    return AttributeType::Float32;
+  } else if constexpr (std::is_same_v<T, double>) {
+    return AttributeType::Float64;
+  } else if constexpr (std::is_same_v<T, int>) {
+    return AttributeType::Int32;
+  } else {
+    static_assert(std::is_same_v<T, uint8_t>, "Unsupported attribute component type");
+    return AttributeType::UInt8;
+  }
+}
+
+// Named data channel of a mesh (normals, colors, UVs, analysis results): one row of 1-4
+// components per vertex or face. Attributes travel in the same buffer as the geometry.
+struct MeshAttribute {
+  // Alternatives are in AttributeType order
+  using Data = std::variant<AttributeMatrix<float>,
+                            AttributeMatrix<double>,
+                            AttributeMatrix<int>,
+                            AttributeMatrix<uint8_t>>;
+
+  std::string name;
+  AttributeDomain domain = AttributeDomain::Vertex;
+  Data data;
+
+  [[nodiscard]] AttributeType type() const noexcept {
+    return static_cast<AttributeType>(data.index());
+  }
+  [[nodiscard]] Eigen::Index count() const noexcept {
+    return std::visit([](const auto& values) { return values.rows(); }, data);
+  }
+  [[nodiscard]] Eigen::Index dimension() const noexcept {
+    return std::visit([](const auto& values) { return values.cols(); }, data);
+  }
+
+  // Typed access; nullptr if the components are of another type
+  template <typename T>
+  [[nodiscard]] const AttributeMatrix<T>* get() const noexcept {
+    return std::get_if<AttributeMatrix<T>>(&data);
+  }
+};
+
+// Non-owning view of an attribute channel, typically straight into a verified buffer
+struct MeshAttributeView {
+  std::string_view name;
+  AttributeDomain domain = AttributeDomain::Vertex;
+  AttributeType type = AttributeType::Float64;
+  const void* data = nullptr;
+  Eigen::Index count = 0;
+  Eigen::Index dimension = 1;
+
+  // Typed map of the components; empty if they are of another type
+  template <typename T>
+  [[nodiscard]] Eigen::Map<const AttributeMatrix<T>> map() const noexcept {
+    return type == attributeTypeOf<T>()
+               ? Eigen::Map<const AttributeMatrix<T>>(static_cast<const T*>(data), count, dimension)
+               : Eigen::Map<const AttributeMatrix<T>>(nullptr, 0, dimension);
+  }
+
+  // Materialize an owning copy
+  [[nodiscard]] MeshAttribute toAttribute() const;
+};
+
 struct Mesh {
   Mesh() = default;
 
   // Constructor to initialize mesh with vertices and faces
   Mesh(const MatrixX3d& vertices, const Eigen::MatrixXi& faces) : V(vertices), F(faces) {}
 
+  // Constructor for polygon meshes (mixed tri/quad, n-gons) from CSR faces
+  Mesh(const MatrixX3d& vertices,
+       const Eigen::VectorXi& offsets,
+       const Eigen::VectorXi& indices)
+      : V(vertices), faceOffsets(offsets), faceIndices(indices) {}
+
   // Mesh data: V - vertices, F - faces (triangles or quads)
   // F is now dynamic width: 3 columns for triangles, 4 columns for quads
   MatrixX3d V;
   Eigen::MatrixXi F;  // Dynamic width to support both tri and quad meshes
 
+  // Polygon faces of any size in CSR form, used instead of F when faceOffsets is non-empty:
+  // face i is faceIndices[faceOffsets[i] .. faceOffsets[i + 1]). Mixed meshes are kept as-is
+  // instead of being triangulated.
+  Eigen::VectorXi faceOffsets;  // face count + 1 entries, starting at 0
+  Eigen::VectorXi faceIndices;
+
   // Optional per-vertex data
   Eigen::VectorXd C;
 
+  // Named per-vertex / per-face attribute channels
+  std::vector<MeshAttribute> attributes;
+
   // Helper methods to identify mesh type
-  [[nodiscard]] constexpr bool isTriangleMesh() const noexcept {
-    return F.cols() == 3;
+  [[nodiscard]] bool isPolygonMesh() const noexcept {
+    return faceOffsets.size() > 0;
+  }
+  [[nodiscard]] bool isTriangleMesh() const noexcept {
+    return !isPolygonMesh() && F.cols() == 3;
+  }
+  [[nodiscard]] bool isQuadMesh() const noexcept {
+    return !isPolygonMesh() && F.cols() == 4;
+  }
+  // Vertices per face; 0 for polygon meshes
+  [[nodiscard]] int faceVertexCount() const noexcept {
+    return isPolygonMesh() ? 0 : static_cast<int>(F.cols());
+  }
+  [[nodiscard]] Eigen::Index faceCount() const noexcept {
+    return isPolygonMesh() ? faceOffsets.size() - 1 : F.rows();
+  }
+
+  // First attribute with the given name, or nullptr
+  [[nodiscard]] const MeshAttribute* attribute(std::string_view name) const noexcept;
+
+  // Bytes held by the vertex, face and attribute storage
+  [[nodiscard]] size_t memoryBytes() const noexcept;
+
+  // Index ranges only; checkTopology (MeshTopology.h) finds degenerate, duplicate and
+  // non-manifold faces
+  [[nodiscard]] bool validate() const;
+  [[nodiscard]] Eigen::Vector3d centroid() const;
+  // Min and max corner of the vertices (see alignedBounds in BoundingBox.h)
+  [[nodiscard]] std::pair<Vector3d, Vector3d> boundingBox() const;
+};
+
+// Read-only, non-owning view of mesh data.
+// Typically maps straight onto a verified FlatBuffer (see Serialization::deserializeMeshView),
+// so no vertex/face data is copied. The viewed memory must outlive the view.
+struct MeshView {
+  MeshView() = default;
+  MeshView(const double* vertices,
+           Eigen::Index vertexCount,
+           const int* faces,
+           Eigen::Index faceCount,
+           Eigen::Index faceVertexCount) {
+    reset(vertices, vertexCount, faces, faceCount, faceVertexCount);
+  }
+
+  // V - vertices (N x 3, row-major), F - faces (M x 3 or M x 4, row-major)
+  Eigen::Map<const MatrixX3d> V{nullptr, 0, 3};
+  Eigen::Map<const MatrixXi> F{nullptr, 0, 3};
+  // Polygon faces in CSR form (see Mesh); empty unless the view was reset to a polygon mesh
+  Eigen::Map<const Eigen::VectorXi> faceOffsets{nullptr, 0};
+  Eigen::Map<const Eigen::VectorXi> faceIndices{nullptr, 0};
+  // Attribute channels; cleared by reset / resetPolygons
+  std::vector<MeshAttributeView> attributes;
+
+  // Re-point the view at new memory (Eigen maps are rebound with placement new)
+  void reset(const double* vertices,
+             Eigen::Index vertexCount,
+             const int* faces,
+             Eigen::Index faceCount,
+             Eigen::Index faceVertexCount) {
+    new (&V) Eigen::Map<const MatrixX3d>(vertices, vertexCount, 3);
+    new (&F) Eigen::Map<const MatrixXi>(faces, faceCount, faceVertexCount);
+    new (&faceOffsets) Eigen::Map<const Eigen::VectorXi>(nullptr, 0);
+    new (&faceIndices) Eigen::Map<const Eigen::VectorXi>(nullptr, 0);
+    attributes.clear();
+  }
+
+  // Re-point the view at a polygon mesh: `faceCount + 1` offsets, `indexCount` indices
+  void resetPolygons(const double* vertices,
+                     Eigen::Index vertexCount,
+                     const int* offsets,
+                     Eigen::Index faceCount,
+                     const int* indices,
+                     Eigen::Index indexCount) {
+    new (&V) Eigen::Map<const MatrixX3d>(vertices, vertexCount, 3);
+    new (&F) Eigen::Map<const MatrixXi>(nullptr, 0, 0);
+    new (&faceOffsets) Eigen::Map<const Eigen::VectorXi>(offsets, faceCount + 1);
+    new (&faceIndices) Eigen::Map<const Eigen::VectorXi>(indices, indexCount);
+    attributes.clear();
+  }
+
+  [[nodiscard]] bool isPolygonMesh() const noexcept {
+    return faceOffsets.size() > 0;
+  }
+  [[nodiscard]] bool isTriangleMesh() const noexcept {
+    return !isPolygonMesh() && F.cols() == 3;
+  }
+  [[nodiscard]] bool isQuadMesh() const noexcept {
+    return !isPolygonMesh() && F.cols() == 4;
   }
-  [[nodiscard]] constexpr bool isQuadMesh() const noexcept {
-    return F.cols() == 4;
+  // Vertices per face; 0 for polygon meshes
+  [[nodiscard]] int faceVertexCount() const noexcept {
+    return isPolygonMesh() ? 0 : static_cast<int>(F.cols());
   }
-  [[nodiscard]] constexpr int faceVertexCount() const noexcept {
-    return static_cast<int>(F.cols());
+  [[nodiscard]] Eigen::Index faceCount() const noexcept {
+    return isPolygonMesh() ? faceOffsets.size() - 1 : F.rows();
   }
 
+  // First attribute with the given name, or nullptr
+  [[nodiscard]] const MeshAttributeView* attribute(std::string_view name) const noexcept;
+
   [[nodiscard]] bool validate() const;
   [[nodiscard]] Eigen::Vector3d centroid() const;
   [[nodiscard]] std::pair<Vector3d, Vector3d> boundingBox() const;
+
+  // Materialize an owning copy
+  [[nodiscard]] Mesh toMesh() const;
+};
+
+// Nested int arrays (face-vertex lists, vertex neighbours, ...) in CSR form: sub-array i is
+// values[offsets[i] .. offsets[i + 1]). Two allocations however many sub-arrays there are,
+// and O(1) access to each one as a span.
+struct CsrIntArray {
+  std::vector<int> offsets{0};  // size() + 1 entries, starting at 0
+  std::vector<int> values;
+
+  [[nodiscard]] size_t size() const noexcept { return offsets.size() - 1; }
+  [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+  [[nodiscard]] std::span<const int> operator[](size_t i) const noexcept {
+    return {values.data() + offsets[i], values.data() + offsets[i + 1]};
+  }
+  [[nodiscard]] std::span<int> operator[](size_t i) noexcept {
+    return {values.data() + offsets[i], values.data() + offsets[i + 1]};
+  }
+
+  void clear() noexcept {
+    offsets.assign(1, 0);
+    values.clear();
+  }
+  void reserve(size_t arrayCount, size_t valueCount) {
+    offsets.reserve(arrayCount + 1);
+    values.reserve(valueCount);
+  }
+  // Append one sub-array
+  void push_back(std::span<const int> subArray) {
+    values.insert(values.end(), subArray.begin(), subArray.end());
+    offsets.push_back(static_cast<int>(values.size()));
+  }
+
+  // Rebuild the offsets from sub-array sizes in one prefix-sum pass; `values` is left to the
+  // caller and must end up with offsets.back() entries. Fails (leaving the array empty) on a
+  // negative size or a total beyond int range.
+  bool assignSizes(std::span<const int> sizes);
+
+  [[nodiscard]] static CsrIntArray fromNested(const std::vector<std::vector<int>>& nested);
+  [[nodiscard]] std::vector<std::vector<int>> toNested() const;
 };
 }  // namespace GeoSharPlusCPP
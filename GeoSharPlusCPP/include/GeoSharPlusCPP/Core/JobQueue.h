@@ -0,0 +1,62 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+#include "GeoSharPlusCPP/Core/MathTypes.h"
+#include "GeoSharPlusCPP/Core/Macro.h"
+
+namespace GeoSharPlusCPP {
+// Process-wide queue of asynchronous jobs, run on the shared thread pool (Parallel.h). A job
+// calls one function with the (inBuffer, inSize, outBuffer, outSize) signature of the example
+// exports on a private copy of its input, so the caller can reuse or rebuild its buffer (e.g.
+// serialize the next input) while the job runs.
+//
+// Job ids are never reused; 0 is never a valid id. A job's record, and its result if not taken,
+// lives until the job is released. All functions are thread-safe.
+using JobId = uint64_t;
+using JobFunction = bool(GSP_CALL*)(const uint8_t* inBuffer,
+                                    int inSize,
+                                    uint8_t** outBuffer,
+                                    int* outSize);
+
+enum class JobStatus : int32_t {
+  Unknown = -1,  // Unknown or released id
+  Pending = 0,
+  Running = 1,
+  Succeeded = 2,
+  Failed = 3,
+  Cancelled = 4,
+};
+
+// Called once per job on a worker thread when it reaches Succeeded, Failed or Cancelled, also
+// if it was released before finishing. It must not block on other jobs.
+using JobCallback = void(GSP_CALL*)(JobId job, int32_t status, void* userData);
+
+// Queues `fn(input)`; returns 0 if the job cannot be queued
+JobId submitJob(JobFunction fn,
+                ByteSpan input,
+                JobCallback callback = nullptr,
+                void* userData = nullptr);
+
+JobStatus jobStatus(JobId job);
+
+// Blocks until the job finishes or `timeout` passes, and returns its status then
+JobStatus waitJob(JobId job);
+JobStatus waitJob(JobId job, std::chrono::milliseconds timeout);
+
+// Requests cancellation. A pending job never runs; a running job's result is discarded, and
+// functions that run long can stop early by polling jobCancelled(). False if the job already
+// finished or is unknown.
+bool cancelJob(JobId job);
+
+// Hands the result of a succeeded job to the caller, who frees it like any other result
+// buffer. False if the job did not succeed or its result was already taken.
+bool takeJobResult(JobId job, uint8_t*& resBuffer, int& resSize);
+
+// Drops the job's record and any untaken result, cancelling the job if it has not finished.
+// False for an unknown or already released id.
+bool releaseJob(JobId job);
+
+// True inside a job function once its job has been cancelled; always false outside jobs
+bool jobCancelled();
+}  // namespace GeoSharPlusCPP
@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+
+#include "GeoSharPlusCPP/Core/Geometry.h"
+#include "GeoSharPlusCPP/Core/MathTypes.h"
+
+namespace GeoSharPlusCPP {
+// ! Mass properties
+// Surface area, enclosed volume, both centroids and the inertia tensor of a mesh, reduced in
+// one pass over its faces. Faces of any size are fanned into triangles from their first vertex,
+// so tri, quad and polygon (CSR) meshes are handled alike; the area of a non-convex n-gon is
+// overestimated where its fan triangles fold over. Volume terms follow the divergence theorem,
+// so they are exact for any planar face and meaningful for closed meshes only.
+//
+// Triangles are gathered into fixed-size blocks in structure-of-arrays layout, so the cross
+// products and moment terms of a block compile to vector instructions. Blocks are summed in
+// parallel chunks (see Parallel.h). Coordinates are taken relative to the first vertex, so
+// meshes far from the origin (e.g. georeferenced models) keep their precision.
+
+enum class MassSummation : int32_t {
+  // One chunk per thread (Reduction::Fast); the last bits may vary with the thread count
+  Fast = 0,
+  // Fixed chunks combined in order (Reduction::Deterministic); bitwise identical for every
+  // thread count and run. Default.
+  Deterministic = 1,
+  // Deterministic, with Neumaier-compensated sums throughout: slower, but results are close
+  // to correctly rounded, so they barely depend on face order or mesh size
+  Compensated = 2,
+};
+
+// True for the values above; used to validate modes coming through the C ABI
+bool isValidMassSummation(int32_t summation);
+
+struct MassProperties {
+  double area = 0.0;
+  // Signed: positive for closed meshes with outward (counter-clockwise) faces
+  double volume = 0.0;
+  // Area-weighted centroid of the surface; zero for a mesh without area
+  Vector3d areaCentroid = Vector3d::Zero();
+  // Centroid of the enclosed solid; the area centroid when the volume is zero
+  Vector3d volumeCentroid = Vector3d::Zero();
+  // Inertia tensor of the solid at unit density, about volumeCentroid with world-aligned axes.
+  // Scales with the sign of the volume.
+  Eigen::Matrix3d inertia = Eigen::Matrix3d::Zero();
+};
+
+// Faces must index valid vertices (see Mesh::validate)
+MassProperties massProperties(const Mesh& mesh,
+                              MassSummation summation = MassSummation::Deterministic);
+MassProperties massProperties(const MeshView& view,
+                              MassSummation summation = MassSummation::Deterministic);
+}  // namespace GeoSharPlusCPP
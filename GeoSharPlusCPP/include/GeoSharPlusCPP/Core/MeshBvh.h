@@ -0,0 +1,112 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "GeoSharPlusCPP/Core/Geometry.h"
+#include "GeoSharPlusCPP/Core/MathTypes.h"
+
+namespace GeoSharPlusCPP {
+// ! Bounding volume hierarchy
+// Spatial index over the faces of a mesh for closest-point, signed-distance and radius
+// queries. Quads and polygons are indexed as triangle fans (corner 0, k, k + 1). The tree is
+// built top-down with a binned SAH split (16 bins per axis); the large upper nodes are binned
+// in parallel and their subtrees built concurrently on the shared thread pool.
+//
+// Nodes are a flat array with siblings side by side, so a traversal tests both children from
+// one cache line pair. Triangles are copied into leaf order with their corner positions, so a
+// leaf reads contiguous memory instead of gathering vertices. Trees are immutable: queries
+// are thread-safe and deterministic, and a tree is meant to be built once and reused (e.g.
+// through findMeshBvh for resident meshes).
+class MeshBvh {
+public:
+  // Closest point of the mesh to a query point
+  struct Hit {
+    int face = -1;  // Face of the mesh; -1 if nothing was found
+    // Vertices of the (fan) triangle and the barycentric weights of the point on it
+    std::array<int, 3> vertices{-1, -1, -1};
+    Vector3d barycentric = Vector3d::Zero();
+    Vector3d point = Vector3d::Zero();
+    // Negative inside a closed mesh for signed queries
+    double distance = std::numeric_limits<double>::infinity();
+  };
+
+  // Faces must index valid vertices (see Mesh::validate)
+  explicit MeshBvh(const Mesh& mesh);
+
+  MeshBvh(const MeshBvh&) = delete;
+  MeshBvh& operator=(const MeshBvh&) = delete;
+
+  // Closest point within `maxDistance` (inclusive); a Hit with face -1 if there is none
+  [[nodiscard]] Hit closestPoint(const Vector3d& point,
+                                 double maxDistance = std::numeric_limits<double>::infinity())
+      const;
+
+  // closestPoint with the distance negated for points inside the mesh. The side is taken from
+  // the angle-weighted pseudo-normal of the closest face, edge or vertex, which is exact for
+  // closed, consistently oriented (outward) meshes; elsewhere it follows the nearest face.
+  // The pseudo-normals are computed on the first signed query.
+  [[nodiscard]] Hit signedClosestPoint(const Vector3d& point,
+                                       double maxDistance = std::numeric_limits<double>::infinity())
+      const;
+
+  // Faces within `radius` (inclusive) of `point` as (face, distance) pairs, nearest first and
+  // by face on ties; appended to `faces`
+  void facesWithin(const Vector3d& point,
+                   double radius,
+                   std::vector<std::pair<int, double>>& faces) const;
+
+  [[nodiscard]] size_t triangleCount() const noexcept { return triangles_.size(); }
+  [[nodiscard]] size_t nodeCount() const noexcept { return nodes_.size(); }
+  // Bytes held by the tree, without the pseudo-normals of signed queries
+  [[nodiscard]] size_t memoryBytes() const noexcept;
+
+private:
+  // Leaves hold `count` > 0 triangles from `index`; inner nodes (count 0) have their children
+  // at `index` and `index + 1`
+  struct alignas(64) Node {
+    double min[3];
+    double max[3];
+    uint32_t index;
+    uint32_t count;
+  };
+
+  struct Triangle {
+    Vector3d a;
+    Vector3d b;
+    Vector3d c;
+  };
+
+  // Per leaf-order triangle: face normal, then the pseudo-normals of its edges ab, bc, ca
+  struct PseudoNormals {
+    std::vector<std::array<Vector3d, 4>> triangles;
+    std::vector<Vector3d> vertices;
+  };
+
+  struct Builder;
+
+  template <typename Visit>
+  void traverse(const Vector3d& point, double limit2, Visit&& visit) const;
+  // closestPoint, also returning the (leaf-order) triangle of the hit
+  Hit nearest(const Vector3d& point, double maxDistance, uint32_t& triangle) const;
+  const PseudoNormals& pseudoNormals() const;
+
+  std::vector<Node> nodes_;
+  std::vector<Triangle> triangles_;  // Leaf order
+  std::vector<int> faces_;           // Face of every triangle
+  std::vector<std::array<int, 3>> vertices_;
+  Eigen::Index vertexCount_ = 0;
+
+  mutable std::once_flag normalsOnce_;
+  mutable PseudoNormals normals_;
+};
+
+// Order in which to run a batch of queries: along a Morton (Z-order) curve over the bounds of
+// the points, so consecutive queries (and the chunks of a parallel loop) reuse the nodes and
+// triangles their neighbours brought into cache
+std::vector<uint32_t> queryOrder(const Eigen::Ref<const MatrixX3d>& points);
+}  // namespace GeoSharPlusCPP
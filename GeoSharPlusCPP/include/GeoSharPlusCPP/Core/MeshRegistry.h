@@ -0,0 +1,44 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "GeoSharPlusCPP/Core/Geometry.h"
+
+namespace GeoSharPlusCPP {
+class MeshBvh;
+
+// Process-wide registry of resident meshes. A mesh that is reused across calls (e.g. the same
+// Grasshopper input on every slider drag) is uploaded and deserialized once, then addressed by
+// an opaque handle, so only small parameters cross the interop boundary per call.
+//
+// Handles are never reused, so a stale handle is reported instead of aliasing a newer mesh;
+// 0 is never a valid handle. Resident meshes are immutable and shared: an operation holding a
+// mesh keeps it alive even if its handle is released concurrently. All functions are
+// thread-safe.
+using MeshHandle = uint64_t;
+
+// Takes ownership of `mesh`; returns 0 if it cannot be stored
+MeshHandle registerMesh(Mesh&& mesh);
+
+// The resident mesh of `handle`, or nullptr for an unknown or released handle
+std::shared_ptr<const Mesh> findMesh(MeshHandle handle);
+// Also returns the axis-aligned bounds of its vertices, computed once at registration
+std::shared_ptr<const Mesh> findMesh(MeshHandle handle, std::pair<Vector3d, Vector3d>& bounds);
+
+// The spatial index of the resident mesh of `handle`, built on first use and kept until the
+// handle is released; nullptr for an unknown handle or a mesh that fails Mesh::validate
+std::shared_ptr<const MeshBvh> findMeshBvh(MeshHandle handle);
+
+// Drops the registry's reference; false for an unknown or released handle
+bool releaseMesh(MeshHandle handle);
+
+struct MeshRegistryStats {
+  size_t handleCount = 0;
+  // Mesh::memoryBytes() summed over the resident meshes, plus their spatial indices once built
+  size_t residentBytes = 0;
+};
+
+MeshRegistryStats meshRegistryStats();
+}  // namespace GeoSharPlusCPP
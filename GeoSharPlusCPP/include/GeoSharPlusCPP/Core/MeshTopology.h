@@ -0,0 +1,74 @@
+#pragma once
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "GeoSharPlusCPP/Core/Geometry.h"
+
+namespace GeoSharPlusCPP {
+// ! Topology check
+// Finds the input that Mesh::validate (index ranges only) lets through but that breaks or slows
+// down later kernels. One parallel pass builds the undirected edges in hash-partitioned tables:
+// half-edges are scattered into buckets by the hash of their vertex pair, then every bucket is
+// grouped on its own, so the pass is O(F) and scales with the thread count. Faces are grouped
+// the same way by their vertex set to find duplicates. Tri, quad and polygon (CSR) meshes are
+// handled alike.
+//
+// Every id refers to the input mesh and every list is sorted, so reports are identical for
+// every thread count.
+struct TopologyReport {
+  Eigen::Index vertexCount = 0;
+  Eigen::Index faceCount = 0;
+  size_t edgeCount = 0;          // Undirected edges
+  size_t boundaryEdgeCount = 0;  // Edges of one face
+
+  // Faces that repeat a vertex or whose (Newell) area vanishes next to their longest edge
+  std::vector<int> degenerateFaces;
+  // Faces with the same vertex set as an earlier face, in any order or orientation
+  std::vector<int> duplicateFaces;
+  // Edges of three or more faces, as (a, b) with a < b
+  std::vector<std::pair<int, int>> nonManifoldEdges;
+  // Vertices whose faces form more than one fan (e.g. two cones touching at their tips)
+  std::vector<int> nonManifoldVertices;
+  // Vertices of no face
+  std::vector<int> unreferencedVertices;
+  // Edges of two faces that run it in the same direction, i.e. flipped neighbours
+  std::vector<std::pair<int, int>> inconsistentEdges;
+  // Chains of boundary edges in face winding order, starting at their smallest vertex; loop i
+  // is boundaryLoops[i]. Chains only stay open where they run into a non-manifold edge.
+  CsrIntArray boundaryLoops;
+
+  // True when none of the above turned up: a manifold, consistently oriented mesh, possibly
+  // with boundaries
+  [[nodiscard]] bool clean() const noexcept {
+    return degenerateFaces.empty() && duplicateFaces.empty() && nonManifoldEdges.empty() &&
+           nonManifoldVertices.empty() && unreferencedVertices.empty() &&
+           inconsistentEdges.empty();
+  }
+};
+
+// Faces must index valid vertices (see Mesh::validate)
+TopologyReport checkTopology(const Mesh& mesh);
+TopologyReport checkTopology(const MeshView& view);
+
+// ! Repair
+// Fixes the common cases a report points out, without another pass over the topology. Faces
+// keep their order and vertices their relative order; attributes and Mesh::C follow their
+// faces and vertices. Edges that are non-manifold or inconsistent only through a removed
+// duplicate are fixed along with it; other non-manifold and orientation problems need
+// modelling decisions and are left alone.
+struct MeshRepairOptions {
+  bool removeDegenerateFaces = true;
+  bool removeDuplicateFaces = true;
+  // Also drops the vertices orphaned by removed faces
+  bool removeUnreferencedVertices = true;
+};
+
+// `report` must be the report of `mesh`
+Mesh repairMesh(const Mesh& mesh,
+                const TopologyReport& report,
+                const MeshRepairOptions& options = {});
+Mesh repairMesh(const MeshView& view,
+                const TopologyReport& report,
+                const MeshRepairOptions& options = {});
+}  // namespace GeoSharPlusCPP
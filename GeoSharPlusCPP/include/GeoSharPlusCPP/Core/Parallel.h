@@ -0,0 +1,90 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace GeoSharPlusCPP {
+// ! Thread pool
+// Library-wide work-stealing pool shared by parallel loops and asynchronous jobs. Each worker
+// runs the tasks it queued itself newest first and steals the oldest tasks of other workers
+// when idle; tasks queued from other threads (e.g. the host's) go to a shared queue. Every
+// function is safe to call from any number of threads at once, including pool threads.
+
+// Number of pool threads; 0 restores the default of one per hardware thread. Work queued
+// before the change still finishes on the previous threads.
+void setThreadCount(size_t count);
+size_t threadCount();
+
+// Queues `task` on the pool. Throws std::bad_alloc or std::system_error if the task or the
+// pool cannot be created.
+void submitTask(std::function<void()> task);
+
+// ! Parallel loops
+// Indices per chunk when no grain is given. Chunks are the unit of scheduling, so a chunk
+// should cover at least a few microseconds of work.
+inline constexpr size_t kDefaultGrain = 4096;
+
+// Calls body(chunkBegin, chunkEnd) for every chunk [begin + k * grain, begin + (k + 1) * grain)
+// of [begin, end), the last one clipped to `end`. Chunks run on the calling thread and at most
+// threadCount() - 1 pool threads, so a loop never waits for a busy pool and loops can nest.
+// Returns once every chunk is done; if `body` throws, remaining chunks are skipped and the
+// first exception is rethrown.
+void parallelForChunks(size_t begin,
+                       size_t end,
+                       size_t grain,
+                       const std::function<void(size_t, size_t)>& body);
+
+// Calls fn(i) for every i in [begin, end)
+template <typename Fn>
+void parallelFor(size_t begin, size_t end, Fn&& fn, size_t grain = kDefaultGrain) {
+  parallelForChunks(begin, end, grain, [&](size_t chunkBegin, size_t chunkEnd) {
+    for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+      fn(i);
+    }
+  });
+}
+
+enum class Reduction {
+  // Chunks depend only on the range and grain and are combined in index order, so the result
+  // is bitwise identical for every thread count and run
+  Deterministic,
+  // One chunk per thread, combined in index order: least overhead, but floating-point results
+  // may differ in the last bits when the thread count changes
+  Fast,
+};
+
+// Reduces [begin, end): map(chunkBegin, chunkEnd) returns the partial result of a chunk, and
+// combine(T, T) merges two partial results left to right, starting from `identity`.
+template <typename T, typename MapFn, typename CombineFn>
+T parallelReduce(size_t begin,
+                 size_t end,
+                 T identity,
+                 MapFn&& map,
+                 CombineFn&& combine,
+                 Reduction mode = Reduction::Deterministic,
+                 size_t grain = kDefaultGrain) {
+  if (end <= begin) {
+    return identity;
+  }
+
+  const size_t count = end - begin;
+  grain = std::max<size_t>(grain, 1);
+  if (mode == Reduction::Fast) {
+    const size_t threads = std::max<size_t>(threadCount(), 1);
+    grain = std::max(grain, count / threads + (count % threads != 0));
+  }
+
+  std::vector<T> partials(count / grain + (count % grain != 0), identity);
+  parallelForChunks(begin, end, grain, [&](size_t chunkBegin, size_t chunkEnd) {
+    partials[(chunkBegin - begin) / grain] = map(chunkBegin, chunkEnd);
+  });
+
+  T result = std::move(identity);
+  for (T& partial : partials) {
+    result = combine(std::move(result), std::move(partial));
+  }
+  return result;
+}
+}  // namespace GeoSharPlusCPP
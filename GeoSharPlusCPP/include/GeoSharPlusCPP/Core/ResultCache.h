@@ -0,0 +1,77 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+#include "GeoSharPlusCPP/Core/MathTypes.h"
+
+namespace GeoSharPlusCPP {
+// 64-bit XXH64 hash of `bytes`; several GB/s, so hashing an input buffer costs far less than
+// recomputing geometry from it
+uint64_t hashBytes(ByteSpan bytes, uint64_t seed = 0);
+
+// ! Result cache
+// Opt-in memoization for exports with the (inBuffer, inSize, outBuffer, outSize) signature:
+// results are keyed on the function name, a hash of the input buffer and of any extra
+// parameters, and kept in an LRU bounded by a byte budget. The cache is process-wide and
+// thread-safe, and disabled (budget 0) until a budget is set.
+//
+// A hit requires the same function and input size and the same 128-bit hash (two XXH64
+// chains with independent seeds), so telling two inputs apart never rests on 64 bits alone.
+struct CacheKey {
+  std::string_view function;  // A string literal: keys outlive the call that made them
+  uint64_t hash = 0;
+  uint64_t check = 0;  // Second half of the 128-bit hash
+  uint64_t inputSize = 0;
+
+  bool operator==(const CacheKey&) const = default;
+};
+
+CacheKey makeCacheKey(std::string_view function, ByteSpan input, ByteSpan params = {});
+
+// Copies a cached result into a new interop buffer; false on a miss
+bool cacheLookup(const CacheKey& key, uint8_t*& resBuffer, int& resSize);
+// Stores a copy of a result, evicting least recently used entries to stay within the budget.
+// Results larger than the whole budget are not stored.
+void cacheStore(const CacheKey& key, ByteSpan result);
+
+// Byte budget for cached results; 0 disables the cache and drops every entry
+void setCacheBudget(size_t bytes);
+size_t cacheBudget();
+void clearCache();
+
+struct CacheStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  size_t entries = 0;
+  size_t bytes = 0;
+};
+
+CacheStats cacheStats();
+
+// Runs `compute(resBuffer, resSize)` unless the result of the same call is cached, and caches
+// what it returns. `function` is a string literal (see CacheKey); `params` are the call's
+// arguments besides the input buffer, as raw bytes.
+template <typename ComputeFn>
+bool cachedResult(std::string_view function,
+                  ByteSpan input,
+                  ByteSpan params,
+                  uint8_t*& resBuffer,
+                  int& resSize,
+                  ComputeFn&& compute) {
+  if (cacheBudget() == 0) {
+    return std::forward<ComputeFn>(compute)(resBuffer, resSize);
+  }
+
+  const CacheKey key = makeCacheKey(function, input, params);
+  if (cacheLookup(key, resBuffer, resSize)) {
+    return true;
+  }
+  if (!std::forward<ComputeFn>(compute)(resBuffer, resSize)) {
+    return false;
+  }
+  cacheStore(key, ByteSpan(resBuffer, static_cast<size_t>(resSize)));
+  return true;
+}
+}  // namespace GeoSharPlusCPP
@@ -0,0 +1,146 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace GeoSharPlusCPP {
+// ! Performance counters
+// Per-export call and byte counters, with a latency histogram for the whole call and for each
+// phase of it. An export opts in with GSP_STATS_CALL as its first statement; the serializers,
+// verifiers and interop allocator mark their phases with GSP_STATS_PHASE, which records into
+// the export running on the same thread. Phases on other threads (e.g. parallel loop helpers)
+// and nested scopes of a phase already being timed are not recorded again. While tracing is on
+// (Trace.h), the same scopes also record timeline spans, on every thread.
+//
+// Counters and spans are compiled in with GSP_ENABLE_STATS (a CMake option, on by default);
+// without it the macros expand to nothing. Compiled in, both are off until enabled at runtime,
+// and a scope then costs a thread-local and a flag read. Recording costs two clock reads and a
+// few relaxed atomic adds per scope.
+enum class StatsPhase : uint8_t {
+  Call = 0,  // The whole export call
+  Deserialize = 1,
+  Verify = 2,  // Up-front buffer verification, part of Deserialize
+  Compute = 3,
+  Serialize = 4,
+  Allocate = 5,  // Interop memory allocations, mostly part of Serialize
+};
+inline constexpr size_t kStatsPhaseCount = 6;
+
+// Bucket k counts durations in [2^(k-1), 2^k) ns, bucket 0 those under 1 ns; the last bucket
+// (from about 4.6 minutes) also holds everything longer
+inline constexpr size_t kLatencyBuckets = 40;
+
+// Counters of one export; opaque, registered once per export
+struct StatsSite;
+
+// Counters of the export `name`, registered on first use. `name` must outlive the process,
+// e.g. a literal or __func__.
+StatsSite* statsSite(const char* name);
+
+void setStatsEnabled(bool enabled);
+bool statsEnabled();
+
+// Zeroes every counter; exports stay registered
+void resetStats();
+
+// Name of the export running on the calling thread while it is counted, traced or its interop
+// memory tracked (InteropAccounting.h); otherwise, and without GSP_ENABLE_STATS, null
+const char* currentExportName();
+
+struct PhaseStats {
+  uint64_t count = 0;
+  uint64_t totalNs = 0;
+  uint64_t maxNs = 0;
+  std::array<uint64_t, kLatencyBuckets> buckets{};
+};
+
+struct ExportStats {
+  std::string_view name;
+  uint64_t bytesIn = 0;
+  uint64_t bytesOut = 0;
+  std::array<PhaseStats, kStatsPhaseCount> phases{};
+
+  uint64_t calls() const { return phases[static_cast<size_t>(StatsPhase::Call)].count; }
+};
+
+// Exports called at least once since the last reset, in registration order. Counters are read
+// one by one while calls may still be recording, so a snapshot can be off by the calls in
+// flight.
+std::vector<ExportStats> collectStats();
+
+// Upper bound of the bucket holding the `fraction` (0-1) percentile, clamped to the maximum;
+// 0 without samples
+uint64_t latencyPercentile(const PhaseStats& stats, double fraction);
+
+// collectStats() as a StatsData buffer (stats.fbs) in interop memory, freed by the caller
+bool serializeStats(uint8_t*& resBuffer, int& resSize);
+
+// Times one phase of the export running on the calling thread; see GSP_STATS_PHASE. Headers
+// hold it as a member (CheckedRoot), so it has the same layout with or without
+// GSP_ENABLE_STATS; compiled out, it does nothing.
+class StatsPhaseScope {
+public:
+#ifdef GSP_ENABLE_STATS
+  explicit StatsPhaseScope(StatsPhase phase);
+  ~StatsPhaseScope();
+#else
+  explicit StatsPhaseScope(StatsPhase phase) : phase_(phase) {}
+#endif
+
+  StatsPhaseScope(const StatsPhaseScope&) = delete;
+  StatsPhaseScope& operator=(const StatsPhaseScope&) = delete;
+
+private:
+  [[maybe_unused]] StatsSite* site_ = nullptr;  // Export being counted, if any
+  [[maybe_unused]] bool active_ = false;
+  [[maybe_unused]] bool tracing_ = false;
+  [[maybe_unused]] StatsPhase phase_;
+  [[maybe_unused]] std::chrono::steady_clock::time_point start_;
+};
+
+#ifdef GSP_ENABLE_STATS
+// Times one export call on the calling thread; see GSP_STATS_CALL
+class StatsCallScope {
+public:
+  // `outSize`, if not null, is read when the scope ends
+  StatsCallScope(StatsSite* site, int64_t inBytes, const int* outSize);
+  ~StatsCallScope();
+
+  StatsCallScope(const StatsCallScope&) = delete;
+  StatsCallScope& operator=(const StatsCallScope&) = delete;
+
+private:
+  StatsSite* site_ = nullptr;  // Null when neither counting, tracing nor tracking memory
+  bool counting_ = false;
+  bool tracing_ = false;
+  StatsSite* outerSite_ = nullptr;
+  const char* outerExport_ = nullptr;
+  uint8_t outerPhases_ = 0;
+  int64_t inBytes_ = 0;
+  const int* outSize_ = nullptr;
+  std::chrono::steady_clock::time_point start_;
+};
+
+  #define GSP_STATS_CONCAT_(a, b) a##b
+  #define GSP_STATS_CONCAT(a, b) GSP_STATS_CONCAT_(a, b)
+
+  // First statement of an export: counts the call, `inBytes` and the *outSize it returns
+  // (pass nullptr if it has none), and times the call and its phases
+  #define GSP_STATS_CALL(inBytes, outSize)                                                  \
+    static ::GeoSharPlusCPP::StatsSite* const gspStatsSite =                                \
+        ::GeoSharPlusCPP::statsSite(__func__);                                              \
+    const ::GeoSharPlusCPP::StatsCallScope gspStatsCall(gspStatsSite, (inBytes), (outSize))
+
+  // Times the rest of the enclosing block as StatsPhase::`phase`
+  #define GSP_STATS_PHASE(phase)                                                         \
+    const ::GeoSharPlusCPP::StatsPhaseScope GSP_STATS_CONCAT(gspStatsPhase, __LINE__)( \
+        ::GeoSharPlusCPP::StatsPhase::phase)
+#else
+// Compiled out: the macros expand to nothing
+  #define GSP_STATS_CALL(inBytes, outSize) static_cast<void>(0)
+  #define GSP_STATS_PHASE(phase) static_cast<void>(0)
+#endif
+}  // namespace GeoSharPlusCPP
@@ -0,0 +1,29 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+
+namespace GeoSharPlusCPP {
+// ! Tracing
+// Opt-in timeline of native calls, written as Chrome trace JSON (chrome://tracing, Perfetto UI).
+// The scopes of Stats.h record one span per export call, named after the export, and one per
+// phase: "deserialize", "verify", "kernel", "serialize" and "interop alloc". Spans are kept in
+// a ring buffer per thread that only its thread writes, without locks; once a ring is full its
+// oldest spans are overwritten. Spans are only recorded in builds with GSP_ENABLE_STATS.
+
+// Spans kept per thread (32 bytes each)
+inline constexpr size_t kTraceRingCapacity = size_t{1} << 15;
+
+// Off by default; spans already recorded are kept while tracing is off
+void setTracingEnabled(bool enabled);
+bool tracingEnabled();
+
+// Records a span on the calling thread. `name` must outlive the process, e.g. a literal.
+void traceSpan(const char* name,
+               std::chrono::steady_clock::time_point start,
+               std::chrono::steady_clock::time_point end);
+
+// Writes every span recorded since the last dump to `path` (UTF-8) as Chrome trace JSON and
+// drops them. Spans recorded while the dump runs may go to the next one. False if the file
+// cannot be written.
+bool dumpTrace(const char* path);
+}  // namespace GeoSharPlusCPP
@@ -14,6 +14,14 @@ extern "C" {
 //
 // These are EXAMPLE functions that you can modify or replace.
 // Use them as templates for your own extensions.
+//
+// Each example is exported in two calling conventions:
+// - `name` allocates the result; C# copies it and frees it with MarshalHelper.Free.
+// - `name_size` + `name_into` write into a caller-provided (e.g. pooled, pinned) buffer:
+//   `name_size` reports an upper bound on the result size for the given input, and
+//   `name_into` writes the result into `outBuffer`. If `outCapacity` is too small, nothing
+//   is written, false is returned and `*outSize` holds the required size, so the caller can
+//   grow its buffer and retry. No native memory is allocated for the result.
 // ============================================
 
 // --------------------------------
@@ -25,6 +33,14 @@ GSP_API bool GSP_CALL example_point3d_roundtrip(const uint8_t* inBuffer,
                                                  int inSize,
                                                  uint8_t** outBuffer,
                                                  int* outSize);
+GSP_API bool GSP_CALL example_point3d_roundtrip_size(const uint8_t* inBuffer,
+                                                     int inSize,
+                                                     int* outSize);
+GSP_API bool GSP_CALL example_point3d_roundtrip_into(const uint8_t* inBuffer,
+                                                     int inSize,
+                                                     uint8_t* outBuffer,
+                                                     int outCapacity,
+                                                     int* outSize);
 
 // --------------------------------
 // Point3d Array Roundtrip Example
@@ -34,15 +50,61 @@ GSP_API bool GSP_CALL example_point3d_array_roundtrip(const uint8_t* inBuffer,
                                                        int inSize,
                                                        uint8_t** outBuffer,
                                                        int* outSize);
+GSP_API bool GSP_CALL example_point3d_array_roundtrip_size(const uint8_t* inBuffer,
+                                                           int inSize,
+                                                           int* outSize);
+GSP_API bool GSP_CALL example_point3d_array_roundtrip_into(const uint8_t* inBuffer,
+                                                           int inSize,
+                                                           uint8_t* outBuffer,
+                                                           int outCapacity,
+                                                           int* outSize);
 
 // --------------------------------
 // Mesh Roundtrip Example
 // --------------------------------
 // Demonstrates sending a mesh (vertices + faces) from C# to C++ and back.
-// Supports both triangle and quad meshes.
+// Supports triangle, quad and mixed (polygon) meshes.
+// The allocating export memoizes its result when the result cache is enabled.
 GSP_API bool GSP_CALL example_mesh_roundtrip(const uint8_t* inBuffer,
                                               int inSize,
                                               uint8_t** outBuffer,
                                               int* outSize);
+GSP_API bool GSP_CALL example_mesh_roundtrip_size(const uint8_t* inBuffer,
+                                                  int inSize,
+                                                  int* outSize);
+GSP_API bool GSP_CALL example_mesh_roundtrip_into(const uint8_t* inBuffer,
+                                                  int inSize,
+                                                  uint8_t* outBuffer,
+                                                  int outCapacity,
+                                                  int* outSize);
+
+// --------------------------------
+// Mesh Batch Roundtrip Example
+// --------------------------------
+// Demonstrates sending many meshes in one buffer and one call, instead of one call per mesh.
+// Large batches are processed on several threads.
+// The allocating export memoizes its result when the result cache is enabled.
+GSP_API bool GSP_CALL example_mesh_batch_roundtrip(const uint8_t* inBuffer,
+                                                    int inSize,
+                                                    uint8_t** outBuffer,
+                                                    int* outSize);
+GSP_API bool GSP_CALL example_mesh_batch_roundtrip_size(const uint8_t* inBuffer,
+                                                        int inSize,
+                                                        int* outSize);
+GSP_API bool GSP_CALL example_mesh_batch_roundtrip_into(const uint8_t* inBuffer,
+                                                        int inSize,
+                                                        uint8_t* outBuffer,
+                                                        int outCapacity,
+                                                        int* outSize);
+
+// --------------------------------
+// Resident Mesh Example
+// --------------------------------
+// Demonstrates an operation on a resident mesh (see gsp_mesh_upload in Core/Exports.h): the
+// mesh is uploaded once, and each call only passes its handle and a parameter. The scaled
+// mesh is returned as a new handle, to be released with gsp_release.
+GSP_API bool GSP_CALL example_mesh_scale_resident(uint64_t meshHandle,
+                                                  double factor,
+                                                  uint64_t* outHandle);
 
 }  // extern "C"
@@ -0,0 +1,93 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+#include "GeoSharPlusCPP/Core/Geometry.h"
+#include "GeoSharPlusCPP/Core/MathTypes.h"
+#include "GeoSharPlusCPP/Serialization/Serializer.h"
+
+namespace GeoSharPlusCPP::Serialization {
+// Chunked streams carry point arrays and meshes past the 2 GB FlatBuffer limit and the
+// int-sized buffer ABI. A stream is a run of frames (see stream.fbs): an int64 length, then a
+// FlatBuffer. The header frame announces the counts; every chunk frame is an ordinary
+// PointArrayData or MeshData buffer that verifies on its own, so neither side ever holds more
+// than one chunk of serialized data.
+
+// Byte size of a frame's length prefix
+constexpr size_t kFrameHeaderBytes = sizeof(int64_t);
+
+struct ChunkOptions {
+  // Target serialized size of one chunk; clamped to kMaxChunkBytes
+  int64_t maxChunkBytes = 64 << 20;
+  // Encodings of the points / mesh vertices and of the mesh faces
+  MeshEncodingOptions encoding;
+};
+
+// Largest accepted chunk target; keeps every chunk far below the int-sized ABI limit
+constexpr int64_t kMaxChunkBytes = 256 << 20;
+
+// Receives each complete frame (length prefix included) as soon as it is built. The bytes
+// are only valid during the call. Returning false aborts the stream.
+using FrameSink = std::function<bool(ByteSpan frame)>;
+
+// Streaming serializers: build and emit one chunk at a time. Meshes must be tri or quad
+// meshes; polygon (CSR) meshes are not streamed, and attribute channels are not sent.
+bool serializePointArrayChunked(std::span<const Vector3d> points,
+                                const FrameSink& sink,
+                                const ChunkOptions& options = {});
+bool serializePointArrayChunked(const MatrixX3d& points,
+                                const FrameSink& sink,
+                                const ChunkOptions& options = {});
+bool serializeMeshChunked(const Mesh& mesh, const FrameSink& sink, const ChunkOptions& options = {});
+
+// Incremental stream reader. Bytes can be appended in pieces of any size; each frame is
+// decoded into the result as soon as it is complete, and only a partial frame is buffered.
+// Chunks are copied into place in the result, which is sized from the header counts up to a
+// cap and grows with the data beyond it, so a forged header cannot claim a huge allocation.
+class StreamReader {
+public:
+  explicit StreamReader(VerifyPolicy policy = defaultVerifyPolicy());
+
+  // Feed the next bytes of the stream. Returns false on malformed data (bad frame, chunk
+  // that fails verification, counts that disagree with the header, a face index outside the
+  // points, trailing bytes); the reader then stays failed.
+  bool append(ByteSpan bytes);
+
+  // All announced chunks have been read and their counts match the header
+  [[nodiscard]] bool complete() const;
+  [[nodiscard]] bool failed() const { return failed_; }
+  [[nodiscard]] bool isMesh() const { return isMesh_; }
+  [[nodiscard]] int64_t bytesRead() const { return bytesRead_; }
+
+  // Assembled payload, valid once complete(): a point array fills V only
+  [[nodiscard]] const Mesh& mesh() const { return result_; }
+  [[nodiscard]] const MatrixX3d& points() const { return result_.V; }
+
+private:
+  bool consume(ByteSpan bytes);
+  bool readFrame(ByteSpan body);
+  bool readHeader(ByteSpan body);
+  bool readPointChunk(ByteSpan body);
+  bool readFaceChunk(ByteSpan body);
+
+  VerifyPolicy policy_;
+  std::vector<uint8_t> pending_;  // Partial frame, length prefix included
+  bool failed_ = false;
+  bool hasHeader_ = false;
+  bool isMesh_ = false;
+  int64_t bytesRead_ = 0;
+
+  uint64_t pointChunks_ = 0;
+  uint64_t faceChunks_ = 0;
+  uint64_t chunksRead_ = 0;
+  // Announced by the header; result_ grows towards them as chunks arrive
+  Eigen::Index pointCount_ = 0;
+  Eigen::Index faceCount_ = 0;
+  Eigen::Index pointsRead_ = 0;
+  Eigen::Index facesRead_ = 0;
+  Mesh result_;
+};
+}  // namespace GeoSharPlusCPP::Serialization
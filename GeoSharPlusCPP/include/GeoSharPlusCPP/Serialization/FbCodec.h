@@ -0,0 +1,373 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <new>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+#include "GeoSharPlusCPP/Core/MathTypes.h"
+#include "GeoSharPlusCPP/Core/Stats.h"
+#include "GeoSharPlusCPP/Serialization/InteropMemory.h"
+#include "GeoSharPlusCPP/Serialization/VerifyPolicy.h"
+#include "flatbuffers/flatbuffers.h"
+
+namespace GeoSharPlusCPP::Serialization {
+// Building blocks shared by the core serializers and extension code, plus FbCodec: serializers
+// generated at compile time for tables whose payload is one vector of scalars or structs.
+
+// ! Size estimates
+// Root offset, vtable, table fields and alignment padding of a single-table buffer
+inline constexpr size_t kTableOverhead = 64;
+// Length prefix plus worst-case alignment padding of one vector
+inline constexpr size_t kVectorOverhead = 16;
+
+// ! Output paths
+// Both output paths share the `build` step that fills a builder and finishes it. A builder
+// that cannot grow throws std::bad_alloc; both paths turn it into a false return, so it never
+// reaches the extern "C" exports above them.
+// Interop path: build into a fresh interop-memory builder and hand its storage over.
+template <typename BuildFn>
+bool serializeToInterop(size_t sizeHint, BuildFn&& build, uint8_t*& resBuffer, int& resSize) {
+  GSP_STATS_PHASE(Serialize);
+  resBuffer = nullptr;
+  resSize = 0;
+  try {
+    auto builder = makeInteropBuilder(sizeHint);
+    if (!build(builder)) {
+      return false;
+    }
+
+    // Hand the builder's interop storage to the caller
+    return releaseInteropBuffer(builder, resBuffer, resSize);
+  } catch (const std::bad_alloc&) {
+    return false;  // The builder's storage went with it
+  }
+}
+
+// Caller-buffer path: build into the reused scratch builder and copy out once.
+template <typename BuildFn>
+bool serializeToSpan(BuildFn&& build, MutableByteSpan dst, int& resSize) {
+  GSP_STATS_PHASE(Serialize);
+  resSize = 0;
+
+  try {
+    auto& builder = scratchBuilder();
+    if (!build(builder)) {
+      return false;
+    }
+
+    return copyToCallerBuffer(builder, dst, resSize);
+  } catch (const std::bad_alloc&) {
+    return false;  // The scratch builder is cleared on its next use
+  }
+}
+
+// ! Input checks
+// Root table of an incoming buffer, checked according to a VerifyPolicy:
+// - Full runs the FlatBuffers verifier over the whole buffer up front.
+// - HeaderOnly checks the root offset and table header here, and each vector, struct or
+//   sub-table field only when it is read (see `readableSlots` and `readable`).
+// - Trusted checks nothing beyond a non-empty buffer.
+// A CheckedRoot times the Deserialize phase of the running export (Stats.h) over its lifetime,
+// which is that of the deserializer using it, and the up-front checks as the Verify phase.
+template <typename Root>
+class CheckedRoot {
+public:
+  CheckedRoot(const uint8_t* data, int size, VerifyPolicy policy)
+      : deserializeScope_(StatsPhase::Deserialize),
+        verifier_(data, size > 0 ? static_cast<size_t>(size) : 0),
+        policy_(policy) {
+    if (!data || size < static_cast<int>(sizeof(flatbuffers::uoffset_t))) {
+      return;
+    }
+
+    GSP_STATS_PHASE(Verify);
+    bool ok = false;
+    switch (policy) {
+      case VerifyPolicy::Full:
+        ok = verifier_.VerifyBuffer<Root>();
+        break;
+      case VerifyPolicy::HeaderOnly:
+        ok = verifier_.VerifyOffset(0) != 0 &&
+             asTable(flatbuffers::GetRoot<Root>(data))->VerifyTableStart(verifier_);
+        break;
+      case VerifyPolicy::Trusted:
+        ok = true;
+        break;
+    }
+
+    if (ok) {
+      root_ = flatbuffers::GetRoot<Root>(data);
+    }
+  }
+
+  const Root* operator->() const { return root_; }
+  const Root* get() const { return root_; }
+  explicit operator bool() const { return root_ != nullptr; }
+  bool trusted() const { return policy_ == VerifyPolicy::Trusted; }
+
+  // Under HeaderOnly, the offset slots of the given vector or sub-table fields of `table`
+  // (generated VT_ ids) and the offsets in them lie within the buffer. Their accessors read the
+  // slots, so this comes first, as in the generated Verify(); absent fields pass.
+  template <typename T>
+  bool readableSlots(const T* table, std::initializer_list<flatbuffers::voffset_t> fields) {
+    if (policy_ == VerifyPolicy::HeaderOnly) {
+      for (auto field : fields) {
+        if (!asTable(table)->VerifyOffset(verifier_, field)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  // A vector field is present and, under HeaderOnly, lies within the buffer
+  template <typename T>
+  bool readable(const flatbuffers::Vector<T>* vec) {
+    return vec && (policy_ != VerifyPolicy::HeaderOnly || verifier_.VerifyVector(vec));
+  }
+
+  // An inline struct field is present and, under HeaderOnly, lies within the buffer
+  template <typename T>
+  bool readable(const T* structField, flatbuffers::voffset_t field) {
+    return structField && (policy_ != VerifyPolicy::HeaderOnly ||
+                           asTable(root_)->template VerifyField<T>(verifier_, field, alignof(T)));
+  }
+
+  // A sub-table field is present and, under HeaderOnly, verified in full
+  template <typename T>
+  bool readableTable(const T* table) {
+    return table && (policy_ != VerifyPolicy::HeaderOnly || table->Verify(verifier_));
+  }
+
+  // An element of a vector of tables is present and, under HeaderOnly, its table header lies
+  // within the buffer; its fields are then checked like the root's, as they are read. The
+  // verifier's nesting depth is closed again, so any number of items can be checked.
+  template <typename T>
+  bool readableItem(const T* table) {
+    return table && (policy_ != VerifyPolicy::HeaderOnly ||
+                     (asTable(table)->VerifyTableStart(verifier_) && verifier_.EndTable()));
+  }
+
+private:
+  // Generated tables derive privately from flatbuffers::Table; address them as one
+  template <typename T>
+  static const flatbuffers::Table* asTable(const T* table) {
+    return reinterpret_cast<const flatbuffers::Table*>(table);
+  }
+
+  // First member, so it spans the whole lifetime of the others
+  StatsPhaseScope deserializeScope_;
+  flatbuffers::Verifier verifier_;
+  VerifyPolicy policy_;
+  const Root* root_ = nullptr;
+};
+
+// ! FbCodec
+// Describes a root table whose payload is one vector of `Element` (a scalar or a FlatBuffers
+// struct). Specialize it for each such table, e.g. for `table Weights { values:[Vec2]; }`:
+//
+//   template <>
+//   struct FbTableTraits<MyNS::Weights> {
+//     using Element = MyNS::Vec2;
+//     static constexpr flatbuffers::voffset_t kValuesField = MyNS::Weights::VT_VALUES;
+//     static auto values(const MyNS::Weights& table) { return table.values(); }
+//     static auto create(flatbuffers::FlatBufferBuilder& builder, FbVectorOffset<Element> v) {
+//       return MyNS::CreateWeights(builder, v);
+//     }
+//   };
+template <typename Table>
+struct FbTableTraits;
+
+// Vector type FlatBuffers uses for a field of `Element`s
+template <typename Element>
+using FbVector = std::conditional_t<std::is_scalar_v<Element>,
+                                    flatbuffers::Vector<Element>,
+                                    flatbuffers::Vector<const Element*>>;
+template <typename Element>
+using FbVectorOffset = flatbuffers::Offset<FbVector<Element>>;
+
+// Deserialization targets that view the buffer instead of copying it
+template <typename T>
+struct IsFbView : std::false_type {};
+template <typename T>
+struct IsFbView<std::span<const T>> : std::true_type {};
+template <typename PlainObject, int MapOptions, typename StrideType>
+struct IsFbView<Eigen::Map<const PlainObject, MapOptions, StrideType>> : std::true_type {};
+
+// Serializers for a table described by FbTableTraits. Containers:
+// - contiguous ranges (std::vector, std::span, std::array) of a type with the element's exact
+//   layout, e.g. std::pair<int, int> or std::array<int, 2> for a Vec2i;
+// - Eigen matrices and maps whose rows are elements, e.g. Eigen::Matrix<int, Dynamic, 2> for
+//   a Vec2i, or Eigen::VectorXd for a double.
+// The payload moves as one bulk copy: a memcpy for ranges and row-major storage, a single
+// Eigen assignment for other storage orders. std::span<const T> and Eigen::Map<const M> (M
+// row-major or a vector) are zero-copy deserialization targets into the buffer, which must
+// then outlive them.
+template <typename Table>
+struct FbCodec {
+  using Traits = FbTableTraits<Table>;
+  using Element = typename Traits::Element;
+
+  static_assert(std::is_standard_layout_v<Element> && std::is_trivially_copyable_v<Element>,
+                "FbCodec elements are scalars or FlatBuffers structs");
+
+  template <typename Container>
+  static size_t sizeBound(const Container& values) {
+    const Eigen::Index count = elementCount(values);
+    return kTableOverhead + kVectorOverhead +
+           sizeof(Element) * static_cast<size_t>(count > 0 ? count : 0);
+  }
+
+  // Write the table into `builder` and finish the buffer
+  template <typename Container>
+  static bool build(flatbuffers::FlatBufferBuilder& builder, const Container& values) {
+    const Eigen::Index count = elementCount(values);
+    if (count < 0) {
+      return false;
+    }
+
+    Element* data = nullptr;
+    FbVectorOffset<Element> vector;
+    if constexpr (std::is_scalar_v<Element>) {
+      vector = builder.CreateUninitializedVector(static_cast<size_t>(count), &data);
+    } else {
+      vector = builder.CreateUninitializedVectorOfStructs(static_cast<size_t>(count), &data);
+    }
+    if (count > 0) {
+      copyOut(values, data, count);
+    }
+
+    builder.Finish(Traits::create(builder, vector));
+    return true;
+  }
+
+  template <typename Container>
+  static bool serialize(const Container& values, uint8_t*& resBuffer, int& resSize) {
+    return serializeToInterop(
+        sizeBound(values), [&](auto& builder) { return build(builder, values); }, resBuffer,
+        resSize);
+  }
+
+  template <typename Container>
+  static bool serialize(const Container& values, MutableByteSpan dst, int& resSize) {
+    return serializeToSpan([&](auto& builder) { return build(builder, values); }, dst, resSize);
+  }
+
+  template <typename Container>
+  static bool deserialize(const uint8_t* data,
+                          int size,
+                          Container& values,
+                          VerifyPolicy policy = defaultVerifyPolicy()) {
+    CheckedRoot<Table> root(data, size, policy);
+    if (!root) {
+      return false;
+    }
+
+    if (!root.readableSlots(root.get(), {Traits::kValuesField})) {
+      return false;
+    }
+    auto vector = Traits::values(*root.get());
+    if (!root.readable(vector)) {
+      return false;
+    }
+    const auto* first = reinterpret_cast<const Element*>(vector->Data());
+    return copyIn(first, static_cast<Eigen::Index>(vector->size()), values);
+  }
+
+private:
+  template <typename Container>
+  static constexpr bool kIsEigen = std::is_base_of_v<Eigen::EigenBase<Container>, Container>;
+
+  // Eigen containers hold one element per row, of the element's scalars
+  template <typename Scalar>
+  static constexpr int kComponents = static_cast<int>(sizeof(Element) / sizeof(Scalar));
+
+  template <typename Scalar>
+  using RowMatrix = Eigen::Matrix<Scalar,
+                                  Eigen::Dynamic,
+                                  kComponents<Scalar>,
+                                  kComponents<Scalar> == 1 ? Eigen::ColMajor : Eigen::RowMajor>;
+
+  template <typename Container>
+  static constexpr void checkLayout() {
+    if constexpr (kIsEigen<Container>) {
+      using Scalar = typename Container::Scalar;
+      static_assert(sizeof(Element) % sizeof(Scalar) == 0 &&
+                        (!std::is_scalar_v<Element> || std::is_same_v<Element, Scalar>),
+                    "Eigen rows must hold the element's scalars");
+      static_assert(Container::ColsAtCompileTime == Eigen::Dynamic ||
+                        Container::ColsAtCompileTime == kComponents<Scalar>,
+                    "Eigen rows must hold exactly one element");
+    } else {
+      using Value = std::ranges::range_value_t<Container>;
+      static_assert(std::ranges::contiguous_range<Container>, "Ranges must be contiguous");
+      static_assert(sizeof(Value) == sizeof(Element) && std::is_standard_layout_v<Value> &&
+                        std::is_trivially_copy_constructible_v<Value> &&
+                        (!std::is_scalar_v<Element> || std::is_same_v<Value, Element>),
+                    "Range values must have the element's layout");
+    }
+  }
+
+  // Number of elements, or -1 for an Eigen matrix whose column count does not match
+  template <typename Container>
+  static Eigen::Index elementCount(const Container& values) {
+    checkLayout<Container>();
+    if constexpr (kIsEigen<Container>) {
+      using Scalar = typename Container::Scalar;
+      if (values.size() == 0) {
+        return 0;
+      }
+      return values.cols() == kComponents<Scalar> ? values.rows() : -1;
+    } else {
+      return static_cast<Eigen::Index>(std::ranges::size(values));
+    }
+  }
+
+  template <typename Container>
+  static void copyOut(const Container& values, Element* data, Eigen::Index count) {
+    if constexpr (kIsEigen<Container>) {
+      using Scalar = typename Container::Scalar;
+      Eigen::Map<RowMatrix<Scalar>>(reinterpret_cast<Scalar*>(data), count,
+                                    kComponents<Scalar>) = values;
+    } else {
+      std::memcpy(static_cast<void*>(data), std::ranges::data(values),
+                  sizeof(Element) * static_cast<size_t>(count));
+    }
+  }
+
+  template <typename Container>
+  static bool copyIn(const Element* first, Eigen::Index count, Container& values) {
+    checkLayout<Container>();
+    if constexpr (kIsEigen<Container>) {
+      using Scalar = typename Container::Scalar;
+      using Target = RowMatrix<Scalar>;
+      Eigen::Map<const Target> source(reinterpret_cast<const Scalar*>(first), count,
+                                      kComponents<Scalar>);
+      if constexpr (IsFbView<Container>::value) {
+        // Zero-copy view; Eigen::Map cannot be reassigned, only re-seated
+        static_assert(Container::IsVectorAtCompileTime ||
+                          static_cast<bool>(Container::IsRowMajor),
+                      "Eigen views need the buffer's row-major layout");
+        new (&values) Container(source.data(), count, kComponents<Scalar>);
+      } else {
+        values = source;
+      }
+    } else if constexpr (IsFbView<Container>::value) {
+      // Zero-copy view
+      using Value = std::ranges::range_value_t<Container>;
+      values = Container(reinterpret_cast<const Value*>(first), static_cast<size_t>(count));
+    } else {
+      values.resize(static_cast<size_t>(count));
+      if (count > 0) {
+        std::memcpy(static_cast<void*>(std::ranges::data(values)), first,
+                    sizeof(Element) * static_cast<size_t>(count));
+      }
+    }
+    return true;
+  }
+};
+}  // namespace GeoSharPlusCPP::Serialization
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "GeoSharPlusCPP/Core/MathTypes.h"
+
+namespace GeoSharPlusCPP::Serialization {
+// Index stream codecs behind the compact mesh face encodings (CompressedFaces in mesh.fbs).
+// Streams are little-endian and hold the indices face after face.
+
+// Fixed width: 2 or 4 bytes per index.
+// 16 bits are only usable when every index is in [0, 65535].
+bool fitsIndex16(std::span<const int> indices);
+// `out` receives `bytesPerIndex * indices.size()` bytes
+void encodeFixedWidth(std::span<const int> indices, int bytesPerIndex, uint8_t* out);
+// `in` holds `bytesPerIndex * out.size()` bytes
+void decodeFixedWidth(const uint8_t* in, int bytesPerIndex, std::span<int> out);
+
+// Delta varint: each index is stored as zigzag(index - previous index) in LEB128, starting
+// from 0. Neighbouring faces reuse nearby vertices, so most deltas fit in a single byte.
+// Fails on negative indices.
+bool encodeDeltaVarint(std::span<const int> indices, std::vector<uint8_t>& out);
+// Decodes exactly `out.size()` indices. Fails on a truncated or overlong stream, trailing
+// bytes, or a decoded index outside [0, INT_MAX].
+bool decodeDeltaVarint(ByteSpan in, std::span<int> out);
+
+// Upper bound on the encoded size of `count` indices
+constexpr size_t maxDeltaVarintSize(size_t count) {
+  return 5 * count;
+}
+}  // namespace GeoSharPlusCPP::Serialization
@@ -0,0 +1,69 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace GeoSharPlusCPP::Serialization {
+// ! Interop memory accounting
+// Optional bookkeeping of the result buffers handed to callers, by AllocateInteropMemory or
+// releaseInteropBuffer (InteropMemory.h): live buffers and bytes, with their high-water mark,
+// in total and per export. The blocks a builder outgrows while building are never counted.
+// A buffer is charged to the export running on the thread handing it out (see GSP_STATS_CALL
+// in Stats.h), or left unattributed without one, e.g. in builds without GSP_ENABLE_STATS.
+//
+// A buffer stays live until FreeInteropMemory (gsp_free_buffer from C#) frees it. Buffers
+// freed by Marshal.FreeCoTaskMem bypass the accounting, so while tracking is on the C# side
+// frees through gsp_free_buffer (MarshalHelper does so once tracking is enabled).
+enum class MemoryTracking : int32_t {
+  Off = 0,  // Default; an allocation then costs one relaxed atomic read
+  // Counters only. Every allocation and free takes a lock and updates a hash map.
+  Counters = 1,
+  // Counters, plus the list of live buffers in snapshots, to find the ones never freed
+  Debug = 2,
+};
+
+// Switching modes keeps the records; switching to Off drops them, so buffers allocated
+// before tracking was (re-)enabled are never counted
+void setMemoryTracking(MemoryTracking mode);
+MemoryTracking memoryTracking();
+
+// True for the values above; used to validate modes coming through the C ABI
+bool isValidMemoryTracking(int32_t mode);
+
+// Called as a buffer is handed out and by FreeInteropMemory; no-ops while tracking is off or,
+// for frees, for unknown pointers
+void trackAllocation(const void* ptr, size_t size);
+void trackFree(const void* ptr);
+
+struct ExportMemoryStats {
+  std::string_view name;  // "(unattributed)" for buffers allocated outside exports
+  uint64_t allocations = 0;
+  uint64_t allocatedBytes = 0;
+  uint64_t liveBuffers = 0;
+  uint64_t liveBytes = 0;
+  uint64_t peakBytes = 0;  // High-water mark of liveBytes
+};
+
+struct LiveBuffer {
+  std::string_view exportName;
+  uintptr_t address = 0;
+  uint64_t size = 0;
+  uint64_t sequence = 0;  // Allocation order since tracking was enabled, from 1
+};
+
+struct MemoryStats {
+  MemoryTracking mode = MemoryTracking::Off;
+  uint64_t liveBuffers = 0;
+  uint64_t liveBytes = 0;
+  uint64_t peakBytes = 0;
+  std::vector<ExportMemoryStats> exports;  // In order of first allocation
+  std::vector<LiveBuffer> live;            // Debug mode only, oldest first
+};
+
+MemoryStats collectMemoryStats();
+
+// collectMemoryStats() as a MemoryStats buffer (memory.fbs) in interop memory, freed by the
+// caller. The buffer itself is allocated after the snapshot, so it is not in it.
+bool serializeMemoryStats(uint8_t*& resBuffer, int& resSize);
+}  // namespace GeoSharPlusCPP::Serialization
@@ -0,0 +1,58 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include "GeoSharPlusCPP/Core/MathTypes.h"
+#include "flatbuffers/flatbuffers.h"
+
+namespace GeoSharPlusCPP::Serialization {
+// Cross-platform memory allocation for C# interop
+// On Windows: Use CoTaskMemAlloc (COM-compatible)
+// On Unix/macOS: Use standard malloc - .NET Core will handle it correctly with
+// Marshal.FreeCoTaskMem Note: On .NET Core/5+, Marshal.FreeCoTaskMem on Unix calls free()
+// internally, which properly pairs with malloc()
+void* AllocateInteropMemory(size_t size);
+
+// Cross-platform memory deallocation for C# interop
+// This should only be used in error paths before the buffer is returned to C#
+// Once returned to C#, the memory MUST be freed by Marshal.FreeCoTaskMem, or by gsp_free_buffer
+// (which calls this) so the buffer leaves the accounting of InteropAccounting.h
+void FreeInteropMemory(void* ptr);
+
+// FlatBuffers allocator backed by interop memory, so a builder's storage can be handed to
+// C# as-is. Throws std::bad_alloc on failure, like the default FlatBuffers allocator. Its
+// blocks are left out of the accounting of InteropAccounting.h until releaseInteropBuffer
+// hands the finished one to the caller.
+class InteropAllocator : public flatbuffers::Allocator {
+public:
+  uint8_t* allocate(size_t size) override;
+  void deallocate(uint8_t* p, size_t size) override;
+
+  // Stateless, so a single shared instance serves every builder
+  static InteropAllocator& instance();
+};
+
+// Create a builder whose storage lives in interop memory.
+// A good `initialSize` estimate avoids the grow-and-copy steps while building.
+flatbuffers::FlatBufferBuilder makeInteropBuilder(size_t initialSize = 1024);
+
+// Detach the finished buffer of an interop builder and hand it to the caller.
+// FlatBuffers builds back-to-front, so the payload sits at the tail of the block; it is slid
+// to the front in place, so no second allocation is made and peak memory stays at one buffer.
+// On failure the block is freed and the outputs are reset.
+bool releaseInteropBuffer(flatbuffers::FlatBufferBuilder& builder,
+                          uint8_t*& resBuffer,
+                          int& resSize);
+
+// Builder for serializers that write into caller-provided memory. It is thread-local and
+// cleared on every call, so repeated calls reuse its storage instead of allocating; storage
+// grown past a few MB by a large payload is released on the next call.
+flatbuffers::FlatBufferBuilder& scratchBuilder();
+
+// Copy a finished buffer into caller memory. `resSize` is always set to the size of the
+// finished buffer; if `dst` is smaller than that nothing is written and false is returned,
+// so the caller can grow its buffer and retry.
+bool copyToCallerBuffer(const flatbuffers::FlatBufferBuilder& builder,
+                        MutableByteSpan dst,
+                        int& resSize);
+}  // namespace GeoSharPlusCPP::Serialization
@@ -1,49 +1,269 @@
 #pragma once
+#include <cstddef>
 #include <cstdint>
+#include <span>
+#include <string_view>
+#include <utility>
 #include <vector>
 
+#include "GeoSharPlusCPP/Core/BoundingBox.h"
 #include "GeoSharPlusCPP/Core/Geometry.h"
+#include "GeoSharPlusCPP/Core/MassProperties.h"
+#include "GeoSharPlusCPP/Core/MathTypes.h"
+#include "GeoSharPlusCPP/Core/MeshBvh.h"
+#include "GeoSharPlusCPP/Core/MeshTopology.h"
+#include "GeoSharPlusCPP/Serialization/VerifyPolicy.h"
 
 namespace GeoSharPlusCPP::Serialization {
+// Every serializer comes in two forms:
+// - `uint8_t*& resBuffer` allocates the result in interop memory, to be freed by the caller.
+// - `MutableByteSpan dst` writes into caller-owned memory (e.g. a pooled, pinned C# buffer)
+//   without allocating. `resSize` is set to the required size; if `dst` is too small nothing
+//   is written and false is returned, so the caller can grow its buffer and retry.
+//   On any other failure `resSize` is 0.
+//
+// Every deserializer checks its input according to a VerifyPolicy; without an explicit one the
+// process-wide default applies (full verification unless changed).
+
+// ! Position encodings
+// Point arrays and mesh vertices are sent as double Vec3 by default. For consumers that do not
+// need full precision, Float halves the payload and Quantized (16 bits per axis relative to
+// the bounding box) quarters it. Deserializers accept every encoding.
+enum class PositionEncoding : int32_t { Double = 0, Float = 1, Quantized = 2 };
+
+struct PositionEncodingOptions {
+  PositionEncoding encoding = PositionEncoding::Double;
+  int quantizationBits = 16;  // 1-16, Quantized only
+};
+
+// ! Face encodings
+// Mesh faces are sent as int Vec3i/Vec4i rows by default. Compact stores 16-bit indices when
+// they all fit (32-bit otherwise); DeltaVarint stores each index as the zigzag varint of its
+// difference to the previous one, which is mostly one byte since neighbouring faces share
+// vertices. Deserializers accept every encoding.
+enum class FaceEncoding : int32_t { Plain = 0, Compact = 1, DeltaVarint = 2 };
+
+struct MeshEncodingOptions {
+  PositionEncodingOptions vertices;
+  FaceEncoding faces = FaceEncoding::Plain;
+};
+
 // ! Basic Type
 // Unified number array serialization (handles both double and int)
+// Containers: std::vector<T> and Eigen::VectorX{d,i}. Serialization also takes
+// std::span<const T> and Eigen::Map<const Eigen::VectorX{d,i}>, read in place without a copy.
 template <typename NumberContainer>
 bool serializeNumberArray(const NumberContainer& numbers, uint8_t*& resBuffer, int& resSize);
+template <typename NumberContainer>
+bool serializeNumberArray(const NumberContainer& numbers, MutableByteSpan dst, int& resSize);
 
 template <typename NumberContainer>
-bool deserializeNumberArray(const uint8_t* data, int size, NumberContainer& numberArray);
+bool deserializeNumberArray(const uint8_t* data,
+                            int size,
+                            NumberContainer& numberArray,
+                            VerifyPolicy policy = defaultVerifyPolicy());
 
 // Index array (pairs of integers) serialization/deserialization
 template <typename IndexContainer>
 bool serializeNumberPairArray(const IndexContainer& indices, uint8_t*& resBuffer, int& resSize);
+template <typename IndexContainer>
+bool serializeNumberPairArray(const IndexContainer& indices, MutableByteSpan dst, int& resSize);
 
 template <typename IndexContainer>
-bool deserializeNumberPairArray(const uint8_t* data, int size, IndexContainer& indexArray);
+bool deserializeNumberPairArray(const uint8_t* data,
+                                int size,
+                                IndexContainer& indexArray,
+                                VerifyPolicy policy = defaultVerifyPolicy());
 
 // Nested integer array serialization/deserialization
 bool serializeNestedIntArray(const std::vector<std::vector<int>>& nestedArray,
                              uint8_t*& resBuffer,
                              int& resSize);
+bool serializeNestedIntArray(const std::vector<std::vector<int>>& nestedArray,
+                             MutableByteSpan dst,
+                             int& resSize);
+
+bool deserializeNestedIntArray(const uint8_t* data,
+                               int size,
+                               std::vector<std::vector<int>>& nestedArray,
+                               VerifyPolicy policy = defaultVerifyPolicy());
 
+// CSR nested arrays map onto the wire format (all values, then sub-array sizes) directly:
+// serialization writes the sizes from the offsets, deserialization rebuilds the offsets in
+// one prefix-sum pass and bulk-copies the values. Use these for large nested arrays.
+// Deserialization fails if the sizes do not add up to the value count.
+bool serializeNestedIntArray(const CsrIntArray& nestedArray, uint8_t*& resBuffer, int& resSize);
+bool serializeNestedIntArray(const CsrIntArray& nestedArray, MutableByteSpan dst, int& resSize);
 bool deserializeNestedIntArray(const uint8_t* data,
                                int size,
-                               std::vector<std::vector<int>>& nestedArray);
+                               CsrIntArray& nestedArray,
+                               VerifyPolicy policy = defaultVerifyPolicy());
 
 // ! Geometry
 // Point serialization
 bool serializePoint(const Vector3d& point, uint8_t*& resBuffer, int& resSize);
-bool deserializePoint(const uint8_t* buffer, int size, Vector3d& point);
+bool serializePoint(const Vector3d& point, MutableByteSpan dst, int& resSize);
+bool deserializePoint(const uint8_t* buffer,
+                      int size,
+                      Vector3d& point,
+                      VerifyPolicy policy = defaultVerifyPolicy());
 
 // Point array (de)serialization
+// Containers: std::vector<Vector3d>, Eigen::MatrixXd, MatrixX3d and MatrixX3f; serialization
+// also takes std::span<const Vector3d> and Eigen::Map<const MatrixX3d>. Packed double storage
+// (vector, span, MatrixX3d, Map) is bulk-copied, since it matches the [Vec3] layout exactly.
 template <typename PointContainer>
-bool serializePointArray(const PointContainer& points, uint8_t*& resBuffer, int& resSize);
+bool serializePointArray(const PointContainer& points,
+                         uint8_t*& resBuffer,
+                         int& resSize,
+                         const PositionEncodingOptions& options = {});
+template <typename PointContainer>
+bool serializePointArray(const PointContainer& points,
+                         MutableByteSpan dst,
+                         int& resSize,
+                         const PositionEncodingOptions& options = {});
 
 // Point array deserialization template declaration
+// Besides the owning containers, std::span<const Vector3d> and Eigen::Map<const MatrixX3d>
+// outputs are zero-copy views into `data`, which must outlive them. Views need double
+// positions, so they fail on Float or Quantized buffers.
 template <typename PointContainer>
-bool deserializePointArray(const uint8_t* data, int size, PointContainer& pointArray);
+bool deserializePointArray(const uint8_t* data,
+                           int size,
+                           PointContainer& pointArray,
+                           VerifyPolicy policy = defaultVerifyPolicy());
 
 // Mesh serialization
-bool serializeMesh(const Mesh& mesh, uint8_t*& resBuffer, int& resSize);
-bool deserializeMesh(const uint8_t* data, int size, Mesh& mesh);
+// Polygon meshes (Mesh::faceOffsets / faceIndices) are sent as CSR faces, so mixed tri/quad
+// and n-gon meshes need no triangulation; face encodings only apply to tri/quad meshes.
+// Attribute channels (Mesh::attributes) are sent with the mesh; serialization fails if one
+// does not hold 1-4 components per vertex or face.
+bool serializeMesh(const Mesh& mesh,
+                   uint8_t*& resBuffer,
+                   int& resSize,
+                   const MeshEncodingOptions& options = {});
+bool serializeMesh(const Mesh& mesh,
+                   MutableByteSpan dst,
+                   int& resSize,
+                   const MeshEncodingOptions& options = {});
+bool deserializeMesh(const uint8_t* data,
+                     int size,
+                     Mesh& mesh,
+                     VerifyPolicy policy = defaultVerifyPolicy());
+
+// Mesh::C travels as a per-vertex Float64 scalar attribute of this name, and is restored into
+// C on deserialization
+inline constexpr std::string_view kScalarAttributeName = "C";
+
+// Single-precision mesh deserialization, for consumers (e.g. display) that work in float.
+// Float buffers are copied as-is and Quantized buffers are decoded straight to float.
+// Fails on polygon (CSR) meshes, which have no dense F. Attributes are ignored.
+bool deserializeMesh(const uint8_t* data,
+                     int size,
+                     MatrixX3f& V,
+                     Eigen::MatrixXi& F,
+                     VerifyPolicy policy = defaultVerifyPolicy());
+
+// Zero-copy mesh deserialization: the view maps the vertex/face vectors of the verified
+// buffer directly, so `data` must stay alive (and unmodified) while the view is in use.
+// Only double vertices and Plain or CSR faces can be mapped; other encodings fail here.
+// Attribute channels are mapped as well (MeshView::attributes).
+bool deserializeMeshView(const uint8_t* data,
+                         int size,
+                         MeshView& view,
+                         VerifyPolicy policy = defaultVerifyPolicy());
+
+// ! Batches
+// Many meshes or point arrays in one buffer (see meshBatch.fbs / pointArrayBatch.fbs), so a
+// whole batch crosses the interop boundary in one call, one verification pass and one
+// allocation. Items are ordinary MeshData / PointArrayData tables and take the same encodings;
+// deserializers resize the output vector and reuse the storage of existing elements.
+bool serializeMeshBatch(std::span<const Mesh> meshes,
+                        uint8_t*& resBuffer,
+                        int& resSize,
+                        const MeshEncodingOptions& options = {});
+bool serializeMeshBatch(std::span<const Mesh> meshes,
+                        MutableByteSpan dst,
+                        int& resSize,
+                        const MeshEncodingOptions& options = {});
+bool deserializeMeshBatch(const uint8_t* data,
+                          int size,
+                          std::vector<Mesh>& meshes,
+                          VerifyPolicy policy = defaultVerifyPolicy());
+// Zero-copy batch deserialization: one MeshView per item, with the limits of
+// deserializeMeshView. `data` must outlive the views.
+bool deserializeMeshBatchView(const uint8_t* data,
+                              int size,
+                              std::vector<MeshView>& views,
+                              VerifyPolicy policy = defaultVerifyPolicy());
+
+bool serializePointArrayBatch(std::span<const MatrixX3d> pointArrays,
+                              uint8_t*& resBuffer,
+                              int& resSize,
+                              const PositionEncodingOptions& options = {});
+bool serializePointArrayBatch(std::span<const MatrixX3d> pointArrays,
+                              MutableByteSpan dst,
+                              int& resSize,
+                              const PositionEncodingOptions& options = {});
+bool deserializePointArrayBatch(const uint8_t* data,
+                                int size,
+                                std::vector<MatrixX3d>& pointArrays,
+                                VerifyPolicy policy = defaultVerifyPolicy());
+
+// ! Mass properties
+// One MassPropertiesData item per result, in order (see massProperties.fbs). Results are read
+// on the C# side only, so there is no deserializer.
+bool serializeMassPropertiesBatch(std::span<const MassProperties> items,
+                                  uint8_t*& resBuffer,
+                                  int& resSize);
+
+// ! Bounding boxes
+// One BoundingBoxData item per box, in order (see boundingBox.fbs); C# reads them, so there is
+// no deserializer either.
+bool serializeBoundingBoxBatch(std::span<const OrientedBox> boxes,
+                               uint8_t*& resBuffer,
+                               int& resSize);
+
+// ! Topology reports
+// See topology.fbs; read on the C# side only
+bool serializeTopologyReport(const TopologyReport& report, uint8_t*& resBuffer, int& resSize);
+
+// ! Mesh queries
+// Per-point results of MeshBvh queries (see meshQuery.fbs), read on the C# side only. Faces
+// within a radius are sent in CSR form, one (face, distance) list per query point.
+bool serializeMeshHits(std::span<const MeshBvh::Hit> hits, uint8_t*& resBuffer, int& resSize);
+bool serializeFacesWithin(std::span<const std::vector<std::pair<int, double>>> faces,
+                          uint8_t*& resBuffer,
+                          int& resSize);
+
+// ! Size bounds
+// Upper bounds on the serialized size, for sizing caller-provided output buffers up front
+size_t pointSizeBound();
+size_t pointArraySizeBound(size_t pointCount,
+                           PositionEncoding encoding = PositionEncoding::Double);
+size_t meshSizeBound(size_t vertexCount,
+                     size_t faceCount,
+                     int faceVertexCount,
+                     const MeshEncodingOptions& options = {});
+// Polygon (CSR) meshes: `indexCount` is the number of face indices over all faces
+size_t polygonMeshSizeBound(size_t vertexCount,
+                            size_t faceCount,
+                            size_t indexCount,
+                            PositionEncoding encoding = PositionEncoding::Double);
+// Whole meshes, attribute channels included
+size_t meshSizeBound(const Mesh& mesh, const MeshEncodingOptions& options = {});
+size_t meshSizeBound(const MeshView& view, const MeshEncodingOptions& options = {});
+size_t nestedIntArraySizeBound(size_t arrayCount, size_t valueCount);
+size_t meshBatchSizeBound(std::span<const Mesh> meshes, const MeshEncodingOptions& options = {});
+size_t meshBatchSizeBound(std::span<const MeshView> views,
+                          const MeshEncodingOptions& options = {});
+size_t pointArrayBatchSizeBound(std::span<const MatrixX3d> pointArrays,
+                                PositionEncoding encoding = PositionEncoding::Double);
+size_t massPropertiesBatchSizeBound(size_t count);
+size_t boundingBoxBatchSizeBound(size_t count);
+size_t topologyReportSizeBound(const TopologyReport& report);
+size_t meshHitsSizeBound(size_t count);
+// `faceCount` is the number of (face, distance) pairs over all query points
+size_t facesWithinSizeBound(size_t pointCount, size_t faceCount);
 
 }  // namespace GeoSharPlusCPP::Serialization
@@ -0,0 +1,22 @@
+#pragma once
+#include <cstdint>
+
+namespace GeoSharPlusCPP::Serialization {
+// How much of an incoming FlatBuffer is checked before the deserializers read it
+enum class VerifyPolicy : int32_t {
+  // Full flatbuffers::Verifier pass (default)
+  Full = 0,
+  // Root offset and table header, plus bounds of each vector as it is read.
+  // Skips the verifier's per-field and nested-table checks.
+  HeaderOnly = 1,
+  // No checks. Only for buffers produced by our own serializers in the same process.
+  Trusted = 2,
+};
+
+// Process-wide policy used when a deserializer is called without an explicit one
+void setDefaultVerifyPolicy(VerifyPolicy policy);
+VerifyPolicy defaultVerifyPolicy();
+
+// True for the values above; used to validate policies coming through the C ABI
+bool isValidVerifyPolicy(int32_t policy);
+}  // namespace GeoSharPlusCPP::Serialization
@@ -0,0 +1,423 @@
+#include "GeoSharPlusCPP/Core/BoundingBox.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <Eigen/Eigenvalues>
+
+#include "GeoSharPlusCPP/Core/Parallel.h"
+
+namespace GeoSharPlusCPP {
+namespace {
+constexpr double kInfinity = std::numeric_limits<double>::infinity();
+
+// Rows per parallel chunk of the O(n) passes; they are memory bound, so chunks are large
+constexpr size_t kPointGrain = size_t{1} << 15;
+
+// Four packed rows: lane k of a running min/max always holds axis k % 3
+constexpr size_t kLanes = 12;
+
+struct Extents {
+  Vector3d min = Vector3d::Constant(kInfinity);
+  Vector3d max = Vector3d::Constant(-kInfinity);
+};
+
+Extents mergeExtents(Extents a, const Extents& b) {
+  a.min = a.min.cwiseMin(b.min);
+  a.max = a.max.cwiseMax(b.max);
+  return a;
+}
+
+// Bounds of rows [first, last) of packed x, y, z doubles. The ternaries keep the running
+// value when a coordinate is NaN, and compile to packed min/max over the 12 lanes.
+Extents packedExtents(const double* xyz, size_t first, size_t last) {
+  std::array<double, kLanes> lo, hi;
+  lo.fill(kInfinity);
+  hi.fill(-kInfinity);
+
+  size_t row = first;
+  for (; row + 4 <= last; row += 4) {
+    const double* p = xyz + 3 * row;
+    for (size_t k = 0; k < kLanes; ++k) {
+      lo[k] = p[k] < lo[k] ? p[k] : lo[k];
+      hi[k] = p[k] > hi[k] ? p[k] : hi[k];
+    }
+  }
+  for (; row < last; ++row) {
+    const double* p = xyz + 3 * row;
+    for (size_t k = 0; k < 3; ++k) {
+      lo[k] = p[k] < lo[k] ? p[k] : lo[k];
+      hi[k] = p[k] > hi[k] ? p[k] : hi[k];
+    }
+  }
+
+  Extents extents;
+  for (size_t k = 0; k < kLanes; ++k) {
+    extents.min[k % 3] = std::min(extents.min[k % 3], lo[k]);
+    extents.max[k % 3] = std::max(extents.max[k % 3], hi[k]);
+  }
+  return extents;
+}
+
+// Coordinates of the points in the frame (origin, axes): min and max along each axis
+Extents frameExtents(const Eigen::Ref<const MatrixX3d>& points,
+                     const Vector3d& origin,
+                     const Eigen::Matrix3d& axes) {
+  return parallelReduce(
+      size_t{0}, static_cast<size_t>(points.rows()), Extents{},
+      [&](size_t first, size_t last) {
+        Extents extents;
+        for (auto i = static_cast<Eigen::Index>(first); i < static_cast<Eigen::Index>(last); ++i) {
+          const Vector3d q = axes.transpose() * (points.row(i).transpose() - origin);
+          extents.min = extents.min.cwiseMin(q);
+          extents.max = extents.max.cwiseMax(q);
+        }
+        return extents;
+      },
+      mergeExtents, Reduction::Fast, kPointGrain);
+}
+
+OrientedBox frameBox(const Vector3d& origin, const Eigen::Matrix3d& axes, const Extents& e) {
+  OrientedBox box;
+  box.axes = axes;
+  box.center = origin + axes * (0.5 * (e.min + e.max));
+  box.halfExtents = 0.5 * (e.max - e.min);
+  return box;
+}
+
+double surfaceArea(const OrientedBox& box) {
+  const Vector3d& h = box.halfExtents;
+  return 8.0 * (h.x() * h.y() + h.y() * h.z() + h.z() * h.x());
+}
+
+// True if `a` is tighter than `b`: less volume or, for about the same volume (e.g. flat point
+// sets, whose boxes only differ by rounding), less surface area
+bool tighter(const OrientedBox& a, const OrientedBox& b, double volumeTolerance) {
+  const double va = a.volume();
+  const double vb = b.volume();
+  if (std::abs(va - vb) > volumeTolerance) {
+    return va < vb;
+  }
+  return surfaceArea(a) < surfaceArea(b);
+}
+
+// Principal axes of the points, as columns from the largest variance down, right-handed
+Eigen::Matrix3d principalAxes(const Eigen::Ref<const MatrixX3d>& points, const Vector3d& origin) {
+  struct Moments {
+    Vector3d sum = Vector3d::Zero();
+    Eigen::Matrix3d outer = Eigen::Matrix3d::Zero();
+  };
+  const Moments moments = parallelReduce(
+      size_t{0}, static_cast<size_t>(points.rows()), Moments{},
+      [&](size_t first, size_t last) {
+        Moments partial;
+        for (auto i = static_cast<Eigen::Index>(first); i < static_cast<Eigen::Index>(last); ++i) {
+          const Vector3d p = points.row(i).transpose() - origin;
+          partial.sum += p;
+          partial.outer.selfadjointView<Eigen::Lower>().rankUpdate(p);
+        }
+        return partial;
+      },
+      [](Moments a, const Moments& b) {
+        a.sum += b.sum;
+        a.outer += b.outer;
+        return a;
+      },
+      Reduction::Deterministic, kPointGrain);
+
+  const double n = static_cast<double>(points.rows());
+  const Vector3d mean = moments.sum / n;
+  Eigen::Matrix3d covariance = moments.outer / n;
+  covariance.triangularView<Eigen::Lower>() -= mean * mean.transpose();
+
+  // Eigenvalues come in increasing order
+  Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(covariance, Eigen::ComputeEigenvectors);
+  if (solver.info() != Eigen::Success) {
+    return Eigen::Matrix3d::Identity();
+  }
+  Eigen::Matrix3d axes;
+  axes.col(0) = solver.eigenvectors().col(2);
+  axes.col(1) = solver.eigenvectors().col(1);
+  axes.col(2) = axes.col(0).cross(axes.col(1));
+  return axes;
+}
+
+double cross(const Eigen::Vector2d& o, const Eigen::Vector2d& a, const Eigen::Vector2d& b) {
+  return (a.x() - o.x()) * (b.y() - o.y()) - (a.y() - o.y()) * (b.x() - o.x());
+}
+
+// Drops the points strictly inside the quadrilateral of the leftmost, lowest, rightmost and
+// highest point (Akl-Toussaint); they cannot be on the hull, and this usually leaves a small
+// fraction of the points to sort
+void discardInterior(std::vector<Eigen::Vector2d>& points) {
+  std::array<Eigen::Vector2d, 4> quad{points[0], points[0], points[0], points[0]};
+  for (const auto& p : points) {
+    if (p.x() < quad[0].x()) {
+      quad[0] = p;
+    }
+    if (p.y() < quad[1].y()) {
+      quad[1] = p;
+    }
+    if (p.x() > quad[2].x()) {
+      quad[2] = p;
+    }
+    if (p.y() > quad[3].y()) {
+      quad[3] = p;
+    }
+  }
+  std::erase_if(points, [&](const Eigen::Vector2d& p) {
+    return cross(quad[0], quad[1], p) > 0 && cross(quad[1], quad[2], p) > 0 &&
+           cross(quad[2], quad[3], p) > 0 && cross(quad[3], quad[0], p) > 0;
+  });
+}
+
+// Convex hull in counter-clockwise order without collinear points (Andrew's monotone chain).
+// Fewer than three points for point sets without area.
+std::vector<Eigen::Vector2d> convexHull(std::vector<Eigen::Vector2d> points) {
+  auto less = [](const Eigen::Vector2d& a, const Eigen::Vector2d& b) {
+    return a.x() < b.x() || (a.x() == b.x() && a.y() < b.y());
+  };
+  std::sort(points.begin(), points.end(), less);
+  points.erase(std::unique(points.begin(), points.end()), points.end());
+  if (points.size() < 3) {
+    return points;
+  }
+
+  std::vector<Eigen::Vector2d> hull(2 * points.size());
+  size_t k = 0;
+  for (const auto& p : points) {  // Lower hull
+    while (k >= 2 && cross(hull[k - 2], hull[k - 1], p) <= 0) {
+      --k;
+    }
+    hull[k++] = p;
+  }
+  for (size_t i = points.size() - 1, lower = k + 1; i > 0; --i) {  // Upper hull
+    while (k >= lower && cross(hull[k - 2], hull[k - 1], points[i - 1]) <= 0) {
+      --k;
+    }
+    hull[k++] = points[i - 1];
+  }
+  hull.resize(k - 1);  // The last point is the first one again
+  return hull;
+}
+
+// Rectangle around 2D points: `direction` is its first (unit) axis, the second is its left
+// normal, and [min, max] the coordinates along them
+struct Rectangle {
+  Eigen::Vector2d direction{1.0, 0.0};
+  Eigen::Vector2d min = Eigen::Vector2d::Zero();
+  Eigen::Vector2d max = Eigen::Vector2d::Zero();
+
+  [[nodiscard]] double area() const {
+    return (max - min).prod();
+  }
+};
+
+Eigen::Vector2d leftNormal(const Eigen::Vector2d& d) {
+  return {-d.y(), d.x()};
+}
+
+// Rectangle of least area around a convex hull: one of its sides lies on a hull edge. The
+// caliper on the far side and those at both ends only move forward as the edges turn, so
+// all edges are visited in O(h).
+Rectangle minimumAreaRectangle(const std::vector<Eigen::Vector2d>& hull) {
+  Rectangle best;
+  const size_t h = hull.size();
+  if (h == 0) {
+    return best;
+  }
+  if (h < 3) {
+    if (h == 2) {
+      best.direction = (hull[1] - hull[0]).normalized();
+    }
+    const Eigen::Vector2d n = leftNormal(best.direction);
+    best.min = best.max = {best.direction.dot(hull[0]), n.dot(hull[0])};
+    const Eigen::Vector2d last{best.direction.dot(hull[h - 1]), n.dot(hull[h - 1])};
+    best.min = best.min.cwiseMin(last);
+    best.max = best.max.cwiseMax(last);
+    return best;
+  }
+
+  auto next = [h](size_t i) { return i + 1 == h ? 0 : i + 1; };
+  auto argExtreme = [&](const Eigen::Vector2d& axis, bool maximum) {
+    size_t index = 0;
+    for (size_t i = 1; i < h; ++i) {
+      const double d = axis.dot(hull[i]) - axis.dot(hull[index]);
+      if (maximum ? d > 0 : d < 0) {
+        index = i;
+      }
+    }
+    return index;
+  };
+
+  const Eigen::Vector2d d0 = (hull[1] - hull[0]).normalized();
+  size_t right = argExtreme(d0, true);
+  size_t far = argExtreme(leftNormal(d0), true);
+  size_t left = argExtreme(d0, false);
+  double bestArea = kInfinity;
+
+  for (size_t i = 0; i < h; ++i) {
+    const Eigen::Vector2d d = (hull[next(i)] - hull[i]).normalized();
+    const Eigen::Vector2d n = leftNormal(d);
+    // Each caliper stops where the next vertex no longer moves outwards
+    while (d.dot(hull[next(right)]) > d.dot(hull[right])) {
+      right = next(right);
+    }
+    while (n.dot(hull[next(far)]) > n.dot(hull[far])) {
+      far = next(far);
+    }
+    while (d.dot(hull[next(left)]) < d.dot(hull[left])) {
+      left = next(left);
+    }
+
+    // The hull is counter-clockwise, so it lies left of every edge
+    Rectangle rectangle;
+    rectangle.direction = d;
+    rectangle.min = {d.dot(hull[left]), n.dot(hull[i])};
+    rectangle.max = {d.dot(hull[right]), n.dot(hull[far])};
+    if (rectangle.area() < bestArea) {
+      bestArea = rectangle.area();
+      best = rectangle;
+    }
+  }
+  return best;
+}
+
+// Box with axis `height` of the principal frame as its height and the least-area rectangle
+// across it
+OrientedBox minimumAreaBox(const Eigen::Ref<const MatrixX3d>& points,
+                           const Vector3d& origin,
+                           const Eigen::Matrix3d& axes,
+                           const Extents& principal,
+                           Eigen::Index height) {
+  // (u, v, w) is a cyclic permutation of the right-handed principal frame
+  const Vector3d u = axes.col((height + 1) % 3);
+  const Vector3d v = axes.col((height + 2) % 3);
+  const Vector3d w = axes.col(height);
+
+  std::vector<Eigen::Vector2d> projected(static_cast<size_t>(points.rows()));
+  parallelFor(
+      0, projected.size(),
+      [&](size_t i) {
+        const Vector3d p = points.row(static_cast<Eigen::Index>(i)).transpose() - origin;
+        projected[i] = {u.dot(p), v.dot(p)};
+      },
+      kPointGrain);
+  discardInterior(projected);
+  const Rectangle rectangle = minimumAreaRectangle(convexHull(std::move(projected)));
+
+  // (a, b, w) is right-handed as well: a x b = (d.x^2 + d.y^2) u x v = w
+  const Eigen::Vector2d& d = rectangle.direction;
+  const Eigen::Vector2d n = leftNormal(d);
+  OrientedBox box;
+  box.axes.col(0) = d.x() * u + d.y() * v;
+  box.axes.col(1) = n.x() * u + n.y() * v;
+  box.axes.col(2) = w;
+
+  const Eigen::Vector2d middle = 0.5 * (rectangle.min + rectangle.max);
+  const double heightMiddle = 0.5 * (principal.min[height] + principal.max[height]);
+  box.center = origin + box.axes.col(0) * middle.x() + box.axes.col(1) * middle.y() +
+               w * heightMiddle;
+  box.halfExtents << 0.5 * (rectangle.max - rectangle.min),
+      0.5 * (principal.max[height] - principal.min[height]);
+  return box;
+}
+
+OrientedBox fitBox(const Eigen::Ref<const MatrixX3d>& points,
+                   const std::pair<Vector3d, Vector3d>& bounds,
+                   BoxFit fit) {
+  OrientedBox best = OrientedBox::aligned(bounds.first, bounds.second);
+  if (fit == BoxFit::Aligned || points.rows() < 2) {
+    return best;
+  }
+
+  // Boxes of the same points differ by rounding only well below this
+  const double size = (bounds.second - bounds.first).norm();
+  const double volumeTolerance = 1e-12 * size * size * size;
+
+  const Vector3d origin = best.center;
+  const Eigen::Matrix3d axes = principalAxes(points, origin);
+  const Extents principal = frameExtents(points, origin, axes);
+  if (OrientedBox box = frameBox(origin, axes, principal);
+      tighter(box, best, volumeTolerance)) {
+    best = box;
+  }
+  if (fit == BoxFit::Principal) {
+    return best;
+  }
+
+  std::array<OrientedBox, 3> candidates;
+  parallelForChunks(0, candidates.size(), 1, [&](size_t first, size_t last) {
+    for (size_t k = first; k < last; ++k) {
+      candidates[k] =
+          minimumAreaBox(points, origin, axes, principal, static_cast<Eigen::Index>(k));
+    }
+  });
+  for (const auto& box : candidates) {
+    if (tighter(box, best, volumeTolerance)) {
+      best = box;
+    }
+  }
+  return best;
+}
+}  // namespace
+
+std::pair<Vector3d, Vector3d> alignedBounds(const Eigen::Ref<const MatrixX3d>& points) {
+  if (points.rows() == 0) {
+    return {Vector3d::Zero(), Vector3d::Zero()};
+  }
+
+  Extents extents;
+  if (points.outerStride() == 3) {
+    extents = parallelReduce(
+        size_t{0}, static_cast<size_t>(points.rows()), Extents{},
+        [&](size_t first, size_t last) { return packedExtents(points.data(), first, last); },
+        mergeExtents, Reduction::Fast, kPointGrain);
+  } else {
+    extents.min = points.colwise().minCoeff().transpose();
+    extents.max = points.colwise().maxCoeff().transpose();
+  }
+
+  // Axes without a single number
+  for (Eigen::Index k = 0; k < 3; ++k) {
+    if (extents.min[k] > extents.max[k]) {
+      extents.min[k] = extents.max[k] = 0.0;
+    }
+  }
+  return {extents.min, extents.max};
+}
+
+OrientedBox OrientedBox::aligned(const Vector3d& min, const Vector3d& max) {
+  OrientedBox box;
+  box.center = 0.5 * (min + max);
+  box.halfExtents = 0.5 * (max - min);
+  return box;
+}
+
+bool isValidBoxFit(int32_t fit) {
+  return fit >= static_cast<int32_t>(BoxFit::Aligned) &&
+         fit <= static_cast<int32_t>(BoxFit::MinimumArea);
+}
+
+OrientedBox orientedBoundingBox(const Eigen::Ref<const MatrixX3d>& points, BoxFit fit) {
+  return fitBox(points, alignedBounds(points), fit);
+}
+
+OrientedBox orientedBoundingBox(const Mesh& mesh, BoxFit fit) {
+  return fitBox(mesh.V, mesh.boundingBox(), fit);
+}
+
+OrientedBox orientedBoundingBox(const MeshView& view, BoxFit fit) {
+  return fitBox(view.V, view.boundingBox(), fit);
+}
+
+OrientedBox orientedBoundingBox(const Eigen::Ref<const MatrixX3d>& points,
+                                const std::pair<Vector3d, Vector3d>& bounds,
+                                BoxFit fit) {
+  return fitBox(points, bounds, fit);
+}
+}  // namespace GeoSharPlusCPP
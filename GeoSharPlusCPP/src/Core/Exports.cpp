@@ -0,0 +1,668 @@
+#include "GeoSharPlusCPP/Core/Exports.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <utility>
+
+#include "GeoSharPlusCPP/Core/BoundingBox.h"
+#include "GeoSharPlusCPP/Core/JobQueue.h"
+#include "GeoSharPlusCPP/Core/MassProperties.h"
+#include "GeoSharPlusCPP/Core/MeshBvh.h"
+#include "GeoSharPlusCPP/Core/MeshRegistry.h"
+#include "GeoSharPlusCPP/Core/MeshTopology.h"
+#include "GeoSharPlusCPP/Core/Parallel.h"
+#include "GeoSharPlusCPP/Core/ResultCache.h"
+#include "GeoSharPlusCPP/Core/Stats.h"
+#include "GeoSharPlusCPP/Core/Trace.h"
+#include "GeoSharPlusCPP/Serialization/ChunkedStream.h"
+#include "GeoSharPlusCPP/Serialization/InteropAccounting.h"
+#include "GeoSharPlusCPP/Serialization/InteropMemory.h"
+#include "GeoSharPlusCPP/Serialization/Serializer.h"
+#include "GeoSharPlusCPP/Serialization/VerifyPolicy.h"
+
+namespace GS = GeoSharPlusCPP::Serialization;
+
+namespace {
+GS::StreamReader* asReader(void* reader) {
+  return static_cast<GS::StreamReader*>(reader);
+}
+
+// Batch items per chunk of work on the shared thread pool
+constexpr size_t kBatchGrain = 16;
+
+// Validates and measures every mesh of a batch in parallel; false if any mesh is invalid
+template <typename MeshType>
+bool batchMassProperties(const std::vector<MeshType>& meshes,
+                         GeoSharPlusCPP::MassSummation summation,
+                         std::vector<GeoSharPlusCPP::MassProperties>& results) {
+  GSP_STATS_PHASE(Compute);
+  results.resize(meshes.size());
+  std::atomic<bool> ok{true};
+  GeoSharPlusCPP::parallelForChunks(0, meshes.size(), kBatchGrain, [&](size_t first, size_t last) {
+    for (size_t i = first; i < last && ok.load(std::memory_order_relaxed); ++i) {
+      if (!meshes[i].validate()) {
+        ok.store(false, std::memory_order_relaxed);
+        return;
+      }
+      results[i] = GeoSharPlusCPP::massProperties(meshes[i], summation);
+    }
+  });
+  return ok.load();
+}
+
+// Fits a box around each of `count` batch items in parallel; box(i) fits item i
+template <typename BoxFn>
+bool batchBoundingBoxes(size_t count, BoxFn&& box, uint8_t*& outBuffer, int& outSize) {
+  std::vector<GeoSharPlusCPP::OrientedBox> boxes(count);
+  {
+    GSP_STATS_PHASE(Compute);
+    GeoSharPlusCPP::parallelFor(0, count, [&](size_t i) { boxes[i] = box(i); }, kBatchGrain);
+  }
+  return GS::serializeBoundingBoxBatch(boxes, outBuffer, outSize);
+}
+
+// Repair bits of gsp_check_topology
+constexpr int32_t kRepairDegenerateFaces = 1;
+constexpr int32_t kRepairDuplicateFaces = 2;
+constexpr int32_t kRepairUnreferencedVertices = 4;
+
+// Checks a valid mesh and serializes its report, and for a nonzero `repair` the repaired mesh
+template <typename MeshType>
+bool checkTopology(const MeshType& mesh,
+                   int32_t repair,
+                   uint8_t*& reportBuffer,
+                   int& reportSize,
+                   uint8_t*& meshBuffer,
+                   int& meshSize) {
+  if (!mesh.validate()) {
+    return false;
+  }
+  GeoSharPlusCPP::TopologyReport report;
+  GeoSharPlusCPP::Mesh repaired;
+  {
+    GSP_STATS_PHASE(Compute);
+    report = GeoSharPlusCPP::checkTopology(mesh);
+    if (repair != 0) {
+      const GeoSharPlusCPP::MeshRepairOptions options{
+          (repair & kRepairDegenerateFaces) != 0, (repair & kRepairDuplicateFaces) != 0,
+          (repair & kRepairUnreferencedVertices) != 0};
+      repaired = GeoSharPlusCPP::repairMesh(mesh, report, options);
+    }
+  }
+  if (repair != 0 && !GS::serializeMesh(repaired, meshBuffer, meshSize)) {
+    return false;
+  }
+  if (!GS::serializeTopologyReport(report, reportBuffer, reportSize)) {
+    GS::FreeInteropMemory(meshBuffer);
+    meshBuffer = nullptr;
+    meshSize = 0;
+    return false;
+  }
+  return true;
+}
+
+// Query points per chunk of work; one query is a short tree descent
+constexpr size_t kQueryGrain = 256;
+
+// The spatial index of a resident mesh, built on the first query of the handle
+std::shared_ptr<const GeoSharPlusCPP::MeshBvh> queryIndex(uint64_t handle) {
+  GSP_STATS_PHASE(Compute);
+  return GeoSharPlusCPP::findMeshBvh(handle);
+}
+
+// results[i] = query(point i) over the points of a PointArrayData buffer, in parallel and in
+// spatial order (see queryOrder). Double buffers are read in place; encoded ones are decoded
+// instead.
+template <typename Result, typename Query>
+bool queryPoints(const uint8_t* buffer, int size, std::vector<Result>& results, Query&& query) {
+  auto run = [&](const auto& points) {
+    GSP_STATS_PHASE(Compute);
+    const auto order = GeoSharPlusCPP::queryOrder(points);
+    results.resize(order.size());
+    GeoSharPlusCPP::parallelFor(
+        0, order.size(),
+        [&](size_t j) {
+          const uint32_t i = order[j];
+          results[i] = query(GeoSharPlusCPP::Vector3d(points(i, 0), points(i, 1), points(i, 2)));
+        },
+        kQueryGrain);
+    return true;
+  };
+  Eigen::Map<const GeoSharPlusCPP::MatrixX3d> view(nullptr, 0, 3);
+  if (GS::deserializePointArray(buffer, size, view)) {
+    return run(view);
+  }
+  GeoSharPlusCPP::MatrixX3d points;
+  return GS::deserializePointArray(buffer, size, points) && run(points);
+}
+
+// Closest points of a resident mesh to the points of a PointArrayData buffer
+bool meshHits(uint64_t handle,
+              const uint8_t* buffer,
+              int size,
+              double maxDistance,
+              bool signedDistance,
+              uint8_t*& outBuffer,
+              int& outSize) {
+  if (!(maxDistance >= 0)) {  // NaN as well
+    return false;
+  }
+  auto bvh = queryIndex(handle);
+  std::vector<GeoSharPlusCPP::MeshBvh::Hit> hits;
+  return bvh &&
+         queryPoints(buffer, size, hits,
+                     [&](const GeoSharPlusCPP::Vector3d& point) {
+                       return signedDistance ? bvh->signedClosestPoint(point, maxDistance)
+                                             : bvh->closestPoint(point, maxDistance);
+                     }) &&
+         GS::serializeMeshHits(hits, outBuffer, outSize);
+}
+}  // namespace
+
+extern "C" {
+
+GSP_API bool GSP_CALL gsp_set_verify_policy(int32_t policy) {
+  if (!GS::isValidVerifyPolicy(policy)) {
+    return false;
+  }
+
+  GS::setDefaultVerifyPolicy(static_cast<GS::VerifyPolicy>(policy));
+  return true;
+}
+
+GSP_API int32_t GSP_CALL gsp_get_verify_policy() {
+  return static_cast<int32_t>(GS::defaultVerifyPolicy());
+}
+
+GSP_API bool GSP_CALL gsp_stream_write_points(const double* xyz,
+                                               int64_t count,
+                                               int64_t maxChunkBytes,
+                                               gsp_frame_sink sink,
+                                               void* context) {
+  GSP_STATS_CALL(count * 3 * static_cast<int64_t>(sizeof(double)), nullptr);
+  if (!sink || count < 0 || (count > 0 && !xyz)) {
+    return false;
+  }
+
+  GS::ChunkOptions options;
+  if (maxChunkBytes > 0) {
+    options.maxChunkBytes = maxChunkBytes;
+  }
+
+  // x, y, z doubles are laid out exactly like Vector3d
+  const std::span<const GeoSharPlusCPP::Vector3d> points(
+      reinterpret_cast<const GeoSharPlusCPP::Vector3d*>(xyz), static_cast<size_t>(count));
+  return GS::serializePointArrayChunked(
+      points,
+      [&](GeoSharPlusCPP::ByteSpan frame) {
+        return sink(frame.data(), static_cast<int64_t>(frame.size()), context);
+      },
+      options);
+}
+
+GSP_API void* GSP_CALL gsp_stream_reader_create() {
+  return new (std::nothrow) GS::StreamReader();
+}
+
+GSP_API void GSP_CALL gsp_stream_reader_destroy(void* reader) {
+  delete asReader(reader);
+}
+
+GSP_API bool GSP_CALL gsp_stream_reader_append(void* reader, const uint8_t* data, int64_t size) {
+  GSP_STATS_CALL(size, nullptr);
+  if (!reader || size < 0 || (size > 0 && !data)) {
+    return false;
+  }
+  return asReader(reader)->append(GeoSharPlusCPP::ByteSpan(data, static_cast<size_t>(size)));
+}
+
+GSP_API bool GSP_CALL gsp_stream_reader_complete(void* reader) {
+  return reader && asReader(reader)->complete();
+}
+
+GSP_API bool GSP_CALL gsp_stream_reader_counts(void* reader,
+                                                int64_t* pointCount,
+                                                int64_t* faceCount,
+                                                int32_t* faceVertexCount) {
+  if (!reader || !asReader(reader)->complete()) {
+    return false;
+  }
+
+  const auto& mesh = asReader(reader)->mesh();
+  if (pointCount) {
+    *pointCount = mesh.V.rows();
+  }
+  if (faceCount) {
+    *faceCount = mesh.F.rows();
+  }
+  if (faceVertexCount) {
+    *faceVertexCount = static_cast<int32_t>(mesh.F.cols());
+  }
+  return true;
+}
+
+GSP_API bool GSP_CALL gsp_stream_reader_copy_points(void* reader, double* xyz, int64_t count) {
+  if (!reader || !asReader(reader)->complete()) {
+    return false;
+  }
+
+  const auto& V = asReader(reader)->points();
+  if (count != V.rows() || (count > 0 && !xyz)) {
+    return false;
+  }
+  // Row-major N x 3, already interleaved
+  std::memcpy(xyz, V.data(), static_cast<size_t>(V.size()) * sizeof(double));
+  return true;
+}
+
+GSP_API bool GSP_CALL gsp_stream_reader_copy_faces(void* reader, int32_t* indices, int64_t count) {
+  if (!reader || !asReader(reader)->complete()) {
+    return false;
+  }
+
+  const auto& F = asReader(reader)->mesh().F;
+  if (count != F.rows() || (count > 0 && !indices)) {
+    return false;
+  }
+  // Mesh::F is column-major; write it out face by face
+  Eigen::Map<GeoSharPlusCPP::MatrixXi>(indices, F.rows(), F.cols()) = F;
+  return true;
+}
+
+GSP_API bool GSP_CALL gsp_mesh_upload(const uint8_t* buffer, int size, uint64_t* handle) {
+  GSP_STATS_CALL(size, nullptr);
+  if (!handle) {
+    return false;
+  }
+  *handle = 0;
+
+  GeoSharPlusCPP::Mesh mesh;
+  if (!GS::deserializeMesh(buffer, size, mesh)) {
+    return false;
+  }
+  *handle = GeoSharPlusCPP::registerMesh(std::move(mesh));
+  return *handle != 0;
+}
+
+GSP_API bool GSP_CALL gsp_mesh_download(uint64_t handle, uint8_t** outBuffer, int* outSize) {
+  if (!outBuffer || !outSize) {
+    return false;
+  }
+  GSP_STATS_CALL(0, outSize);
+  *outBuffer = nullptr;
+  *outSize = 0;
+
+  auto mesh = GeoSharPlusCPP::findMesh(handle);
+  return mesh && GS::serializeMesh(*mesh, *outBuffer, *outSize);
+}
+
+GSP_API bool GSP_CALL gsp_release(uint64_t handle) {
+  return GeoSharPlusCPP::releaseMesh(handle);
+}
+
+GSP_API void GSP_CALL gsp_resident_stats(int64_t* handleCount, int64_t* residentBytes) {
+  const auto stats = GeoSharPlusCPP::meshRegistryStats();
+  if (handleCount) {
+    *handleCount = static_cast<int64_t>(stats.handleCount);
+  }
+  if (residentBytes) {
+    *residentBytes = static_cast<int64_t>(stats.residentBytes);
+  }
+}
+
+GSP_API bool GSP_CALL gsp_mass_properties(const uint8_t* inBuffer,
+                                          int inSize,
+                                          int32_t summation,
+                                          uint8_t** outBuffer,
+                                          int* outSize) {
+  if (!outBuffer || !outSize) {
+    return false;
+  }
+  GSP_STATS_CALL(inSize, outSize);
+  *outBuffer = nullptr;
+  *outSize = 0;
+  if (!GeoSharPlusCPP::isValidMassSummation(summation)) {
+    return false;
+  }
+  const auto mode = static_cast<GeoSharPlusCPP::MassSummation>(summation);
+
+  // Meshes are read in place; batches with encoded vertices or faces are decoded instead
+  std::vector<GeoSharPlusCPP::MassProperties> results;
+  std::vector<GeoSharPlusCPP::MeshView> views;
+  if (GS::deserializeMeshBatchView(inBuffer, inSize, views)) {
+    if (!batchMassProperties(views, mode, results)) {
+      return false;
+    }
+  } else {
+    std::vector<GeoSharPlusCPP::Mesh> meshes;
+    if (!GS::deserializeMeshBatch(inBuffer, inSize, meshes) ||
+        !batchMassProperties(meshes, mode, results)) {
+      return false;
+    }
+  }
+  return GS::serializeMassPropertiesBatch(results, *outBuffer, *outSize);
+}
+
+GSP_API bool GSP_CALL gsp_mesh_bounding_boxes(const uint8_t* inBuffer,
+                                              int inSize,
+                                              int32_t fit,
+                                              uint8_t** outBuffer,
+                                              int* outSize) {
+  if (!outBuffer || !outSize) {
+    return false;
+  }
+  GSP_STATS_CALL(inSize, outSize);
+  *outBuffer = nullptr;
+  *outSize = 0;
+  if (!GeoSharPlusCPP::isValidBoxFit(fit)) {
+    return false;
+  }
+  const auto mode = static_cast<GeoSharPlusCPP::BoxFit>(fit);
+
+  // Meshes are read in place; batches with encoded vertices or faces are decoded instead
+  std::vector<GeoSharPlusCPP::MeshView> views;
+  if (GS::deserializeMeshBatchView(inBuffer, inSize, views)) {
+    return batchBoundingBoxes(
+        views.size(), [&](size_t i) { return GeoSharPlusCPP::orientedBoundingBox(views[i], mode); },
+        *outBuffer, *outSize);
+  }
+  std::vector<GeoSharPlusCPP::Mesh> meshes;
+  return GS::deserializeMeshBatch(inBuffer, inSize, meshes) &&
+         batchBoundingBoxes(
+             meshes.size(),
+             [&](size_t i) { return GeoSharPlusCPP::orientedBoundingBox(meshes[i], mode); },
+             *outBuffer, *outSize);
+}
+
+GSP_API bool GSP_CALL gsp_point_bounding_boxes(const uint8_t* inBuffer,
+                                               int inSize,
+                                               int32_t fit,
+                                               uint8_t** outBuffer,
+                                               int* outSize) {
+  if (!outBuffer || !outSize) {
+    return false;
+  }
+  GSP_STATS_CALL(inSize, outSize);
+  *outBuffer = nullptr;
+  *outSize = 0;
+  if (!GeoSharPlusCPP::isValidBoxFit(fit)) {
+    return false;
+  }
+  const auto mode = static_cast<GeoSharPlusCPP::BoxFit>(fit);
+
+  std::vector<GeoSharPlusCPP::MatrixX3d> pointArrays;
+  return GS::deserializePointArrayBatch(inBuffer, inSize, pointArrays) &&
+         batchBoundingBoxes(
+             pointArrays.size(),
+             [&](size_t i) { return GeoSharPlusCPP::orientedBoundingBox(pointArrays[i], mode); },
+             *outBuffer, *outSize);
+}
+
+GSP_API bool GSP_CALL gsp_resident_bounding_boxes(const uint64_t* handles,
+                                                  int count,
+                                                  int32_t fit,
+                                                  uint8_t** outBuffer,
+                                                  int* outSize) {
+  if (!outBuffer || !outSize) {
+    return false;
+  }
+  GSP_STATS_CALL(0, outSize);
+  *outBuffer = nullptr;
+  *outSize = 0;
+  if (!GeoSharPlusCPP::isValidBoxFit(fit) || count < 0 || (count > 0 && !handles)) {
+    return false;
+  }
+  const auto mode = static_cast<GeoSharPlusCPP::BoxFit>(fit);
+
+  // The meshes are held for the whole call, so concurrent releases cannot free them
+  std::vector<std::shared_ptr<const GeoSharPlusCPP::Mesh>> meshes(static_cast<size_t>(count));
+  std::vector<std::pair<GeoSharPlusCPP::Vector3d, GeoSharPlusCPP::Vector3d>> bounds(meshes.size());
+  for (size_t i = 0; i < meshes.size(); ++i) {
+    meshes[i] = GeoSharPlusCPP::findMesh(handles[i], bounds[i]);
+    if (!meshes[i]) {
+      return false;
+    }
+  }
+  return batchBoundingBoxes(
+      meshes.size(),
+      [&](size_t i) {
+        return GeoSharPlusCPP::orientedBoundingBox(meshes[i]->V, bounds[i], mode);
+      },
+      *outBuffer, *outSize);
+}
+
+GSP_API bool GSP_CALL gsp_check_topology(const uint8_t* inBuffer,
+                                         int inSize,
+                                         int32_t repair,
+                                         uint8_t** reportBuffer,
+                                         int* reportSize,
+                                         uint8_t** meshBuffer,
+                                         int* meshSize) {
+  if (!reportBuffer || !reportSize || !meshBuffer || !meshSize) {
+    return false;
+  }
+  GSP_STATS_CALL(inSize, reportSize);
+  *reportBuffer = nullptr;
+  *reportSize = 0;
+  *meshBuffer = nullptr;
+  *meshSize = 0;
+  constexpr int32_t kAllRepairs =
+      kRepairDegenerateFaces | kRepairDuplicateFaces | kRepairUnreferencedVertices;
+  if ((repair & ~kAllRepairs) != 0) {
+    return false;
+  }
+
+  // The mesh is read in place; buffers with encoded vertices or faces are decoded instead
+  GeoSharPlusCPP::MeshView view;
+  if (GS::deserializeMeshView(inBuffer, inSize, view)) {
+    return checkTopology(view, repair, *reportBuffer, *reportSize, *meshBuffer, *meshSize);
+  }
+  GeoSharPlusCPP::Mesh mesh;
+  return GS::deserializeMesh(inBuffer, inSize, mesh) &&
+         checkTopology(mesh, repair, *reportBuffer, *reportSize, *meshBuffer, *meshSize);
+}
+
+GSP_API bool GSP_CALL gsp_mesh_closest_points(uint64_t handle,
+                                              const uint8_t* inBuffer,
+                                              int inSize,
+                                              double maxDistance,
+                                              uint8_t** outBuffer,
+                                              int* outSize) {
+  if (!outBuffer || !outSize) {
+    return false;
+  }
+  GSP_STATS_CALL(inSize, outSize);
+  *outBuffer = nullptr;
+  *outSize = 0;
+
+  return meshHits(handle, inBuffer, inSize, maxDistance, false, *outBuffer, *outSize);
+}
+
+GSP_API bool GSP_CALL gsp_mesh_signed_distances(uint64_t handle,
+                                                const uint8_t* inBuffer,
+                                                int inSize,
+                                                double maxDistance,
+                                                uint8_t** outBuffer,
+                                                int* outSize) {
+  if (!outBuffer || !outSize) {
+    return false;
+  }
+  GSP_STATS_CALL(inSize, outSize);
+  *outBuffer = nullptr;
+  *outSize = 0;
+
+  return meshHits(handle, inBuffer, inSize, maxDistance, true, *outBuffer, *outSize);
+}
+
+GSP_API bool GSP_CALL gsp_mesh_faces_within(uint64_t handle,
+                                            const uint8_t* inBuffer,
+                                            int inSize,
+                                            double radius,
+                                            uint8_t** outBuffer,
+                                            int* outSize) {
+  if (!outBuffer || !outSize) {
+    return false;
+  }
+  GSP_STATS_CALL(inSize, outSize);
+  *outBuffer = nullptr;
+  *outSize = 0;
+  if (!(radius >= 0)) {  // NaN as well
+    return false;
+  }
+
+  auto bvh = queryIndex(handle);
+  std::vector<std::vector<std::pair<int, double>>> faces;
+  return bvh &&
+         queryPoints(inBuffer, inSize, faces,
+                     [&](const GeoSharPlusCPP::Vector3d& point) {
+                       std::vector<std::pair<int, double>> within;
+                       bvh->facesWithin(point, radius, within);
+                       return within;
+                     }) &&
+         GS::serializeFacesWithin(faces, *outBuffer, *outSize);
+}
+
+GSP_API bool GSP_CALL gsp_cache_set_budget(int64_t bytes) {
+  if (bytes < 0) {
+    return false;
+  }
+  GeoSharPlusCPP::setCacheBudget(static_cast<size_t>(bytes));
+  return true;
+}
+
+GSP_API void GSP_CALL gsp_cache_clear() {
+  GeoSharPlusCPP::clearCache();
+}
+
+GSP_API void GSP_CALL gsp_cache_stats(int64_t* hits,
+                                      int64_t* misses,
+                                      int64_t* entries,
+                                      int64_t* bytes) {
+  const auto stats = GeoSharPlusCPP::cacheStats();
+  if (hits) {
+    *hits = static_cast<int64_t>(stats.hits);
+  }
+  if (misses) {
+    *misses = static_cast<int64_t>(stats.misses);
+  }
+  if (entries) {
+    *entries = static_cast<int64_t>(stats.entries);
+  }
+  if (bytes) {
+    *bytes = static_cast<int64_t>(stats.bytes);
+  }
+}
+
+GSP_API void GSP_CALL gsp_set_stats_enabled(bool enabled) {
+  GeoSharPlusCPP::setStatsEnabled(enabled);
+}
+
+GSP_API bool GSP_CALL gsp_get_stats(uint8_t** outBuffer, int* outSize) {
+  if (!outBuffer || !outSize) {
+    return false;
+  }
+  *outBuffer = nullptr;
+  *outSize = 0;
+  return GeoSharPlusCPP::serializeStats(*outBuffer, *outSize);
+}
+
+GSP_API void GSP_CALL gsp_reset_stats() {
+  GeoSharPlusCPP::resetStats();
+}
+
+GSP_API void GSP_CALL gsp_trace_enable(bool enabled) {
+  GeoSharPlusCPP::setTracingEnabled(enabled);
+}
+
+GSP_API bool GSP_CALL gsp_trace_dump(const char* path) {
+  return GeoSharPlusCPP::dumpTrace(path);
+}
+
+GSP_API bool GSP_CALL gsp_set_memory_tracking(int32_t mode) {
+  if (!GS::isValidMemoryTracking(mode)) {
+    return false;
+  }
+  GS::setMemoryTracking(static_cast<GS::MemoryTracking>(mode));
+  return true;
+}
+
+GSP_API bool GSP_CALL gsp_memory_stats(uint8_t** outBuffer, int* outSize) {
+  if (!outBuffer || !outSize) {
+    return false;
+  }
+  *outBuffer = nullptr;
+  *outSize = 0;
+  return GS::serializeMemoryStats(*outBuffer, *outSize);
+}
+
+GSP_API void GSP_CALL gsp_free_buffer(void* buffer) {
+  if (buffer) {
+    GS::FreeInteropMemory(buffer);
+  }
+}
+
+GSP_API bool GSP_CALL gsp_set_thread_count(int32_t count) {
+  if (count < 0) {
+    return false;
+  }
+  GeoSharPlusCPP::setThreadCount(static_cast<size_t>(count));
+  return true;
+}
+
+GSP_API int32_t GSP_CALL gsp_get_thread_count() {
+  return static_cast<int32_t>(GeoSharPlusCPP::threadCount());
+}
+
+GSP_API bool GSP_CALL gsp_submit(gsp_job_function fn,
+                                  const uint8_t* inBuffer,
+                                  int inSize,
+                                  gsp_job_callback callback,
+                                  void* userData,
+                                  uint64_t* job) {
+  if (!job) {
+    return false;
+  }
+  *job = 0;
+  if (inSize < 0 || (!inBuffer && inSize > 0)) {
+    return false;
+  }
+
+  GeoSharPlusCPP::ByteSpan input;
+  if (inSize > 0) {
+    input = {inBuffer, static_cast<size_t>(inSize)};
+  }
+  *job = GeoSharPlusCPP::submitJob(fn, input, callback, userData);
+  return *job != 0;
+}
+
+GSP_API int32_t GSP_CALL gsp_poll(uint64_t job) {
+  return static_cast<int32_t>(GeoSharPlusCPP::jobStatus(job));
+}
+
+GSP_API int32_t GSP_CALL gsp_wait(uint64_t job, int32_t timeoutMs) {
+  const auto status = timeoutMs < 0
+                          ? GeoSharPlusCPP::waitJob(job)
+                          : GeoSharPlusCPP::waitJob(job, std::chrono::milliseconds(timeoutMs));
+  return static_cast<int32_t>(status);
+}
+
+GSP_API bool GSP_CALL gsp_cancel(uint64_t job) {
+  return GeoSharPlusCPP::cancelJob(job);
+}
+
+GSP_API bool GSP_CALL gsp_job_result(uint64_t job, uint8_t** outBuffer, int* outSize) {
+  if (!outBuffer || !outSize) {
+    return false;
+  }
+  *outBuffer = nullptr;
+  *outSize = 0;
+  return GeoSharPlusCPP::takeJobResult(job, *outBuffer, *outSize);
+}
+
+GSP_API bool GSP_CALL gsp_job_release(uint64_t job) {
+  return GeoSharPlusCPP::releaseJob(job);
+}
+
+}  // extern "C"
@@ -1,72 +1,282 @@
 #include "GeoSharPlusCPP/Core/Geometry.h"
 
-namespace GeoSharPlusCPP {  // Corrected namespace name to match the header file
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <functional>
 
-// Polyline operations
-double Polyline::length() const {
-  double total = 0.0;
-  const auto n = vertices.rows();
+#include "GeoSharPlusCPP/Core/BoundingBox.h"
+#include "GeoSharPlusCPP/Core/Parallel.h"
+
+namespace GeoSharPlusCPP {  // Corrected namespace name to match the header file
 
-  for (Eigen::Index i = 1; i < n; ++i) {
-    total += (vertices.row(i) - vertices.row(i - 1)).norm();
+namespace {
+// Shared kernels for Mesh (owning) and MeshView (mapped) storage
+template <typename DerivedV, typename DerivedF>
+bool validateMesh(const Eigen::MatrixBase<DerivedV>& V, const Eigen::MatrixBase<DerivedF>& F) {
+  if (F.size() == 0) {
+    return F.cols() == 3 || F.cols() == 4;
   }
 
-  return total;
+  // Check face indices are within valid range
+  return F.maxCoeff() < V.rows() && F.minCoeff() >= 0 &&
+         (F.cols() == 3 || F.cols() == 4);  // triangles or quads
 }
 
-// Mesh validation implementation
-bool Mesh::validate() const {
-  const auto n_V = V.rows();
+// CSR polygon faces: offsets start at 0, grow by at least 3 per face and end at the index
+// count, and every index is a vertex
+template <typename DerivedV, typename DerivedO, typename DerivedI>
+bool validatePolygons(const Eigen::MatrixBase<DerivedV>& V,
+                      const Eigen::MatrixBase<DerivedO>& offsets,
+                      const Eigen::MatrixBase<DerivedI>& indices) {
+  const Eigen::Index faceCount = offsets.size() - 1;
+  if (faceCount < 0 || offsets(0) != 0 || offsets(faceCount) != indices.size()) {
+    return false;
+  }
+  for (Eigen::Index i = 0; i < faceCount; ++i) {
+    if (offsets(i + 1) - offsets(i) < 3) {
+      return false;
+    }
+  }
 
-  // Check face indices are within valid range
-  return F.maxCoeff() < n_V && F.minCoeff() >= 0 &&
-         (F.cols() == 3 || F.cols() == 4);  // triangles or quads
+  return indices.size() == 0 || (indices.minCoeff() >= 0 && indices.maxCoeff() < V.rows());
 }
 
-// Add this method to the Mesh class implementation
-Eigen::Vector3d Mesh::centroid() const {
+// Area-weighted centroid over a fan triangulation of each face. `faceSize(f)` is the vertex
+// count of face f and `corner(f, k)` its k-th vertex, so dense and CSR faces share the kernel.
+template <typename DerivedV, typename FaceSize, typename Corner>
+Vector3d areaWeightedCentroid(const Eigen::MatrixBase<DerivedV>& V,
+                              Eigen::Index faceCount,
+                              FaceSize faceSize,
+                              Corner corner) {
   if (V.rows() == 0) {
     return Vector3d::Zero();
   }
 
   // For closed meshes, use weighted approach
-  if (F.rows() > 0) {
-    Vector3d center = Vector3d::Zero();
-    double totalArea = 0.0;
+  if (faceCount > 0) {
+    // Faces are summed in parallel chunks; the deterministic reduction keeps the result
+    // independent of the thread count
+    struct Partial {
+      Vector3d center = Vector3d::Zero();
+      double area = 0.0;
+    };
+    const Partial total = parallelReduce(
+        size_t{0}, static_cast<size_t>(faceCount), Partial{},
+        [&](size_t first, size_t last) {
+          Partial partial;
+          for (auto i = static_cast<Eigen::Index>(first); i < static_cast<Eigen::Index>(last);
+               ++i) {
+            const Vector3d v1 = V.row(corner(i, 0)).transpose();
+            for (Eigen::Index k = 2; k < faceSize(i); ++k) {
+              Vector3d v2 = V.row(corner(i, k - 1)).transpose();
+              Vector3d v3 = V.row(corner(i, k)).transpose();
 
-    for (Eigen::Index i = 0; i < F.rows(); ++i) {
-      Vector3d v1 = V.row(F(i, 0));
-      Vector3d v2 = V.row(F(i, 1));
-      Vector3d v3 = V.row(F(i, 2));
+              double area = 0.5 * (v2 - v1).cross(v3 - v1).norm();
+              Vector3d triangleCenter = (v1 + v2 + v3) / 3.0;
 
-      double area = 0.5 * (v2 - v1).cross(v3 - v1).norm();
-      Vector3d triangleCenter = (v1 + v2 + v3) / 3.0;
-
-      center += area * triangleCenter;
-      totalArea += area;
-    }
+              partial.center += area * triangleCenter;
+              partial.area += area;
+            }
+          }
+          return partial;
+        },
+        [](Partial a, const Partial& b) {
+          a.center += b.center;
+          a.area += b.area;
+          return a;
+        });
 
-    if (totalArea > 0) {
-      center /= totalArea;
+    Vector3d center = total.center;
+    if (total.area > 0) {
+      center /= total.area;
     }
 
     return center;
   }
 
   // Simple average of vertices for non-closed meshes
-  return V.colwise().mean();
+  return V.colwise().mean().transpose();
+}
+
+template <typename DerivedV, typename DerivedF>
+Vector3d meshCentroid(const Eigen::MatrixBase<DerivedV>& V, const Eigen::MatrixBase<DerivedF>& F) {
+  return areaWeightedCentroid(
+      V, F.rows(), [&](Eigen::Index) { return F.cols(); },
+      [&](Eigen::Index face, Eigen::Index k) { return F(face, k); });
+}
+
+template <typename DerivedV, typename DerivedO, typename DerivedI>
+Vector3d polygonCentroid(const Eigen::MatrixBase<DerivedV>& V,
+                         const Eigen::MatrixBase<DerivedO>& offsets,
+                         const Eigen::MatrixBase<DerivedI>& indices) {
+  return areaWeightedCentroid(
+      V, offsets.size() - 1, [&](Eigen::Index face) { return offsets(face + 1) - offsets(face); },
+      [&](Eigen::Index face, Eigen::Index k) { return indices(offsets(face) + k); });
+}
+
+// Every attribute has 1-4 components and one element per vertex or face
+bool validAttribute(AttributeDomain domain,
+                    Eigen::Index count,
+                    Eigen::Index dimension,
+                    Eigen::Index vertexCount,
+                    Eigen::Index faceCount) {
+  return dimension >= 1 && dimension <= 4 &&
+         count == (domain == AttributeDomain::Vertex ? vertexCount : faceCount);
+}
+
+template <typename Attribute>
+const Attribute* findAttribute(const std::vector<Attribute>& attributes, std::string_view name) {
+  auto it = std::find_if(attributes.begin(), attributes.end(),
+                         [&](const Attribute& attribute) { return attribute.name == name; });
+  return it != attributes.end() ? &*it : nullptr;
+}
+}  // namespace
+
+// Polyline operations
+double Polyline::length() const {
+  const auto n = static_cast<size_t>(vertices.rows());
+  if (n < 2) {
+    return 0.0;
+  }
+
+  // Segments are summed in parallel chunks, combined in a fixed order
+  return parallelReduce(
+      size_t{1}, n, 0.0,
+      [&](size_t first, size_t last) {
+        double total = 0.0;
+        for (auto i = static_cast<Eigen::Index>(first); i < static_cast<Eigen::Index>(last); ++i) {
+          total += (vertices.row(i) - vertices.row(i - 1)).norm();
+        }
+        return total;
+      },
+      std::plus<>());
+}
+
+// Mesh validation implementation
+bool Mesh::validate() const {
+  const bool faces =
+      isPolygonMesh() ? validatePolygons(V, faceOffsets, faceIndices) : validateMesh(V, F);
+  return faces && std::all_of(attributes.begin(), attributes.end(), [&](const auto& attribute) {
+           return validAttribute(attribute.domain, attribute.count(), attribute.dimension(),
+                                 V.rows(), faceCount());
+         });
+}
+
+const MeshAttribute* Mesh::attribute(std::string_view name) const noexcept {
+  return findAttribute(attributes, name);
+}
+
+size_t Mesh::memoryBytes() const noexcept {
+  size_t bytes = sizeof(double) * static_cast<size_t>(V.size() + C.size()) +
+                 sizeof(int) * static_cast<size_t>(F.size() + faceOffsets.size() +
+                                                   faceIndices.size());
+  for (const auto& attribute : attributes) {
+    bytes += attribute.name.size();
+    std::visit(
+        [&](const auto& values) {
+          bytes += sizeof(values(0, 0)) * static_cast<size_t>(values.size());
+        },
+        attribute.data);
+  }
+  return bytes;
+}
+
+// Add this method to the Mesh class implementation
+Eigen::Vector3d Mesh::centroid() const {
+  return isPolygonMesh() ? polygonCentroid(V, faceOffsets, faceIndices) : meshCentroid(V, F);
 }
 
 // Bounding box calculation for mesh
 std::pair<Vector3d, Vector3d> Mesh::boundingBox() const {
-  if (V.rows() == 0) {  // Corrected to use V instead of vertices
-    return {Vector3d::Zero(), Vector3d::Zero()};
+  return alignedBounds(V);
+}
+
+// MeshView operations - same kernels, evaluated directly on the mapped memory
+bool MeshView::validate() const {
+  const bool faces =
+      isPolygonMesh() ? validatePolygons(V, faceOffsets, faceIndices) : validateMesh(V, F);
+  return faces && std::all_of(attributes.begin(), attributes.end(), [&](const auto& attribute) {
+           return validAttribute(attribute.domain, attribute.count, attribute.dimension, V.rows(),
+                                 faceCount());
+         });
+}
+
+const MeshAttributeView* MeshView::attribute(std::string_view name) const noexcept {
+  return findAttribute(attributes, name);
+}
+
+Eigen::Vector3d MeshView::centroid() const {
+  return isPolygonMesh() ? polygonCentroid(V, faceOffsets, faceIndices) : meshCentroid(V, F);
+}
+
+std::pair<Vector3d, Vector3d> MeshView::boundingBox() const {
+  return alignedBounds(V);
+}
+
+Mesh MeshView::toMesh() const {
+  Mesh mesh = isPolygonMesh() ? Mesh(V, faceOffsets, faceIndices) : Mesh(V, F);
+  mesh.attributes.reserve(attributes.size());
+  for (const auto& attribute : attributes) {
+    mesh.attributes.push_back(attribute.toAttribute());
   }
+  return mesh;
+}
 
-  Vector3d min =
-      V.colwise().minCoeff();  // Corrected to use V instead of vertices
-  Vector3d max =
-      V.colwise().maxCoeff();  // Corrected to use V instead of vertices
-  return {min, max};
+MeshAttribute MeshAttributeView::toAttribute() const {
+  MeshAttribute attribute{std::string(name), domain, {}};
+  switch (type) {
+    case AttributeType::Float32:
+      attribute.data = AttributeMatrix<float>(map<float>());
+      break;
+    case AttributeType::Float64:
+      attribute.data = AttributeMatrix<double>(map<double>());
+      break;
+    case AttributeType::Int32:
+      attribute.data = AttributeMatrix<int>(map<int>());
+      break;
+    case AttributeType::UInt8:
+      attribute.data = AttributeMatrix<uint8_t>(map<uint8_t>());
+      break;
+  }
+  return attribute;
+}
+
+bool CsrIntArray::assignSizes(std::span<const int> sizes) {
+  offsets.resize(sizes.size() + 1);
+  offsets[0] = 0;
+  int64_t total = 0;
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    total += sizes[i];
+    if (sizes[i] < 0 || total > INT_MAX) {
+      clear();
+      return false;
+    }
+    offsets[i + 1] = static_cast<int>(total);
+  }
+  return true;
+}
+
+CsrIntArray CsrIntArray::fromNested(const std::vector<std::vector<int>>& nested) {
+  CsrIntArray csr;
+  size_t valueCount = 0;
+  for (const auto& subArray : nested) {
+    valueCount += subArray.size();
+  }
+
+  csr.reserve(nested.size(), valueCount);
+  for (const auto& subArray : nested) {
+    csr.push_back(subArray);
+  }
+  return csr;
+}
+
+std::vector<std::vector<int>> CsrIntArray::toNested() const {
+  std::vector<std::vector<int>> nested(size());
+  for (size_t i = 0; i < nested.size(); ++i) {
+    const auto subArray = (*this)[i];
+    nested[i].assign(subArray.begin(), subArray.end());
+  }
+  return nested;
 }
 }  // namespace GeoSharPlusCPP
@@ -0,0 +1,229 @@
+#include "GeoSharPlusCPP/Core/JobQueue.h"
+
+#include <atomic>
+#include <climits>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "GeoSharPlusCPP/Core/Parallel.h"
+#include "GeoSharPlusCPP/Serialization/InteropMemory.h"
+
+namespace GeoSharPlusCPP {
+namespace {
+struct Job {
+  JobId id = 0;
+  JobFunction fn = nullptr;
+  std::vector<uint8_t> input;
+  JobCallback callback = nullptr;
+  void* userData = nullptr;
+  std::atomic<bool> cancelled{false};
+
+  // Guarded by Queue::mutex
+  JobStatus status = JobStatus::Pending;
+  uint8_t* result = nullptr;
+  int resultSize = 0;
+
+  ~Job() {
+    if (result) {
+      Serialization::FreeInteropMemory(result);
+    }
+  }
+};
+
+bool finished(JobStatus status) {
+  return status == JobStatus::Succeeded || status == JobStatus::Failed ||
+         status == JobStatus::Cancelled;
+}
+
+struct Queue {
+  std::mutex mutex;
+  std::condition_variable done;
+  std::unordered_map<JobId, std::shared_ptr<Job>> jobs;
+  JobId nextId = 1;
+};
+
+thread_local const Job* currentJob = nullptr;
+
+// Never destroyed, like the thread pool running the jobs
+Queue& queue() {
+  static Queue* instance = new Queue;
+  return *instance;
+}
+
+void runJob(Queue& q, Job& job) {
+  uint8_t* resBuffer = nullptr;
+  int resSize = 0;
+  bool ok = false;
+  currentJob = &job;
+  try {
+    ok = job.fn(job.input.data(), static_cast<int>(job.input.size()), &resBuffer, &resSize);
+  } catch (...) {
+    ok = false;
+  }
+  currentJob = nullptr;
+  std::vector<uint8_t>().swap(job.input);
+
+  std::lock_guard lock(q.mutex);
+  if (ok && !job.cancelled.load()) {
+    job.status = JobStatus::Succeeded;
+    job.result = resBuffer;
+    job.resultSize = resSize;
+    return;
+  }
+  job.status = job.cancelled.load() ? JobStatus::Cancelled : JobStatus::Failed;
+  if (resBuffer) {
+    Serialization::FreeInteropMemory(resBuffer);
+  }
+}
+
+// Pool task of one job
+void processJob(Queue& q, const std::shared_ptr<Job>& job) {
+  bool run = false;
+  {
+    std::lock_guard lock(q.mutex);
+    // Jobs cancelled while queued are already marked; only their callback is left
+    if (job->status == JobStatus::Pending) {
+      job->status = JobStatus::Running;
+      run = true;
+    }
+  }
+
+  if (run) {
+    runJob(q, *job);
+    q.done.notify_all();
+  }
+  if (job->callback) {
+    job->callback(job->id, static_cast<int32_t>(job->status), job->userData);
+  }
+}
+
+// Called with the queue locked
+void markCancelled(Job& job) {
+  job.cancelled.store(true);
+  if (job.status == JobStatus::Pending) {
+    job.status = JobStatus::Cancelled;
+  }
+}
+
+std::shared_ptr<Job> findJob(Queue& q, JobId id) {
+  auto it = q.jobs.find(id);
+  return it != q.jobs.end() ? it->second : nullptr;
+}
+}  // namespace
+
+JobId submitJob(JobFunction fn, ByteSpan input, JobCallback callback, void* userData) {
+  if (!fn || input.size() > static_cast<size_t>(INT_MAX)) {
+    return 0;
+  }
+
+  try {
+    auto job = std::make_shared<Job>();
+    job->fn = fn;
+    job->input.assign(input.begin(), input.end());
+    job->callback = callback;
+    job->userData = userData;
+
+    auto& q = queue();
+    {
+      std::lock_guard lock(q.mutex);
+      job->id = q.nextId++;
+      q.jobs.emplace(job->id, job);
+    }
+    try {
+      submitTask([&q, job] { processJob(q, job); });
+    } catch (const std::exception&) {
+      std::lock_guard lock(q.mutex);
+      q.jobs.erase(job->id);
+      throw;
+    }
+    return job->id;
+  } catch (const std::exception&) {
+    // Out of memory, or no pool thread could be started
+    return 0;
+  }
+}
+
+JobStatus jobStatus(JobId id) {
+  auto& q = queue();
+  std::lock_guard lock(q.mutex);
+  auto job = findJob(q, id);
+  return job ? job->status : JobStatus::Unknown;
+}
+
+JobStatus waitJob(JobId id) {
+  auto& q = queue();
+  std::unique_lock lock(q.mutex);
+  auto job = findJob(q, id);
+  if (!job) {
+    return JobStatus::Unknown;
+  }
+  q.done.wait(lock, [&] { return finished(job->status); });
+  return job->status;
+}
+
+JobStatus waitJob(JobId id, std::chrono::milliseconds timeout) {
+  auto& q = queue();
+  std::unique_lock lock(q.mutex);
+  auto job = findJob(q, id);
+  if (!job) {
+    return JobStatus::Unknown;
+  }
+  q.done.wait_for(lock, timeout, [&] { return finished(job->status); });
+  return job->status;
+}
+
+bool cancelJob(JobId id) {
+  auto& q = queue();
+  {
+    std::lock_guard lock(q.mutex);
+    auto job = findJob(q, id);
+    if (!job || finished(job->status)) {
+      return false;
+    }
+    markCancelled(*job);
+  }
+  q.done.notify_all();
+  return true;
+}
+
+bool takeJobResult(JobId id, uint8_t*& resBuffer, int& resSize) {
+  auto& q = queue();
+  std::lock_guard lock(q.mutex);
+  auto job = findJob(q, id);
+  if (!job || !job->result) {
+    return false;
+  }
+  resBuffer = std::exchange(job->result, nullptr);
+  resSize = std::exchange(job->resultSize, 0);
+  return true;
+}
+
+bool releaseJob(JobId id) {
+  // An untaken result is freed outside the lock, once the worker (if any) lets go of the job
+  std::shared_ptr<Job> released;
+  auto& q = queue();
+  {
+    std::lock_guard lock(q.mutex);
+    auto it = q.jobs.find(id);
+    if (it == q.jobs.end()) {
+      return false;
+    }
+    released = std::move(it->second);
+    q.jobs.erase(it);
+    if (!finished(released->status)) {
+      markCancelled(*released);
+    }
+  }
+  q.done.notify_all();
+  return true;
+}
+
+bool jobCancelled() {
+  return currentJob && currentJob->cancelled.load(std::memory_order_relaxed);
+}
+}  // namespace GeoSharPlusCPP
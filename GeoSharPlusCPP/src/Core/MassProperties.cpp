@@ -0,0 +1,242 @@
+#include "GeoSharPlusCPP/Core/MassProperties.h"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+#include "GeoSharPlusCPP/Core/Parallel.h"
+
+namespace GeoSharPlusCPP {
+namespace {
+// Triangles per block; a block and its terms take about 23 KB of stack
+constexpr size_t kBlockTriangles = 128;
+
+// Faces per parallel chunk
+constexpr size_t kFaceGrain = 2048;
+
+// Integrals summed over the triangles, relative to the reference point
+enum Term : size_t {
+  kArea,
+  kVolume,
+  kAreaMomentX,  // Integral of x dA
+  kAreaMomentY,
+  kAreaMomentZ,
+  kVolumeMomentX,  // Integral of x dV
+  kVolumeMomentY,
+  kVolumeMomentZ,
+  kXX,  // Integral of x x^T dV
+  kYY,
+  kZZ,
+  kXY,
+  kYZ,
+  kZX,
+  kTermCount
+};
+
+using BlockTerms = std::array<std::array<double, kBlockTriangles>, kTermCount>;
+
+struct Sums {
+  std::array<double, kTermCount> sum{};
+  std::array<double, kTermCount> carry{};  // Rounding errors; zero unless compensated
+};
+
+// Neumaier's variant of Kahan summation: adds `x` to `sum` and the rounding error to `carry`
+inline void compensatedAdd(double& sum, double& carry, double x) {
+  const double t = sum + x;
+  carry += std::abs(sum) >= std::abs(x) ? (sum - t) + x : (x - t) + sum;
+  sum = t;
+}
+
+// Triangle corners in structure-of-arrays layout
+struct TriangleBlock {
+  std::array<double, kBlockTriangles> ax, ay, az, bx, by, bz, cx, cy, cz;
+  size_t size = 0;
+};
+
+// Terms of every triangle of a block. Each triangle spans a tetrahedron with the reference
+// point, whose signed volume is a . (b x c) / 6. The loop has no branches or calls besides
+// sqrt, so it compiles to vector instructions.
+void blockTerms(const TriangleBlock& block, BlockTerms& terms) {
+  for (size_t i = 0; i < block.size; ++i) {
+    const double ax = block.ax[i], ay = block.ay[i], az = block.az[i];
+    const double bx = block.bx[i], by = block.by[i], bz = block.bz[i];
+    const double cx = block.cx[i], cy = block.cy[i], cz = block.cz[i];
+
+    // Twice the vector area
+    const double ux = bx - ax, uy = by - ay, uz = bz - az;
+    const double vx = cx - ax, vy = cy - ay, vz = cz - az;
+    const double nx = uy * vz - uz * vy;
+    const double ny = uz * vx - ux * vz;
+    const double nz = ux * vy - uy * vx;
+    const double area = 0.5 * std::sqrt(nx * nx + ny * ny + nz * nz);
+
+    const double det = ax * (by * cz - bz * cy) + ay * (bz * cx - bx * cz) +
+                       az * (bx * cy - by * cx);
+    const double sx = ax + bx + cx, sy = ay + by + cy, sz = az + bz + cz;
+
+    terms[kArea][i] = area;
+    terms[kVolume][i] = det / 6.0;
+    terms[kAreaMomentX][i] = area * sx / 3.0;
+    terms[kAreaMomentY][i] = area * sy / 3.0;
+    terms[kAreaMomentZ][i] = area * sz / 3.0;
+    terms[kVolumeMomentX][i] = det * sx / 24.0;
+    terms[kVolumeMomentY][i] = det * sy / 24.0;
+    terms[kVolumeMomentZ][i] = det * sz / 24.0;
+
+    // Second moments of a tetrahedron with a corner at the origin:
+    // V / 20 * (a a^T + b b^T + c c^T + s s^T), with s = a + b + c
+    const double k = det / 120.0;
+    terms[kXX][i] = k * (ax * ax + bx * bx + cx * cx + sx * sx);
+    terms[kYY][i] = k * (ay * ay + by * by + cy * cy + sy * sy);
+    terms[kZZ][i] = k * (az * az + bz * bz + cz * cz + sz * sz);
+    terms[kXY][i] = k * (ax * ay + bx * by + cx * cy + sx * sy);
+    terms[kYZ][i] = k * (ay * az + by * bz + cy * cz + sy * sz);
+    terms[kZX][i] = k * (az * ax + bz * bx + cz * cx + sz * sx);
+  }
+}
+
+void addBlock(const TriangleBlock& block, bool compensated, Sums& sums) {
+  BlockTerms terms;
+  blockTerms(block, terms);
+  for (size_t t = 0; t < kTermCount; ++t) {
+    const auto& values = terms[t];
+    if (compensated) {
+      for (size_t i = 0; i < block.size; ++i) {
+        compensatedAdd(sums.sum[t], sums.carry[t], values[i]);
+      }
+    } else {
+      double total = 0.0;
+      for (size_t i = 0; i < block.size; ++i) {
+        total += values[i];
+      }
+      sums.sum[t] += total;
+    }
+  }
+}
+
+// Reduces the fan triangles of every face. `faceSize(f)` is the vertex count of face f and
+// `corner(f, k)` its k-th vertex, so dense and CSR faces share the kernel.
+template <typename DerivedV, typename FaceSize, typename Corner>
+MassProperties reduceMassProperties(const Eigen::MatrixBase<DerivedV>& V,
+                                    Eigen::Index faceCount,
+                                    FaceSize faceSize,
+                                    Corner corner,
+                                    MassSummation summation) {
+  MassProperties result;
+  if (V.rows() == 0 || faceCount <= 0) {
+    return result;
+  }
+
+  const Vector3d origin = V.row(0).transpose();
+  const bool compensated = summation == MassSummation::Compensated;
+  const Sums total = parallelReduce(
+      size_t{0}, static_cast<size_t>(faceCount), Sums{},
+      [&](size_t first, size_t last) {
+        Sums sums;
+        TriangleBlock block;
+        auto put = [&](size_t i, Eigen::Index v, std::array<double, kBlockTriangles>& x,
+                       std::array<double, kBlockTriangles>& y,
+                       std::array<double, kBlockTriangles>& z) {
+          x[i] = V(v, 0) - origin.x();
+          y[i] = V(v, 1) - origin.y();
+          z[i] = V(v, 2) - origin.z();
+        };
+
+        for (auto f = static_cast<Eigen::Index>(first); f < static_cast<Eigen::Index>(last);
+             ++f) {
+          const Eigen::Index a = corner(f, 0);
+          for (Eigen::Index k = 2; k < faceSize(f); ++k) {
+            if (block.size == kBlockTriangles) {
+              addBlock(block, compensated, sums);
+              block.size = 0;
+            }
+            const size_t i = block.size++;
+            put(i, a, block.ax, block.ay, block.az);
+            put(i, corner(f, k - 1), block.bx, block.by, block.bz);
+            put(i, corner(f, k), block.cx, block.cy, block.cz);
+          }
+        }
+        addBlock(block, compensated, sums);
+        return sums;
+      },
+      [compensated](Sums a, const Sums& b) {
+        for (size_t t = 0; t < kTermCount; ++t) {
+          if (compensated) {
+            compensatedAdd(a.sum[t], a.carry[t], b.sum[t]);
+            a.carry[t] += b.carry[t];
+          } else {
+            a.sum[t] += b.sum[t];
+          }
+        }
+        return a;
+      },
+      summation == MassSummation::Fast ? Reduction::Fast : Reduction::Deterministic, kFaceGrain);
+
+  std::array<double, kTermCount> s;
+  for (size_t t = 0; t < kTermCount; ++t) {
+    s[t] = total.sum[t] + total.carry[t];
+  }
+
+  result.area = s[kArea];
+  result.volume = s[kVolume];
+  if (result.area > 0) {
+    result.areaCentroid =
+        origin + Vector3d(s[kAreaMomentX], s[kAreaMomentY], s[kAreaMomentZ]) / result.area;
+  }
+
+  // Volume centroid relative to the reference point
+  Vector3d center = Vector3d::Zero();
+  if (result.volume != 0) {
+    center = Vector3d(s[kVolumeMomentX], s[kVolumeMomentY], s[kVolumeMomentZ]) / result.volume;
+    result.volumeCentroid = origin + center;
+  } else {
+    result.volumeCentroid = result.areaCentroid;
+  }
+
+  // Second moments about the reference point, moved to the centroid (parallel axis theorem)
+  Eigen::Matrix3d second;
+  second << s[kXX], s[kXY], s[kZX],  //
+      s[kXY], s[kYY], s[kYZ],        //
+      s[kZX], s[kYZ], s[kZZ];
+  second -= result.volume * center * center.transpose();
+  result.inertia = second.trace() * Eigen::Matrix3d::Identity() - second;
+  return result;
+}
+
+template <typename DerivedV, typename DerivedF>
+MassProperties meshMassProperties(const Eigen::MatrixBase<DerivedV>& V,
+                                  const Eigen::MatrixBase<DerivedF>& F,
+                                  MassSummation summation) {
+  return reduceMassProperties(
+      V, F.rows(), [&](Eigen::Index) { return F.cols(); },
+      [&](Eigen::Index face, Eigen::Index k) { return F(face, k); }, summation);
+}
+
+template <typename DerivedV, typename DerivedO, typename DerivedI>
+MassProperties polygonMassProperties(const Eigen::MatrixBase<DerivedV>& V,
+                                     const Eigen::MatrixBase<DerivedO>& offsets,
+                                     const Eigen::MatrixBase<DerivedI>& indices,
+                                     MassSummation summation) {
+  return reduceMassProperties(
+      V, offsets.size() - 1, [&](Eigen::Index face) { return offsets(face + 1) - offsets(face); },
+      [&](Eigen::Index face, Eigen::Index k) { return indices(offsets(face) + k); }, summation);
+}
+}  // namespace
+
+bool isValidMassSummation(int32_t summation) {
+  return summation >= static_cast<int32_t>(MassSummation::Fast) &&
+         summation <= static_cast<int32_t>(MassSummation::Compensated);
+}
+
+MassProperties massProperties(const Mesh& mesh, MassSummation summation) {
+  return mesh.isPolygonMesh()
+             ? polygonMassProperties(mesh.V, mesh.faceOffsets, mesh.faceIndices, summation)
+             : meshMassProperties(mesh.V, mesh.F, summation);
+}
+
+MassProperties massProperties(const MeshView& view, MassSummation summation) {
+  return view.isPolygonMesh()
+             ? polygonMassProperties(view.V, view.faceOffsets, view.faceIndices, summation)
+             : meshMassProperties(view.V, view.F, summation);
+}
+}  // namespace GeoSharPlusCPP
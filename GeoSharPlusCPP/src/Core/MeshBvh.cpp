@@ -0,0 +1,648 @@
+#include "GeoSharPlusCPP/Core/MeshBvh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+#include "GeoSharPlusCPP/Core/Parallel.h"
+
+namespace GeoSharPlusCPP {
+namespace {
+constexpr int kBinCount = 16;
+
+// Ranges of at most kLeafSize triangles always become leaves, ranges of up to kMaxLeafSize when
+// no split is cheaper (SAH, with a traversal step costing as much as one triangle test)
+constexpr size_t kLeafSize = 4;
+constexpr size_t kMaxLeafSize = 8;
+
+// Below this depth, nodes are split at the median instead, so the depth (and the traversal
+// stack) stays below kSahDepth + 32 for any input
+constexpr int kSahDepth = 32;
+constexpr int kStackSize = kSahDepth + 40;
+
+// Subtrees of more triangles are built concurrently; ranges of more than kBinGrain triangles
+// are binned in parallel chunks
+constexpr size_t kParallelBuildSize = size_t{1} << 14;
+constexpr size_t kBinGrain = size_t{1} << 14;
+
+constexpr double kInfinity = std::numeric_limits<double>::infinity();
+
+// Squared search limit for a distance limit, padded so rounding never prunes a triangle that
+// is within the limit; candidates are then checked against the unsquared limit
+double searchLimit2(double distance) {
+  return distance * distance * (1.0 + 8 * std::numeric_limits<double>::epsilon());
+}
+
+struct Box {
+  Vector3d min = Vector3d::Constant(kInfinity);
+  Vector3d max = Vector3d::Constant(-kInfinity);
+
+  void grow(const Vector3d& p) {
+    min = min.cwiseMin(p);
+    max = max.cwiseMax(p);
+  }
+  void grow(const Box& box) {
+    min = min.cwiseMin(box.min);
+    max = max.cwiseMax(box.max);
+  }
+  [[nodiscard]] double halfArea() const {
+    const Vector3d d = (max - min).cwiseMax(0.0);
+    return d.x() * d.y() + d.y() * d.z() + d.z() * d.x();
+  }
+};
+
+// Build input of one triangle; partitioned in place, so every range is contiguous
+struct PrimRef {
+  Box box;
+  Vector3d centroid;
+  uint32_t triangle;
+};
+
+// Bounds of a range: of the triangles, and of their centroids (which decide the splits)
+struct RangeBounds {
+  Box box;
+  Box centroids;
+};
+
+struct Bins {
+  std::array<std::array<Box, kBinCount>, 3> boxes;
+  std::array<std::array<uint32_t, kBinCount>, 3> counts{};
+};
+
+// Closest point of triangle abc to p, with its barycentric weights (Ericson, Real-Time
+// Collision Detection, 5.1.5). Weights are exactly 0 outside the closest feature, which the
+// signed queries rely on.
+std::pair<Vector3d, Vector3d> closestOnTriangle(const Vector3d& p,
+                                                const Vector3d& a,
+                                                const Vector3d& b,
+                                                const Vector3d& c) {
+  const Vector3d ab = b - a;
+  const Vector3d ac = c - a;
+  const Vector3d ap = p - a;
+  const double d1 = ab.dot(ap);
+  const double d2 = ac.dot(ap);
+  if (d1 <= 0.0 && d2 <= 0.0) {
+    return {a, Vector3d(1, 0, 0)};
+  }
+  const Vector3d bp = p - b;
+  const double d3 = ab.dot(bp);
+  const double d4 = ac.dot(bp);
+  if (d3 >= 0.0 && d4 <= d3) {
+    return {b, Vector3d(0, 1, 0)};
+  }
+  const double vc = d1 * d4 - d3 * d2;
+  if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) {
+    const double v = d1 / (d1 - d3);
+    return {a + v * ab, Vector3d(1 - v, v, 0)};
+  }
+  const Vector3d cp = p - c;
+  const double d5 = ab.dot(cp);
+  const double d6 = ac.dot(cp);
+  if (d6 >= 0.0 && d5 <= d6) {
+    return {c, Vector3d(0, 0, 1)};
+  }
+  const double vb = d5 * d2 - d1 * d6;
+  if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) {
+    const double w = d2 / (d2 - d6);
+    return {a + w * ac, Vector3d(1 - w, 0, w)};
+  }
+  const double va = d3 * d6 - d5 * d4;
+  if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0) {
+    const double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+    return {b + w * (c - b), Vector3d(0, 1 - w, w)};
+  }
+  const double sum = va + vb + vc;
+  if (!(sum > 0.0)) {
+    // Degenerate (collinear) triangle that no region test caught: nearest of its corners
+    const double da = (p - a).squaredNorm();
+    const double db = (p - b).squaredNorm();
+    const double dc = (p - c).squaredNorm();
+    if (da <= db && da <= dc) {
+      return {a, Vector3d(1, 0, 0)};
+    }
+    return db <= dc ? std::pair{b, Vector3d(0, 1, 0)} : std::pair{c, Vector3d(0, 0, 1)};
+  }
+  const double v = vb / sum;
+  const double w = vc / sum;
+  return {a + ab * v + ac * w, Vector3d(1 - v - w, v, w)};
+}
+// Spreads the low 21 bits of `v` to every third bit, for 63-bit Morton keys
+uint64_t spreadBits(uint64_t v) {
+  v &= 0x1fffff;
+  v = (v | v << 32) & 0x1f00000000ffff;
+  v = (v | v << 16) & 0x1f0000ff0000ff;
+  v = (v | v << 8) & 0x100f00f00f00f00f;
+  v = (v | v << 4) & 0x10c30c30c30c30c3;
+  v = (v | v << 2) & 0x1249249249249249;
+  return v;
+}
+
+// parallelReduce for large ranges; small ones (most nodes) skip the thread pool round trip
+template <typename T, typename MapFn, typename CombineFn>
+T reduceRange(size_t begin, size_t end, MapFn&& map, CombineFn&& combine) {
+  if (end - begin <= kBinGrain) {
+    return map(begin, end);
+  }
+  return parallelReduce(begin, end, T{}, map, combine, Reduction::Fast, kBinGrain);
+}
+}  // namespace
+
+struct MeshBvh::Builder {
+  std::vector<PrimRef>& refs;
+
+  RangeBounds bounds(size_t begin, size_t end) const {
+    return reduceRange<RangeBounds>(
+        begin, end,
+        [&](size_t first, size_t last) {
+          RangeBounds result;
+          for (size_t i = first; i < last; ++i) {
+            const PrimRef& ref = refs[i];
+            result.box.grow(ref.box);
+            result.centroids.grow(ref.centroid);
+          }
+          return result;
+        },
+        [](RangeBounds a, const RangeBounds& b) {
+          a.box.grow(b.box);
+          a.centroids.grow(b.centroids);
+          return a;
+        });
+  }
+
+  // Splits refs[begin, end) and returns the start of the right half, or nothing for a leaf.
+  // `node` receives the bounds of the range.
+  std::optional<size_t> split(Node& node, size_t begin, size_t end, int depth) const {
+    const RangeBounds range = bounds(begin, end);
+    for (int k = 0; k < 3; ++k) {
+      node.min[k] = range.box.min[k];
+      node.max[k] = range.box.max[k];
+    }
+    const size_t count = end - begin;
+    if (count <= kLeafSize) {
+      return std::nullopt;
+    }
+
+    const Vector3d extent = range.centroids.max - range.centroids.min;
+    int axis = 0;
+    extent.maxCoeff(&axis);
+    // Median along the longest axis; equal centroids are simply divided in two
+    auto medianSplit = [&] {
+      const size_t mid = begin + count / 2;
+      std::nth_element(refs.begin() + begin, refs.begin() + mid, refs.begin() + end,
+                       [&](const PrimRef& a, const PrimRef& b) {
+                         return a.centroid[axis] < b.centroid[axis] ||
+                                (a.centroid[axis] == b.centroid[axis] && a.triangle < b.triangle);
+                       });
+      return mid;
+    };
+    if (depth >= kSahDepth || !(extent[axis] > 0.0)) {
+      return medianSplit();
+    }
+
+    // Binned SAH over the three axes
+    Vector3d scale;
+    for (int k = 0; k < 3; ++k) {
+      scale[k] = extent[k] > 0.0 ? kBinCount / extent[k] : 0.0;
+    }
+    auto binOf = [&](const Vector3d& centroid, int k) {
+      const auto bin = static_cast<int>((centroid[k] - range.centroids.min[k]) * scale[k]);
+      return std::clamp(bin, 0, kBinCount - 1);
+    };
+    const Bins bins = reduceRange<Bins>(
+        begin, end,
+        [&](size_t first, size_t last) {
+          Bins result;
+          for (size_t i = first; i < last; ++i) {
+            const PrimRef& ref = refs[i];
+            const Vector3d offset = ref.centroid - range.centroids.min;
+            const Eigen::Array3i bin =
+                (offset.array() * scale.array()).cast<int>().min(kBinCount - 1).max(0);
+            for (int k = 0; k < 3; ++k) {
+              result.boxes[k][bin[k]].grow(ref.box);
+              ++result.counts[k][bin[k]];
+            }
+          }
+          return result;
+        },
+        [](Bins a, const Bins& b) {
+          for (int k = 0; k < 3; ++k) {
+            for (int bin = 0; bin < kBinCount; ++bin) {
+              a.boxes[k][bin].grow(b.boxes[k][bin]);
+              a.counts[k][bin] += b.counts[k][bin];
+            }
+          }
+          return a;
+        });
+
+    double bestCost = kInfinity;
+    int bestAxis = -1;
+    int bestBin = 0;
+    for (int k = 0; k < 3; ++k) {
+      if (scale[k] == 0.0) {
+        continue;
+      }
+      // Sweep from the right for the right-hand costs, then from the left
+      std::array<double, kBinCount> rightCost{};
+      Box right;
+      size_t rightCount = 0;
+      for (int bin = kBinCount - 1; bin > 0; --bin) {
+        right.grow(bins.boxes[k][bin]);
+        rightCount += bins.counts[k][bin];
+        rightCost[bin] = static_cast<double>(rightCount) * right.halfArea();
+      }
+      Box left;
+      size_t leftCount = 0;
+      for (int bin = 1; bin < kBinCount; ++bin) {
+        left.grow(bins.boxes[k][bin - 1]);
+        leftCount += bins.counts[k][bin - 1];
+        const double cost = static_cast<double>(leftCount) * left.halfArea() + rightCost[bin];
+        if (leftCount > 0 && leftCount < count && cost < bestCost) {
+          bestCost = cost;
+          bestAxis = k;
+          bestBin = bin;
+        }
+      }
+    }
+    const double area = range.box.halfArea();
+    if (count <= kMaxLeafSize &&
+        (bestAxis < 0 || (area > 0.0 && 1.0 + bestCost / area >= static_cast<double>(count)))) {
+      return std::nullopt;
+    }
+    if (bestAxis < 0) {
+      return medianSplit();
+    }
+
+    const auto mid =
+        std::partition(refs.begin() + begin, refs.begin() + end,
+                       [&](const PrimRef& ref) { return binOf(ref.centroid, bestAxis) < bestBin; });
+    return static_cast<size_t>(mid - refs.begin());
+  }
+
+  // Builds the subtree of refs[begin, end) below nodes[index], appending its nodes
+  void buildSerial(std::vector<Node>& nodes, size_t index, size_t begin, size_t end, int depth) {
+    Node node{};
+    const auto mid = split(node, begin, end, depth);
+    if (!mid) {
+      node.index = static_cast<uint32_t>(begin);
+      node.count = static_cast<uint32_t>(end - begin);
+      nodes[index] = node;
+      return;
+    }
+    const size_t left = nodes.size();
+    node.index = static_cast<uint32_t>(left);
+    node.count = 0;
+    nodes[index] = node;
+    nodes.resize(left + 2);
+    buildSerial(nodes, left, begin, *mid, depth + 1);
+    buildSerial(nodes, left + 1, *mid, end, depth + 1);
+  }
+
+  // Subtree of refs[begin, end) with its root at 0; large halves are built concurrently
+  std::vector<Node> build(size_t begin, size_t end, int depth) {
+    std::vector<Node> nodes(1);
+    if (end - begin <= kParallelBuildSize) {
+      buildSerial(nodes, 0, begin, end, depth);
+      return nodes;
+    }
+
+    const auto mid = split(nodes[0], begin, end, depth);
+    std::array<std::vector<Node>, 2> children;
+    parallelForChunks(0, 2, 1, [&](size_t i, size_t) {
+      children[i] = i == 0 ? build(begin, *mid, depth + 1) : build(*mid, end, depth + 1);
+    });
+
+    // [root, left root, right root, rest of left, rest of right]; child indices shift with
+    // their subtree
+    const size_t leftSize = children[0].size();
+    nodes.reserve(leftSize + children[1].size() + 1);
+    nodes[0].index = 1;
+    nodes[0].count = 0;
+    nodes.resize(3);
+    for (size_t side = 0; side < 2; ++side) {
+      const size_t shift = side == 0 ? 2 : leftSize + 1;
+      for (size_t j = 0; j < children[side].size(); ++j) {
+        Node node = children[side][j];
+        if (node.count == 0) {
+          node.index += static_cast<uint32_t>(shift);
+        }
+        if (j == 0) {
+          nodes[1 + side] = node;
+        } else {
+          nodes.push_back(node);
+        }
+      }
+    }
+    return nodes;
+  }
+};
+
+MeshBvh::MeshBvh(const Mesh& mesh) : vertexCount_(mesh.V.rows()) {
+  // Fan triangles of every face
+  std::vector<int> triangleFaces;
+  std::vector<std::array<int, 3>> triangleVertices;
+  auto addFan = [&](int face, Eigen::Index size, auto&& corner) {
+    for (Eigen::Index k = 1; k + 1 < size; ++k) {
+      triangleFaces.push_back(face);
+      triangleVertices.push_back({corner(0), corner(k), corner(k + 1)});
+    }
+  };
+  const Eigen::Index faceCount = mesh.faceCount();
+  if (mesh.isPolygonMesh()) {
+    triangleFaces.reserve(static_cast<size_t>(mesh.faceIndices.size()));
+    triangleVertices.reserve(static_cast<size_t>(mesh.faceIndices.size()));
+    for (Eigen::Index f = 0; f < faceCount; ++f) {
+      const int offset = mesh.faceOffsets(f);
+      addFan(static_cast<int>(f), mesh.faceOffsets(f + 1) - offset,
+             [&](Eigen::Index k) { return mesh.faceIndices(offset + k); });
+    }
+  } else {
+    const auto perFace = static_cast<size_t>(std::max<Eigen::Index>(mesh.F.cols() - 2, 0));
+    triangleFaces.reserve(static_cast<size_t>(faceCount) * perFace);
+    triangleVertices.reserve(static_cast<size_t>(faceCount) * perFace);
+    for (Eigen::Index f = 0; f < faceCount; ++f) {
+      addFan(static_cast<int>(f), mesh.F.cols(), [&](Eigen::Index k) { return mesh.F(f, k); });
+    }
+  }
+
+  const size_t count = triangleFaces.size();
+  if (count == 0) {
+    return;
+  }
+  std::vector<PrimRef> refs(count);
+  parallelFor(
+      0, count,
+      [&](size_t t) {
+        PrimRef& ref = refs[t];
+        for (int v : triangleVertices[t]) {
+          ref.box.grow(mesh.V.row(v).transpose());
+        }
+        ref.centroid = (ref.box.min + ref.box.max) / 2;
+        ref.triangle = static_cast<uint32_t>(t);
+      },
+      kBinGrain);
+
+  Builder builder{refs};
+  nodes_ = builder.build(0, count, 0);
+
+  // Triangles in leaf order
+  triangles_.resize(count);
+  faces_.resize(count);
+  vertices_.resize(count);
+  parallelFor(
+      0, count,
+      [&](size_t i) {
+        const uint32_t t = refs[i].triangle;
+        const auto& v = triangleVertices[t];
+        triangles_[i] = {mesh.V.row(v[0]).transpose(), mesh.V.row(v[1]).transpose(),
+                         mesh.V.row(v[2]).transpose()};
+        faces_[i] = triangleFaces[t];
+        vertices_[i] = v;
+      },
+      kBinGrain);
+}
+
+std::vector<uint32_t> queryOrder(const Eigen::Ref<const MatrixX3d>& points) {
+  const auto count = static_cast<size_t>(points.rows());
+  std::vector<std::pair<uint64_t, uint32_t>> keys(count);
+  if (count > 0) {
+    constexpr double kCells = (1 << 21) - 1;
+    const Vector3d min = points.colwise().minCoeff().transpose();
+    const Vector3d extent = points.colwise().maxCoeff().transpose() - min;
+    Vector3d scale;
+    for (int k = 0; k < 3; ++k) {
+      scale[k] = extent[k] > 0.0 && extent[k] < kInfinity ? kCells / extent[k] : 0.0;
+    }
+    parallelFor(
+        0, count,
+        [&](size_t i) {
+          uint64_t key = 0;
+          for (int k = 0; k < 3; ++k) {
+            // NaN and infinite coordinates land in the first or last cell
+            const double cell = (points(static_cast<Eigen::Index>(i), k) - min[k]) * scale[k];
+            key |= spreadBits(cell > 0.0 ? static_cast<uint64_t>(std::min(cell, kCells)) : 0) << k;
+          }
+          keys[i] = {key, static_cast<uint32_t>(i)};
+        },
+        kBinGrain);
+    std::sort(keys.begin(), keys.end());
+  }
+
+  std::vector<uint32_t> order(count);
+  for (size_t i = 0; i < count; ++i) {
+    order[i] = keys[i].second;
+  }
+  return order;
+}
+
+size_t MeshBvh::memoryBytes() const noexcept {
+  return nodes_.size() * sizeof(Node) + triangles_.size() * sizeof(Triangle) +
+         faces_.size() * sizeof(int) + vertices_.size() * sizeof(std::array<int, 3>);
+}
+
+// Visits the triangles of the leaves within sqrt(limit2) of `point`, nearest leaf first.
+// visit(triangle, limit2) returns the new limit, which prunes the rest of the traversal.
+template <typename Visit>
+void MeshBvh::traverse(const Vector3d& point, double limit2, Visit&& visit) const {
+  if (nodes_.empty()) {
+    return;
+  }
+  auto distance2 = [&](const Node& node) {
+    double d2 = 0.0;
+    for (int k = 0; k < 3; ++k) {
+      const double d = std::max({node.min[k] - point[k], 0.0, point[k] - node.max[k]});
+      d2 += d * d;
+    }
+    return d2;
+  };
+
+  std::array<std::pair<uint32_t, double>, kStackSize> stack;
+  size_t top = 0;
+  uint32_t current = 0;
+  if (distance2(nodes_[0]) > limit2) {
+    return;
+  }
+  while (true) {
+    const Node& node = nodes_[current];
+    if (node.count > 0) {
+      for (uint32_t t = node.index; t < node.index + node.count; ++t) {
+        limit2 = visit(t, limit2);
+      }
+    } else {
+      uint32_t nearChild = node.index;
+      uint32_t farChild = node.index + 1;
+      double nearDistance = distance2(nodes_[nearChild]);
+      double farDistance = distance2(nodes_[farChild]);
+      if (farDistance < nearDistance) {
+        std::swap(nearChild, farChild);
+        std::swap(nearDistance, farDistance);
+      }
+      if (nearDistance <= limit2) {
+        if (farDistance <= limit2) {
+          stack[top++] = {farChild, farDistance};
+        }
+        current = nearChild;
+        continue;
+      }
+    }
+    // Next pending node still within the (possibly reduced) limit
+    do {
+      if (top == 0) {
+        return;
+      }
+      --top;
+    } while (stack[top].second > limit2);
+    current = stack[top].first;
+  }
+}
+
+MeshBvh::Hit MeshBvh::closestPoint(const Vector3d& point, double maxDistance) const {
+  uint32_t triangle = 0;
+  return nearest(point, maxDistance, triangle);
+}
+
+MeshBvh::Hit MeshBvh::nearest(const Vector3d& point, double maxDistance, uint32_t& triangle) const {
+  Hit hit;
+  if (!(maxDistance >= 0.0)) {
+    return hit;
+  }
+  bool found = false;
+  traverse(point, searchLimit2(maxDistance), [&](uint32_t t, double limit2) {
+    const Triangle& tri = triangles_[t];
+    const auto [closest, weights] = closestOnTriangle(point, tri.a, tri.b, tri.c);
+    const double d2 = (point - closest).squaredNorm();
+    // Within the limit the first time; strictly closer afterwards, so ties keep the first
+    if (found ? d2 < limit2 : std::sqrt(d2) <= maxDistance) {
+      found = true;
+      triangle = t;
+      hit.point = closest;
+      hit.barycentric = weights;
+      hit.distance = d2;
+      return d2;
+    }
+    return limit2;
+  });
+  if (found) {
+    hit.face = faces_[triangle];
+    hit.vertices = vertices_[triangle];
+    hit.distance = std::sqrt(hit.distance);
+  }
+  return hit;
+}
+
+MeshBvh::Hit MeshBvh::signedClosestPoint(const Vector3d& point, double maxDistance) const {
+  uint32_t triangle = 0;
+  Hit hit = nearest(point, maxDistance, triangle);
+  if (hit.face < 0 || hit.distance == 0.0) {
+    return hit;
+  }
+
+  // Pseudo-normal of the feature the point is closest to: a corner (two zero weights), an
+  // edge (one, opposite the edge) or the face itself
+  const PseudoNormals& normals = pseudoNormals();
+  const Vector3d& w = hit.barycentric;
+  const int zeros = (w[0] == 0.0) + (w[1] == 0.0) + (w[2] == 0.0);
+  Vector3d normal;
+  if (zeros == 2) {
+    const int corner = w[0] != 0.0 ? 0 : (w[1] != 0.0 ? 1 : 2);
+    normal = normals.vertices[static_cast<size_t>(hit.vertices[static_cast<size_t>(corner)])];
+  } else if (zeros == 1) {
+    // Edges ab, bc, ca are opposite corners c, a, b
+    const int edge = w[2] == 0.0 ? 1 : (w[0] == 0.0 ? 2 : 3);
+    normal = normals.triangles[triangle][static_cast<size_t>(edge)];
+  } else {
+    normal = normals.triangles[triangle][0];
+  }
+  if ((point - hit.point).dot(normal) < 0.0) {
+    hit.distance = -hit.distance;
+  }
+  return hit;
+}
+
+const MeshBvh::PseudoNormals& MeshBvh::pseudoNormals() const {
+  std::call_once(normalsOnce_, [&] {
+    PseudoNormals result;
+    const size_t count = triangles_.size();
+    result.triangles.resize(count);
+    parallelFor(
+        0, count,
+        [&](size_t t) {
+          const Triangle& tri = triangles_[t];
+          const Vector3d n = (tri.b - tri.a).cross(tri.c - tri.a);
+          const double length = n.norm();
+          result.triangles[t][0] = length > 0.0 ? Vector3d(n / length) : Vector3d::Zero();
+        },
+        kBinGrain);
+
+    // Vertices: face normals weighted by the corner angle (Baerentzen and Aanaes)
+    result.vertices.assign(static_cast<size_t>(vertexCount_), Vector3d::Zero());
+    for (size_t t = 0; t < count; ++t) {
+      const Triangle& tri = triangles_[t];
+      const std::array<const Vector3d*, 3> p{&tri.a, &tri.b, &tri.c};
+      for (size_t k = 0; k < 3; ++k) {
+        const Vector3d u = *p[(k + 1) % 3] - *p[k];
+        const Vector3d v = *p[(k + 2) % 3] - *p[k];
+        const double angle = std::atan2(u.cross(v).norm(), u.dot(v));
+        result.vertices[static_cast<size_t>(vertices_[t][k])] += angle * result.triangles[t][0];
+      }
+    }
+
+    // Edges: the sum of the normals of their triangles, matched through their vertex pair
+    struct EdgeRef {
+      uint64_t key;
+      uint32_t slot;  // 3 * triangle + edge
+    };
+    std::vector<EdgeRef> edges(3 * count);
+    for (size_t t = 0; t < count; ++t) {
+      for (size_t k = 0; k < 3; ++k) {
+        const auto a = static_cast<uint32_t>(vertices_[t][k]);
+        const auto b = static_cast<uint32_t>(vertices_[t][(k + 1) % 3]);
+        edges[3 * t + k] = {(static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b),
+                            static_cast<uint32_t>(3 * t + k)};
+      }
+    }
+    std::sort(edges.begin(), edges.end(), [](const EdgeRef& x, const EdgeRef& y) {
+      return x.key < y.key || (x.key == y.key && x.slot < y.slot);
+    });
+    for (size_t first = 0; first < edges.size();) {
+      size_t last = first;
+      Vector3d sum = Vector3d::Zero();
+      for (; last < edges.size() && edges[last].key == edges[first].key; ++last) {
+        sum += result.triangles[edges[last].slot / 3][0];
+      }
+      for (size_t e = first; e < last; ++e) {
+        result.triangles[edges[e].slot / 3][1 + edges[e].slot % 3] = sum;
+      }
+      first = last;
+    }
+    normals_ = std::move(result);
+  });
+  return normals_;
+}
+
+void MeshBvh::facesWithin(const Vector3d& point,
+                          double radius,
+                          std::vector<std::pair<int, double>>& faces) const {
+  if (!(radius >= 0.0)) {
+    return;
+  }
+  const size_t first = faces.size();
+  traverse(point, searchLimit2(radius), [&](uint32_t t, double limit2) {
+    const Triangle& tri = triangles_[t];
+    const double d = (point - closestOnTriangle(point, tri.a, tri.b, tri.c).first).norm();
+    if (d <= radius) {
+      faces.emplace_back(faces_[t], d);
+    }
+    return limit2;
+  });
+
+  // One entry per face (fan triangles of a polygon share it), at its nearest triangle
+  const auto begin = faces.begin() + static_cast<std::ptrdiff_t>(first);
+  std::sort(begin, faces.end());
+  faces.erase(std::unique(begin, faces.end(),
+                          [](const auto& a, const auto& b) { return a.first == b.first; }),
+              faces.end());
+  std::sort(begin, faces.end(), [](const auto& a, const auto& b) {
+    return a.second < b.second || (a.second == b.second && a.first < b.first);
+  });
+}
+}  // namespace GeoSharPlusCPP
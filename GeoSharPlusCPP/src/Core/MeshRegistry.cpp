@@ -0,0 +1,138 @@
+#include "GeoSharPlusCPP/Core/MeshRegistry.h"
+
+#include "GeoSharPlusCPP/Core/BoundingBox.h"
+#include "GeoSharPlusCPP/Core/MeshBvh.h"
+
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <utility>
+
+namespace GeoSharPlusCPP {
+namespace {
+// Built by the first query that needs it, outside the registry lock; later queries wait on
+// the flag instead of building their own
+struct LazyBvh {
+  std::once_flag once;
+  std::shared_ptr<const MeshBvh> tree;
+};
+
+struct Entry {
+  std::shared_ptr<const Mesh> mesh;
+  std::shared_ptr<LazyBvh> bvh;
+  std::pair<Vector3d, Vector3d> bounds;
+  size_t bytes = 0;  // Mesh and index
+};
+
+struct Registry {
+  std::mutex mutex;
+  std::unordered_map<MeshHandle, Entry> entries;
+  MeshHandle nextHandle = 1;
+  size_t residentBytes = 0;
+};
+
+// Function-local, so exports called during static initialization of the host still work
+Registry& registry() {
+  static Registry instance;
+  return instance;
+}
+}  // namespace
+
+MeshHandle registerMesh(Mesh&& mesh) {
+  try {
+    Entry entry;
+    entry.bytes = mesh.memoryBytes();
+    entry.bounds = alignedBounds(mesh.V);
+    entry.mesh = std::make_shared<const Mesh>(std::move(mesh));
+    entry.bvh = std::make_shared<LazyBvh>();
+
+    auto& r = registry();
+    std::lock_guard lock(r.mutex);
+    const MeshHandle handle = r.nextHandle++;
+    r.residentBytes += entry.bytes;
+    r.entries.emplace(handle, std::move(entry));
+    return handle;
+  } catch (const std::bad_alloc&) {
+    return 0;
+  }
+}
+
+std::shared_ptr<const Mesh> findMesh(MeshHandle handle) {
+  auto& r = registry();
+  std::lock_guard lock(r.mutex);
+  auto it = r.entries.find(handle);
+  return it != r.entries.end() ? it->second.mesh : nullptr;
+}
+
+std::shared_ptr<const Mesh> findMesh(MeshHandle handle, std::pair<Vector3d, Vector3d>& bounds) {
+  auto& r = registry();
+  std::lock_guard lock(r.mutex);
+  auto it = r.entries.find(handle);
+  if (it == r.entries.end()) {
+    return nullptr;
+  }
+  bounds = it->second.bounds;
+  return it->second.mesh;
+}
+
+std::shared_ptr<const MeshBvh> findMeshBvh(MeshHandle handle) {
+  std::shared_ptr<const Mesh> mesh;
+  std::shared_ptr<LazyBvh> lazy;
+  auto& r = registry();
+  {
+    std::lock_guard lock(r.mutex);
+    auto it = r.entries.find(handle);
+    if (it == r.entries.end()) {
+      return nullptr;
+    }
+    mesh = it->second.mesh;
+    lazy = it->second.bvh;
+  }
+
+  try {
+    std::call_once(lazy->once, [&] {
+      if (!mesh->validate()) {
+        return;  // Stays null: resident meshes never change
+      }
+      lazy->tree = std::make_shared<const MeshBvh>(*mesh);
+
+      // Unless the handle was released meanwhile, the index now counts as resident
+      const size_t bytes = lazy->tree->memoryBytes();
+      std::lock_guard lock(r.mutex);
+      auto it = r.entries.find(handle);
+      if (it != r.entries.end() && it->second.bvh == lazy) {
+        it->second.bytes += bytes;
+        r.residentBytes += bytes;
+      }
+    });
+  } catch (const std::bad_alloc&) {
+    return nullptr;  // The flag stays unset, so a later query tries again
+  }
+  return lazy->tree;
+}
+
+bool releaseMesh(MeshHandle handle) {
+  // The mesh and its index are destroyed outside the lock, once the last holder lets go
+  std::shared_ptr<const Mesh> released;
+  std::shared_ptr<LazyBvh> releasedBvh;
+  {
+    auto& r = registry();
+    std::lock_guard lock(r.mutex);
+    auto it = r.entries.find(handle);
+    if (it == r.entries.end()) {
+      return false;
+    }
+    r.residentBytes -= it->second.bytes;
+    released = std::move(it->second.mesh);
+    releasedBvh = std::move(it->second.bvh);
+    r.entries.erase(it);
+  }
+  return true;
+}
+
+MeshRegistryStats meshRegistryStats() {
+  auto& r = registry();
+  std::lock_guard lock(r.mutex);
+  return {r.entries.size(), r.residentBytes};
+}
+}  // namespace GeoSharPlusCPP
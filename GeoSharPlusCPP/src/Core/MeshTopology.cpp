@@ -0,0 +1,603 @@
+#include "GeoSharPlusCPP/Core/MeshTopology.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <variant>
+
+#include "GeoSharPlusCPP/Core/Parallel.h"
+
+namespace GeoSharPlusCPP {
+namespace {
+// Faces per parallel chunk
+constexpr size_t kFaceGrain = 16384;
+
+// Hash buckets of the edge and face tables; a bucket is grouped by one thread, so there are
+// many more buckets than threads
+constexpr size_t kBucketBits = 10;
+constexpr size_t kBucketCount = size_t{1} << kBucketBits;
+
+// Buckets per parallel chunk when grouping
+constexpr size_t kBucketGrain = 8;
+
+// A face is degenerate when twice its area is below this fraction of its longest edge squared
+constexpr double kAreaTolerance = 1e-12;
+
+// Corners are the (face, vertex) slots of the face lists, numbered in face order
+constexpr uint32_t kNone = std::numeric_limits<uint32_t>::max();
+
+// Uniform faces of a dense F (tri or quad meshes)
+template <typename DerivedF>
+struct DenseFaces {
+  const Eigen::MatrixBase<DerivedF>& F;
+
+  [[nodiscard]] Eigen::Index count() const { return F.rows(); }
+  [[nodiscard]] Eigen::Index size(Eigen::Index) const { return F.cols(); }
+  [[nodiscard]] size_t firstCorner(Eigen::Index face) const {
+    return static_cast<size_t>(face * F.cols());
+  }
+  [[nodiscard]] int vertex(Eigen::Index face, Eigen::Index k) const { return F(face, k); }
+};
+
+// Polygon faces in CSR form
+template <typename DerivedO, typename DerivedI>
+struct PolygonFaces {
+  const Eigen::MatrixBase<DerivedO>& offsets;
+  const Eigen::MatrixBase<DerivedI>& indices;
+
+  [[nodiscard]] Eigen::Index count() const { return offsets.size() - 1; }
+  [[nodiscard]] Eigen::Index size(Eigen::Index face) const {
+    return offsets(face + 1) - offsets(face);
+  }
+  [[nodiscard]] size_t firstCorner(Eigen::Index face) const {
+    return static_cast<size_t>(offsets(face));
+  }
+  [[nodiscard]] int vertex(Eigen::Index face, Eigen::Index k) const {
+    return indices(offsets(face) + k);
+  }
+};
+
+size_t bucketOf(uint64_t key) {
+  return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> (64 - kBucketBits));
+}
+
+// Records grouped by the bucket of their key: bucket b is records[offsets[b] .. offsets[b + 1])
+template <typename Record>
+struct Buckets {
+  std::vector<Record> records;
+  std::vector<size_t> offsets;
+};
+
+// Scatters the records of `itemCount` items into hash buckets in two parallel passes (count,
+// then write). emit(i, sink) calls sink(record) for every record of item i, and must emit the
+// same records both times. Positions only depend on the items, not on the thread count.
+template <typename Record, typename EmitFn>
+Buckets<Record> scatter(size_t itemCount, EmitFn&& emit) {
+  const size_t chunkCount = (itemCount + kFaceGrain - 1) / kFaceGrain;
+  std::vector<size_t> cursors(chunkCount * kBucketCount, 0);
+  parallelForChunks(0, itemCount, kFaceGrain, [&](size_t first, size_t last) {
+    size_t* counts = &cursors[first / kFaceGrain * kBucketCount];
+    for (size_t i = first; i < last; ++i) {
+      emit(i, [&](const Record& record) { ++counts[bucketOf(record.key)]; });
+    }
+  });
+
+  // Within a bucket, chunks write in order after each other
+  Buckets<Record> buckets;
+  buckets.offsets.resize(kBucketCount + 1);
+  size_t total = 0;
+  for (size_t b = 0; b < kBucketCount; ++b) {
+    buckets.offsets[b] = total;
+    for (size_t c = 0; c < chunkCount; ++c) {
+      const size_t count = cursors[c * kBucketCount + b];
+      cursors[c * kBucketCount + b] = total;
+      total += count;
+    }
+  }
+  buckets.offsets[kBucketCount] = total;
+
+  buckets.records.resize(total);
+  parallelForChunks(0, itemCount, kFaceGrain, [&](size_t first, size_t last) {
+    size_t* cursor = &cursors[first / kFaceGrain * kBucketCount];
+    for (size_t i = first; i < last; ++i) {
+      emit(i, [&](const Record& record) {
+        buckets.records[cursor[bucketOf(record.key)]++] = record;
+      });
+    }
+  });
+  return buckets;
+}
+
+// A face side between two corners of one face; key is the undirected edge (min << 32 | max)
+struct HalfEdge {
+  uint64_t key = 0;
+  uint32_t from = 0;  // Corners
+  uint32_t to = 0;
+  bool forward = false;  // From the smaller vertex to the larger one
+};
+
+uint64_t edgeKey(int a, int b) {
+  return (static_cast<uint64_t>(std::min(a, b)) << 32) | static_cast<uint32_t>(std::max(a, b));
+}
+
+std::pair<int, int> edgeVertices(uint64_t key) {
+  return {static_cast<int>(key >> 32), static_cast<int>(key & 0xFFFFFFFFu)};
+}
+
+// Every corner has two slots, one per face side at it: In (arriving) and Out (leaving). A
+// manifold edge links the slots of its two faces at each of its vertices, so the faces around
+// a vertex form a chain of links. Link values are 2 * corner + slot.
+constexpr uint32_t kIn = 0;
+constexpr uint32_t kOut = 1;
+
+// Slot of a half-edge at the smaller or larger vertex of its edge
+uint32_t slotAtMin(const HalfEdge& h) {
+  return h.forward ? 2 * h.from + kOut : 2 * h.to + kIn;
+}
+uint32_t slotAtMax(const HalfEdge& h) {
+  return h.forward ? 2 * h.to + kIn : 2 * h.from + kOut;
+}
+
+// Corners in the fan of `start`: around the vertex through the Out slots until the fan closes,
+// then, for an open fan, back from `start` through the In slots. Each slot is linked to at
+// most one other, so the walk ends; `limit` only guards against malformed links.
+size_t fanSize(const std::vector<uint32_t>& links, uint32_t start, size_t limit) {
+  size_t size = 1;
+  for (uint32_t slot = 2 * start + kOut; links[slot] != kNone && size <= limit;) {
+    const uint32_t target = links[slot];
+    if (target / 2 == start) {
+      return size;
+    }
+    ++size;
+    slot = target ^ 1;  // Leave through the other slot
+  }
+  for (uint32_t slot = 2 * start + kIn; links[slot] != kNone && size <= limit;) {
+    const uint32_t target = links[slot];
+    ++size;
+    slot = target ^ 1;
+  }
+  return size;
+}
+
+// Findings of one bucket of the edge table
+struct EdgeGroups {
+  size_t edgeCount = 0;
+  std::vector<std::pair<int, int>> boundary;  // Directed as the face runs them
+  std::vector<std::pair<int, int>> nonManifold;
+  std::vector<std::pair<int, int>> inconsistent;
+};
+
+void groupEdges(std::span<HalfEdge> halfEdges, std::vector<uint32_t>& links, EdgeGroups& groups) {
+  std::sort(halfEdges.begin(), halfEdges.end(), [](const HalfEdge& a, const HalfEdge& b) {
+    return a.key < b.key || (a.key == b.key && a.from < b.from);
+  });
+
+  for (size_t first = 0; first < halfEdges.size();) {
+    size_t last = first + 1;
+    while (last < halfEdges.size() && halfEdges[last].key == halfEdges[first].key) {
+      ++last;
+    }
+    ++groups.edgeCount;
+
+    const HalfEdge& h1 = halfEdges[first];
+    const auto [a, b] = edgeVertices(h1.key);
+    if (last - first == 1) {
+      groups.boundary.push_back(h1.forward ? std::pair{a, b} : std::pair{b, a});
+    } else if (last - first == 2) {
+      const HalfEdge& h2 = halfEdges[first + 1];
+      if (h1.forward == h2.forward) {
+        groups.inconsistent.emplace_back(a, b);
+      }
+      // The slots belong to these two half-edges alone, so buckets never write the same one
+      links[slotAtMin(h1)] = slotAtMin(h2);
+      links[slotAtMin(h2)] = slotAtMin(h1);
+      links[slotAtMax(h1)] = slotAtMax(h2);
+      links[slotAtMax(h2)] = slotAtMax(h1);
+    } else {
+      groups.nonManifold.emplace_back(a, b);
+    }
+    first = last;
+  }
+}
+
+// Boundary edges chained into loops; `edges` is sorted
+CsrIntArray boundaryLoops(const std::vector<std::pair<int, int>>& edges) {
+  CsrIntArray loops;
+  std::vector<char> used(edges.size(), 0);
+  std::vector<int> loop;
+  for (size_t e = 0; e < edges.size(); ++e) {
+    if (used[e]) {
+      continue;
+    }
+    // Edges are visited from the smallest vertex, so every loop starts at its smallest vertex
+    loop.clear();
+    size_t current = e;
+    while (true) {
+      used[current] = 1;
+      loop.push_back(edges[current].first);
+      const int next = edges[current].second;
+      if (next == edges[e].first) {
+        break;
+      }
+      // Any unused edge leaving `next`; there are several only at pinched boundaries
+      auto it = std::lower_bound(edges.begin(), edges.end(), std::pair{next, INT32_MIN});
+      while (it != edges.end() && it->first == next && used[it - edges.begin()]) {
+        ++it;
+      }
+      if (it == edges.end() || it->first != next) {
+        break;  // Open chain; only possible around non-manifold edges
+      }
+      current = static_cast<size_t>(it - edges.begin());
+    }
+    loops.push_back(loop);
+  }
+  return loops;
+}
+
+// Sorted vertex set of a face, for comparing faces in any order or orientation
+template <typename Faces>
+void sortedFace(const Faces& faces, Eigen::Index face, std::vector<int>& vertices) {
+  vertices.resize(static_cast<size_t>(faces.size(face)));
+  for (Eigen::Index k = 0; k < faces.size(face); ++k) {
+    vertices[static_cast<size_t>(k)] = faces.vertex(face, k);
+  }
+  std::sort(vertices.begin(), vertices.end());
+}
+
+uint64_t hashVertices(const std::vector<int>& vertices) {
+  uint64_t hash = vertices.size();
+  for (int v : vertices) {
+    hash ^= static_cast<uint32_t>(v) + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+  }
+  return hash;
+}
+
+struct FaceRecord {
+  uint64_t key = 0;
+  int face = 0;
+};
+
+template <typename Faces>
+std::vector<int> findDuplicateFaces(const Faces& faces) {
+  // emit runs on every worker thread at once, so each call sorts into a scratch of its own
+  auto buckets =
+      scatter<FaceRecord>(static_cast<size_t>(faces.count()), [&](size_t i, auto&& sink) {
+        const auto face = static_cast<Eigen::Index>(i);
+        std::vector<int> vertices;
+        sortedFace(faces, face, vertices);
+        sink(FaceRecord{hashVertices(vertices), static_cast<int>(face)});
+      });
+
+  std::vector<std::vector<int>> found(kBucketCount);
+  parallelForChunks(0, kBucketCount, kBucketGrain, [&](size_t firstBucket, size_t lastBucket) {
+    std::vector<int> a;
+    std::vector<int> b;
+    for (size_t bucket = firstBucket; bucket < lastBucket; ++bucket) {
+      const std::span<FaceRecord> records(buckets.records.data() + buckets.offsets[bucket],
+                                          buckets.offsets[bucket + 1] - buckets.offsets[bucket]);
+      std::sort(records.begin(), records.end(), [](const FaceRecord& x, const FaceRecord& y) {
+        return x.key < y.key || (x.key == y.key && x.face < y.face);
+      });
+      // A face is a duplicate if an earlier face of the same hash has the same vertex set
+      for (size_t i = 1; i < records.size(); ++i) {
+        for (size_t j = i; j-- > 0 && records[j].key == records[i].key;) {
+          sortedFace(faces, records[i].face, a);
+          sortedFace(faces, records[j].face, b);
+          if (a == b) {
+            found[bucket].push_back(records[i].face);
+            break;
+          }
+        }
+      }
+    }
+  });
+
+  std::vector<int> duplicates;
+  for (const auto& bucket : found) {
+    duplicates.insert(duplicates.end(), bucket.begin(), bucket.end());
+  }
+  std::sort(duplicates.begin(), duplicates.end());
+  return duplicates;
+}
+
+template <typename DerivedV, typename Faces>
+std::vector<int> findDegenerateFaces(const Eigen::MatrixBase<DerivedV>& V, const Faces& faces) {
+  return parallelReduce(
+      size_t{0}, static_cast<size_t>(faces.count()), std::vector<int>{},
+      [&](size_t first, size_t last) {
+        std::vector<int> degenerate;
+        for (auto f = static_cast<Eigen::Index>(first); f < static_cast<Eigen::Index>(last); ++f) {
+          const Eigen::Index n = faces.size(f);
+          bool repeated = false;
+          for (Eigen::Index i = 0; i < n && !repeated; ++i) {
+            for (Eigen::Index j = i + 1; j < n && !repeated; ++j) {
+              repeated = faces.vertex(f, i) == faces.vertex(f, j);
+            }
+          }
+
+          // Newell area, relative to the first corner to keep precision far from the origin
+          const Vector3d origin = V.row(faces.vertex(f, 0)).transpose();
+          Vector3d normal = Vector3d::Zero();
+          double longestEdge = 0.0;
+          for (Eigen::Index k = 0; k < n && !repeated; ++k) {
+            const Vector3d p = V.row(faces.vertex(f, k)).transpose() - origin;
+            const Vector3d q = V.row(faces.vertex(f, (k + 1) % n)).transpose() - origin;
+            normal += p.cross(q);
+            longestEdge = std::max(longestEdge, (q - p).squaredNorm());
+          }
+          if (repeated || normal.norm() <= kAreaTolerance * longestEdge) {
+            degenerate.push_back(static_cast<int>(f));
+          }
+        }
+        return degenerate;
+      },
+      [](std::vector<int> a, const std::vector<int>& b) {
+        a.insert(a.end(), b.begin(), b.end());
+        return a;
+      },
+      Reduction::Deterministic, kFaceGrain);
+}
+
+template <typename DerivedV, typename Faces>
+TopologyReport check(const Eigen::MatrixBase<DerivedV>& V, const Faces& faces) {
+  TopologyReport report;
+  report.vertexCount = V.rows();
+  report.faceCount = faces.count();
+  const auto faceCount = static_cast<size_t>(faces.count());
+  const size_t cornerCount = faceCount == 0 ? 0 : faces.firstCorner(faces.count() - 1) +
+                                                      static_cast<size_t>(
+                                                          faces.size(faces.count() - 1));
+
+  report.degenerateFaces = findDegenerateFaces(V, faces);
+  report.duplicateFaces = findDuplicateFaces(faces);
+
+  // Corners per vertex, and one corner of each to start its fan walk from
+  std::vector<std::atomic<uint32_t>> cornersAt(static_cast<size_t>(V.rows()));
+  std::vector<std::atomic<uint32_t>> firstCorner(static_cast<size_t>(V.rows()));
+  parallelFor(
+      0, faceCount,
+      [&](size_t i) {
+        const auto face = static_cast<Eigen::Index>(i);
+        for (Eigen::Index k = 0; k < faces.size(face); ++k) {
+          const auto v = static_cast<size_t>(faces.vertex(face, k));
+          const auto corner = static_cast<uint32_t>(faces.firstCorner(face) + k);
+          if (cornersAt[v].fetch_add(1, std::memory_order_relaxed) == 0) {
+            firstCorner[v].store(corner, std::memory_order_relaxed);
+          }
+        }
+      },
+      kFaceGrain);
+
+  // Edge table
+  auto halfEdges = scatter<HalfEdge>(faceCount, [&](size_t i, auto&& sink) {
+    const auto face = static_cast<Eigen::Index>(i);
+    const Eigen::Index n = faces.size(face);
+    const auto first = static_cast<uint32_t>(faces.firstCorner(face));
+    for (Eigen::Index k = 0; k < n; ++k) {
+      const Eigen::Index next = (k + 1) % n;
+      const int a = faces.vertex(face, k);
+      const int b = faces.vertex(face, next);
+      if (a != b) {
+        sink(HalfEdge{edgeKey(a, b), first + static_cast<uint32_t>(k),
+                      first + static_cast<uint32_t>(next), a < b});
+      }
+    }
+  });
+
+  std::vector<uint32_t> links(2 * cornerCount, kNone);
+  std::vector<EdgeGroups> groups(kBucketCount);
+  parallelForChunks(0, kBucketCount, kBucketGrain, [&](size_t first, size_t last) {
+    for (size_t bucket = first; bucket < last; ++bucket) {
+      groupEdges({halfEdges.records.data() + halfEdges.offsets[bucket],
+                  halfEdges.offsets[bucket + 1] - halfEdges.offsets[bucket]},
+                 links, groups[bucket]);
+    }
+  });
+
+  std::vector<std::pair<int, int>> boundary;
+  for (auto& group : groups) {
+    report.edgeCount += group.edgeCount;
+    boundary.insert(boundary.end(), group.boundary.begin(), group.boundary.end());
+    report.nonManifoldEdges.insert(report.nonManifoldEdges.end(), group.nonManifold.begin(),
+                                   group.nonManifold.end());
+    report.inconsistentEdges.insert(report.inconsistentEdges.end(), group.inconsistent.begin(),
+                                    group.inconsistent.end());
+  }
+  report.boundaryEdgeCount = boundary.size();
+  std::sort(boundary.begin(), boundary.end());
+  std::sort(report.nonManifoldEdges.begin(), report.nonManifoldEdges.end());
+  std::sort(report.inconsistentEdges.begin(), report.inconsistentEdges.end());
+  report.boundaryLoops = boundaryLoops(boundary);
+
+  // A vertex is manifold if one fan holds all its corners
+  struct VertexFindings {
+    std::vector<int> unreferenced;
+    std::vector<int> nonManifold;
+  };
+  auto vertices = parallelReduce(
+      size_t{0}, static_cast<size_t>(V.rows()), VertexFindings{},
+      [&](size_t first, size_t last) {
+        VertexFindings findings;
+        for (size_t v = first; v < last; ++v) {
+          const uint32_t corners = cornersAt[v].load(std::memory_order_relaxed);
+          if (corners == 0) {
+            findings.unreferenced.push_back(static_cast<int>(v));
+          } else if (corners > 1 &&
+                     fanSize(links, firstCorner[v].load(std::memory_order_relaxed), corners) !=
+                         corners) {
+            findings.nonManifold.push_back(static_cast<int>(v));
+          }
+        }
+        return findings;
+      },
+      [](VertexFindings a, const VertexFindings& b) {
+        a.unreferenced.insert(a.unreferenced.end(), b.unreferenced.begin(), b.unreferenced.end());
+        a.nonManifold.insert(a.nonManifold.end(), b.nonManifold.begin(), b.nonManifold.end());
+        return a;
+      },
+      Reduction::Deterministic, kFaceGrain);
+  report.unreferencedVertices = std::move(vertices.unreferenced);
+  report.nonManifoldVertices = std::move(vertices.nonManifold);
+  return report;
+}
+
+template <typename MeshType>
+TopologyReport checkMesh(const MeshType& mesh) {
+  if (mesh.isPolygonMesh()) {
+    return check(mesh.V, PolygonFaces{mesh.faceOffsets, mesh.faceIndices});
+  }
+  return check(mesh.V, DenseFaces{mesh.F});
+}
+
+// Rows `rows` of `values`, in order
+template <typename T, typename Derived>
+AttributeMatrix<T> takeRows(const Eigen::MatrixBase<Derived>& values,
+                             const std::vector<int>& rows) {
+  AttributeMatrix<T> result(static_cast<Eigen::Index>(rows.size()), values.cols());
+  for (size_t i = 0; i < rows.size(); ++i) {
+    result.row(static_cast<Eigen::Index>(i)) = values.row(rows[i]);
+  }
+  return result;
+}
+
+template <typename MeshType, typename Faces>
+Mesh repair(const MeshType& mesh,
+            const Faces& faces,
+            const TopologyReport& report,
+            const MeshRepairOptions& options) {
+  std::vector<char> removed(static_cast<size_t>(faces.count()), 0);
+  if (options.removeDegenerateFaces) {
+    for (int face : report.degenerateFaces) {
+      removed[static_cast<size_t>(face)] = 1;
+    }
+  }
+  if (options.removeDuplicateFaces) {
+    for (int face : report.duplicateFaces) {
+      removed[static_cast<size_t>(face)] = 1;
+    }
+  }
+  std::vector<int> keptFaces;
+  keptFaces.reserve(removed.size());
+  for (size_t f = 0; f < removed.size(); ++f) {
+    if (!removed[f]) {
+      keptFaces.push_back(static_cast<int>(f));
+    }
+  }
+
+  // Vertices in their previous order, and where each one moves
+  std::vector<int> keptVertices;
+  std::vector<int> remap(static_cast<size_t>(mesh.V.rows()), -1);
+  if (options.removeUnreferencedVertices) {
+    for (int face : keptFaces) {
+      for (Eigen::Index k = 0; k < faces.size(face); ++k) {
+        remap[static_cast<size_t>(faces.vertex(face, k))] = 0;
+      }
+    }
+  } else {
+    std::fill(remap.begin(), remap.end(), 0);
+  }
+  for (size_t v = 0; v < remap.size(); ++v) {
+    if (remap[v] == 0) {
+      remap[v] = static_cast<int>(keptVertices.size());
+      keptVertices.push_back(static_cast<int>(v));
+    }
+  }
+
+  Mesh result;
+  result.V = takeRows<double>(mesh.V, keptVertices);
+  if (mesh.isPolygonMesh()) {
+    result.faceOffsets.resize(static_cast<Eigen::Index>(keptFaces.size() + 1));
+    result.faceOffsets(0) = 0;
+    for (size_t i = 0; i < keptFaces.size(); ++i) {
+      result.faceOffsets(static_cast<Eigen::Index>(i + 1)) =
+          result.faceOffsets(static_cast<Eigen::Index>(i)) +
+          static_cast<int>(faces.size(keptFaces[i]));
+    }
+    result.faceIndices.resize(result.faceOffsets(result.faceOffsets.size() - 1));
+    for (size_t i = 0; i < keptFaces.size(); ++i) {
+      const int offset = result.faceOffsets(static_cast<Eigen::Index>(i));
+      for (Eigen::Index k = 0; k < faces.size(keptFaces[i]); ++k) {
+        result.faceIndices(offset + k) = remap[static_cast<size_t>(faces.vertex(keptFaces[i], k))];
+      }
+    }
+  } else {
+    result.F.resize(static_cast<Eigen::Index>(keptFaces.size()), mesh.F.cols());
+    for (size_t i = 0; i < keptFaces.size(); ++i) {
+      for (Eigen::Index k = 0; k < mesh.F.cols(); ++k) {
+        result.F(static_cast<Eigen::Index>(i), k) =
+            remap[static_cast<size_t>(faces.vertex(keptFaces[i], k))];
+      }
+    }
+  }
+
+  // Attributes keep the rows of the kept elements
+  for (const auto& attribute : mesh.attributes) {
+    const auto& rows = attribute.domain == AttributeDomain::Vertex ? keptVertices : keptFaces;
+    MeshAttribute repaired{std::string(attribute.name), attribute.domain, {}};
+    if constexpr (std::is_same_v<MeshType, Mesh>) {
+      std::visit(
+          [&](const auto& values) {
+            using T = typename std::decay_t<decltype(values)>::Scalar;
+            repaired.data = takeRows<T>(values, rows);
+          },
+          attribute.data);
+    } else {
+      switch (attribute.type) {
+        case AttributeType::Float32:
+          repaired.data = takeRows<float>(attribute.template map<float>(), rows);
+          break;
+        case AttributeType::Float64:
+          repaired.data = takeRows<double>(attribute.template map<double>(), rows);
+          break;
+        case AttributeType::Int32:
+          repaired.data = takeRows<int>(attribute.template map<int>(), rows);
+          break;
+        case AttributeType::UInt8:
+          repaired.data = takeRows<uint8_t>(attribute.template map<uint8_t>(), rows);
+          break;
+      }
+    }
+    result.attributes.push_back(std::move(repaired));
+  }
+  if constexpr (std::is_same_v<MeshType, Mesh>) {
+    if (mesh.C.size() == mesh.V.rows()) {
+      result.C.resize(static_cast<Eigen::Index>(keptVertices.size()));
+      for (size_t i = 0; i < keptVertices.size(); ++i) {
+        result.C(static_cast<Eigen::Index>(i)) = mesh.C(keptVertices[i]);
+      }
+    }
+  }
+  return result;
+}
+
+template <typename MeshType>
+Mesh repairMeshOf(const MeshType& mesh,
+                  const TopologyReport& report,
+                  const MeshRepairOptions& options) {
+  if (mesh.isPolygonMesh()) {
+    return repair(mesh, PolygonFaces{mesh.faceOffsets, mesh.faceIndices}, report, options);
+  }
+  return repair(mesh, DenseFaces{mesh.F}, report, options);
+}
+}  // namespace
+
+TopologyReport checkTopology(const Mesh& mesh) {
+  return checkMesh(mesh);
+}
+
+TopologyReport checkTopology(const MeshView& view) {
+  return checkMesh(view);
+}
+
+Mesh repairMesh(const Mesh& mesh, const TopologyReport& report, const MeshRepairOptions& options) {
+  return repairMeshOf(mesh, report, options);
+}
+
+Mesh repairMesh(const MeshView& view,
+                const TopologyReport& report,
+                const MeshRepairOptions& options) {
+  return repairMeshOf(view, report, options);
+}
+}  // namespace GeoSharPlusCPP
@@ -0,0 +1,281 @@
+#include "GeoSharPlusCPP/Core/Parallel.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+
+namespace GeoSharPlusCPP {
+namespace {
+using Task = std::function<void()>;
+
+class Pool {
+public:
+  // Starts `threads` workers; each holds the pool, so a retired pool lives until it drains.
+  // Throws std::system_error if no worker could be started.
+  static std::shared_ptr<Pool> start(size_t threads);
+
+  void push(Task task);
+  // Workers exit once every queued task has run
+  void retire();
+  size_t workerCount() const { return workerCount_; }
+
+private:
+  struct WorkQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  bool tryPop(size_t self, Task& task);
+  void run(size_t self);
+
+  std::vector<std::unique_ptr<WorkQueue>> queues_;  // One per worker
+  WorkQueue shared_;                                // Tasks queued by non-pool threads
+  size_t workerCount_ = 0;
+  std::atomic<size_t> queued_{0};
+  std::mutex sleepMutex_;
+  std::condition_variable wake_;
+  bool stopping_ = false;  // Guarded by sleepMutex_
+};
+
+thread_local Pool* currentPool = nullptr;
+thread_local size_t currentWorker = 0;
+
+std::shared_ptr<Pool> Pool::start(size_t threads) {
+  auto pool = std::make_shared<Pool>();
+  for (size_t i = 0; i < threads; ++i) {
+    pool->queues_.push_back(std::make_unique<WorkQueue>());
+  }
+  for (size_t i = 0; i < threads; ++i) {
+    try {
+      std::thread([pool, i] { pool->run(i); }).detach();
+    } catch (const std::system_error&) {
+      if (i == 0) {
+        throw;
+      }
+      // Queues of workers that never started stay empty, as only their owner pushes to them
+      break;
+    }
+    pool->workerCount_ = i + 1;
+  }
+  return pool;
+}
+
+void Pool::push(Task task) {
+  WorkQueue& queue = currentPool == this ? *queues_[currentWorker] : shared_;
+  {
+    std::lock_guard lock(queue.mutex);
+    queue.tasks.push_back(std::move(task));
+  }
+  queued_.fetch_add(1);
+  // Taking the lock orders this push before a worker's check-then-sleep
+  { std::lock_guard lock(sleepMutex_); }
+  wake_.notify_one();
+}
+
+void Pool::retire() {
+  {
+    std::lock_guard lock(sleepMutex_);
+    stopping_ = true;
+  }
+  wake_.notify_all();
+}
+
+bool Pool::tryPop(size_t self, Task& task) {
+  // Own tasks newest first (still hot in cache), then the shared queue and other workers'
+  // tasks oldest first
+  auto take = [&](WorkQueue& queue, bool newest) {
+    std::lock_guard lock(queue.mutex);
+    if (queue.tasks.empty()) {
+      return false;
+    }
+    if (newest) {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+    } else {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+    }
+    queued_.fetch_sub(1);
+    return true;
+  };
+
+  if (take(*queues_[self], true) || take(shared_, false)) {
+    return true;
+  }
+  for (size_t k = 1; k < queues_.size(); ++k) {
+    if (take(*queues_[(self + k) % queues_.size()], false)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void Pool::run(size_t self) {
+  currentPool = this;
+  currentWorker = self;
+  for (;;) {
+    Task task;
+    if (tryPop(self, task)) {
+      try {
+        task();
+      } catch (...) {
+        // Tasks report their own errors; one that throws must not take the worker down
+      }
+      continue;
+    }
+
+    std::unique_lock lock(sleepMutex_);
+    wake_.wait(lock, [&] { return stopping_ || queued_.load() > 0; });
+    if (stopping_ && queued_.load() == 0) {
+      return;
+    }
+  }
+}
+
+struct Scheduler {
+  std::mutex mutex;
+  std::shared_ptr<Pool> pool;
+  size_t requested = 0;
+};
+
+// Never destroyed: detached workers may still use it while the process exits, and joining them
+// from static destructors (or DLL unload on Windows) can deadlock
+Scheduler& scheduler() {
+  static Scheduler* instance = new Scheduler;
+  return *instance;
+}
+
+size_t resolveThreadCount(size_t requested) {
+  return requested > 0 ? requested : std::max(1u, std::thread::hardware_concurrency());
+}
+
+std::shared_ptr<Pool> activePool() {
+  auto& s = scheduler();
+  std::lock_guard lock(s.mutex);
+  if (!s.pool) {
+    s.pool = Pool::start(resolveThreadCount(s.requested));
+  }
+  return s.pool;
+}
+
+// One parallelForChunks call; shared with the pool tasks helping with it, which may start
+// after the loop has returned and then only touch `next`
+struct Loop {
+  size_t begin = 0;
+  size_t end = 0;
+  size_t grain = 1;
+  size_t chunkCount = 0;
+  const std::function<void(size_t, size_t)>* body = nullptr;
+
+  std::atomic<size_t> next{0};
+  std::atomic<size_t> done{0};
+  std::atomic<bool> failed{false};
+  std::mutex errorMutex;
+  std::exception_ptr error;
+
+  void work() {
+    for (size_t chunk = next.fetch_add(1); chunk < chunkCount; chunk = next.fetch_add(1)) {
+      if (!failed.load(std::memory_order_relaxed)) {
+        const size_t chunkBegin = begin + chunk * grain;
+        const size_t chunkEnd = end - chunkBegin > grain ? chunkBegin + grain : end;
+        try {
+          (*body)(chunkBegin, chunkEnd);
+        } catch (...) {
+          std::lock_guard lock(errorMutex);
+          if (!error) {
+            error = std::current_exception();
+          }
+          failed.store(true, std::memory_order_relaxed);
+        }
+      }
+      if (done.fetch_add(1, std::memory_order_acq_rel) + 1 == chunkCount) {
+        done.notify_all();
+      }
+    }
+  }
+};
+}  // namespace
+
+void setThreadCount(size_t count) {
+  std::shared_ptr<Pool> retired;
+  {
+    auto& s = scheduler();
+    std::lock_guard lock(s.mutex);
+    s.requested = count;
+    if (s.pool && s.pool->workerCount() != resolveThreadCount(count)) {
+      // The next pool starts on first use
+      retired = std::move(s.pool);
+    }
+  }
+  if (retired) {
+    retired->retire();
+  }
+}
+
+size_t threadCount() {
+  auto& s = scheduler();
+  std::lock_guard lock(s.mutex);
+  return s.pool ? s.pool->workerCount() : resolveThreadCount(s.requested);
+}
+
+void submitTask(std::function<void()> task) {
+  activePool()->push(std::move(task));
+}
+
+void parallelForChunks(size_t begin,
+                       size_t end,
+                       size_t grain,
+                       const std::function<void(size_t, size_t)>& body) {
+  if (end <= begin) {
+    return;
+  }
+
+  grain = std::max<size_t>(grain, 1);
+  const size_t count = end - begin;
+  const size_t chunkCount = count / grain + (count % grain != 0);
+  const size_t threads = std::min(chunkCount, threadCount());
+  if (threads <= 1) {
+    for (size_t chunkBegin = begin; chunkBegin < end;) {
+      const size_t chunkEnd = end - chunkBegin > grain ? chunkBegin + grain : end;
+      body(chunkBegin, chunkEnd);
+      chunkBegin = chunkEnd;
+    }
+    return;
+  }
+
+  auto loop = std::make_shared<Loop>();
+  loop->begin = begin;
+  loop->end = end;
+  loop->grain = grain;
+  loop->chunkCount = chunkCount;
+  loop->body = &body;
+
+  try {
+    for (size_t t = 1; t < threads; ++t) {
+      submitTask([loop] { loop->work(); });
+    }
+  } catch (const std::exception&) {
+    // Fewer helpers; the calling thread takes whatever chunks are left
+  }
+  loop->work();
+
+  for (size_t done = loop->done.load(std::memory_order_acquire); done < chunkCount;
+       done = loop->done.load(std::memory_order_acquire)) {
+    loop->done.wait(done, std::memory_order_acquire);
+  }
+  // Moved out, so the exception is not released by a late helper dropping the loop
+  std::exception_ptr error;
+  {
+    std::lock_guard lock(loop->errorMutex);
+    error = std::move(loop->error);
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+}  // namespace GeoSharPlusCPP
@@ -0,0 +1,224 @@
+#include "GeoSharPlusCPP/Core/ResultCache.h"
+
+#include <bit>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <vector>
+
+#include "GeoSharPlusCPP/Serialization/InteropMemory.h"
+
+namespace GeoSharPlusCPP {
+namespace {
+// XXH64 (https://github.com/Cyan4973/xxHash), little-endian hosts only like the rest of the
+// interop layer
+constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t kPrime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t kPrime5 = 0x27D4EB2F165667C5ULL;
+
+uint64_t read64(const uint8_t* p) {
+  uint64_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+uint32_t read32(const uint8_t* p) {
+  uint32_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+uint64_t xxhRound(uint64_t acc, uint64_t input) {
+  acc += input * kPrime2;
+  return std::rotl(acc, 31) * kPrime1;
+}
+
+uint64_t mergeRound(uint64_t acc, uint64_t value) {
+  acc ^= xxhRound(0, value);
+  return acc * kPrime1 + kPrime4;
+}
+
+struct KeyHash {
+  size_t operator()(const CacheKey& key) const noexcept { return static_cast<size_t>(key.hash); }
+};
+
+struct Entry {
+  CacheKey key;
+  std::vector<uint8_t> result;
+};
+
+struct Cache {
+  std::mutex mutex;
+  // Most recently used first
+  std::list<Entry> entries;
+  std::unordered_map<CacheKey, std::list<Entry>::iterator, KeyHash> index;
+  size_t budget = 0;
+  size_t bytes = 0;
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+
+  void evictTo(size_t limit) {
+    while (bytes > limit && !entries.empty()) {
+      bytes -= entries.back().result.size();
+      index.erase(entries.back().key);
+      entries.pop_back();
+    }
+  }
+};
+
+// Function-local, so exports called during static initialization of the host still work
+Cache& cache() {
+  static Cache instance;
+  return instance;
+}
+}  // namespace
+
+uint64_t hashBytes(ByteSpan bytes, uint64_t seed) {
+  const uint8_t* p = bytes.data();
+  const uint8_t* const end = p + bytes.size();
+  uint64_t h;
+
+  if (bytes.size() >= 32) {
+    uint64_t v1 = seed + kPrime1 + kPrime2;
+    uint64_t v2 = seed + kPrime2;
+    uint64_t v3 = seed;
+    uint64_t v4 = seed - kPrime1;
+    for (const uint8_t* limit = end - 32; p <= limit; p += 32) {
+      v1 = xxhRound(v1, read64(p));
+      v2 = xxhRound(v2, read64(p + 8));
+      v3 = xxhRound(v3, read64(p + 16));
+      v4 = xxhRound(v4, read64(p + 24));
+    }
+    h = std::rotl(v1, 1) + std::rotl(v2, 7) + std::rotl(v3, 12) + std::rotl(v4, 18);
+    h = mergeRound(h, v1);
+    h = mergeRound(h, v2);
+    h = mergeRound(h, v3);
+    h = mergeRound(h, v4);
+  } else {
+    h = seed + kPrime5;
+  }
+  h += static_cast<uint64_t>(bytes.size());
+
+  for (; p + 8 <= end; p += 8) {
+    h ^= xxhRound(0, read64(p));
+    h = std::rotl(h, 27) * kPrime1 + kPrime4;
+  }
+  if (p + 4 <= end) {
+    h ^= static_cast<uint64_t>(read32(p)) * kPrime1;
+    h = std::rotl(h, 23) * kPrime2 + kPrime3;
+    p += 4;
+  }
+  for (; p < end; ++p) {
+    h ^= *p * kPrime5;
+    h = std::rotl(h, 11) * kPrime1;
+  }
+
+  h ^= h >> 33;
+  h *= kPrime2;
+  h ^= h >> 29;
+  h *= kPrime3;
+  h ^= h >> 32;
+  return h;
+}
+
+CacheKey makeCacheKey(std::string_view function, ByteSpan input, ByteSpan params) {
+  // Each part seeds the next, so the same bytes split differently give different keys. The
+  // second chain starts from another seed, making the two halves independent hashes.
+  const auto* name = reinterpret_cast<const uint8_t*>(function.data());
+  const auto chain = [&](uint64_t seed) {
+    uint64_t h = hashBytes(ByteSpan(name, function.size()), seed);
+    h = hashBytes(params, h ^ params.size());
+    return hashBytes(input, h);
+  };
+  return {function, chain(0), chain(kPrime3), input.size()};
+}
+
+bool cacheLookup(const CacheKey& key, uint8_t*& resBuffer, int& resSize) {
+  auto& c = cache();
+  std::lock_guard lock(c.mutex);
+  auto it = c.index.find(key);
+  if (it == c.index.end()) {
+    ++c.misses;
+    return false;
+  }
+
+  const auto& result = it->second->result;
+  resBuffer = static_cast<uint8_t*>(Serialization::AllocateInteropMemory(result.size()));
+  if (!resBuffer) {
+    // Let the caller recompute rather than fail a call that would have succeeded uncached
+    ++c.misses;
+    return false;
+  }
+  std::memcpy(resBuffer, result.data(), result.size());
+  resSize = static_cast<int>(result.size());
+  c.entries.splice(c.entries.begin(), c.entries, it->second);
+  ++c.hits;
+  return true;
+}
+
+void cacheStore(const CacheKey& key, ByteSpan result) {
+  if (result.size() > cacheBudget()) {
+    return;
+  }
+
+  try {
+    // Copied before taking the lock, so concurrent lookups are not held up by large results
+    std::vector<uint8_t> copy(result.begin(), result.end());
+
+    auto& c = cache();
+    std::lock_guard lock(c.mutex);
+    if (copy.size() > c.budget) {
+      return;
+    }
+    if (auto it = c.index.find(key); it != c.index.end()) {
+      // Computed concurrently by another caller; keep the newer copy
+      c.bytes -= it->second->result.size();
+      c.entries.erase(it->second);
+      c.index.erase(it);
+    }
+    c.evictTo(c.budget - copy.size());
+
+    c.entries.push_front({key, std::move(copy)});
+    try {
+      c.index.emplace(key, c.entries.begin());
+    } catch (...) {
+      c.entries.pop_front();
+      throw;
+    }
+    c.bytes += c.entries.front().result.size();
+  } catch (const std::bad_alloc&) {
+    // Caching is best effort
+  }
+}
+
+void setCacheBudget(size_t bytes) {
+  auto& c = cache();
+  std::lock_guard lock(c.mutex);
+  c.budget = bytes;
+  c.evictTo(bytes);
+}
+
+size_t cacheBudget() {
+  auto& c = cache();
+  std::lock_guard lock(c.mutex);
+  return c.budget;
+}
+
+void clearCache() {
+  auto& c = cache();
+  std::lock_guard lock(c.mutex);
+  c.evictTo(0);
+  c.hits = 0;
+  c.misses = 0;
+}
+
+CacheStats cacheStats() {
+  auto& c = cache();
+  std::lock_guard lock(c.mutex);
+  return {c.hits, c.misses, c.entries.size(), c.bytes};
+}
+}  // namespace GeoSharPlusCPP
@@ -0,0 +1,282 @@
+#include "GeoSharPlusCPP/Core/Stats.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+#include "GSP_FB/cpp/stats_generated.h"
+#include "GeoSharPlusCPP/Core/Trace.h"
+#include "GeoSharPlusCPP/Serialization/FbCodec.h"
+#include "GeoSharPlusCPP/Serialization/InteropAccounting.h"
+
+namespace GeoSharPlusCPP {
+struct StatsSite {
+  struct Phase {
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> totalNs{0};
+    std::atomic<uint64_t> maxNs{0};
+    std::array<std::atomic<uint64_t>, kLatencyBuckets> buckets{};
+  };
+
+  const char* name = nullptr;
+  std::atomic<uint64_t> bytesIn{0};
+  std::atomic<uint64_t> bytesOut{0};
+  std::array<Phase, kStatsPhaseCount> phases{};
+};
+
+namespace {
+std::atomic<bool> enabled{false};
+
+struct Registry {
+  std::mutex mutex;
+  std::deque<StatsSite> sites;  // Stable addresses
+};
+
+// Never destroyed: exports may still record from detached pool threads while the process exits
+Registry& registry() {
+  static Registry* instance = new Registry;
+  return *instance;
+}
+
+[[maybe_unused]] void record(StatsSite::Phase& phase, uint64_t ns) {
+  constexpr auto relaxed = std::memory_order_relaxed;
+  phase.count.fetch_add(1, relaxed);
+  phase.totalNs.fetch_add(ns, relaxed);
+  uint64_t max = phase.maxNs.load(relaxed);
+  while (ns > max && !phase.maxNs.compare_exchange_weak(max, ns, relaxed)) {
+  }
+  const size_t bucket = std::min<size_t>(std::bit_width(ns), kLatencyBuckets - 1);
+  phase.buckets[bucket].fetch_add(1, relaxed);
+}
+
+#ifdef GSP_ENABLE_STATS
+// Export being counted on this thread, and the phases being timed, one bit per StatsPhase
+thread_local StatsSite* currentSite = nullptr;
+thread_local const char* currentExport = nullptr;
+thread_local uint8_t activePhases = 0;
+
+// Trace span names by StatsPhase; calls are named after their export
+constexpr const char* kPhaseSpanNames[kStatsPhaseCount] = {
+    "call", "deserialize", "verify", "kernel", "serialize", "interop alloc"};
+
+uint64_t elapsedNs(std::chrono::steady_clock::time_point start,
+                   std::chrono::steady_clock::time_point end) {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+#endif
+}  // namespace
+
+StatsSite* statsSite(const char* name) {
+  auto& r = registry();
+  std::lock_guard lock(r.mutex);
+  for (auto& site : r.sites) {
+    if (std::strcmp(site.name, name) == 0) {
+      return &site;
+    }
+  }
+  auto& site = r.sites.emplace_back();
+  site.name = name;
+  return &site;
+}
+
+void setStatsEnabled(bool on) {
+  enabled.store(on, std::memory_order_relaxed);
+}
+
+bool statsEnabled() {
+  return enabled.load(std::memory_order_relaxed);
+}
+
+void resetStats() {
+  auto& r = registry();
+  std::lock_guard lock(r.mutex);
+  for (auto& site : r.sites) {
+    site.bytesIn.store(0, std::memory_order_relaxed);
+    site.bytesOut.store(0, std::memory_order_relaxed);
+    for (auto& phase : site.phases) {
+      phase.count.store(0, std::memory_order_relaxed);
+      phase.totalNs.store(0, std::memory_order_relaxed);
+      phase.maxNs.store(0, std::memory_order_relaxed);
+      for (auto& bucket : phase.buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+}
+
+const char* currentExportName() {
+#ifdef GSP_ENABLE_STATS
+  return currentExport;
+#else
+  return nullptr;
+#endif
+}
+
+std::vector<ExportStats> collectStats() {
+  std::vector<ExportStats> result;
+  auto& r = registry();
+  std::lock_guard lock(r.mutex);
+  for (const auto& site : r.sites) {
+    ExportStats stats;
+    stats.name = site.name;
+    stats.bytesIn = site.bytesIn.load(std::memory_order_relaxed);
+    stats.bytesOut = site.bytesOut.load(std::memory_order_relaxed);
+    for (size_t p = 0; p < kStatsPhaseCount; ++p) {
+      const auto& phase = site.phases[p];
+      auto& out = stats.phases[p];
+      out.count = phase.count.load(std::memory_order_relaxed);
+      out.totalNs = phase.totalNs.load(std::memory_order_relaxed);
+      out.maxNs = phase.maxNs.load(std::memory_order_relaxed);
+      for (size_t b = 0; b < kLatencyBuckets; ++b) {
+        out.buckets[b] = phase.buckets[b].load(std::memory_order_relaxed);
+      }
+    }
+    if (stats.calls() > 0) {
+      result.push_back(stats);
+    }
+  }
+  return result;
+}
+
+uint64_t latencyPercentile(const PhaseStats& stats, double fraction) {
+  uint64_t total = 0;
+  for (uint64_t count : stats.buckets) {
+    total += count;
+  }
+  if (total == 0) {
+    return 0;
+  }
+
+  // Rank of the sample at `fraction`, 1-based
+  const double clamped = std::clamp(fraction, 0.0, 1.0);
+  const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped * total)));
+  uint64_t seen = 0;
+  for (size_t b = 0; b < kLatencyBuckets; ++b) {
+    seen += stats.buckets[b];
+    if (seen >= rank) {
+      const uint64_t upper = b + 1 < kLatencyBuckets ? (uint64_t{1} << b) - 1 : stats.maxNs;
+      return std::min(upper, stats.maxNs);
+    }
+  }
+  return stats.maxNs;
+}
+
+bool serializeStats(uint8_t*& resBuffer, int& resSize) {
+  const auto exports = collectStats();
+  const bool on = statsEnabled();
+
+  // Names, plus the buckets and fixed fields of every phase
+  size_t sizeHint = Serialization::kTableOverhead + Serialization::kVectorOverhead;
+  for (const auto& stats : exports) {
+    sizeHint += Serialization::kTableOverhead + 2 * Serialization::kVectorOverhead +
+                stats.name.size() +
+                kStatsPhaseCount * (Serialization::kTableOverhead +
+                                    Serialization::kVectorOverhead +
+                                    sizeof(uint64_t) * (kLatencyBuckets + 6));
+  }
+
+  return Serialization::serializeToInterop(
+      sizeHint,
+      [&](flatbuffers::FlatBufferBuilder& builder) {
+        std::vector<flatbuffers::Offset<GSP::FB::ExportStats>> exportOffsets;
+        exportOffsets.reserve(exports.size());
+        for (const auto& stats : exports) {
+          std::vector<flatbuffers::Offset<GSP::FB::PhaseStats>> phaseOffsets;
+          for (size_t p = 0; p < kStatsPhaseCount; ++p) {
+            const auto& phase = stats.phases[p];
+            if (phase.count == 0) {
+              continue;
+            }
+            auto buckets = builder.CreateVector(phase.buckets.data(), phase.buckets.size());
+            phaseOffsets.push_back(GSP::FB::CreatePhaseStats(
+                builder, static_cast<GSP::FB::StatsPhase>(p), phase.count, phase.totalNs,
+                phase.maxNs, latencyPercentile(phase, 0.5), latencyPercentile(phase, 0.9),
+                latencyPercentile(phase, 0.99), buckets));
+          }
+          auto name = builder.CreateString(stats.name.data(), stats.name.size());
+          auto phases = builder.CreateVector(phaseOffsets);
+          exportOffsets.push_back(GSP::FB::CreateExportStats(
+              builder, name, stats.calls(), stats.bytesIn, stats.bytesOut, phases));
+        }
+        auto exportsVector = builder.CreateVector(exportOffsets);
+        builder.Finish(GSP::FB::CreateStatsData(builder, on, exportsVector));
+        return true;
+      },
+      resBuffer, resSize);
+}
+
+#ifdef GSP_ENABLE_STATS
+StatsCallScope::StatsCallScope(StatsSite* site, int64_t inBytes, const int* outSize) {
+  counting_ = enabled.load(std::memory_order_relaxed);
+  tracing_ = tracingEnabled();
+  if (!site || (!counting_ && !tracing_ &&
+                Serialization::memoryTracking() == Serialization::MemoryTracking::Off)) {
+    return;
+  }
+  site_ = site;
+  outerSite_ = std::exchange(currentSite, counting_ ? site : nullptr);
+  outerExport_ = std::exchange(currentExport, site->name);
+  outerPhases_ = std::exchange(activePhases, 0);
+  inBytes_ = inBytes;
+  outSize_ = outSize;
+  start_ = std::chrono::steady_clock::now();
+}
+
+StatsCallScope::~StatsCallScope() {
+  if (!site_) {
+    return;
+  }
+  const auto end = std::chrono::steady_clock::now();
+  if (counting_) {
+    record(site_->phases[static_cast<size_t>(StatsPhase::Call)], elapsedNs(start_, end));
+    if (inBytes_ > 0) {
+      site_->bytesIn.fetch_add(static_cast<uint64_t>(inBytes_), std::memory_order_relaxed);
+    }
+    if (outSize_ && *outSize_ > 0) {
+      site_->bytesOut.fetch_add(static_cast<uint64_t>(*outSize_), std::memory_order_relaxed);
+    }
+  }
+  if (tracing_) {
+    traceSpan(site_->name, start_, end);
+  }
+  currentSite = outerSite_;
+  currentExport = outerExport_;
+  activePhases = outerPhases_;
+}
+
+StatsPhaseScope::StatsPhaseScope(StatsPhase phase) : phase_(phase) {
+  const auto bit = static_cast<uint8_t>(1u << static_cast<unsigned>(phase));
+  if ((activePhases & bit) != 0) {
+    return;
+  }
+  tracing_ = tracingEnabled();
+  if (!currentSite && !tracing_) {
+    return;
+  }
+  site_ = currentSite;
+  active_ = true;
+  activePhases |= bit;
+  start_ = std::chrono::steady_clock::now();
+}
+
+StatsPhaseScope::~StatsPhaseScope() {
+  if (!active_) {
+    return;
+  }
+  const auto end = std::chrono::steady_clock::now();
+  if (site_) {
+    record(site_->phases[static_cast<size_t>(phase_)], elapsedNs(start_, end));
+  }
+  if (tracing_) {
+    traceSpan(kPhaseSpanNames[static_cast<size_t>(phase_)], start_, end);
+  }
+  activePhases &= static_cast<uint8_t>(~(1u << static_cast<unsigned>(phase_)));
+}
+#endif
+}  // namespace GeoSharPlusCPP
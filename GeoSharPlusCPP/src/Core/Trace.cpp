@@ -0,0 +1,202 @@
+#include "GeoSharPlusCPP/Core/Trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace GeoSharPlusCPP {
+namespace {
+using Clock = std::chrono::steady_clock;
+
+// Timestamps count from when the library was loaded
+const Clock::time_point epoch = Clock::now();
+
+uint64_t sinceEpochNs(Clock::time_point t) {
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t - epoch).count();
+  return ns > 0 ? static_cast<uint64_t>(ns) : 0;
+}
+
+// One span. `seq` is odd while the owner thread writes the slot and 2 * (index + 1) once span
+// `index` is complete, so a dump can tell a slot that was overwritten while it read it.
+struct Slot {
+  std::atomic<uint64_t> seq{0};
+  std::atomic<const char*> name{nullptr};
+  std::atomic<uint64_t> startNs{0};
+  std::atomic<uint64_t> endNs{0};
+};
+
+struct Ring {
+  uint32_t tid = 0;
+  std::unique_ptr<Slot[]> slots = std::make_unique<Slot[]>(kTraceRingCapacity);
+  std::atomic<uint64_t> head{0};    // Spans written; stored by the owner thread only
+  std::atomic<bool> exited{false};  // The owner thread has ended; head is final
+  uint64_t dumped = 0;              // Guarded by Registry::mutex
+};
+
+struct Registry {
+  std::mutex mutex;  // Held to add rings and during dumps
+  std::vector<std::unique_ptr<Ring>> rings;
+  uint32_t nextTid = 1;
+};
+
+// Never destroyed: pool threads may still record while the process exits
+Registry& registry() {
+  static Registry* instance = new Registry;
+  return *instance;
+}
+
+std::atomic<bool> enabled{false};
+
+// The calling thread's ring, created with its first span. Marked when the thread ends, so the
+// next dump can free it.
+struct ThreadRing {
+  Ring* ring = nullptr;
+
+  ~ThreadRing() {
+    if (ring) {
+      ring->exited.store(true, std::memory_order_release);
+    }
+  }
+};
+
+thread_local ThreadRing threadRing;
+
+Ring* ringOfThisThread() {
+  if (!threadRing.ring) {
+    try {
+      auto ring = std::make_unique<Ring>();
+      auto& r = registry();
+      std::lock_guard lock(r.mutex);
+      ring->tid = r.nextTid++;
+      threadRing.ring = ring.get();
+      r.rings.push_back(std::move(ring));
+    } catch (const std::exception&) {
+      return nullptr;  // Out of memory; the span is dropped
+    }
+  }
+  return threadRing.ring;
+}
+
+// "ts" and "dur" are microseconds
+void writeSpan(std::ofstream& out,
+               uint32_t tid,
+               const char* name,
+               uint64_t startNs,
+               uint64_t endNs) {
+  const uint64_t durNs = endNs > startNs ? endNs - startNs : 0;
+  char line[256];
+  std::snprintf(line, sizeof(line),
+                ",\n{\"name\":\"%s\",\"cat\":\"gsp\",\"ph\":\"X\",\"pid\":1,\"tid\":%" PRIu32
+                ",\"ts\":%" PRIu64 ".%03u,\"dur\":%" PRIu64 ".%03u}",
+                name, tid, startNs / 1000, static_cast<unsigned>(startNs % 1000), durNs / 1000,
+                static_cast<unsigned>(durNs % 1000));
+  out << line;
+}
+}  // namespace
+
+void setTracingEnabled(bool on) {
+  enabled.store(on, std::memory_order_relaxed);
+}
+
+bool tracingEnabled() {
+  return enabled.load(std::memory_order_relaxed);
+}
+
+void traceSpan(const char* name, Clock::time_point start, Clock::time_point end) {
+  Ring* ring = ringOfThisThread();
+  if (!ring) {
+    return;
+  }
+
+  const uint64_t index = ring->head.load(std::memory_order_relaxed);
+  Slot& slot = ring->slots[index % kTraceRingCapacity];
+  slot.seq.store(2 * index + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.name.store(name, std::memory_order_relaxed);
+  slot.startNs.store(sinceEpochNs(start), std::memory_order_relaxed);
+  slot.endNs.store(sinceEpochNs(end), std::memory_order_relaxed);
+  slot.seq.store(2 * index + 2, std::memory_order_release);
+  ring->head.store(index + 1, std::memory_order_release);
+}
+
+bool dumpTrace(const char* path) {
+  if (!path) {
+    return false;
+  }
+
+  auto& r = registry();
+  std::lock_guard lock(r.mutex);
+  std::ofstream out(std::filesystem::path(reinterpret_cast<const char8_t*>(path)),
+                    std::ios::binary | std::ios::trunc);
+  if (!out) {
+    return false;
+  }
+
+  out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+         "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+         "\"args\":{\"name\":\"GeoSharPlusCPP\"}}";
+
+  // Where each ring's dump ends, and whether its thread had ended before
+  struct Progress {
+    uint64_t head = 0;
+    bool exited = false;
+  };
+  std::vector<Progress> progress(r.rings.size());
+  for (size_t k = 0; k < r.rings.size(); ++k) {
+    Ring& ring = *r.rings[k];
+    progress[k].exited = ring.exited.load(std::memory_order_acquire);
+    const uint64_t head = ring.head.load(std::memory_order_acquire);
+    progress[k].head = head;
+
+    out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << ring.tid
+        << ",\"args\":{\"name\":\"gsp thread " << ring.tid << "\"}}";
+
+    const uint64_t first =
+        std::max(ring.dumped, head > kTraceRingCapacity ? head - kTraceRingCapacity : 0);
+    for (uint64_t index = first; index < head; ++index) {
+      const Slot& slot = ring.slots[index % kTraceRingCapacity];
+      const uint64_t seq = slot.seq.load(std::memory_order_acquire);
+      if (seq != 2 * index + 2) {
+        continue;  // Already overwritten by a newer span
+      }
+      const char* name = slot.name.load(std::memory_order_relaxed);
+      const uint64_t startNs = slot.startNs.load(std::memory_order_relaxed);
+      const uint64_t endNs = slot.endNs.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.seq.load(std::memory_order_relaxed) != seq) {
+        continue;  // Overwritten while being read
+      }
+      writeSpan(out, ring.tid, name, startNs, endNs);
+    }
+  }
+
+  out << "\n]}\n";
+  out.flush();
+  if (!out) {
+    return false;  // Spans stay for the next dump
+  }
+
+  // Drop what was written, and the rings of threads that have ended
+  size_t kept = 0;
+  for (size_t k = 0; k < r.rings.size(); ++k) {
+    if (progress[k].exited) {
+      continue;
+    }
+    r.rings[k]->dumped = progress[k].head;
+    if (kept != k) {
+      r.rings[kept] = std::move(r.rings[k]);
+    }
+    ++kept;
+  }
+  r.rings.resize(kept);
+  return true;
+}
+}  // namespace GeoSharPlusCPP
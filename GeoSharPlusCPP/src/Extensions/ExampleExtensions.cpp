@@ -1,12 +1,22 @@
 #include "GeoSharPlusCPP/Extensions/ExampleExtensions.h"
 
+#include <atomic>
+#include <climits>
 #include <iostream>
+#include <span>
+#include <utility>
 #include <vector>
 
 #include "GSP_FB/cpp/mesh_generated.h"
 #include "GSP_FB/cpp/pointArray_generated.h"
 #include "GSP_FB/cpp/point_generated.h"
+#include "GeoSharPlusCPP/Core/JobQueue.h"
 #include "GeoSharPlusCPP/Core/MathTypes.h"
+#include "GeoSharPlusCPP/Core/MeshRegistry.h"
+#include "GeoSharPlusCPP/Core/Parallel.h"
+#include "GeoSharPlusCPP/Core/ResultCache.h"
+#include "GeoSharPlusCPP/Core/Stats.h"
+#include "GeoSharPlusCPP/Serialization/InteropMemory.h"
 #include "GeoSharPlusCPP/Serialization/Serializer.h"
 
 namespace GS = GeoSharPlusCPP::Serialization;
@@ -21,34 +31,142 @@ namespace GS = GeoSharPlusCPP::Serialization;
 // 2. Process data (optional - these examples just pass through)
 // 3. Serialize result back to output buffer
 //
+// Steps 1-2 live in one helper per example, shared by the allocating export and the
+// caller-buffer (`_size` / `_into`) exports.
+//
+// Each export starts with GSP_STATS_CALL, so gsp_get_stats reports its calls, bytes and
+// latencies and gsp_trace_dump shows it on a timeline. Deserialization and serialization time
+// themselves; wrap the work of step 2 in GSP_STATS_PHASE(Compute).
+//
 // You can modify these or create your own functions following this pattern.
 // ============================================
 
+namespace {
+bool processPoint(const uint8_t* inBuffer, int inSize, GeoSharPlusCPP::Vector3d& pt) {
+  // Step 1: Deserialize the input point
+  if (!GS::deserializePoint(inBuffer, inSize, pt)) {
+    return false;
+  }
+
+  // Step 2: Process the point (example: you could transform it here)
+  // For this example, we just pass it through unchanged.
+  // Example processing:
+  //   pt.x() += 1.0;  // Translate X by 1
+  //   pt = pt * 2.0;  // Scale by 2
+  return true;
+}
+
+bool processPointArray(const uint8_t* inBuffer,
+                       int inSize,
+                       std::vector<GeoSharPlusCPP::Vector3d>& points) {
+  // Step 1: Deserialize the input point array
+  if (!GS::deserializePointArray(inBuffer, inSize, points)) {
+    return false;
+  }
+
+  // Step 2: Process the points (example: you could transform them here)
+  // For this example, we just pass them through unchanged.
+  // Example processing:
+  //   for (auto& pt : points) {
+  //     pt.z() += 10.0;  // Move all points up by 10
+  //   }
+  return true;
+}
+
+bool processMesh(const uint8_t* inBuffer, int inSize, GeoSharPlusCPP::Mesh& mesh) {
+  // Step 1: Deserialize the input mesh
+  if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
+    return false;
+  }
+
+  // Step 2: Process the mesh (example: you could modify it here)
+  // For this example, we just pass it through unchanged.
+  //
+  // The mesh structure:
+  //   mesh.V - Eigen::MatrixXd (N x 3) - vertex positions
+  //   mesh.F - Eigen::MatrixXi (M x 3 or M x 4) - face indices (tri or quad)
+  //
+  // Example processing:
+  //   mesh.V.col(2) *= 2.0;  // Scale Z coordinates by 2
+  //   mesh.V.rowwise() += Eigen::RowVector3d(1, 0, 0);  // Translate
+  return true;
+}
+
+// Batch items per chunk of work on the shared thread pool; smaller batches run on the calling
+// thread
+constexpr size_t kBatchGrain = 16;
+
+// Run `process(item)` over every batch item on the shared thread pool (see Parallel.h). Items
+// are independent; once one fails, the items not yet started are skipped.
+template <typename Item, typename ProcessFn>
+bool processBatchItems(std::vector<Item>& items, ProcessFn&& process) {
+  GSP_STATS_PHASE(Compute);
+  std::atomic<bool> ok{true};
+  GeoSharPlusCPP::parallelForChunks(0, items.size(), kBatchGrain, [&](size_t first, size_t last) {
+    for (size_t i = first; i < last && ok.load(std::memory_order_relaxed); ++i) {
+      if (!process(items[i])) {
+        ok.store(false, std::memory_order_relaxed);
+      }
+    }
+  });
+  return ok.load();
+}
+
+bool processMeshBatch(const uint8_t* inBuffer,
+                      int inSize,
+                      std::vector<GeoSharPlusCPP::Mesh>& meshes) {
+  // Step 1: Deserialize every mesh of the batch, checked in one pass over one buffer
+  if (!GS::deserializeMeshBatch(inBuffer, inSize, meshes)) {
+    return false;
+  }
+
+  // Step 2: Process each mesh (example: pass-through). Items do not share state, so the
+  // per-mesh work runs in parallel for large batches.
+  return processBatchItems(meshes, [](GeoSharPlusCPP::Mesh& mesh) {
+    // Example processing:
+    //   mesh.V.rowwise() += Eigen::RowVector3d(1, 0, 0);  // Translate
+    (void)mesh;
+    return true;
+  });
+}
+
+// Size bounds are reported through the int-sized ABI
+bool reportSizeBound(size_t bound, int* outSize) {
+  if (bound > static_cast<size_t>(INT_MAX)) {
+    return false;
+  }
+  *outSize = static_cast<int>(bound);
+  return true;
+}
+
+// Input bytes as a cache key part; invalid inputs are keyed as empty and fail uncached
+GeoSharPlusCPP::ByteSpan inputBytes(const uint8_t* inBuffer, int inSize) {
+  if (!inBuffer || inSize <= 0) {
+    return {};
+  }
+  return {inBuffer, static_cast<size_t>(inSize)};
+}
+}  // namespace
+
 extern "C" {
 
 GSP_API bool GSP_CALL example_point3d_roundtrip(const uint8_t* inBuffer,
                                                  int inSize,
                                                  uint8_t** outBuffer,
                                                  int* outSize) {
+  GSP_STATS_CALL(inSize, outSize);
   // Initialize output
   *outBuffer = nullptr;
   *outSize = 0;
 
-  // Step 1: Deserialize the input point
   GeoSharPlusCPP::Vector3d pt;
-  if (!GS::deserializePoint(inBuffer, inSize, pt)) {
+  if (!processPoint(inBuffer, inSize, pt)) {
     return false;
   }
 
-  // Step 2: Process the point (example: you could transform it here)
-  // For this example, we just pass it through unchanged.
-  // Example processing:
-  //   pt.x() += 1.0;  // Translate X by 1
-  //   pt = pt * 2.0;  // Scale by 2
-
   // Step 3: Serialize the result
   if (!GS::serializePoint(pt, *outBuffer, *outSize)) {
-    if (*outBuffer) delete[] *outBuffer;
+    if (*outBuffer) GS::FreeInteropMemory(*outBuffer);
     *outBuffer = nullptr;
     *outSize = 0;
     return false;
@@ -57,30 +175,53 @@ GSP_API bool GSP_CALL example_point3d_roundtrip(const uint8_t* inBuffer,
   return true;
 }
 
+GSP_API bool GSP_CALL example_point3d_roundtrip_size(const uint8_t* /*inBuffer*/,
+                                                      int /*inSize*/,
+                                                      int* outSize) {
+  GSP_STATS_CALL(0, nullptr);
+  // A point result has a fixed size
+  *outSize = 0;
+  return reportSizeBound(GS::pointSizeBound(), outSize);
+}
+
+GSP_API bool GSP_CALL example_point3d_roundtrip_into(const uint8_t* inBuffer,
+                                                      int inSize,
+                                                      uint8_t* outBuffer,
+                                                      int outCapacity,
+                                                      int* outSize) {
+  GSP_STATS_CALL(inSize, outSize);
+  *outSize = 0;
+  if (outCapacity < 0 || (!outBuffer && outCapacity > 0)) {
+    return false;
+  }
+
+  GeoSharPlusCPP::Vector3d pt;
+  if (!processPoint(inBuffer, inSize, pt)) {
+    return false;
+  }
+
+  // Step 3: Serialize the result into the caller's buffer
+  return GS::serializePoint(pt, GeoSharPlusCPP::MutableByteSpan(outBuffer, outCapacity),
+                            *outSize);
+}
+
 GSP_API bool GSP_CALL example_point3d_array_roundtrip(const uint8_t* inBuffer,
                                                        int inSize,
                                                        uint8_t** outBuffer,
                                                        int* outSize) {
+  GSP_STATS_CALL(inSize, outSize);
   // Initialize output
   *outBuffer = nullptr;
   *outSize = 0;
 
-  // Step 1: Deserialize the input point array
   std::vector<GeoSharPlusCPP::Vector3d> points;
-  if (!GS::deserializePointArray(inBuffer, inSize, points)) {
+  if (!processPointArray(inBuffer, inSize, points)) {
     return false;
   }
 
-  // Step 2: Process the points (example: you could transform them here)
-  // For this example, we just pass them through unchanged.
-  // Example processing:
-  //   for (auto& pt : points) {
-  //     pt.z() += 10.0;  // Move all points up by 10
-  //   }
-
   // Step 3: Serialize the result
   if (!GS::serializePointArray(points, *outBuffer, *outSize)) {
-    if (*outBuffer) delete[] *outBuffer;
+    if (*outBuffer) GS::FreeInteropMemory(*outBuffer);
     *outBuffer = nullptr;
     *outSize = 0;
     return false;
@@ -89,40 +230,212 @@ GSP_API bool GSP_CALL example_point3d_array_roundtrip(const uint8_t* inBuffer,
   return true;
 }
 
+GSP_API bool GSP_CALL example_point3d_array_roundtrip_size(const uint8_t* inBuffer,
+                                                            int inSize,
+                                                            int* outSize) {
+  GSP_STATS_CALL(inSize, nullptr);
+  *outSize = 0;
+
+  // The pass-through result has as many points as the input, read from a view without
+  // copying them. Only [Vec3] points map as a view; others are decoded.
+  std::span<const GeoSharPlusCPP::Vector3d> view;
+  if (GS::deserializePointArray(inBuffer, inSize, view)) {
+    return reportSizeBound(GS::pointArraySizeBound(view.size()), outSize);
+  }
+  std::vector<GeoSharPlusCPP::Vector3d> points;
+  if (!GS::deserializePointArray(inBuffer, inSize, points)) {
+    return false;
+  }
+  return reportSizeBound(GS::pointArraySizeBound(points.size()), outSize);
+}
+
+GSP_API bool GSP_CALL example_point3d_array_roundtrip_into(const uint8_t* inBuffer,
+                                                            int inSize,
+                                                            uint8_t* outBuffer,
+                                                            int outCapacity,
+                                                            int* outSize) {
+  GSP_STATS_CALL(inSize, outSize);
+  *outSize = 0;
+  if (outCapacity < 0 || (!outBuffer && outCapacity > 0)) {
+    return false;
+  }
+
+  std::vector<GeoSharPlusCPP::Vector3d> points;
+  if (!processPointArray(inBuffer, inSize, points)) {
+    return false;
+  }
+
+  // Step 3: Serialize the result into the caller's buffer
+  return GS::serializePointArray(points, GeoSharPlusCPP::MutableByteSpan(outBuffer, outCapacity),
+                                 *outSize);
+}
+
 GSP_API bool GSP_CALL example_mesh_roundtrip(const uint8_t* inBuffer,
                                               int inSize,
                                               uint8_t** outBuffer,
                                               int* outSize) {
+  GSP_STATS_CALL(inSize, outSize);
   // Initialize output
   *outBuffer = nullptr;
   *outSize = 0;
 
-  // Step 1: Deserialize the input mesh
+  // Steps 1-3 are skipped when the same input was processed before and the result cache is
+  // enabled (gsp_cache_set_budget)
+  return GeoSharPlusCPP::cachedResult(
+      "example_mesh_roundtrip", inputBytes(inBuffer, inSize), {}, *outBuffer, *outSize,
+      [&](uint8_t*& resBuffer, int& resSize) {
+        GeoSharPlusCPP::Mesh mesh;
+        if (!processMesh(inBuffer, inSize, mesh)) {
+          return false;
+        }
+
+        // Step 3: Serialize the result
+        if (!GS::serializeMesh(mesh, resBuffer, resSize)) {
+          if (resBuffer) GS::FreeInteropMemory(resBuffer);
+          resBuffer = nullptr;
+          resSize = 0;
+          return false;
+        }
+        return true;
+      });
+}
+
+GSP_API bool GSP_CALL example_mesh_roundtrip_size(const uint8_t* inBuffer,
+                                                   int inSize,
+                                                   int* outSize) {
+  GSP_STATS_CALL(inSize, nullptr);
+  *outSize = 0;
+
+  // The pass-through result has the input's vertices, faces and attributes; a view reads
+  // them without copying the mesh. Only [Vec3] vertices with plain faces map as a view;
+  // encoded meshes are decoded.
+  GeoSharPlusCPP::MeshView view;
+  if (GS::deserializeMeshView(inBuffer, inSize, view)) {
+    return reportSizeBound(GS::meshSizeBound(view), outSize);
+  }
   GeoSharPlusCPP::Mesh mesh;
   if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
     return false;
   }
+  return reportSizeBound(GS::meshSizeBound(mesh), outSize);
+}
 
-  // Step 2: Process the mesh (example: you could modify it here)
-  // For this example, we just pass it through unchanged.
-  // 
-  // The mesh structure:
-  //   mesh.V - Eigen::MatrixXd (N x 3) - vertex positions
-  //   mesh.F - Eigen::MatrixXi (M x 3 or M x 4) - face indices (tri or quad)
-  //
-  // Example processing:
-  //   mesh.V.col(2) *= 2.0;  // Scale Z coordinates by 2
-  //   mesh.V.rowwise() += Eigen::RowVector3d(1, 0, 0);  // Translate
+GSP_API bool GSP_CALL example_mesh_roundtrip_into(const uint8_t* inBuffer,
+                                                   int inSize,
+                                                   uint8_t* outBuffer,
+                                                   int outCapacity,
+                                                   int* outSize) {
+  GSP_STATS_CALL(inSize, outSize);
+  *outSize = 0;
+  if (outCapacity < 0 || (!outBuffer && outCapacity > 0)) {
+    return false;
+  }
 
-  // Step 3: Serialize the result
-  if (!GS::serializeMesh(mesh, *outBuffer, *outSize)) {
-    if (*outBuffer) delete[] *outBuffer;
-    *outBuffer = nullptr;
-    *outSize = 0;
+  GeoSharPlusCPP::Mesh mesh;
+  if (!processMesh(inBuffer, inSize, mesh)) {
     return false;
   }
 
-  return true;
+  // Step 3: Serialize the result into the caller's buffer
+  return GS::serializeMesh(mesh, GeoSharPlusCPP::MutableByteSpan(outBuffer, outCapacity),
+                           *outSize);
+}
+
+GSP_API bool GSP_CALL example_mesh_batch_roundtrip(const uint8_t* inBuffer,
+                                                    int inSize,
+                                                    uint8_t** outBuffer,
+                                                    int* outSize) {
+  GSP_STATS_CALL(inSize, outSize);
+  // Initialize output
+  *outBuffer = nullptr;
+  *outSize = 0;
+
+  return GeoSharPlusCPP::cachedResult(
+      "example_mesh_batch_roundtrip", inputBytes(inBuffer, inSize), {}, *outBuffer, *outSize,
+      [&](uint8_t*& resBuffer, int& resSize) {
+        std::vector<GeoSharPlusCPP::Mesh> meshes;
+        if (!processMeshBatch(inBuffer, inSize, meshes)) {
+          return false;
+        }
+        // Run as a job (gsp_submit) that was cancelled meanwhile: nobody reads the result
+        if (GeoSharPlusCPP::jobCancelled()) {
+          return false;
+        }
+
+        // Step 3: Serialize all results into one buffer
+        if (!GS::serializeMeshBatch(meshes, resBuffer, resSize)) {
+          if (resBuffer) GS::FreeInteropMemory(resBuffer);
+          resBuffer = nullptr;
+          resSize = 0;
+          return false;
+        }
+        return true;
+      });
+}
+
+GSP_API bool GSP_CALL example_mesh_batch_roundtrip_size(const uint8_t* inBuffer,
+                                                         int inSize,
+                                                         int* outSize) {
+  GSP_STATS_CALL(inSize, nullptr);
+  *outSize = 0;
+
+  // The pass-through result has the input's counts, read from views of the batch without
+  // copying it. Only batches of [Vec3] vertices map as views; others are decoded.
+  std::vector<GeoSharPlusCPP::MeshView> views;
+  if (GS::deserializeMeshBatchView(inBuffer, inSize, views)) {
+    return reportSizeBound(GS::meshBatchSizeBound(views), outSize);
+  }
+  std::vector<GeoSharPlusCPP::Mesh> meshes;
+  if (!GS::deserializeMeshBatch(inBuffer, inSize, meshes)) {
+    return false;
+  }
+  return reportSizeBound(GS::meshBatchSizeBound(meshes), outSize);
+}
+
+GSP_API bool GSP_CALL example_mesh_batch_roundtrip_into(const uint8_t* inBuffer,
+                                                         int inSize,
+                                                         uint8_t* outBuffer,
+                                                         int outCapacity,
+                                                         int* outSize) {
+  GSP_STATS_CALL(inSize, outSize);
+  *outSize = 0;
+  if (outCapacity < 0 || (!outBuffer && outCapacity > 0)) {
+    return false;
+  }
+
+  std::vector<GeoSharPlusCPP::Mesh> meshes;
+  if (!processMeshBatch(inBuffer, inSize, meshes)) {
+    return false;
+  }
+
+  // Step 3: Serialize all results into the caller's buffer
+  return GS::serializeMeshBatch(meshes, GeoSharPlusCPP::MutableByteSpan(outBuffer, outCapacity),
+                                *outSize);
+}
+
+GSP_API bool GSP_CALL example_mesh_scale_resident(uint64_t meshHandle,
+                                                  double factor,
+                                                  uint64_t* outHandle) {
+  GSP_STATS_CALL(0, nullptr);
+  *outHandle = 0;
+
+  // Step 1: Look up the resident mesh; nothing is deserialized
+  auto mesh = GeoSharPlusCPP::findMesh(meshHandle);
+  if (!mesh) {
+    return false;
+  }
+
+  // Step 2: Process a copy; resident meshes are shared and never modified
+  GeoSharPlusCPP::Mesh scaled;
+  {
+    GSP_STATS_PHASE(Compute);
+    scaled = *mesh;
+    scaled.V *= factor;
+  }
+
+  // Step 3: Keep the result resident as well
+  *outHandle = GeoSharPlusCPP::registerMesh(std::move(scaled));
+  return *outHandle != 0;
 }
 
 }  // extern "C"
@@ -0,0 +1,396 @@
+#include "GeoSharPlusCPP/Serialization/ChunkedStream.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <limits>
+#include <new>
+
+#include "GSP_FB/cpp/stream_generated.h"
+#include "GeoSharPlusCPP/Core/Stats.h"
+#include "GeoSharPlusCPP/Serialization/InteropMemory.h"
+#include "flatbuffers/flatbuffers.h"
+
+namespace GeoSharPlusCPP::Serialization {
+namespace {
+// Rows allocated up front from the counts in a stream header. The header is not trusted with
+// more: past this, the result grows (doubling) as chunks actually arrive.
+constexpr Eigen::Index kInitialRows = Eigen::Index{1} << 16;
+
+// Makes room for `rows` rows, growing geometrically but never past `limit`
+template <typename Matrix>
+bool reserveRows(Matrix& matrix, Eigen::Index rows, Eigen::Index limit) {
+  if (rows <= matrix.rows()) {
+    return true;
+  }
+  try {
+    matrix.conservativeResize(std::min(std::max(rows, 2 * matrix.rows()), limit), matrix.cols());
+  } catch (const std::bad_alloc&) {
+    return false;
+  }
+  return true;
+}
+
+// Builds frames into one reused buffer and hands each to the sink
+class FrameWriter {
+public:
+  explicit FrameWriter(const FrameSink& sink) : sink_(sink) {}
+
+  // `serialize(MutableByteSpan dst, int& size)` writes one frame body with the span-based
+  // serializer contract; the buffer is grown once if the size hint was too small.
+  template <typename SerializeFn>
+  bool emit(size_t sizeHint, SerializeFn&& serialize) {
+    buffer_.resize(kFrameHeaderBytes + sizeHint);
+
+    int size = 0;
+    if (!serialize(body(), size)) {
+      if (size <= 0 || static_cast<size_t>(size) <= body().size()) {
+        return false;  // Failed for a reason other than buffer size
+      }
+      buffer_.resize(kFrameHeaderBytes + static_cast<size_t>(size));
+      if (!serialize(body(), size)) {
+        return false;
+      }
+    }
+
+    // Length prefix in host order; like the FlatBuffers payload, the ABI is little-endian
+    const int64_t length = size;
+    std::memcpy(buffer_.data(), &length, sizeof(length));
+    return sink_(ByteSpan(buffer_.data(), kFrameHeaderBytes + static_cast<size_t>(size)));
+  }
+
+private:
+  MutableByteSpan body() { return MutableByteSpan(buffer_).subspan(kFrameHeaderBytes); }
+
+  const FrameSink& sink_;
+  std::vector<uint8_t> buffer_;
+};
+
+// Elements per chunk for the chunk byte target, at least one
+size_t perChunk(int64_t maxChunkBytes, size_t bytesPerElement) {
+  const auto target = static_cast<size_t>(std::min(maxChunkBytes, kMaxChunkBytes));
+  return std::max<size_t>(1, target / bytesPerElement);
+}
+
+size_t chunkCount(size_t count, size_t chunkSize) {
+  return (count + chunkSize - 1) / chunkSize;
+}
+
+size_t bytesPerPoint(PositionEncoding encoding) {
+  switch (encoding) {
+    case PositionEncoding::Float:
+      return 3 * sizeof(float);
+    case PositionEncoding::Quantized:
+      return 3 * sizeof(uint16_t);
+    default:
+      return 3 * sizeof(double);
+  }
+}
+
+// Typical encoded size of one face index; varint chunks may come out somewhat larger
+size_t bytesPerIndex(FaceEncoding encoding, size_t vertexCount) {
+  switch (encoding) {
+    case FaceEncoding::Compact:
+      return vertexCount <= 0x10000 ? sizeof(uint16_t) : sizeof(int);
+    case FaceEncoding::DeltaVarint:
+      return 2;
+    default:
+      return sizeof(int);
+  }
+}
+
+bool emitHeader(FrameWriter& writer,
+                GSP::FB::StreamPayload payload,
+                size_t pointCount,
+                size_t faceCount,
+                int faceVertexCount,
+                size_t pointChunks,
+                size_t faceChunks) {
+  flatbuffers::FlatBufferBuilder builder(128);
+  builder.Finish(GSP::FB::CreateStreamHeader(builder, payload, pointCount, faceCount,
+                                             static_cast<uint8_t>(faceVertexCount), pointChunks,
+                                             faceChunks));
+  return writer.emit(builder.GetSize(), [&](MutableByteSpan dst, int& size) {
+    return copyToCallerBuffer(builder, dst, size);
+  });
+}
+
+bool emitPointChunks(FrameWriter& writer,
+                     std::span<const Vector3d> points,
+                     size_t chunkSize,
+                     const PositionEncodingOptions& options) {
+  for (size_t start = 0; start < points.size(); start += chunkSize) {
+    const auto chunk = points.subspan(start, std::min(chunkSize, points.size() - start));
+    const bool ok = writer.emit(pointArraySizeBound(chunk.size(), options.encoding),
+                                [&](MutableByteSpan dst, int& size) {
+                                  return serializePointArray(chunk, dst, size, options);
+                                });
+    if (!ok) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Frame length from its prefix; bodies must fit the int-sized deserializers
+bool frameLength(const uint8_t* prefix, size_t& length) {
+  int64_t value = 0;
+  std::memcpy(&value, prefix, sizeof(value));
+  if (value <= 0 || value > INT_MAX) {
+    return false;
+  }
+  length = static_cast<size_t>(value);
+  return true;
+}
+}  // namespace
+
+bool serializePointArrayChunked(std::span<const Vector3d> points,
+                                const FrameSink& sink,
+                                const ChunkOptions& options) {
+  if (options.maxChunkBytes <= 0) {
+    return false;
+  }
+
+  const PositionEncodingOptions& encoding = options.encoding.vertices;
+  const size_t chunkSize = perChunk(options.maxChunkBytes, bytesPerPoint(encoding.encoding));
+
+  FrameWriter writer(sink);
+  return emitHeader(writer, GSP::FB::StreamPayload::PointArray, points.size(), 0, 3,
+                    chunkCount(points.size(), chunkSize), 0) &&
+         emitPointChunks(writer, points, chunkSize, encoding);
+}
+
+bool serializePointArrayChunked(const MatrixX3d& points,
+                                const FrameSink& sink,
+                                const ChunkOptions& options) {
+  // Row-major N x 3 doubles are packed exactly like Vector3d
+  return serializePointArrayChunked(
+      std::span<const Vector3d>(reinterpret_cast<const Vector3d*>(points.data()),
+                                static_cast<size_t>(points.rows())),
+      sink, options);
+}
+
+bool serializeMeshChunked(const Mesh& mesh, const FrameSink& sink, const ChunkOptions& options) {
+  const int faceVertexCount = mesh.faceVertexCount();
+  if (options.maxChunkBytes <= 0 || (faceVertexCount != 3 && faceVertexCount != 4)) {
+    return false;
+  }
+
+  const auto vertexCount = static_cast<size_t>(mesh.V.rows());
+  const auto faceCount = static_cast<size_t>(mesh.F.rows());
+  const size_t pointChunkSize =
+      perChunk(options.maxChunkBytes, bytesPerPoint(options.encoding.vertices.encoding));
+  const size_t faceChunkSize =
+      perChunk(options.maxChunkBytes,
+               faceVertexCount * bytesPerIndex(options.encoding.faces, vertexCount));
+
+  FrameWriter writer(sink);
+  if (!emitHeader(writer, GSP::FB::StreamPayload::Mesh, vertexCount, faceCount,
+                  faceVertexCount, chunkCount(vertexCount, pointChunkSize),
+                  chunkCount(faceCount, faceChunkSize))) {
+    return false;
+  }
+
+  // Vertices go out as point array chunks
+  const std::span<const Vector3d> vertices(reinterpret_cast<const Vector3d*>(mesh.V.data()),
+                                           vertexCount);
+  if (!emitPointChunks(writer, vertices, pointChunkSize, options.encoding.vertices)) {
+    return false;
+  }
+
+  // Faces go out as vertex-less meshes; only one chunk of faces is copied at a time
+  MeshEncodingOptions faceEncoding;
+  faceEncoding.faces = options.encoding.faces;
+  Mesh part;
+  part.V.resize(0, 3);
+  for (size_t start = 0; start < faceCount; start += faceChunkSize) {
+    const auto count = static_cast<Eigen::Index>(std::min(faceChunkSize, faceCount - start));
+    part.F = mesh.F.middleRows(static_cast<Eigen::Index>(start), count);
+
+    const bool ok =
+        writer.emit(meshSizeBound(0, static_cast<size_t>(count), faceVertexCount, faceEncoding),
+                    [&](MutableByteSpan dst, int& size) {
+                      return serializeMesh(part, dst, size, faceEncoding);
+                    });
+    if (!ok) {
+      return false;
+    }
+  }
+  return true;
+}
+
+StreamReader::StreamReader(VerifyPolicy policy) : policy_(policy) {}
+
+bool StreamReader::append(ByteSpan bytes) {
+  if (failed_) {
+    return false;
+  }
+
+  bytesRead_ += static_cast<int64_t>(bytes.size());
+  if (!consume(bytes)) {
+    failed_ = true;
+    pending_.clear();
+    return false;
+  }
+  return true;
+}
+
+bool StreamReader::complete() const {
+  return hasHeader_ && !failed_ && pending_.empty() && chunksRead_ == pointChunks_ + faceChunks_ &&
+         pointsRead_ == pointCount_ && facesRead_ == faceCount_;
+}
+
+bool StreamReader::consume(ByteSpan bytes) {
+  // Finish the frame left partial by the previous call
+  if (!pending_.empty()) {
+    if (pending_.size() < kFrameHeaderBytes) {
+      const size_t take = std::min(kFrameHeaderBytes - pending_.size(), bytes.size());
+      pending_.insert(pending_.end(), bytes.begin(), bytes.begin() + take);
+      bytes = bytes.subspan(take);
+      if (pending_.size() < kFrameHeaderBytes) {
+        return true;
+      }
+    }
+
+    size_t length = 0;
+    if (!frameLength(pending_.data(), length)) {
+      return false;
+    }
+    const size_t total = kFrameHeaderBytes + length;
+    pending_.reserve(total);
+
+    const size_t take = std::min(total - pending_.size(), bytes.size());
+    pending_.insert(pending_.end(), bytes.begin(), bytes.begin() + take);
+    bytes = bytes.subspan(take);
+    if (pending_.size() < total) {
+      return true;
+    }
+
+    if (!readFrame(ByteSpan(pending_).subspan(kFrameHeaderBytes))) {
+      return false;
+    }
+    pending_.clear();
+  }
+
+  // Complete frames are read straight from the input, without buffering
+  while (bytes.size() >= kFrameHeaderBytes) {
+    size_t length = 0;
+    if (!frameLength(bytes.data(), length)) {
+      return false;
+    }
+    if (bytes.size() - kFrameHeaderBytes < length) {
+      break;
+    }
+
+    if (!readFrame(bytes.subspan(kFrameHeaderBytes, length))) {
+      return false;
+    }
+    bytes = bytes.subspan(kFrameHeaderBytes + length);
+  }
+
+  // Keep the start of the next frame for the following call
+  pending_.assign(bytes.begin(), bytes.end());
+  return true;
+}
+
+bool StreamReader::readFrame(ByteSpan body) {
+  if (!hasHeader_) {
+    return readHeader(body);
+  }
+
+  if (chunksRead_ < pointChunks_) {
+    if (!readPointChunk(body)) {
+      return false;
+    }
+    // The point chunks must add up exactly to the announced count
+    return ++chunksRead_ < pointChunks_ || pointsRead_ == pointCount_;
+  }
+
+  if (chunksRead_ < pointChunks_ + faceChunks_) {
+    if (!readFaceChunk(body)) {
+      return false;
+    }
+    return ++chunksRead_ < pointChunks_ + faceChunks_ || facesRead_ == faceCount_;
+  }
+
+  return false;  // Trailing frame
+}
+
+bool StreamReader::readHeader(ByteSpan body) {
+  GSP_STATS_PHASE(Deserialize);
+  if (policy_ != VerifyPolicy::Trusted) {
+    GSP_STATS_PHASE(Verify);
+    flatbuffers::Verifier verifier(body.data(), body.size());
+    if (!verifier.VerifyBuffer<GSP::FB::StreamHeader>(nullptr)) {
+      return false;
+    }
+  }
+
+  auto header = flatbuffers::GetRoot<GSP::FB::StreamHeader>(body.data());
+  const auto payload = header->payload();
+  const int faceVertexCount = header->face_vertex_count();
+  if (payload != GSP::FB::StreamPayload::PointArray && payload != GSP::FB::StreamPayload::Mesh) {
+    return false;
+  }
+
+  // Every chunk holds at least one element, so empty payloads have no chunks
+  const uint64_t maxCount = static_cast<uint64_t>(std::numeric_limits<Eigen::Index>::max()) / 4;
+  const uint64_t pointCount = header->point_count();
+  const uint64_t faceCount = header->face_count();
+  if (pointCount > maxCount || faceCount > maxCount ||
+      header->point_chunks() > pointCount || (pointCount > 0 && header->point_chunks() == 0) ||
+      header->face_chunks() > faceCount || (faceCount > 0 && header->face_chunks() == 0) ||
+      (payload == GSP::FB::StreamPayload::PointArray && faceCount > 0) ||
+      (faceVertexCount != 3 && faceVertexCount != 4)) {
+    return false;
+  }
+
+  // Small payloads are sized once; chunks are then copied straight into place
+  pointCount_ = static_cast<Eigen::Index>(pointCount);
+  faceCount_ = static_cast<Eigen::Index>(faceCount);
+  try {
+    result_.V.resize(std::min(pointCount_, kInitialRows), 3);
+    result_.F.resize(std::min(faceCount_, kInitialRows), faceVertexCount);
+  } catch (const std::bad_alloc&) {
+    return false;
+  }
+
+  isMesh_ = payload == GSP::FB::StreamPayload::Mesh;
+  pointChunks_ = header->point_chunks();
+  faceChunks_ = header->face_chunks();
+  hasHeader_ = true;
+  return true;
+}
+
+bool StreamReader::readPointChunk(ByteSpan body) {
+  // Decoded from any position encoding, then placed after the points read so far
+  MatrixX3d chunk;
+  if (!deserializePointArray(body.data(), static_cast<int>(body.size()), chunk, policy_) ||
+      chunk.rows() == 0 || chunk.rows() > pointCount_ - pointsRead_ ||
+      !reserveRows(result_.V, pointsRead_ + chunk.rows(), pointCount_)) {
+    return false;
+  }
+
+  result_.V.middleRows(pointsRead_, chunk.rows()) = chunk;
+  pointsRead_ += chunk.rows();
+  return true;
+}
+
+bool StreamReader::readFaceChunk(ByteSpan body) {
+  Mesh chunk;
+  if (!deserializeMesh(body.data(), static_cast<int>(body.size()), chunk, policy_) ||
+      chunk.V.rows() != 0 || chunk.F.cols() != result_.F.cols() || chunk.F.rows() == 0 ||
+      chunk.F.rows() > faceCount_ - facesRead_) {
+    return false;
+  }
+  // Every point chunk precedes the faces, so indices are checked against the final count
+  if ((chunk.F.array() < 0).any() || (chunk.F.array() >= pointCount_).any() ||
+      !reserveRows(result_.F, facesRead_ + chunk.F.rows(), faceCount_)) {
+    return false;
+  }
+
+  result_.F.middleRows(facesRead_, chunk.F.rows()) = chunk.F;
+  facesRead_ += chunk.F.rows();
+  return true;
+}
+}  // namespace GeoSharPlusCPP::Serialization
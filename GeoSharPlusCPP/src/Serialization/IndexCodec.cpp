@@ -0,0 +1,124 @@
+#include "GeoSharPlusCPP/Serialization/IndexCodec.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+namespace GeoSharPlusCPP::Serialization {
+namespace {
+// Continuation bits of eight packed varint bytes
+constexpr uint64_t kContinuationBits = 0x8080808080808080ull;
+
+uint32_t zigzag(int32_t value) {
+  return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+}
+
+int32_t unzigzag(uint32_t value) {
+  return static_cast<int32_t>(value >> 1) ^ -static_cast<int32_t>(value & 1);
+}
+}  // namespace
+
+bool fitsIndex16(std::span<const int> indices) {
+  return std::all_of(indices.begin(), indices.end(),
+                     [](int index) { return index >= 0 && index <= 0xFFFF; });
+}
+
+void encodeFixedWidth(std::span<const int> indices, int bytesPerIndex, uint8_t* out) {
+  if (bytesPerIndex == 4) {
+    std::memcpy(out, indices.data(), indices.size_bytes());
+    return;
+  }
+
+  auto out16 = reinterpret_cast<uint16_t*>(out);
+  for (size_t i = 0; i < indices.size(); ++i) {
+    out16[i] = static_cast<uint16_t>(indices[i]);
+  }
+}
+
+void decodeFixedWidth(const uint8_t* in, int bytesPerIndex, std::span<int> out) {
+  if (bytesPerIndex == 4) {
+    std::memcpy(out.data(), in, out.size_bytes());
+    return;
+  }
+
+  // Plain widening loop, vectorized by the compiler
+  auto in16 = reinterpret_cast<const uint16_t*>(in);
+  for (size_t i = 0; i < out.size(); ++i) {
+    out[i] = in16[i];
+  }
+}
+
+bool encodeDeltaVarint(std::span<const int> indices, std::vector<uint8_t>& out) {
+  out.clear();
+  out.reserve(indices.size() + indices.size() / 4);
+
+  int32_t previous = 0;
+  for (int index : indices) {
+    if (index < 0) {
+      return false;
+    }
+
+    // Both ends are non-negative, so the delta cannot overflow
+    uint32_t value = zigzag(index - previous);
+    previous = index;
+
+    while (value >= 0x80) {
+      out.push_back(static_cast<uint8_t>(value | 0x80));
+      value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+  }
+  return true;
+}
+
+bool decodeDeltaVarint(ByteSpan in, std::span<int> out) {
+  const uint8_t* bytes = in.data();
+  const size_t size = in.size();
+  size_t pos = 0;
+  int64_t previous = 0;
+
+  for (size_t i = 0; i < out.size();) {
+    // Fast path: eight single-byte deltas in a row, detected with one test on a 64-bit word
+    if (pos + 8 <= size && i + 8 <= out.size()) {
+      uint64_t word = 0;
+      std::memcpy(&word, bytes + pos, sizeof(word));
+      if ((word & kContinuationBits) == 0) {
+        for (size_t k = 0; k < 8; ++k) {
+          previous += unzigzag(bytes[pos + k]);
+          if (previous < 0 || previous > INT_MAX) {
+            return false;
+          }
+          out[i + k] = static_cast<int>(previous);
+        }
+        pos += 8;
+        i += 8;
+        continue;
+      }
+    }
+
+    // General LEB128 varint of at most five bytes
+    uint32_t value = 0;
+    for (int shift = 0;; shift += 7) {
+      if (pos >= size) {
+        return false;
+      }
+      const uint8_t byte = bytes[pos++];
+      if (shift == 28 && (byte & 0xF0) != 0) {
+        return false;  // Overflows 32 bits
+      }
+      value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) {
+        break;
+      }
+    }
+
+    previous += unzigzag(value);
+    if (previous < 0 || previous > INT_MAX) {
+      return false;
+    }
+    out[i++] = static_cast<int>(previous);
+  }
+
+  return pos == size;
+}
+}  // namespace GeoSharPlusCPP::Serialization
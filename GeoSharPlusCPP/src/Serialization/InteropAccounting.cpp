@@ -0,0 +1,186 @@
+#include "GeoSharPlusCPP/Serialization/InteropAccounting.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <unordered_map>
+
+#include "GSP_FB/cpp/memory_generated.h"
+#include "GeoSharPlusCPP/Core/Stats.h"
+#include "GeoSharPlusCPP/Serialization/FbCodec.h"
+
+namespace GeoSharPlusCPP::Serialization {
+namespace {
+constexpr std::string_view kUnattributed = "(unattributed)";
+
+struct Buffer {
+  uint64_t size = 0;
+  size_t exportIndex = 0;
+  uint64_t sequence = 0;
+};
+
+struct Ledger {
+  std::mutex mutex;
+  // The mode only changes under the mutex; allocations read it without it to skip the lock
+  std::atomic<MemoryTracking> mode{MemoryTracking::Off};
+  std::unordered_map<const void*, Buffer> buffers;
+  std::vector<ExportMemoryStats> exports;
+  std::unordered_map<const char*, size_t> exportIndex;  // Export names are unique pointers
+  uint64_t liveBytes = 0;
+  uint64_t peakBytes = 0;
+  uint64_t nextSequence = 1;
+
+  void clear() {
+    buffers.clear();
+    exports.clear();
+    exportIndex.clear();
+    liveBytes = 0;
+    peakBytes = 0;
+    nextSequence = 1;
+  }
+};
+
+// Never destroyed: buffers may still be freed while the process exits
+Ledger& ledger() {
+  static Ledger* instance = new Ledger;
+  return *instance;
+}
+
+size_t exportIndexOf(Ledger& l, const char* name) {
+  auto [it, inserted] = l.exportIndex.try_emplace(name, l.exports.size());
+  if (inserted) {
+    l.exports.push_back({name ? std::string_view(name) : kUnattributed});
+  }
+  return it->second;
+}
+}  // namespace
+
+void setMemoryTracking(MemoryTracking mode) {
+  auto& l = ledger();
+  std::lock_guard lock(l.mutex);
+  if (mode == MemoryTracking::Off) {
+    l.clear();
+  }
+  l.mode.store(mode, std::memory_order_relaxed);
+}
+
+MemoryTracking memoryTracking() {
+  return ledger().mode.load(std::memory_order_relaxed);
+}
+
+bool isValidMemoryTracking(int32_t mode) {
+  return mode >= static_cast<int32_t>(MemoryTracking::Off) &&
+         mode <= static_cast<int32_t>(MemoryTracking::Debug);
+}
+
+void trackAllocation(const void* ptr, size_t size) {
+  auto& l = ledger();
+  if (!ptr || l.mode.load(std::memory_order_relaxed) == MemoryTracking::Off) {
+    return;
+  }
+
+  const char* name = currentExportName();
+  std::lock_guard lock(l.mutex);
+  if (l.mode.load(std::memory_order_relaxed) == MemoryTracking::Off) {
+    return;
+  }
+  try {
+    const size_t index = exportIndexOf(l, name);
+    l.buffers[ptr] = {size, index, l.nextSequence++};
+
+    auto& stats = l.exports[index];
+    ++stats.allocations;
+    stats.allocatedBytes += size;
+    ++stats.liveBuffers;
+    stats.liveBytes += size;
+    stats.peakBytes = std::max(stats.peakBytes, stats.liveBytes);
+    l.liveBytes += size;
+    l.peakBytes = std::max(l.peakBytes, l.liveBytes);
+  } catch (const std::exception&) {
+    // Out of memory for the bookkeeping; the buffer itself is fine and goes uncounted
+  }
+}
+
+void trackFree(const void* ptr) {
+  auto& l = ledger();
+  if (!ptr || l.mode.load(std::memory_order_relaxed) == MemoryTracking::Off) {
+    return;
+  }
+
+  std::lock_guard lock(l.mutex);
+  auto it = l.buffers.find(ptr);
+  if (it == l.buffers.end()) {
+    return;  // Allocated while tracking was off
+  }
+  auto& stats = l.exports[it->second.exportIndex];
+  --stats.liveBuffers;
+  stats.liveBytes -= it->second.size;
+  l.liveBytes -= it->second.size;
+  l.buffers.erase(it);
+}
+
+MemoryStats collectMemoryStats() {
+  MemoryStats result;
+  auto& l = ledger();
+  std::lock_guard lock(l.mutex);
+  result.mode = l.mode.load(std::memory_order_relaxed);
+  result.liveBuffers = l.buffers.size();
+  result.liveBytes = l.liveBytes;
+  result.peakBytes = l.peakBytes;
+  result.exports = l.exports;
+
+  if (result.mode == MemoryTracking::Debug) {
+    result.live.reserve(l.buffers.size());
+    for (const auto& [ptr, buffer] : l.buffers) {
+      result.live.push_back({l.exports[buffer.exportIndex].name,
+                             reinterpret_cast<uintptr_t>(ptr), buffer.size, buffer.sequence});
+    }
+    std::sort(result.live.begin(), result.live.end(),
+              [](const LiveBuffer& a, const LiveBuffer& b) { return a.sequence < b.sequence; });
+  }
+  return result;
+}
+
+bool serializeMemoryStats(uint8_t*& resBuffer, int& resSize) {
+  const auto stats = collectMemoryStats();
+
+  size_t sizeHint = kTableOverhead + 2 * kVectorOverhead;
+  for (const auto& exportStats : stats.exports) {
+    sizeHint += kTableOverhead + exportStats.name.size();
+  }
+  sizeHint += stats.live.size() * kTableOverhead;  // Live buffers share their name strings
+
+  return serializeToInterop(
+      sizeHint,
+      [&](flatbuffers::FlatBufferBuilder& builder) {
+        std::vector<flatbuffers::Offset<GSP::FB::ExportMemoryStats>> exportOffsets;
+        exportOffsets.reserve(stats.exports.size());
+        for (const auto& e : stats.exports) {
+          auto name = builder.CreateString(e.name.data(), e.name.size());
+          exportOffsets.push_back(GSP::FB::CreateExportMemoryStats(
+              builder, name, e.allocations, e.allocatedBytes, e.liveBuffers, e.liveBytes,
+              e.peakBytes));
+        }
+        auto exports = builder.CreateVector(exportOffsets);
+
+        flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<GSP::FB::LiveBuffer>>> live;
+        if (stats.mode == MemoryTracking::Debug) {
+          std::vector<flatbuffers::Offset<GSP::FB::LiveBuffer>> liveOffsets;
+          liveOffsets.reserve(stats.live.size());
+          for (const auto& b : stats.live) {
+            auto name = builder.CreateSharedString(b.exportName.data(), b.exportName.size());
+            liveOffsets.push_back(
+                GSP::FB::CreateLiveBuffer(builder, name, b.address, b.size, b.sequence));
+          }
+          live = builder.CreateVector(liveOffsets);
+        }
+
+        builder.Finish(GSP::FB::CreateMemoryStats(
+            builder, static_cast<GSP::FB::MemoryTracking>(stats.mode), stats.liveBuffers,
+            stats.liveBytes, stats.peakBytes, exports, live));
+        return true;
+      },
+      resBuffer, resSize);
+}
+}  // namespace GeoSharPlusCPP::Serialization
@@ -0,0 +1,135 @@
+#include "GeoSharPlusCPP/Serialization/InteropMemory.h"
+
+#include <climits>
+#include <cstring>
+#include <new>
+
+#include "GeoSharPlusCPP/Core/Stats.h"
+#include "GeoSharPlusCPP/Serialization/InteropAccounting.h"
+
+#ifdef _WIN32
+  #include <combaseapi.h>  // Windows: CoTaskMemAlloc for COM interop
+#else
+  #include <cstdlib>  // Unix/macOS: use malloc/free
+#endif
+
+namespace GeoSharPlusCPP::Serialization {
+namespace {
+// Scratch storage above this size is released rather than kept for the next call
+constexpr size_t kScratchRetainBytes = 4 * 1024 * 1024;
+
+// Interop memory outside the accounting, for the blocks a builder grows through
+void* allocateUntracked(size_t size) {
+  GSP_STATS_PHASE(Allocate);
+#ifdef _WIN32
+  return CoTaskMemAlloc(size);
+#else
+  // On Unix/macOS, use malloc which pairs with .NET's Marshal.FreeCoTaskMem
+  // .NET Core runtime translates Marshal.FreeCoTaskMem to free() on non-Windows platforms
+  return malloc(size);
+#endif
+}
+
+void freeUntracked(void* ptr) {
+#ifdef _WIN32
+  CoTaskMemFree(ptr);
+#else
+  free(ptr);
+#endif
+}
+}  // namespace
+
+void* AllocateInteropMemory(size_t size) {
+  void* ptr = allocateUntracked(size);
+  trackAllocation(ptr, size);
+  return ptr;
+}
+
+void FreeInteropMemory(void* ptr) {
+  // Before the free, so another thread cannot be handed the same address while it is tracked
+  trackFree(ptr);
+  freeUntracked(ptr);
+}
+
+uint8_t* InteropAllocator::allocate(size_t size) {
+  auto p = static_cast<uint8_t*>(allocateUntracked(size));
+  if (!p) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void InteropAllocator::deallocate(uint8_t* p, size_t /*size*/) {
+  freeUntracked(p);
+}
+
+InteropAllocator& InteropAllocator::instance() {
+  static InteropAllocator allocator;
+  return allocator;
+}
+
+flatbuffers::FlatBufferBuilder makeInteropBuilder(size_t initialSize) {
+  return flatbuffers::FlatBufferBuilder(initialSize, &InteropAllocator::instance(), false);
+}
+
+bool releaseInteropBuffer(flatbuffers::FlatBufferBuilder& builder,
+                          uint8_t*& resBuffer,
+                          int& resSize) {
+  resBuffer = nullptr;
+  resSize = 0;
+
+  size_t blockSize = 0;
+  size_t offset = 0;
+  uint8_t* block = builder.ReleaseRaw(blockSize, offset);
+  if (!block) {
+    return false;
+  }
+
+  const size_t dataSize = blockSize - offset;
+  if (dataSize > static_cast<size_t>(INT_MAX)) {
+    freeUntracked(block);  // Does not fit the int-sized interop ABI
+    return false;
+  }
+
+  // Move the payload to the start of the block so C# can free it with FreeCoTaskMem
+  if (offset > 0) {
+    std::memmove(block, block + offset, dataSize);
+  }
+
+  // Only now does the block become a result buffer; it holds on to all of its bytes
+  trackAllocation(block, blockSize);
+  resBuffer = block;
+  resSize = static_cast<int>(dataSize);
+  return true;
+}
+
+flatbuffers::FlatBufferBuilder& scratchBuilder() {
+  thread_local flatbuffers::FlatBufferBuilder builder;
+
+  // GetSize() still reports the previous payload until the builder is cleared
+  if (builder.GetSize() > kScratchRetainBytes) {
+    builder.Reset();
+  } else {
+    builder.Clear();
+  }
+  return builder;
+}
+
+bool copyToCallerBuffer(const flatbuffers::FlatBufferBuilder& builder,
+                        MutableByteSpan dst,
+                        int& resSize) {
+  const size_t dataSize = builder.GetSize();
+  if (dataSize > static_cast<size_t>(INT_MAX)) {
+    resSize = 0;  // Does not fit the int-sized interop ABI
+    return false;
+  }
+
+  resSize = static_cast<int>(dataSize);
+  if (dataSize > dst.size()) {
+    return false;  // Caller buffer too small; resSize reports what is needed
+  }
+
+  std::memcpy(dst.data(), builder.GetBufferPointer(), dataSize);
+  return true;
+}
+}  // namespace GeoSharPlusCPP::Serialization
@@ -1,464 +1,834 @@
 #include "GeoSharPlusCPP/Serialization/Serializer.h"
 
-#ifdef _WIN32
-  #include <combaseapi.h>  // Windows: CoTaskMemAlloc for COM interop
-#else
-  #include <cstdlib>  // Unix/macOS: use malloc/free
-  #include <cstring>  // Unix/macOS: use memcpy
-#endif
-
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <new>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+#include "GSP_FB/cpp/boundingBox_generated.h"
 #include "GSP_FB/cpp/doubleArray_generated.h"
 #include "GSP_FB/cpp/doublePairArray_generated.h"
 #include "GSP_FB/cpp/intArray_generated.h"
 #include "GSP_FB/cpp/intNestedArray_generated.h"
 #include "GSP_FB/cpp/intPairArray_generated.h"
+#include "GSP_FB/cpp/massProperties_generated.h"
+#include "GSP_FB/cpp/meshBatch_generated.h"
+#include "GSP_FB/cpp/meshQuery_generated.h"
 #include "GSP_FB/cpp/mesh_generated.h"
+#include "GSP_FB/cpp/pointArrayBatch_generated.h"
 #include "GSP_FB/cpp/pointArray_generated.h"
 #include "GSP_FB/cpp/point_generated.h"
+#include "GSP_FB/cpp/topology_generated.h"
 #include "GeoSharPlusCPP/Core/MathTypes.h"
+#include "GeoSharPlusCPP/Core/Parallel.h"
+#include "GeoSharPlusCPP/Serialization/FbCodec.h"
+#include "GeoSharPlusCPP/Serialization/IndexCodec.h"
+#include "GeoSharPlusCPP/Serialization/InteropMemory.h"
 #include "flatbuffers/flatbuffers.h"
 
 namespace GeoSharPlusCPP::Serialization {
-// Cross-platform memory allocation for C# interop
-// On Windows: Use CoTaskMemAlloc (COM-compatible)
-// On Unix/macOS: Use standard malloc - .NET Core will handle it correctly with
-// Marshal.FreeCoTaskMem Note: On .NET Core/5+, Marshal.FreeCoTaskMem on Unix calls free()
-// internally, which properly pairs with malloc()
-inline void* AllocateInteropMemory(size_t size) {
-#ifdef _WIN32
-  return CoTaskMemAlloc(size);
-#else
-  // On Unix/macOS, use malloc which pairs with .NET's Marshal.FreeCoTaskMem
-  // .NET Core runtime translates Marshal.FreeCoTaskMem to free() on non-Windows platforms
-  return malloc(size);
-#endif
-}
-
-// Cross-platform memory deallocation for C# interop
-// This should only be used in error paths before the buffer is returned to C#
-// Once returned to C#, the memory MUST be freed by Marshal.FreeCoTaskMem
-inline void FreeInteropMemory(void* ptr) {
-#ifdef _WIN32
-  CoTaskMemFree(ptr);
-#else
-  free(ptr);
-#endif
-}
-
-// Helper template to get the element type of a container
-template <typename Container>
-struct element_type {
-  // Default case for std::vector
-  using type = typename std::remove_reference_t<Container>::value_type;
-};
-
-// Specialization for Eigen::VectorXd
+// ! Number arrays
+// The number and number pair tables hold one vector of scalars or structs, so FbCodec
+// generates their serializers: one bulk copy each way for every supported container.
 template <>
-struct element_type<Eigen::VectorXd> {
-  using type = double;
+struct FbTableTraits<GSP::FB::DoubleArrayData> {
+  using Element = double;
+  static constexpr flatbuffers::voffset_t kValuesField = GSP::FB::DoubleArrayData::VT_VALUES;
+  static auto values(const GSP::FB::DoubleArrayData& table) { return table.values(); }
+  static auto create(flatbuffers::FlatBufferBuilder& builder, FbVectorOffset<Element> values) {
+    return GSP::FB::CreateDoubleArrayData(builder, values);
+  }
 };
 
-// Specialization for Eigen::VectorXi
 template <>
-struct element_type<Eigen::VectorXi> {
-  using type = int;
+struct FbTableTraits<GSP::FB::IntArrayData> {
+  using Element = int;
+  static constexpr flatbuffers::voffset_t kValuesField = GSP::FB::IntArrayData::VT_VALUES;
+  static auto values(const GSP::FB::IntArrayData& table) { return table.values(); }
+  static auto create(flatbuffers::FlatBufferBuilder& builder, FbVectorOffset<Element> values) {
+    return GSP::FB::CreateIntArrayData(builder, values);
+  }
 };
 
-// Specialization for Eigen::MatrixXd
 template <>
-struct element_type<Eigen::MatrixXd> {
-  using type = double;
+struct FbTableTraits<GSP::FB::DoublePairArrayData> {
+  using Element = GSP::FB::Vec2;
+  static constexpr flatbuffers::voffset_t kValuesField = GSP::FB::DoublePairArrayData::VT_PAIRS;
+  static auto values(const GSP::FB::DoublePairArrayData& table) { return table.pairs(); }
+  static auto create(flatbuffers::FlatBufferBuilder& builder, FbVectorOffset<Element> pairs) {
+    return GSP::FB::CreateDoublePairArrayData(builder, pairs);
+  }
 };
 
-// Helper to get the pair element type
-template <typename PairContainer>
-struct pair_element_type {
-  // Default for vectors of pairs
-  using type = typename std::remove_reference_t<PairContainer>::value_type::first_type;
-};
-// Specialization for Eigen::Matrix<int, Dynamic, 2>
 template <>
-struct pair_element_type<Eigen::Matrix<int, Eigen::Dynamic, 2>> {
-  using type = int;
+struct FbTableTraits<GSP::FB::IntPairArrayData> {
+  using Element = GSP::FB::Vec2i;
+  static constexpr flatbuffers::voffset_t kValuesField = GSP::FB::IntPairArrayData::VT_PAIRS;
+  static auto values(const GSP::FB::IntPairArrayData& table) { return table.pairs(); }
+  static auto create(flatbuffers::FlatBufferBuilder& builder, FbVectorOffset<Element> pairs) {
+    return GSP::FB::CreateIntPairArrayData(builder, pairs);
+  }
 };
 
-// Specialization for Eigen::Matrix<double, Dynamic, 2>
-template <>
-struct pair_element_type<Eigen::Matrix<double, Eigen::Dynamic, 2>> {
-  using type = double;
-};
+// Scalar type held by a number or number pair container
+template <typename Container>
+constexpr auto scalarTypeOf() {
+  if constexpr (std::is_base_of_v<Eigen::EigenBase<Container>, Container>) {
+    return std::type_identity<typename Container::Scalar>{};
+  } else if constexpr (std::is_scalar_v<std::ranges::range_value_t<Container>>) {
+    return std::type_identity<std::ranges::range_value_t<Container>>{};
+  } else {
+    return std::type_identity<typename std::ranges::range_value_t<Container>::first_type>{};
+  }
+}
+
+template <typename Container>
+using ScalarOf = typename decltype(scalarTypeOf<Container>())::type;
+
+template <typename Container>
+using NumberArrayCodec = FbCodec<std::conditional_t<std::is_same_v<ScalarOf<Container>, double>,
+                                                    GSP::FB::DoubleArrayData,
+                                                    GSP::FB::IntArrayData>>;
+
+template <typename Container>
+using NumberPairArrayCodec =
+    FbCodec<std::conditional_t<std::is_same_v<ScalarOf<Container>, double>,
+                               GSP::FB::DoublePairArrayData,
+                               GSP::FB::IntPairArrayData>>;
 
-// Unified number array serialization - detects both container and element types
 template <typename NumberContainer>
 bool serializeNumberArray(const NumberContainer& numbers, uint8_t*& resBuffer, int& resSize) {
-  flatbuffers::FlatBufferBuilder builder;
+  return NumberArrayCodec<NumberContainer>::serialize(numbers, resBuffer, resSize);
+}
+
+template <typename NumberContainer>
+bool serializeNumberArray(const NumberContainer& numbers, MutableByteSpan dst, int& resSize) {
+  return NumberArrayCodec<NumberContainer>::serialize(numbers, dst, resSize);
+}
+
+template <typename NumberContainer>
+bool deserializeNumberArray(const uint8_t* data,
+                            int size,
+                            NumberContainer& numberArray,
+                            VerifyPolicy policy) {
+  return NumberArrayCodec<NumberContainer>::deserialize(data, size, numberArray, policy);
+}
 
-  // Extract value type from container
-  using ValueType = typename element_type<NumberContainer>::type;
+template <typename PairContainer>
+bool serializeNumberPairArray(const PairContainer& pairs, uint8_t*& resBuffer, int& resSize) {
+  return NumberPairArrayCodec<PairContainer>::serialize(pairs, resBuffer, resSize);
+}
 
-  if constexpr (std::is_same_v<ValueType, double>) {
-    // Handle double values
-    std::vector<double> valueVector;
+template <typename PairContainer>
+bool serializeNumberPairArray(const PairContainer& pairs, MutableByteSpan dst, int& resSize) {
+  return NumberPairArrayCodec<PairContainer>::serialize(pairs, dst, resSize);
+}
 
-    if constexpr (std::is_same_v<NumberContainer, std::vector<double>>) {
-      valueVector = numbers;
-    } else if constexpr (std::is_same_v<NumberContainer, Eigen::VectorXd>) {
-      valueVector = std::vector<double>(numbers.data(), numbers.data() + numbers.size());
-    }
+template <typename PairContainer>
+bool deserializeNumberPairArray(const uint8_t* data,
+                                int size,
+                                PairContainer& pairArray,
+                                VerifyPolicy policy) {
+  return NumberPairArrayCodec<PairContainer>::deserialize(data, size, pairArray, policy);
+}
 
-    auto valuesVector = builder.CreateVector(valueVector);
-    auto arrayOffset = GSP::FB::CreateDoubleArrayData(builder, valuesVector);
-    builder.Finish(arrayOffset);
-  } else if constexpr (std::is_same_v<ValueType, int>) {
-    // Handle integer values
-    std::vector<int32_t> valueVector;
+size_t pointSizeBound() {
+  return kTableOverhead + sizeof(GSP::FB::Vec3);
+}
 
-    if constexpr (std::is_same_v<NumberContainer, std::vector<int>>) {
-      valueVector = numbers;
-    } else if constexpr (std::is_same_v<NumberContainer, Eigen::VectorXi>) {
-      valueVector = std::vector<int>(numbers.data(), numbers.data() + numbers.size());
-    }
+static bool buildPoint(flatbuffers::FlatBufferBuilder& builder, const Vector3d& point) {
+  auto vec = GSP::FB::Vec3(point[0], point[1], point[2]);
+  auto ptOffset = GSP::FB::CreatePointData(builder, &vec);
+  builder.Finish(ptOffset);
+  return true;
+}
 
-    auto valuesVector = builder.CreateVector(valueVector);
-    auto arrayOffset = GSP::FB::CreateIntArrayData(builder, valuesVector);
-    builder.Finish(arrayOffset);
-  }
+bool serializePoint(const Vector3d& point, uint8_t*& resBuffer, int& resSize) {
+  return serializeToInterop(
+      pointSizeBound(), [&](auto& builder) { return buildPoint(builder, point); }, resBuffer,
+      resSize);
+}
 
-  // Copy the serialized data to the provided buffer
-  resSize = builder.GetSize();
-  resBuffer = static_cast<uint8_t*>(AllocateInteropMemory(resSize));
-  if (!resBuffer) {
-    return false;  // Handle allocation failure
+bool serializePoint(const Vector3d& point, MutableByteSpan dst, int& resSize) {
+  return serializeToSpan([&](auto& builder) { return buildPoint(builder, point); }, dst,
+                         resSize);
+}
+
+bool deserializePoint(const uint8_t* buffer, int size, Vector3d& point, VerifyPolicy policy) {
+  CheckedRoot<GSP::FB::PointData> ptData(buffer, size, policy);
+  if (!ptData || !ptData.readable(ptData->point(), GSP::FB::PointData::VT_POINT)) {
+    return false;
   }
-  std::memcpy(resBuffer, builder.GetBufferPointer(), resSize);
 
+  point = Vector3d(ptData->point()->x(), ptData->point()->y(), ptData->point()->z());
   return true;
 }
 
-// Unified number array deserialization - detects container and element types
-template <typename NumberContainer>
-bool deserializeNumberArray(const uint8_t* data, int size, NumberContainer& numberArray) {
-  // Extract value type from container
-  using ValueType = typename element_type<NumberContainer>::type;
-
-  if constexpr (std::is_same_v<ValueType, double>) {
-    // Handle double values
-    flatbuffers::Verifier verifier(data, size);
-    if (!verifier.VerifyBuffer<GSP::FB::DoubleArrayData>()) {
-      return false;
-    }
+// Serialized bytes of `count` positions in the given encoding
+static size_t positionsSize(size_t count, PositionEncoding encoding) {
+  switch (encoding) {
+    case PositionEncoding::Float:
+      return kVectorOverhead + sizeof(GSP::FB::Vec3f) * count;
+    case PositionEncoding::Quantized:
+      return kTableOverhead + kVectorOverhead + 3 * sizeof(uint16_t) * count;
+    default:
+      return kVectorOverhead + sizeof(GSP::FB::Vec3) * count;
+  }
+}
 
-    auto arrayData = GSP::FB::GetDoubleArrayData(data);
-    if (!arrayData || !arrayData->values()) {
-      return false;
-    }
+size_t pointArraySizeBound(size_t pointCount, PositionEncoding encoding) {
+  return kTableOverhead + positionsSize(pointCount, encoding);
+}
+
+// Offsets of the position field filled for the chosen encoding; the others stay null
+struct PositionOffsets {
+  flatbuffers::Offset<flatbuffers::Vector<const GSP::FB::Vec3*>> doubles;
+  flatbuffers::Offset<flatbuffers::Vector<const GSP::FB::Vec3f*>> floats;
+  flatbuffers::Offset<GSP::FB::QuantizedPositions> quantized;
+};
 
-    auto values = arrayData->values();
+// Write N x 3 positions in the requested encoding. Vec3 and Vec3f vectors are packed x,y,z
+// rows, so both are filled in place through a row-major map.
+template <typename Derived>
+static bool buildPositions(flatbuffers::FlatBufferBuilder& builder,
+                           const Eigen::MatrixBase<Derived>& P,
+                           const PositionEncodingOptions& options,
+                           PositionOffsets& offsets) {
+  static_assert(sizeof(GSP::FB::Vec3) == 3 * sizeof(double));
+  static_assert(sizeof(GSP::FB::Vec3f) == 3 * sizeof(float));
+
+  const Eigen::Index count = P.rows();
+  switch (options.encoding) {
+    case PositionEncoding::Double: {
+      GSP::FB::Vec3* data = nullptr;
+      offsets.doubles =
+          builder.CreateUninitializedVectorOfStructs(static_cast<size_t>(count), &data);
+      Eigen::Map<MatrixX3d>(reinterpret_cast<double*>(data), count, 3) =
+          P.template cast<double>();
+      return true;
+    }
+    case PositionEncoding::Float: {
+      GSP::FB::Vec3f* data = nullptr;
+      offsets.floats =
+          builder.CreateUninitializedVectorOfStructs(static_cast<size_t>(count), &data);
+      Eigen::Map<MatrixX3f>(reinterpret_cast<float*>(data), count, 3) =
+          P.template cast<float>();
+      return true;
+    }
+    case PositionEncoding::Quantized: {
+      const int bits = options.quantizationBits;
+      if (bits < 1 || bits > 16) {
+        return false;
+      }
 
-    if constexpr (std::is_same_v<NumberContainer, std::vector<double>>) {
-      numberArray.clear();
-      numberArray.reserve(values->size());
-      for (size_t i = 0; i < values->size(); i++) {
-        numberArray.push_back(values->Get(i));
+      Eigen::RowVector3d min = Eigen::RowVector3d::Zero();
+      Eigen::RowVector3d max = Eigen::RowVector3d::Zero();
+      if (count > 0) {
+        min = P.template cast<double>().colwise().minCoeff();
+        max = P.template cast<double>().colwise().maxCoeff();
       }
-    } else if constexpr (std::is_same_v<NumberContainer, Eigen::VectorXd>) {
-      numberArray.resize(values->size());
-      for (size_t i = 0; i < values->size(); i++) {
-        numberArray(i) = values->Get(i);
+
+      // Flat axes (zero extent) encode to 0 and decode back to `min`
+      const double levels = static_cast<double>((1 << bits) - 1);
+      const Eigen::RowVector3d extent = max - min;
+      Eigen::RowVector3d toLevels;
+      for (int a = 0; a < 3; ++a) {
+        toLevels[a] = extent[a] > 0.0 ? levels / extent[a] : 0.0;
       }
+
+      uint16_t* values = nullptr;
+      auto valuesVector =
+          builder.CreateUninitializedVector(3 * static_cast<size_t>(count), &values);
+      // Points are independent, so large clouds are encoded on several threads
+      parallelFor(0, static_cast<size_t>(count), [&](size_t point) {
+        const auto i = static_cast<Eigen::Index>(point);
+        for (int a = 0; a < 3; ++a) {
+          const double q = (static_cast<double>(P(i, a)) - min[a]) * toLevels[a];
+          values[3 * i + a] = static_cast<uint16_t>(std::lround(std::clamp(q, 0.0, levels)));
+        }
+      });
+
+      const GSP::FB::Vec3 fbMin(min[0], min[1], min[2]);
+      const GSP::FB::Vec3 fbMax(max[0], max[1], max[2]);
+      offsets.quantized = GSP::FB::CreateQuantizedPositions(
+          builder, &fbMin, &fbMax, static_cast<uint8_t>(bits), valuesVector);
+      return true;
     }
-  } else if constexpr (std::is_same_v<ValueType, int>) {
-    // Handle integer values
-    flatbuffers::Verifier verifier(data, size);
-    if (!verifier.VerifyBuffer<GSP::FB::IntArrayData>()) {
+  }
+  return false;
+}
+
+// Position fields of an incoming mesh or point array; at most one is expected to be set
+struct PositionFields {
+  const flatbuffers::Vector<const GSP::FB::Vec3*>* doubles = nullptr;
+  const flatbuffers::Vector<const GSP::FB::Vec3f*>* floats = nullptr;
+  const GSP::FB::QuantizedPositions* quantized = nullptr;
+  size_t count = 0;
+
+  [[nodiscard]] bool present() const { return doubles || floats || quantized; }
+};
+
+// Collect and check whichever position field the buffer carries
+template <typename Root>
+static bool readPositions(CheckedRoot<Root>& root,
+                          const flatbuffers::Vector<const GSP::FB::Vec3*>* doubles,
+                          const flatbuffers::Vector<const GSP::FB::Vec3f*>* floats,
+                          const GSP::FB::QuantizedPositions* quantized,
+                          PositionFields& fields) {
+  fields = {};
+  if (doubles) {
+    if (!root.readable(doubles)) {
       return false;
     }
-
-    auto arrayData = GSP::FB::GetIntArrayData(data);
-    if (!arrayData || !arrayData->values()) {
+    fields.doubles = doubles;
+    fields.count = doubles->size();
+  } else if (floats) {
+    if (!root.readable(floats)) {
       return false;
     }
-
-    auto values = arrayData->values();
-
-    if constexpr (std::is_same_v<NumberContainer, std::vector<int>>) {
-      numberArray.clear();
-      numberArray.reserve(values->size());
-      for (size_t i = 0; i < values->size(); i++) {
-        numberArray.push_back(values->Get(i));
-      }
-    } else if constexpr (std::is_same_v<NumberContainer, Eigen::VectorXi>) {
-      numberArray.resize(values->size());
-      for (size_t i = 0; i < values->size(); i++) {
-        numberArray(i) = values->Get(i);
-      }
+    fields.floats = floats;
+    fields.count = floats->size();
+  } else if (quantized) {
+    if (!root.readableTable(quantized)) {
+      return false;
     }
+    auto values = quantized->values();
+    const int bits = quantized->bits();
+    if (!quantized->min() || !quantized->max() || bits < 1 || bits > 16 ||
+        (values && values->size() % 3 != 0)) {
+      return false;
+    }
+    fields.quantized = quantized;
+    fields.count = values ? values->size() / 3 : 0;
   }
-
   return true;
 }
 
-// Unified number pair array serialization
-template <typename PairContainer>
-bool serializeNumberPairArray(const PairContainer& pairs, uint8_t*& resBuffer, int& resSize) {
-  flatbuffers::FlatBufferBuilder builder;
-
-  // Extract element type from container
-  using ElementType = typename pair_element_type<PairContainer>::type;
-
-  if constexpr (std::is_same_v<ElementType, int>) {
-    // Handle integer pairs
-    std::vector<GSP::FB::Vec2i> pairVector;
+// Dequantize interleaved x,y,z values into `out`. Twelve values (four points) are decoded per
+// step with fixed-size Eigen arrays, so the multiply-add runs on full SIMD packets for both
+// float and double; the tail is finished one value at a time.
+template <typename Scalar>
+static void dequantizePositions(const GSP::FB::QuantizedPositions& quantized, Scalar* out) {
+  using Block = Eigen::Array<Scalar, 12, 1>;
+  using QuantBlock = Eigen::Array<uint16_t, 12, 1>;
+
+  const auto values = quantized.values();
+  const size_t n = values ? values->size() : 0;
+  const uint16_t* q = n > 0 ? reinterpret_cast<const uint16_t*>(values->Data()) : nullptr;
+
+  const double levels = static_cast<double>((1 << quantized.bits()) - 1);
+  const double min[3] = {quantized.min()->x(), quantized.min()->y(), quantized.min()->z()};
+  const double max[3] = {quantized.max()->x(), quantized.max()->y(), quantized.max()->z()};
+
+  // Per-value scale and offset, repeating with the x,y,z period of the interleaved values
+  Block scale;
+  Block offset;
+  for (int j = 0; j < 12; ++j) {
+    scale[j] = static_cast<Scalar>((max[j % 3] - min[j % 3]) / levels);
+    offset[j] = static_cast<Scalar>(min[j % 3]);
+  }
 
-    if constexpr (std::is_same_v<PairContainer, std::vector<std::pair<int, int>>>) {
-      // Handle std::vector<std::pair<int, int>>
-      pairVector.reserve(pairs.size());
-      for (const auto& p : pairs) {
-        pairVector.emplace_back(GSP::FB::Vec2i(p.first, p.second));
-      }
-    } else if constexpr (std::is_same_v<PairContainer, Eigen::Matrix<int, Eigen::Dynamic, 2>>) {
-      // Handle Eigen::Matrix<int, Dynamic, 2>
-      pairVector.reserve(pairs.rows());
-      for (Eigen::Index i = 0; i < pairs.rows(); ++i) {
-        pairVector.emplace_back(GSP::FB::Vec2i(pairs(i, 0), pairs(i, 1)));
-      }
+  // Blocks are independent, so large arrays are decoded on several threads
+  const size_t blocks = n / 12;
+  parallelForChunks(0, blocks, kDefaultGrain, [&](size_t first, size_t last) {
+    for (size_t i = 12 * first; i < 12 * last; i += 12) {
+      Eigen::Map<Block>(out + i) =
+          Eigen::Map<const QuantBlock>(q + i).template cast<Scalar>() * scale + offset;
     }
+  });
+  for (size_t i = 12 * blocks; i < n; ++i) {
+    out[i] = static_cast<Scalar>(q[i]) * scale[i % 3] + offset[i % 3];
+  }
+}
 
-    auto pairsVector = builder.CreateVectorOfStructs(pairVector);
-    auto arrayOffset = GSP::FB::CreateIntPairArrayData(builder, pairsVector);
-    builder.Finish(arrayOffset);
-  } else if constexpr (std::is_same_v<ElementType, double>) {
-    // Handle double pairs
-    std::vector<GSP::FB::Vec2> pairVector;
-
-    if constexpr (std::is_same_v<PairContainer, std::vector<std::pair<double, double>>>) {
-      // Handle std::vector<std::pair<double, double>>
-      pairVector.reserve(pairs.size());
-      for (const auto& p : pairs) {
-        pairVector.emplace_back(GSP::FB::Vec2(p.first, p.second));
-      }
-    } else if constexpr (std::is_same_v<PairContainer, Eigen::Matrix<double, Eigen::Dynamic, 2>>) {
-      // Handle Eigen::Matrix<double, Dynamic, 2>
-      pairVector.reserve(pairs.rows());
-      for (Eigen::Index i = 0; i < pairs.rows(); ++i) {
-        pairVector.emplace_back(GSP::FB::Vec2(pairs(i, 0), pairs(i, 1)));
-      }
+// Decode checked positions into an N x 3 Eigen matrix of any layout and scalar type
+template <typename Derived>
+static void decodePositions(const PositionFields& fields, Eigen::PlainObjectBase<Derived>& out) {
+  using Scalar = typename Derived::Scalar;
+  using RowMajorX3 = Eigen::Matrix<Scalar, Eigen::Dynamic, 3, Eigen::RowMajor>;
+  const auto count = static_cast<Eigen::Index>(fields.count);
+
+  if (fields.doubles) {
+    out = Eigen::Map<const MatrixX3d>(reinterpret_cast<const double*>(fields.doubles->Data()),
+                                      count, 3)
+              .template cast<Scalar>();
+  } else if (fields.floats) {
+    out = Eigen::Map<const MatrixX3f>(reinterpret_cast<const float*>(fields.floats->Data()),
+                                      count, 3)
+              .template cast<Scalar>();
+  } else if (fields.quantized) {
+    if constexpr (Derived::IsRowMajor && Derived::ColsAtCompileTime == 3) {
+      // Packed row-major storage matches the interleaved values: decode in place
+      out.resize(count, 3);
+      dequantizePositions(*fields.quantized, out.data());
+    } else {
+      RowMajorX3 packed(count, 3);
+      dequantizePositions(*fields.quantized, packed.data());
+      out = packed;
     }
+  } else {
+    out.resize(0, 3);
+  }
+}
 
-    auto pairsVector = builder.CreateVectorOfStructs(pairVector);
-    auto arrayOffset = GSP::FB::CreateDoublePairArrayData(builder, pairsVector);
-    builder.Finish(arrayOffset);
+template <typename PointContainer>
+static size_t pointCount(const PointContainer& points) {
+  if constexpr (std::is_base_of_v<Eigen::EigenBase<PointContainer>, PointContainer>) {
+    return static_cast<size_t>(points.rows());
+  } else {
+    return points.size();
   }
+}
 
-  // Copy the serialized data to the provided buffer
-  resSize = builder.GetSize();
-  resBuffer = static_cast<uint8_t*>(AllocateInteropMemory(resSize));
-  if (!resBuffer) {
-    return false;  // Handle allocation failure
+// N x 3 Eigen view of any supported point container, without copying
+template <typename PointContainer>
+static decltype(auto) pointMatrix(const PointContainer& points) {
+  if constexpr (!std::is_base_of_v<Eigen::EigenBase<PointContainer>, PointContainer>) {
+    // vector/span of Vector3d: packed x,y,z doubles, i.e. a row-major N x 3 block
+    static_assert(sizeof(Vector3d) == 3 * sizeof(double));
+    return Eigen::Map<const MatrixX3d>(reinterpret_cast<const double*>(points.data()),
+                                       static_cast<Eigen::Index>(points.size()), 3);
+  } else if constexpr (PointContainer::ColsAtCompileTime == 3) {
+    return (points);
+  } else {
+    // Column-major MatrixXd: only the first three columns are positions
+    return points.leftCols(3);
   }
-  std::memcpy(resBuffer, builder.GetBufferPointer(), resSize);
+}
 
+// Template function to handle vector/span of Vector3d and Eigen point matrices
+template <typename PointContainer>
+static bool createPointArray(flatbuffers::FlatBufferBuilder& builder,
+                             const PointContainer& points,
+                             const PositionEncodingOptions& options,
+                             flatbuffers::Offset<GSP::FB::PointArrayData>& offset) {
+  // Positions are written straight into the builder: packed double storage is a linear copy,
+  // other layouts and encodings are converted in the same pass
+  PositionOffsets offsets;
+  if (!buildPositions(builder, pointMatrix(points), options, offsets)) {
+    return false;
+  }
+
+  offset =
+      GSP::FB::CreatePointArrayData(builder, offsets.doubles, offsets.floats, offsets.quantized);
   return true;
 }
 
-// Unified number pair array deserialization
-template <typename PairContainer>
-bool deserializeNumberPairArray(const uint8_t* data, int size, PairContainer& pairArray) {
-  // Extract element type from container
-  using ElementType = typename pair_element_type<PairContainer>::type;
-
-  if constexpr (std::is_same_v<ElementType, int>) {
-    // Handle integer pairs
-    flatbuffers::Verifier verifier(data, size);
-    if (!verifier.VerifyBuffer<GSP::FB::IntPairArrayData>()) {
-      return false;
-    }
+template <typename PointContainer>
+static bool buildPointArray(flatbuffers::FlatBufferBuilder& builder,
+                            const PointContainer& points,
+                            const PositionEncodingOptions& options) {
+  flatbuffers::Offset<GSP::FB::PointArrayData> ptArray;
+  if (!createPointArray(builder, points, options, ptArray)) {
+    return false;
+  }
+  builder.Finish(ptArray);
+  return true;
+}
 
-    auto arrayData = GSP::FB::GetIntPairArrayData(data);
-    if (!arrayData || !arrayData->pairs()) {
-      return false;
-    }
+template <typename PointContainer>
+bool serializePointArray(const PointContainer& points,
+                         uint8_t*& resBuffer,
+                         int& resSize,
+                         const PositionEncodingOptions& options) {
+  return serializeToInterop(
+      pointArraySizeBound(pointCount(points), options.encoding),
+      [&](auto& builder) { return buildPointArray(builder, points, options); }, resBuffer,
+      resSize);
+}
 
-    auto pairs = arrayData->pairs();
+template <typename PointContainer>
+bool serializePointArray(const PointContainer& points,
+                         MutableByteSpan dst,
+                         int& resSize,
+                         const PositionEncodingOptions& options) {
+  return serializeToSpan(
+      [&](auto& builder) { return buildPointArray(builder, points, options); }, dst, resSize);
+}
 
-    if constexpr (std::is_same_v<PairContainer, std::vector<std::pair<int, int>>>) {
-      // Clear the output vector and reserve space
-      pairArray.clear();
-      pairArray.reserve(pairs->size());
+// Template function to handle vector<Vector3d>, Eigen point matrices and zero-copy views
+template <typename PointContainer>
+bool deserializePointArray(const uint8_t* data,
+                           int size,
+                           PointContainer& pointArray,
+                           VerifyPolicy policy) {
+  // Check the buffer according to the policy
+  CheckedRoot<GSP::FB::PointArrayData> ptArrayData(data, size, policy);
+  PositionFields fields;
+  if (!ptArrayData ||
+      !ptArrayData.readableSlots(ptArrayData.get(), {GSP::FB::PointArrayData::VT_POINTS,
+                                                     GSP::FB::PointArrayData::VT_POINTS_F,
+                                                     GSP::FB::PointArrayData::VT_POINTS_Q}) ||
+      !readPositions(ptArrayData, ptArrayData->points(), ptArrayData->points_f(),
+                     ptArrayData->points_q(), fields)) {
+    return false;
+  }
 
-      // Fill with pairs
-      for (size_t i = 0; i < pairs->size(); i++) {
-        auto pair = pairs->Get(i);
-        pairArray.emplace_back(std::make_pair(pair->x(), pair->y()));
-      }
-    } else if constexpr (std::is_same_v<PairContainer, Eigen::Matrix<int, Eigen::Dynamic, 2>>) {
-      // Resize the matrix
-      pairArray.resize(pairs->size(), 2);
-
-      // Fill the matrix
-      for (size_t i = 0; i < pairs->size(); i++) {
-        auto pair = pairs->Get(i);
-        pairArray(i, 0) = pair->x();
-        pairArray(i, 1) = pair->y();
-      }
+  // [Vec3] is packed x,y,z doubles, so it is read as one row-major block
+  const auto count = static_cast<Eigen::Index>(fields.count);
+  const double* first =
+      fields.doubles && count > 0 ? reinterpret_cast<const double*>(fields.doubles->Data())
+                                  : nullptr;
+
+  if constexpr (std::is_same_v<PointContainer, std::vector<Vector3d>>) {
+    // Packed Vector3d storage has the same layout: decoded straight into the vector
+    pointArray.resize(fields.count);
+    Eigen::Map<MatrixX3d> target(reinterpret_cast<double*>(pointArray.data()), count, 3);
+    if (first) {
+      target = Eigen::Map<const MatrixX3d>(first, count, 3);
+    } else if (count > 0) {
+      MatrixX3d decoded;
+      decodePositions(fields, decoded);
+      target = decoded;
     }
-  } else if constexpr (std::is_same_v<ElementType, double>) {
-    // Handle double pairs
-    flatbuffers::Verifier verifier(data, size);
-    if (!verifier.VerifyBuffer<GSP::FB::DoublePairArrayData>()) {
+  } else if constexpr (std::is_same_v<PointContainer, std::span<const Vector3d>>) {
+    // Zero-copy view into the buffer
+    if (count > 0 && !first) {
       return false;
     }
-
-    auto arrayData = GSP::FB::GetDoublePairArrayData(data);
-    if (!arrayData || !arrayData->pairs()) {
+    pointArray = std::span<const Vector3d>(reinterpret_cast<const Vector3d*>(first), fields.count);
+  } else if constexpr (std::is_same_v<PointContainer, Eigen::Map<const MatrixX3d>>) {
+    // Zero-copy view into the buffer; Eigen::Map cannot be reassigned, only re-seated
+    if (count > 0 && !first) {
       return false;
     }
+    new (&pointArray) Eigen::Map<const MatrixX3d>(first, count, 3);
+  } else {
+    // Owning Eigen matrices: bulk copy for MatrixX3d, transpose/conversion otherwise
+    decodePositions(fields, pointArray);
+  }
 
-    auto pairs = arrayData->pairs();
-
-    if constexpr (std::is_same_v<PairContainer, std::vector<std::pair<double, double>>>) {
-      // Clear the output vector and reserve space
-      pairArray.clear();
-      pairArray.reserve(pairs->size());
+  return true;
+}
 
-      // Fill with pairs
-      for (size_t i = 0; i < pairs->size(); i++) {
-        auto pair = pairs->Get(i);
-        pairArray.emplace_back(std::make_pair(pair->x(), pair->y()));
-      }
-    } else if constexpr (std::is_same_v<PairContainer, Eigen::Matrix<double, Eigen::Dynamic, 2>>) {
-      // Resize the matrix
-      pairArray.resize(pairs->size(), 2);
-
-      // Fill the matrix
-      for (size_t i = 0; i < pairs->size(); i++) {
-        auto pair = pairs->Get(i);
-        pairArray(i, 0) = pair->x();
-        pairArray(i, 1) = pair->y();
-      }
-    }
+// Serialized bytes of `indexCount` face indices in the given encoding
+static size_t facesSize(size_t indexCount, size_t vertexCount, FaceEncoding encoding) {
+  switch (encoding) {
+    case FaceEncoding::Compact:
+      return kTableOverhead + kVectorOverhead +
+             (vertexCount <= 0x10000 ? sizeof(uint16_t) : sizeof(int)) * indexCount;
+    case FaceEncoding::DeltaVarint:
+      return kTableOverhead + kVectorOverhead + maxDeltaVarintSize(indexCount);
+    default:
+      return kVectorOverhead + sizeof(int) * indexCount;
   }
+}
 
-  return true;
+size_t meshSizeBound(size_t vertexCount,
+                     size_t faceCount,
+                     int faceVertexCount,
+                     const MeshEncodingOptions& options) {
+  return kTableOverhead + positionsSize(vertexCount, options.vertices.encoding) +
+         facesSize(static_cast<size_t>(faceVertexCount) * faceCount, vertexCount, options.faces);
 }
 
-bool serializePoint(const Vector3d& point, uint8_t*& resBuffer, int& resSize) {
-  flatbuffers::FlatBufferBuilder builder;
+size_t polygonMeshSizeBound(size_t vertexCount,
+                            size_t faceCount,
+                            size_t indexCount,
+                            PositionEncoding encoding) {
+  return kTableOverhead + positionsSize(vertexCount, encoding) + 2 * kVectorOverhead +
+         sizeof(int) * (faceCount + 1 + indexCount);
+}
 
-  auto vec = GSP::FB::Vec3(point[0], point[1], point[2]);
-  auto ptOffset = GSP::FB::CreatePointData(builder, &vec);
-  builder.Finish(ptOffset);
+// Write faces as a CompressedFaces index stream (row-major order, face after face)
+static bool buildCompressedFaces(flatbuffers::FlatBufferBuilder& builder,
+                                 const Eigen::MatrixXi& F,
+                                 FaceEncoding encoding,
+                                 flatbuffers::Offset<GSP::FB::CompressedFaces>& offset) {
+  if (static_cast<uint64_t>(F.rows()) > UINT32_MAX) {
+    return false;
+  }
 
-  // Copy the serialized data to the provided buffer
-  resSize = builder.GetSize();
-  resBuffer = static_cast<uint8_t*>(AllocateInteropMemory(resSize));
-  if (!resBuffer) {
-    return false;  // Handle allocation failure
+  const MatrixXi rows = F;  // Row-major: indices face after face
+  const std::span<const int> indices(rows.data(), static_cast<size_t>(rows.size()));
+
+  GSP::FB::IndexEncoding indexEncoding;
+  flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data;
+  if (encoding == FaceEncoding::Compact) {
+    // Written in place at the narrowest width that holds every index
+    const int width = fitsIndex16(indices) ? 2 : 4;
+    indexEncoding = width == 2 ? GSP::FB::IndexEncoding::U16 : GSP::FB::IndexEncoding::U32;
+
+    uint8_t* bytes = nullptr;
+    data = builder.CreateUninitializedVector(width * indices.size(), &bytes);
+    encodeFixedWidth(indices, width, bytes);
+  } else if (encoding == FaceEncoding::DeltaVarint) {
+    // Variable length, so staged in a reused thread-local buffer first. Like the scratch
+    // builder (InteropMemory.h), it gives back storage grown past a few MB by a large mesh.
+    constexpr size_t kScratchRetainBytes = 4 * 1024 * 1024;
+    thread_local std::vector<uint8_t> bytes;
+    const bool encoded = encodeDeltaVarint(indices, bytes);
+    if (encoded) {
+      data = builder.CreateVector(bytes);
+    }
+    if (bytes.capacity() > kScratchRetainBytes) {
+      std::vector<uint8_t>().swap(bytes);
+    }
+    if (!encoded) {
+      return false;
+    }
+    indexEncoding = GSP::FB::IndexEncoding::DeltaVarint;
+  } else {
+    return false;
   }
-  std::memcpy(resBuffer, builder.GetBufferPointer(), resSize);
 
+  offset = GSP::FB::CreateCompressedFaces(builder, indexEncoding, static_cast<uint8_t>(F.cols()),
+                                          static_cast<uint32_t>(F.rows()), data);
   return true;
 }
 
-bool deserializePoint(const uint8_t* buffer, int size, Vector3d& point) {
-  flatbuffers::Verifier verifier(buffer, size);
-  if (!verifier.VerifyBuffer<GSP::FB::PointData>()) {
-    return false;
+// ! Mesh attributes
+using AttributesOffset =
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<GSP::FB::MeshAttribute>>>;
+
+static size_t componentSize(AttributeType type) {
+  switch (type) {
+    case AttributeType::Float64:
+      return sizeof(double);
+    case AttributeType::UInt8:
+      return sizeof(uint8_t);
+    default:
+      return sizeof(float);
   }
+}
 
-  auto ptData = GSP::FB::GetPointData(buffer);
-  if (!ptData) {
-    return false;
+// Serialized bytes of one attribute table: header, name and values
+static size_t attributeSize(size_t nameLength,
+                            Eigen::Index count,
+                            Eigen::Index dimension,
+                            AttributeType type) {
+  return kTableOverhead + 2 * kVectorOverhead + sizeof(flatbuffers::uoffset_t) + nameLength + 1 +
+         static_cast<size_t>(count * dimension) * componentSize(type);
+}
+
+static size_t attributesSize(const Mesh& mesh) {
+  if (mesh.attributes.empty() && mesh.C.size() == 0) {
+    return 0;
+  }
+  size_t size = kVectorOverhead;
+  if (mesh.C.size() > 0) {
+    size += attributeSize(kScalarAttributeName.size(), mesh.C.size(), 1, AttributeType::Float64);
+  }
+  for (const auto& attribute : mesh.attributes) {
+    size += attributeSize(attribute.name.size(), attribute.count(), attribute.dimension(),
+                          attribute.type());
   }
+  return size;
+}
 
-  point = Vector3d(ptData->point()->x(), ptData->point()->y(), ptData->point()->z());
-  return true;
+static size_t attributesSize(const MeshView& view) {
+  size_t size = view.attributes.empty() ? 0 : kVectorOverhead;
+  for (const auto& attribute : view.attributes) {
+    size += attributeSize(attribute.name.size(), attribute.count, attribute.dimension,
+                          attribute.type);
+  }
+  return size;
 }
 
-// Template function to handle both vector<Vector3d> and MatrixXd
-template <typename PointContainer>
-bool serializePointArray(const PointContainer& points, uint8_t*& resBuffer, int& resSize) {
-  flatbuffers::FlatBufferBuilder builder;
+// Write one attribute channel; the values of the row-major matrix are one bulk copy
+template <typename T>
+static flatbuffers::Offset<GSP::FB::MeshAttribute> createAttribute(
+    flatbuffers::FlatBufferBuilder& builder,
+    std::string_view name,
+    AttributeDomain domain,
+    const T* values,
+    Eigen::Index count,
+    Eigen::Index dimension) {
+  auto nameOffset = builder.CreateString(name.data(), name.size());
+  auto valuesOffset = builder.CreateVector(values, static_cast<size_t>(count * dimension));
+
+  GSP::FB::MeshAttributeBuilder attributeBuilder(builder);
+  attributeBuilder.add_name(nameOffset);
+  attributeBuilder.add_domain(static_cast<GSP::FB::AttributeDomain>(domain));
+  attributeBuilder.add_dimension(static_cast<uint8_t>(dimension));
+  if constexpr (std::is_same_v<T, float>) {
+    attributeBuilder.add_f32(valuesOffset);
+  } else if constexpr (std::is_same_v<T, double>) {
+    attributeBuilder.add_f64(valuesOffset);
+  } else if constexpr (std::is_same_v<T, int>) {
+    attributeBuilder.add_i32(valuesOffset);
+  } else {
+    attributeBuilder.add_u8(valuesOffset);
+  }
+  return attributeBuilder.Finish();
+}
 
-  // Convert data to FlatBuffer vectors
-  std::vector<GSP::FB::Vec3> pointVector;
-  if constexpr (std::is_same_v<PointContainer, std::vector<Vector3d>>) {
-    // Handle std::vector<Vector3d>
-    pointVector.reserve(points.size());
-    for (const auto& p : points) {
-      pointVector.emplace_back(p.x(), p.y(), p.z());
-    }
-  } else if constexpr (std::is_same_v<PointContainer, Eigen::MatrixXd>) {
-    // Handle Eigen::MatrixXd
-    pointVector.reserve(points.rows());
-    for (Eigen::Index i = 0; i < points.rows(); ++i) {
-      pointVector.emplace_back(points(i, 0), points(i, 1), points(i, 2));
-    }
+// Attribute channels of a mesh, Mesh::C included; a null offset if there are none. Fails on
+// channels that do not have one element of 1-4 components per vertex or face.
+static bool createAttributes(flatbuffers::FlatBufferBuilder& builder,
+                             const Mesh& mesh,
+                             AttributesOffset& offset) {
+  offset = {};
+  if (mesh.attributes.empty() && mesh.C.size() == 0) {
+    return true;
   }
 
-  auto vecVector = builder.CreateVectorOfStructs(pointVector);
-  auto ptArray = GSP::FB::CreatePointArrayData(builder, vecVector);
-  builder.Finish(ptArray);
+  std::vector<flatbuffers::Offset<GSP::FB::MeshAttribute>> items;
+  items.reserve(mesh.attributes.size() + 1);
+  if (mesh.C.size() > 0) {
+    if (mesh.C.size() != mesh.V.rows()) {
+      return false;
+    }
+    items.push_back(createAttribute(builder, kScalarAttributeName, AttributeDomain::Vertex,
+                                    mesh.C.data(), mesh.C.size(), 1));
+  }
 
-  // Copy the serialized data to the provided buffer
-  resSize = builder.GetSize();
-  resBuffer = static_cast<uint8_t*>(AllocateInteropMemory(resSize));
-  if (!resBuffer) {
-    return false;  // Handle allocation failure
+  for (const auto& attribute : mesh.attributes) {
+    const Eigen::Index expected =
+        attribute.domain == AttributeDomain::Vertex ? mesh.V.rows() : mesh.faceCount();
+    if (attribute.count() != expected || attribute.dimension() < 1 || attribute.dimension() > 4) {
+      return false;
+    }
+    items.push_back(std::visit(
+        [&](const auto& values) {
+          return createAttribute(builder, attribute.name, attribute.domain, values.data(),
+                                 values.rows(), values.cols());
+        },
+        attribute.data));
   }
-  std::memcpy(resBuffer, builder.GetBufferPointer(), resSize);
 
+  offset = builder.CreateVector(items);
   return true;
 }
-// Template function to handle both vector<Vector3d> and MatrixXd output types
-template <typename PointContainer>
-bool deserializePointArray(const uint8_t* data, int size, PointContainer& pointArray) {
-  // Verify the buffer integrity
-  flatbuffers::Verifier verifier(data, size);
-  if (!verifier.VerifyBuffer<GSP::FB::PointArrayData>()) {
+
+// Check one attribute table and map it as a view into the buffer: exactly one value vector,
+// 1-4 components, one element per vertex or face
+static bool readAttribute(const GSP::FB::MeshAttribute& attribute,
+                          Eigen::Index vertexCount,
+                          Eigen::Index faceCount,
+                          MeshAttributeView& view) {
+  const int dimension = attribute.dimension();
+  const auto domain = attribute.domain();
+  if (dimension < 1 || dimension > 4 ||
+      (domain != GSP::FB::AttributeDomain::Vertex && domain != GSP::FB::AttributeDomain::Face)) {
     return false;
   }
 
-  // Get the vector from the buffer
-  auto ptArrayData = GSP::FB::GetPointArrayData(data);
-  if (!ptArrayData) {
+  int present = 0;
+  size_t valueCount = 0;
+  auto use = [&](const auto* values, AttributeType type) {
+    if (values) {
+      ++present;
+      view.type = type;
+      view.data = values->data();
+      valueCount = values->size();
+    }
+  };
+  use(attribute.f32(), AttributeType::Float32);
+  use(attribute.f64(), AttributeType::Float64);
+  use(attribute.i32(), AttributeType::Int32);
+  use(attribute.u8(), AttributeType::UInt8);
+  if (present != 1 || valueCount % dimension != 0) {
     return false;
   }
 
-  auto points = ptArrayData->points();
+  auto name = attribute.name();
+  view.name = name ? std::string_view(name->c_str(), name->size()) : std::string_view();
+  view.domain = static_cast<AttributeDomain>(domain);
+  view.count = static_cast<Eigen::Index>(valueCount / dimension);
+  view.dimension = dimension;
+  return view.count == (view.domain == AttributeDomain::Vertex ? vertexCount : faceCount);
+}
 
-  if constexpr (std::is_same_v<PointContainer, std::vector<Vector3d>>) {
-    // Clear the output vector and reserve space for better performance
-    pointArray.clear();
-    pointArray.reserve(points->size());
+template <typename Root>
+static bool readAttributeViews(CheckedRoot<Root>& checked,
+                               const GSP::FB::MeshData* meshData,
+                               Eigen::Index vertexCount,
+                               Eigen::Index faceCount,
+                               std::vector<MeshAttributeView>& views) {
+  views.clear();
+  if (!checked.readableSlots(meshData, {GSP::FB::MeshData::VT_ATTRIBUTES})) {
+    return false;
+  }
+  auto attributes = meshData->attributes();
+  if (!attributes) {
+    return true;
+  }
+  if (!checked.readable(attributes)) {
+    return false;
+  }
 
-    // Convert each FlatBuffers Vec3 to an Eigen Vector3d
-    for (size_t i = 0; i < points->size(); i++) {
-      auto point = points->Get(i);
-      pointArray.emplace_back(point->x(), point->y(), point->z());
+  views.resize(attributes->size());
+  for (flatbuffers::uoffset_t i = 0; i < attributes->size(); ++i) {
+    auto attribute = attributes->Get(i);
+    if (!checked.readableTable(attribute) ||
+        !readAttribute(*attribute, vertexCount, faceCount, views[i])) {
+      return false;
     }
-  } else if constexpr (std::is_same_v<PointContainer, Eigen::MatrixXd>) {
-    // Resize the matrix to hold all points
-    pointArray.resize(points->size(), 3);
+  }
+  return true;
+}
 
-    // Fill the matrix with point data
-    for (size_t i = 0; i < points->size(); i++) {
-      auto point = points->Get(i);
-      pointArray.row(i) << point->x(), point->y(), point->z();
-    }
+// Copy the attribute channels of a mesh table (read after its vertices and faces); the first
+// per-vertex scalar double channel named kScalarAttributeName goes back to Mesh::C
+template <typename Root>
+static bool readAttributes(CheckedRoot<Root>& checked,
+                           const GSP::FB::MeshData* meshData,
+                           Mesh& mesh) {
+  std::vector<MeshAttributeView> views;
+  mesh.attributes.clear();
+  mesh.C.resize(0);
+  if (!readAttributeViews(checked, meshData, mesh.V.rows(), mesh.faceCount(), views)) {
+    return false;
   }
 
+  bool hasScalars = false;
+  mesh.attributes.reserve(views.size());
+  for (const auto& view : views) {
+    if (!hasScalars && view.name == kScalarAttributeName &&
+        view.domain == AttributeDomain::Vertex && view.dimension == 1 &&
+        view.type == AttributeType::Float64) {
+      mesh.C = view.map<double>();
+      hasScalars = true;
+    } else {
+      mesh.attributes.push_back(view.toAttribute());
+    }
+  }
   return true;
 }
 
-bool serializeMesh(const Mesh& mesh, uint8_t*& resBuffer, int& resSize) {
-  flatbuffers::FlatBufferBuilder builder;
+// Polygon meshes: the CSR face arrays are written as two bulk int vectors
+static bool createPolygonMesh(flatbuffers::FlatBufferBuilder& builder,
+                              const Mesh& mesh,
+                              const PositionEncodingOptions& options,
+                              flatbuffers::Offset<GSP::FB::MeshData>& offset) {
+  const Eigen::VectorXi& offsets = mesh.faceOffsets;
+  const Eigen::VectorXi& indices = mesh.faceIndices;
+  if (offsets(0) != 0 || offsets(offsets.size() - 1) != indices.size()) {
+    return false;  // Offsets do not span the index array
+  }
+
+  auto faceOffsets = builder.CreateVector(offsets.data(), static_cast<size_t>(offsets.size()));
+  auto faceIndices = builder.CreateVector(indices.data(), static_cast<size_t>(indices.size()));
+
+  PositionOffsets vertices;
+  AttributesOffset attributes;
+  if (!buildPositions(builder, mesh.V, options, vertices) ||
+      !createAttributes(builder, mesh, attributes)) {
+    return false;
+  }
+
+  GSP::FB::MeshDataBuilder meshBuilder(builder);
+  meshBuilder.add_vertices(vertices.doubles);
+  meshBuilder.add_vertices_f(vertices.floats);
+  meshBuilder.add_vertices_q(vertices.quantized);
+  meshBuilder.add_face_offsets(faceOffsets);
+  meshBuilder.add_face_indices(faceIndices);
+  meshBuilder.add_attributes(attributes);
+  offset = meshBuilder.Finish();
+  return true;
+}
 
-  // Convert vertices to flatbuffers compatible format
-  std::vector<GSP::FB::Vec3> vertices;
-  vertices.reserve(mesh.V.rows());
-  for (size_t i = 0; i < mesh.V.rows(); i++) {
-    vertices.emplace_back(mesh.V(i, 0), mesh.V(i, 1), mesh.V(i, 2));
+static bool createMesh(flatbuffers::FlatBufferBuilder& builder,
+                       const Mesh& mesh,
+                       const MeshEncodingOptions& options,
+                       flatbuffers::Offset<GSP::FB::MeshData>& offset) {
+  if (mesh.isPolygonMesh()) {
+    return createPolygonMesh(builder, mesh, options.vertices, offset);
   }
 
   // Determine if this is a triangle or quad mesh
@@ -466,233 +836,922 @@ bool serializeMesh(const Mesh& mesh, uint8_t*& resBuffer, int& resSize) {
   
   flatbuffers::Offset<flatbuffers::Vector<const GSP::FB::Vec3i*>> facesVector;
   flatbuffers::Offset<flatbuffers::Vector<const GSP::FB::Vec4i*>> quadFacesVector;
+  flatbuffers::Offset<GSP::FB::CompressedFaces> compressedFaces;
   
-  if (faceCols == 3) {
-    // Triangle mesh - use existing Vec3i format
-    std::vector<GSP::FB::Vec3i> faces;
-    faces.reserve(mesh.F.rows());
-    for (size_t i = 0; i < mesh.F.rows(); i++) {
-      faces.emplace_back(mesh.F(i, 0), mesh.F(i, 1), mesh.F(i, 2));
-    }
-    facesVector = builder.CreateVectorOfStructs(faces);
-  } else if (faceCols == 4) {
-    // Quad mesh - use Vec4i format
-    std::vector<GSP::FB::Vec4i> quadFaces;
-    quadFaces.reserve(mesh.F.rows());
-    for (size_t i = 0; i < mesh.F.rows(); i++) {
-      quadFaces.emplace_back(mesh.F(i, 0), mesh.F(i, 1), mesh.F(i, 2), mesh.F(i, 3));
-    }
-    quadFacesVector = builder.CreateVectorOfStructs(quadFaces);
-  } else {
+  if (faceCols != 3 && faceCols != 4) {
     // Invalid face count
     return false;
+  } else if (options.faces != FaceEncoding::Plain) {
+    // Compact index stream
+    if (!buildCompressedFaces(builder, mesh.F, options.faces, compressedFaces)) {
+      return false;
+    }
+  } else if (faceCols == 3) {
+    // Triangle mesh: [Vec3i] rows are packed like a row-major N x 3 block, filled in place
+    static_assert(sizeof(GSP::FB::Vec3i) == 3 * sizeof(int));
+    GSP::FB::Vec3i* faces = nullptr;
+    facesVector =
+        builder.CreateUninitializedVectorOfStructs(static_cast<size_t>(mesh.F.rows()), &faces);
+    Eigen::Map<MatrixXi>(reinterpret_cast<int*>(faces), mesh.F.rows(), 3) = mesh.F;
+  } else if (faceCols == 4) {
+    // Quad mesh: [Vec4i] rows, the same way
+    static_assert(sizeof(GSP::FB::Vec4i) == 4 * sizeof(int));
+    GSP::FB::Vec4i* quadFaces = nullptr;
+    quadFacesVector = builder.CreateUninitializedVectorOfStructs(
+        static_cast<size_t>(mesh.F.rows()), &quadFaces);
+    Eigen::Map<MatrixXi>(reinterpret_cast<int*>(quadFaces), mesh.F.rows(), 4) = mesh.F;
   }
 
-  // Create vertices vector
-  auto verticesVector = builder.CreateVectorOfStructs(vertices);
+  // Create the vertices in the requested encoding, then the attribute channels
+  PositionOffsets vertices;
+  AttributesOffset attributes;
+  if (!buildPositions(builder, mesh.V, options.vertices, vertices) ||
+      !createAttributes(builder, mesh, attributes)) {
+    return false;
+  }
 
   // Create the mesh with appropriate face data
   GSP::FB::MeshDataBuilder meshBuilder(builder);
-  meshBuilder.add_vertices(verticesVector);
+  meshBuilder.add_vertices(vertices.doubles);
+  meshBuilder.add_vertices_f(vertices.floats);
+  meshBuilder.add_vertices_q(vertices.quantized);
   
-  if (faceCols == 3) {
+  if (options.faces != FaceEncoding::Plain) {
+    meshBuilder.add_faces_c(compressedFaces);
+  } else if (faceCols == 3) {
     meshBuilder.add_faces(facesVector);
   } else if (faceCols == 4) {
     meshBuilder.add_quad_faces(quadFacesVector);
   }
-  
-  auto meshOffset = meshBuilder.Finish();
+  meshBuilder.add_attributes(attributes);
+
+  offset = meshBuilder.Finish();
+  return true;
+}
+
+static bool buildMesh(flatbuffers::FlatBufferBuilder& builder,
+                      const Mesh& mesh,
+                      const MeshEncodingOptions& options) {
+  flatbuffers::Offset<GSP::FB::MeshData> meshOffset;
+  if (!createMesh(builder, mesh, options, meshOffset)) {
+    return false;
+  }
   builder.Finish(meshOffset);
+  return true;
+}
+
+size_t meshSizeBound(const Mesh& mesh, const MeshEncodingOptions& options) {
+  const size_t geometry =
+      mesh.isPolygonMesh()
+          ? polygonMeshSizeBound(static_cast<size_t>(mesh.V.rows()),
+                                 static_cast<size_t>(mesh.faceCount()),
+                                 static_cast<size_t>(mesh.faceIndices.size()),
+                                 options.vertices.encoding)
+          : meshSizeBound(static_cast<size_t>(mesh.V.rows()), static_cast<size_t>(mesh.F.rows()),
+                          static_cast<int>(mesh.F.cols()), options);
+  return geometry + attributesSize(mesh);
+}
+
+size_t meshSizeBound(const MeshView& view, const MeshEncodingOptions& options) {
+  const size_t geometry =
+      view.isPolygonMesh()
+          ? polygonMeshSizeBound(static_cast<size_t>(view.V.rows()),
+                                 static_cast<size_t>(view.faceCount()),
+                                 static_cast<size_t>(view.faceIndices.size()),
+                                 options.vertices.encoding)
+          : meshSizeBound(static_cast<size_t>(view.V.rows()), static_cast<size_t>(view.F.rows()),
+                          view.faceVertexCount(), options);
+  return geometry + attributesSize(view);
+}
+
+bool serializeMesh(const Mesh& mesh,
+                   uint8_t*& resBuffer,
+                   int& resSize,
+                   const MeshEncodingOptions& options) {
+  return serializeToInterop(
+      meshSizeBound(mesh, options),
+      [&](auto& builder) { return buildMesh(builder, mesh, options); }, resBuffer, resSize);
+}
 
-  // Copy the serialized data to the provided buffer
-  resSize = builder.GetSize();
-  resBuffer = static_cast<uint8_t*>(AllocateInteropMemory(resSize));
-  if (!resBuffer) {
-    return false;  // Handle allocation failure
+bool serializeMesh(const Mesh& mesh,
+                   MutableByteSpan dst,
+                   int& resSize,
+                   const MeshEncodingOptions& options) {
+  return serializeToSpan([&](auto& builder) { return buildMesh(builder, mesh, options); }, dst,
+                         resSize);
+}
+
+// Face block of a checked mesh table: quads when present, triangles otherwise
+template <typename Root>
+static bool readMeshFaces(CheckedRoot<Root>& checked,
+                          const GSP::FB::MeshData* meshData,
+                          const int*& faces,
+                          Eigen::Index& faceCount,
+                          Eigen::Index& faceVertexCount) {
+  // The FlatBuffers structs are packed exactly like rows of the row-major Eigen matrices
+  static_assert(sizeof(GSP::FB::Vec3i) == 3 * sizeof(int));
+  static_assert(sizeof(GSP::FB::Vec4i) == 4 * sizeof(int));
+
+  if (!checked.readableSlots(meshData,
+                             {GSP::FB::MeshData::VT_FACES, GSP::FB::MeshData::VT_QUAD_FACES})) {
+    return false;
+  }
+  auto triFaces = meshData->faces();
+  auto quadFaces = meshData->quad_faces();
+
+  if (quadFaces && quadFaces->size() > 0) {
+    if (!checked.readable(quadFaces)) {
+      return false;
+    }
+    // Quad mesh
+    faces = reinterpret_cast<const int*>(quadFaces->Data());
+    faceCount = static_cast<Eigen::Index>(quadFaces->size());
+    faceVertexCount = 4;
+  } else if (triFaces && triFaces->size() > 0) {
+    if (!checked.readable(triFaces)) {
+      return false;
+    }
+    // Triangle mesh
+    faces = reinterpret_cast<const int*>(triFaces->Data());
+    faceCount = static_cast<Eigen::Index>(triFaces->size());
+    faceVertexCount = 3;
+  } else {
+    return false;  // No faces found
   }
-  std::memcpy(resBuffer, builder.GetBufferPointer(), resSize);
 
   return true;
 }
 
-bool deserializeMesh(const uint8_t* data, int size, Mesh& mesh) {
-  // Verify the buffer integrity
-  flatbuffers::Verifier verifier(data, size);
-  if (!verifier.VerifyBuffer<GSP::FB::MeshData>()) {
+// CSR face block of a checked mesh table. Unless trusted, the offsets must start at 0, never
+// decrease and end at the index count, so every face lies inside the index vector.
+template <typename Root>
+static bool readPolygonFaces(CheckedRoot<Root>& checked,
+                             const GSP::FB::MeshData* meshData,
+                             const int*& offsets,
+                             Eigen::Index& faceCount,
+                             const int*& indices,
+                             Eigen::Index& indexCount) {
+  if (!checked.readableSlots(meshData, {GSP::FB::MeshData::VT_FACE_OFFSETS,
+                                        GSP::FB::MeshData::VT_FACE_INDICES})) {
     return false;
   }
+  auto faceOffsets = meshData->face_offsets();
+  auto faceIndices = meshData->face_indices();
+  if (!checked.readable(faceOffsets) || faceOffsets->size() == 0 ||
+      (faceIndices && !checked.readable(faceIndices))) {
+    return false;
+  }
+
+  offsets = faceOffsets->data();
+  faceCount = static_cast<Eigen::Index>(faceOffsets->size()) - 1;
+  indices = faceIndices ? faceIndices->data() : nullptr;
+  indexCount = faceIndices ? static_cast<Eigen::Index>(faceIndices->size()) : 0;
+
+  if (!checked.trusted()) {
+    if (offsets[0] != 0 || offsets[faceCount] != indexCount) {
+      return false;
+    }
+    for (Eigen::Index i = 0; i < faceCount; ++i) {
+      if (offsets[i + 1] < offsets[i]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
 
-  // Get the mesh data from the buffer
-  auto meshData = GSP::FB::GetMeshData(data);
-  if (!meshData) {
+// Decode a CompressedFaces index stream. Stream lengths are checked against the face count
+// before anything is allocated, so a corrupt count cannot trigger a huge allocation.
+static bool decodeCompressedFaces(const GSP::FB::CompressedFaces& compressed,
+                                  Eigen::MatrixXi& F) {
+  const int faceVertexCount = compressed.face_vertex_count();
+  if (faceVertexCount != 3 && faceVertexCount != 4) {
     return false;
   }
 
-  // Extract vertices
-  auto vertices = meshData->vertices();
-  if (!vertices) {
+  const size_t indexCount = static_cast<size_t>(compressed.face_count()) * faceVertexCount;
+  const auto data = compressed.data();
+  const ByteSpan bytes = data ? ByteSpan(data->data(), data->size()) : ByteSpan();
+
+  int width = 0;
+  switch (compressed.encoding()) {
+    case GSP::FB::IndexEncoding::U16:
+      width = 2;
+      break;
+    case GSP::FB::IndexEncoding::U32:
+      width = 4;
+      break;
+    case GSP::FB::IndexEncoding::DeltaVarint:
+      break;
+    default:
+      return false;
+  }
+  if (width > 0 ? bytes.size() != width * indexCount : bytes.size() < indexCount) {
+    return false;  // Every varint takes at least one byte
+  }
+
+  MatrixXi rows(static_cast<Eigen::Index>(compressed.face_count()), faceVertexCount);
+  const std::span<int> indices(rows.data(), indexCount);
+  if (width > 0) {
+    decodeFixedWidth(bytes.data(), width, indices);
+  } else if (!decodeDeltaVarint(bytes, indices)) {
     return false;
   }
-  mesh.V.resize(vertices->size(), 3);
-  for (size_t i = 0; i < vertices->size(); i++) {
-    auto vertex = vertices->Get(i);
-    mesh.V.row(i) = Eigen::Vector3d(vertex->x(), vertex->y(), vertex->z()).transpose();
+
+  F = rows;
+  return true;
+}
+
+// Shared by the double and float mesh outputs and by batches: positions and faces are decoded
+// from whichever encodings the table carries (Plain faces are a bulk copy; row-major source,
+// F column-major). CSR polygon faces need `faceOffsets` / `faceIndices`; without them such
+// tables fail.
+template <typename Root, typename VertexMatrix>
+static bool readMesh(CheckedRoot<Root>& checked,
+                     const GSP::FB::MeshData* meshData,
+                     VertexMatrix& V,
+                     Eigen::MatrixXi& F,
+                     Eigen::VectorXi* faceOffsets,
+                     Eigen::VectorXi* faceIndices) {
+  PositionFields vertices;
+  if (!checked.readableSlots(meshData, {GSP::FB::MeshData::VT_VERTICES,
+                                        GSP::FB::MeshData::VT_VERTICES_F,
+                                        GSP::FB::MeshData::VT_VERTICES_Q,
+                                        GSP::FB::MeshData::VT_FACE_OFFSETS,
+                                        GSP::FB::MeshData::VT_FACES_C}) ||
+      !readPositions(checked, meshData->vertices(), meshData->vertices_f(),
+                     meshData->vertices_q(), vertices) ||
+      !vertices.present()) {
+    return false;
   }
 
-  // Extract faces - check if we have triangle or quad faces
-  auto triFaces = meshData->faces();
-  auto quadFaces = meshData->quad_faces();
-  
-  if (quadFaces && quadFaces->size() > 0) {
-    // Quad mesh
-    mesh.F.resize(quadFaces->size(), 4);
-    for (size_t i = 0; i < quadFaces->size(); i++) {
-      auto face = quadFaces->Get(i);
-      mesh.F(i, 0) = face->x();
-      mesh.F(i, 1) = face->y();
-      mesh.F(i, 2) = face->z();
-      mesh.F(i, 3) = face->w();
+  if (meshData->face_offsets()) {
+    const int* offsets = nullptr;
+    const int* indices = nullptr;
+    Eigen::Index faceCount = 0;
+    Eigen::Index indexCount = 0;
+    if (!faceOffsets ||
+        !readPolygonFaces(checked, meshData, offsets, faceCount, indices, indexCount)) {
+      return false;
     }
-  } else if (triFaces && triFaces->size() > 0) {
-    // Triangle mesh
-    mesh.F.resize(triFaces->size(), 3);
-    for (size_t i = 0; i < triFaces->size(); i++) {
-      auto face = triFaces->Get(i);
-      mesh.F(i, 0) = face->x();
-      mesh.F(i, 1) = face->y();
-      mesh.F(i, 2) = face->z();
+    *faceOffsets = Eigen::Map<const Eigen::VectorXi>(offsets, faceCount + 1);
+    *faceIndices = Eigen::Map<const Eigen::VectorXi>(indices, indexCount);
+    F.resize(0, 0);
+  } else if (auto compressed = meshData->faces_c()) {
+    if (!checked.readableTable(compressed) || !decodeCompressedFaces(*compressed, F)) {
+      return false;
     }
   } else {
-    return false;  // No faces found
+    const int* faces = nullptr;
+    Eigen::Index faceCount = 0;
+    Eigen::Index faceVertexCount = 0;
+    if (!readMeshFaces(checked, meshData, faces, faceCount, faceVertexCount)) {
+      return false;
+    }
+    F = Eigen::Map<const MatrixXi>(faces, faceCount, faceVertexCount);
+  }
+
+  // Dense faces replace any polygon faces left in a reused output
+  if (faceOffsets && !meshData->face_offsets()) {
+    faceOffsets->resize(0);
+    faceIndices->resize(0);
+  }
+
+  decodePositions(vertices, V);
+  return true;
+}
+
+template <typename VertexMatrix>
+static bool deserializeMeshInto(const uint8_t* data,
+                                int size,
+                                VertexMatrix& V,
+                                Eigen::MatrixXi& F,
+                                Eigen::VectorXi* faceOffsets,
+                                Eigen::VectorXi* faceIndices,
+                                VerifyPolicy policy) {
+  CheckedRoot<GSP::FB::MeshData> meshData(data, size, policy);
+  return meshData && readMesh(meshData, meshData.get(), V, F, faceOffsets, faceIndices);
+}
+
+// Maps a MeshData table of a checked buffer (a single mesh or a batch item) onto `view`
+template <typename Root>
+static bool readMeshView(CheckedRoot<Root>& checked,
+                         const GSP::FB::MeshData* meshData,
+                         MeshView& view) {
+  // Only [Vec3] vertices (packed x,y,z doubles) can be mapped as a MatrixX3d
+  if (!checked.readableSlots(meshData, {GSP::FB::MeshData::VT_VERTICES,
+                                        GSP::FB::MeshData::VT_FACE_OFFSETS})) {
+    return false;
+  }
+  auto vertices = meshData->vertices();
+  if (!checked.readable(vertices)) {
+    return false;
+  }
+  auto vertexData = reinterpret_cast<const double*>(vertices->Data());
+  const auto vertexCount = static_cast<Eigen::Index>(vertices->size());
+
+  if (meshData->face_offsets()) {
+    const int* offsets = nullptr;
+    const int* indices = nullptr;
+    Eigen::Index faceCount = 0;
+    Eigen::Index indexCount = 0;
+    if (!readPolygonFaces(checked, meshData, offsets, faceCount, indices, indexCount)) {
+      return false;
+    }
+    view.resetPolygons(vertexData, vertexCount, offsets, faceCount, indices, indexCount);
+  } else {
+    const int* faces = nullptr;
+    Eigen::Index faceCount = 0;
+    Eigen::Index faceVertexCount = 0;
+    if (!readMeshFaces(checked, meshData, faces, faceCount, faceVertexCount)) {
+      return false;
+    }
+    view.reset(vertexData, vertexCount, faces, faceCount, faceVertexCount);
+  }
+
+  // Attribute channels are mapped in place as well
+  return readAttributeViews(checked, meshData, vertexCount, view.faceCount(), view.attributes);
+}
+
+bool deserializeMeshView(const uint8_t* data, int size, MeshView& view, VerifyPolicy policy) {
+  // Check the buffer according to the policy
+  CheckedRoot<GSP::FB::MeshData> meshData(data, size, policy);
+  return meshData && readMeshView(meshData, meshData.get(), view);
+}
+
+bool deserializeMesh(const uint8_t* data, int size, Mesh& mesh, VerifyPolicy policy) {
+  CheckedRoot<GSP::FB::MeshData> meshData(data, size, policy);
+  return meshData &&
+         readMesh(meshData, meshData.get(), mesh.V, mesh.F, &mesh.faceOffsets,
+                  &mesh.faceIndices) &&
+         readAttributes(meshData, meshData.get(), mesh);
+}
+
+bool deserializeMesh(const uint8_t* data,
+                     int size,
+                     MatrixX3f& V,
+                     Eigen::MatrixXi& F,
+                     VerifyPolicy policy) {
+  return deserializeMeshInto(data, size, V, F, nullptr, nullptr, policy);
+}
+
+// Batches: every item is built with the single-geometry create* step into one builder, and
+// read back with the same readers, checked against the one batch buffer
+size_t meshBatchSizeBound(std::span<const Mesh> meshes, const MeshEncodingOptions& options) {
+  size_t size = kTableOverhead + kVectorOverhead;
+  for (const Mesh& mesh : meshes) {
+    size += sizeof(flatbuffers::uoffset_t) + meshSizeBound(mesh, options);
+  }
+  return size;
+}
+
+size_t meshBatchSizeBound(std::span<const MeshView> views, const MeshEncodingOptions& options) {
+  size_t size = kTableOverhead + kVectorOverhead;
+  for (const MeshView& view : views) {
+    size += sizeof(flatbuffers::uoffset_t) + meshSizeBound(view, options);
+  }
+  return size;
+}
+
+size_t pointArrayBatchSizeBound(std::span<const MatrixX3d> pointArrays,
+                                PositionEncoding encoding) {
+  size_t size = kTableOverhead + kVectorOverhead;
+  for (const MatrixX3d& points : pointArrays) {
+    size += sizeof(flatbuffers::uoffset_t) +
+            pointArraySizeBound(static_cast<size_t>(points.rows()), encoding);
+  }
+  return size;
+}
+
+static bool buildMeshBatch(flatbuffers::FlatBufferBuilder& builder,
+                           std::span<const Mesh> meshes,
+                           const MeshEncodingOptions& options) {
+  std::vector<flatbuffers::Offset<GSP::FB::MeshData>> items(meshes.size());
+  for (size_t i = 0; i < meshes.size(); ++i) {
+    if (!createMesh(builder, meshes[i], options, items[i])) {
+      return false;
+    }
+  }
+
+  builder.Finish(GSP::FB::CreateMeshBatch(builder, builder.CreateVector(items)));
+  return true;
+}
+
+bool serializeMeshBatch(std::span<const Mesh> meshes,
+                        uint8_t*& resBuffer,
+                        int& resSize,
+                        const MeshEncodingOptions& options) {
+  return serializeToInterop(
+      meshBatchSizeBound(meshes, options),
+      [&](auto& builder) { return buildMeshBatch(builder, meshes, options); }, resBuffer,
+      resSize);
+}
+
+bool serializeMeshBatch(std::span<const Mesh> meshes,
+                        MutableByteSpan dst,
+                        int& resSize,
+                        const MeshEncodingOptions& options) {
+  return serializeToSpan(
+      [&](auto& builder) { return buildMeshBatch(builder, meshes, options); }, dst, resSize);
+}
+
+bool deserializeMeshBatch(const uint8_t* data,
+                          int size,
+                          std::vector<Mesh>& meshes,
+                          VerifyPolicy policy) {
+  CheckedRoot<GSP::FB::MeshBatch> batch(data, size, policy);
+  if (!batch || !batch.readableSlots(batch.get(), {GSP::FB::MeshBatch::VT_MESHES})) {
+    return false;
+  }
+  auto items = batch->meshes();
+  if (!batch.readable(items)) {
+    return false;
+  }
+
+  meshes.resize(items->size());
+  for (flatbuffers::uoffset_t i = 0; i < items->size(); ++i) {
+    auto item = items->Get(i);
+    Mesh& mesh = meshes[i];
+    if (!batch.readableItem(item) ||
+        !readMesh(batch, item, mesh.V, mesh.F, &mesh.faceOffsets, &mesh.faceIndices) ||
+        !readAttributes(batch, item, mesh)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool deserializeMeshBatchView(const uint8_t* data,
+                              int size,
+                              std::vector<MeshView>& views,
+                              VerifyPolicy policy) {
+  CheckedRoot<GSP::FB::MeshBatch> batch(data, size, policy);
+  if (!batch || !batch.readableSlots(batch.get(), {GSP::FB::MeshBatch::VT_MESHES})) {
+    return false;
+  }
+  auto items = batch->meshes();
+  if (!batch.readable(items)) {
+    return false;
+  }
+
+  views.resize(items->size());
+  for (flatbuffers::uoffset_t i = 0; i < items->size(); ++i) {
+    auto item = items->Get(i);
+    if (!batch.readableItem(item) || !readMeshView(batch, item, views[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool buildPointArrayBatch(flatbuffers::FlatBufferBuilder& builder,
+                                 std::span<const MatrixX3d> pointArrays,
+                                 const PositionEncodingOptions& options) {
+  std::vector<flatbuffers::Offset<GSP::FB::PointArrayData>> items(pointArrays.size());
+  for (size_t i = 0; i < pointArrays.size(); ++i) {
+    if (!createPointArray(builder, pointArrays[i], options, items[i])) {
+      return false;
+    }
+  }
+
+  builder.Finish(GSP::FB::CreatePointArrayBatch(builder, builder.CreateVector(items)));
+  return true;
+}
+
+bool serializePointArrayBatch(std::span<const MatrixX3d> pointArrays,
+                              uint8_t*& resBuffer,
+                              int& resSize,
+                              const PositionEncodingOptions& options) {
+  return serializeToInterop(
+      pointArrayBatchSizeBound(pointArrays, options.encoding),
+      [&](auto& builder) { return buildPointArrayBatch(builder, pointArrays, options); },
+      resBuffer, resSize);
+}
+
+bool serializePointArrayBatch(std::span<const MatrixX3d> pointArrays,
+                              MutableByteSpan dst,
+                              int& resSize,
+                              const PositionEncodingOptions& options) {
+  return serializeToSpan(
+      [&](auto& builder) { return buildPointArrayBatch(builder, pointArrays, options); }, dst,
+      resSize);
+}
+
+bool deserializePointArrayBatch(const uint8_t* data,
+                                int size,
+                                std::vector<MatrixX3d>& pointArrays,
+                                VerifyPolicy policy) {
+  CheckedRoot<GSP::FB::PointArrayBatch> batch(data, size, policy);
+  if (!batch || !batch.readableSlots(batch.get(), {GSP::FB::PointArrayBatch::VT_POINT_ARRAYS})) {
+    return false;
+  }
+  auto items = batch->point_arrays();
+  if (!batch.readable(items)) {
+    return false;
   }
 
+  pointArrays.resize(items->size());
+  for (flatbuffers::uoffset_t i = 0; i < items->size(); ++i) {
+    auto item = items->Get(i);
+    PositionFields fields;
+    if (!batch.readableItem(item) ||
+        !batch.readableSlots(item, {GSP::FB::PointArrayData::VT_POINTS,
+                                    GSP::FB::PointArrayData::VT_POINTS_F,
+                                    GSP::FB::PointArrayData::VT_POINTS_Q}) ||
+        !readPositions(batch, item->points(), item->points_f(), item->points_q(), fields)) {
+      return false;
+    }
+    decodePositions(fields, pointArrays[i]);
+  }
   return true;
 }
 
-template bool
-serializeNumberArray(const std::vector<double>& numbers, uint8_t*& resBuffer, int& resSize);
-template bool
-serializeNumberArray(const std::vector<int>& numbers, uint8_t*& resBuffer, int& resSize);
-template bool
-serializeNumberArray(const Eigen::VectorXd& numbers, uint8_t*& resBuffer, int& resSize);
-template bool
-serializeNumberArray(const Eigen::VectorXi& numbers, uint8_t*& resBuffer, int& resSize);
-template bool
-deserializeNumberArray(const uint8_t* data, int size, std::vector<double>& numberArray);
-template bool deserializeNumberArray(const uint8_t* data, int size, std::vector<int>& numberArray);
-template bool deserializeNumberArray(const uint8_t* data, int size, Eigen::VectorXd& numberArray);
-template bool deserializeNumberArray(const uint8_t* data, int size, Eigen::VectorXi& numberArray);
+// ! Mass properties
+size_t massPropertiesBatchSizeBound(size_t count) {
+  return kTableOverhead + kVectorOverhead +
+         count * (sizeof(flatbuffers::uoffset_t) + kTableOverhead + 2 * sizeof(double) +
+                  4 * sizeof(GSP::FB::Vec3));
+}
+
+bool serializeMassPropertiesBatch(std::span<const MassProperties> items,
+                                  uint8_t*& resBuffer,
+                                  int& resSize) {
+  return serializeToInterop(
+      massPropertiesBatchSizeBound(items.size()),
+      [&](flatbuffers::FlatBufferBuilder& builder) {
+        auto vec3 = [](const Vector3d& v) { return GSP::FB::Vec3(v.x(), v.y(), v.z()); };
+        std::vector<flatbuffers::Offset<GSP::FB::MassPropertiesData>> offsets(items.size());
+        for (size_t i = 0; i < items.size(); ++i) {
+          const MassProperties& item = items[i];
+          const auto areaCentroid = vec3(item.areaCentroid);
+          const auto volumeCentroid = vec3(item.volumeCentroid);
+          const auto diagonal = vec3(item.inertia.diagonal());
+          const GSP::FB::Vec3 products(item.inertia(0, 1), item.inertia(1, 2), item.inertia(2, 0));
+          offsets[i] = GSP::FB::CreateMassPropertiesData(builder, item.area, item.volume,
+                                                         &areaCentroid, &volumeCentroid,
+                                                         &diagonal, &products);
+        }
+        builder.Finish(GSP::FB::CreateMassPropertiesBatch(builder, builder.CreateVector(offsets)));
+        return true;
+      },
+      resBuffer, resSize);
+}
+
+// ! Bounding boxes
+size_t boundingBoxBatchSizeBound(size_t count) {
+  return kTableOverhead + kVectorOverhead +
+         count * (sizeof(flatbuffers::uoffset_t) + kTableOverhead + 5 * sizeof(GSP::FB::Vec3));
+}
+
+bool serializeBoundingBoxBatch(std::span<const OrientedBox> boxes,
+                               uint8_t*& resBuffer,
+                               int& resSize) {
+  return serializeToInterop(
+      boundingBoxBatchSizeBound(boxes.size()),
+      [&](flatbuffers::FlatBufferBuilder& builder) {
+        auto vec3 = [](const Vector3d& v) { return GSP::FB::Vec3(v.x(), v.y(), v.z()); };
+        std::vector<flatbuffers::Offset<GSP::FB::BoundingBoxData>> offsets(boxes.size());
+        for (size_t i = 0; i < boxes.size(); ++i) {
+          const OrientedBox& box = boxes[i];
+          const auto center = vec3(box.center);
+          const auto axisX = vec3(box.axes.col(0));
+          const auto axisY = vec3(box.axes.col(1));
+          const auto axisZ = vec3(box.axes.col(2));
+          const auto halfExtents = vec3(box.halfExtents);
+          offsets[i] = GSP::FB::CreateBoundingBoxData(builder, &center, &axisX, &axisY, &axisZ,
+                                                      &halfExtents);
+        }
+        builder.Finish(GSP::FB::CreateBoundingBoxBatch(builder, builder.CreateVector(offsets)));
+        return true;
+      },
+      resBuffer, resSize);
+}
+
+// ! Topology reports
+size_t topologyReportSizeBound(const TopologyReport& report) {
+  const size_t ints = report.degenerateFaces.size() + report.duplicateFaces.size() +
+                      report.nonManifoldVertices.size() + report.unreferencedVertices.size() +
+                      report.boundaryLoops.values.size() + report.boundaryLoops.offsets.size();
+  const size_t pairs = report.nonManifoldEdges.size() + report.inconsistentEdges.size();
+  return kTableOverhead + 4 * sizeof(int64_t) + 8 * kVectorOverhead + ints * sizeof(int) +
+         pairs * sizeof(GSP::FB::Vec2i);
+}
+
+bool serializeTopologyReport(const TopologyReport& report, uint8_t*& resBuffer, int& resSize) {
+  return serializeToInterop(
+      topologyReportSizeBound(report),
+      [&](flatbuffers::FlatBufferBuilder& builder) {
+        auto pairs = [&](const std::vector<std::pair<int, int>>& edges) {
+          GSP::FB::Vec2i* data = nullptr;
+          auto offset = builder.CreateUninitializedVectorOfStructs(edges.size(), &data);
+          for (const auto& [a, b] : edges) {
+            *data++ = GSP::FB::Vec2i(a, b);
+          }
+          return offset;
+        };
+        const auto& loops = report.boundaryLoops;
+        std::vector<int> loopSizes(loops.size());
+        for (size_t i = 0; i < loopSizes.size(); ++i) {
+          loopSizes[i] = loops.offsets[i + 1] - loops.offsets[i];
+        }
+
+        auto degenerate = builder.CreateVector(report.degenerateFaces);
+        auto duplicate = builder.CreateVector(report.duplicateFaces);
+        auto nonManifoldEdges = pairs(report.nonManifoldEdges);
+        auto nonManifoldVertices = builder.CreateVector(report.nonManifoldVertices);
+        auto unreferenced = builder.CreateVector(report.unreferencedVertices);
+        auto inconsistent = pairs(report.inconsistentEdges);
+        auto loopVertices = builder.CreateVector(loops.values);
+        auto sizes = builder.CreateVector(loopSizes);
+        builder.Finish(GSP::FB::CreateTopologyReport(
+            builder, report.vertexCount, report.faceCount,
+            static_cast<int64_t>(report.edgeCount), static_cast<int64_t>(report.boundaryEdgeCount),
+            degenerate, duplicate, nonManifoldEdges, nonManifoldVertices, unreferenced,
+            inconsistent, loopVertices, sizes));
+        return true;
+      },
+      resBuffer, resSize);
+}
+
+// ! Mesh queries
+size_t meshHitsSizeBound(size_t count) {
+  return kTableOverhead + 5 * kVectorOverhead +
+         count * (sizeof(int) + sizeof(double) + sizeof(GSP::FB::Vec3i) +
+                  2 * sizeof(GSP::FB::Vec3));
+}
+
+bool serializeMeshHits(std::span<const MeshBvh::Hit> hits, uint8_t*& resBuffer, int& resSize) {
+  return serializeToInterop(
+      meshHitsSizeBound(hits.size()),
+      [&](flatbuffers::FlatBufferBuilder& builder) {
+        // Each vector is filled before the next is created, which may grow the builder
+        auto column = [&]<typename T>(std::type_identity<T>, auto&& value) {
+          T* data = nullptr;
+          flatbuffers::Offset<flatbuffers::Vector<std::conditional_t<std::is_scalar_v<T>, T,
+                                                                     const T*>>> offset;
+          if constexpr (std::is_scalar_v<T>) {
+            offset = builder.CreateUninitializedVector(hits.size(), &data);
+          } else {
+            offset = builder.CreateUninitializedVectorOfStructs(hits.size(), &data);
+          }
+          for (const auto& hit : hits) {
+            *data++ = value(hit);
+          }
+          return offset;
+        };
+        auto vec3 = [](const Vector3d& v) { return GSP::FB::Vec3(v.x(), v.y(), v.z()); };
+        auto faces = column(std::type_identity<int>{}, [](const auto& hit) { return hit.face; });
+        auto distances =
+            column(std::type_identity<double>{}, [](const auto& hit) { return hit.distance; });
+        auto vertices = column(std::type_identity<GSP::FB::Vec3i>{}, [](const auto& hit) {
+          return GSP::FB::Vec3i(hit.vertices[0], hit.vertices[1], hit.vertices[2]);
+        });
+        auto barycentrics = column(std::type_identity<GSP::FB::Vec3>{},
+                                   [&](const auto& hit) { return vec3(hit.barycentric); });
+        auto points = column(std::type_identity<GSP::FB::Vec3>{},
+                             [&](const auto& hit) { return vec3(hit.point); });
+        builder.Finish(GSP::FB::CreateMeshHitsData(builder, faces, distances, vertices,
+                                                   barycentrics, points));
+        return true;
+      },
+      resBuffer, resSize);
+}
+
+size_t facesWithinSizeBound(size_t pointCount, size_t faceCount) {
+  return kTableOverhead + 3 * kVectorOverhead + pointCount * sizeof(int) +
+         faceCount * (sizeof(int) + sizeof(double));
+}
+
+bool serializeFacesWithin(std::span<const std::vector<std::pair<int, double>>> faces,
+                          uint8_t*& resBuffer,
+                          int& resSize) {
+  size_t total = 0;
+  for (const auto& list : faces) {
+    total += list.size();
+  }
+  return serializeToInterop(
+      facesWithinSizeBound(faces.size(), total),
+      [&](flatbuffers::FlatBufferBuilder& builder) {
+        int* counts = nullptr;
+        int* ids = nullptr;
+        double* distances = nullptr;
+        auto countsOffset = builder.CreateUninitializedVector(faces.size(), &counts);
+        auto idsOffset = builder.CreateUninitializedVector(total, &ids);
+        auto distancesOffset = builder.CreateUninitializedVector(total, &distances);
+        for (const auto& list : faces) {
+          *counts++ = static_cast<int>(list.size());
+          for (const auto& [face, distance] : list) {
+            *ids++ = face;
+            *distances++ = distance;
+          }
+        }
+        builder.Finish(
+            GSP::FB::CreateFacesWithinData(builder, countsOffset, idsOffset, distancesOffset));
+        return true;
+      },
+      resBuffer, resSize);
+}
+
+// clang-format off
+template bool serializeNumberArray(const std::vector<double>& numbers, uint8_t*& resBuffer, int& resSize);
+template bool serializeNumberArray(const std::vector<int>& numbers, uint8_t*& resBuffer, int& resSize);
+template bool serializeNumberArray(const Eigen::VectorXd& numbers, uint8_t*& resBuffer, int& resSize);
+template bool serializeNumberArray(const Eigen::VectorXi& numbers, uint8_t*& resBuffer, int& resSize);
+template bool serializeNumberArray(const std::vector<double>& numbers, MutableByteSpan dst, int& resSize);
+template bool serializeNumberArray(const std::vector<int>& numbers, MutableByteSpan dst, int& resSize);
+template bool serializeNumberArray(const Eigen::VectorXd& numbers, MutableByteSpan dst, int& resSize);
+template bool serializeNumberArray(const Eigen::VectorXi& numbers, MutableByteSpan dst, int& resSize);
+template bool serializeNumberArray(const std::span<const double>& numbers, uint8_t*& resBuffer, int& resSize);
+template bool serializeNumberArray(const std::span<const int>& numbers, uint8_t*& resBuffer, int& resSize);
+template bool serializeNumberArray(const Eigen::Map<const Eigen::VectorXd>& numbers, uint8_t*& resBuffer, int& resSize);
+template bool serializeNumberArray(const Eigen::Map<const Eigen::VectorXi>& numbers, uint8_t*& resBuffer, int& resSize);
+template bool serializeNumberArray(const std::span<const double>& numbers, MutableByteSpan dst, int& resSize);
+template bool serializeNumberArray(const std::span<const int>& numbers, MutableByteSpan dst, int& resSize);
+template bool serializeNumberArray(const Eigen::Map<const Eigen::VectorXd>& numbers, MutableByteSpan dst, int& resSize);
+template bool serializeNumberArray(const Eigen::Map<const Eigen::VectorXi>& numbers, MutableByteSpan dst, int& resSize);
+template bool deserializeNumberArray(const uint8_t* data, int size, std::vector<double>& numberArray, VerifyPolicy policy);
+template bool deserializeNumberArray(const uint8_t* data, int size, std::vector<int>& numberArray, VerifyPolicy policy);
+template bool deserializeNumberArray(const uint8_t* data, int size, Eigen::VectorXd& numberArray, VerifyPolicy policy);
+template bool deserializeNumberArray(const uint8_t* data, int size, Eigen::VectorXi& numberArray, VerifyPolicy policy);
 // Explicit instantiations for integer pair arrays
-template bool serializeNumberPairArray(const std::vector<std::pair<int, int>>& pairs,
-                                       uint8_t*& resBuffer,
-                                       int& resSize);
-template bool serializeNumberPairArray(const Eigen::Matrix<int, Eigen::Dynamic, 2>& pairs,
-                                       uint8_t*& resBuffer,
-                                       int& resSize);
-template bool deserializeNumberPairArray(const uint8_t* data,
-                                         int size,
-                                         std::vector<std::pair<int, int>>& pairArray);
-template bool deserializeNumberPairArray(const uint8_t* data,
-                                         int size,
-                                         Eigen::Matrix<int, Eigen::Dynamic, 2>& pairArray);
+template bool serializeNumberPairArray(const std::vector<std::pair<int, int>>& pairs, uint8_t*& resBuffer, int& resSize);
+template bool serializeNumberPairArray(const Eigen::Matrix<int, Eigen::Dynamic, 2>& pairs, uint8_t*& resBuffer, int& resSize);
+template bool serializeNumberPairArray(const std::vector<std::pair<int, int>>& pairs, MutableByteSpan dst, int& resSize);
+template bool serializeNumberPairArray(const Eigen::Matrix<int, Eigen::Dynamic, 2>& pairs, MutableByteSpan dst, int& resSize);
+template bool deserializeNumberPairArray(const uint8_t* data, int size, std::vector<std::pair<int, int>>& pairArray, VerifyPolicy policy);
+template bool deserializeNumberPairArray(const uint8_t* data, int size, Eigen::Matrix<int, Eigen::Dynamic, 2>& pairArray, VerifyPolicy policy);
 
 // Explicit instantiations for double pair arrays
-template bool serializeNumberPairArray(const std::vector<std::pair<double, double>>& pairs,
-                                       uint8_t*& resBuffer,
-                                       int& resSize);
-template bool serializeNumberPairArray(const Eigen::Matrix<double, Eigen::Dynamic, 2>& pairs,
-                                       uint8_t*& resBuffer,
-                                       int& resSize);
-template bool deserializeNumberPairArray(const uint8_t* data,
-                                         int size,
-                                         std::vector<std::pair<double, double>>& pairArray);
-template bool deserializeNumberPairArray(const uint8_t* data,
-                                         int size,
-                                         Eigen::Matrix<double, Eigen::Dynamic, 2>& pairArray);
+template bool serializeNumberPairArray(const std::vector<std::pair<double, double>>& pairs, uint8_t*& resBuffer, int& resSize);
+template bool serializeNumberPairArray(const Eigen::Matrix<double, Eigen::Dynamic, 2>& pairs, uint8_t*& resBuffer, int& resSize);
+template bool serializeNumberPairArray(const std::vector<std::pair<double, double>>& pairs, MutableByteSpan dst, int& resSize);
+template bool serializeNumberPairArray(const Eigen::Matrix<double, Eigen::Dynamic, 2>& pairs, MutableByteSpan dst, int& resSize);
+template bool deserializeNumberPairArray(const uint8_t* data, int size, std::vector<std::pair<double, double>>& pairArray, VerifyPolicy policy);
+template bool deserializeNumberPairArray(const uint8_t* data, int size, Eigen::Matrix<double, Eigen::Dynamic, 2>& pairArray, VerifyPolicy policy);
 // Explicit instantiations to ensure the template is compiled for these types
-template bool
-serializePointArray(const std::vector<Vector3d>& points, uint8_t*& resBuffer, int& resSize);
-template bool serializePointArray(const Eigen::MatrixXd& points, uint8_t*& resBuffer, int& resSize);
+template bool serializePointArray(const std::vector<Vector3d>& points, uint8_t*& resBuffer, int& resSize, const PositionEncodingOptions& options);
+template bool serializePointArray(const Eigen::MatrixXd& points, uint8_t*& resBuffer, int& resSize, const PositionEncodingOptions& options);
+template bool serializePointArray(const MatrixX3d& points, uint8_t*& resBuffer, int& resSize, const PositionEncodingOptions& options);
+template bool serializePointArray(const MatrixX3f& points, uint8_t*& resBuffer, int& resSize, const PositionEncodingOptions& options);
+template bool serializePointArray(const Eigen::Map<const MatrixX3d>& points, uint8_t*& resBuffer, int& resSize, const PositionEncodingOptions& options);
+template bool serializePointArray(const std::span<const Vector3d>& points, uint8_t*& resBuffer, int& resSize, const PositionEncodingOptions& options);
+template bool serializePointArray(const std::vector<Vector3d>& points, MutableByteSpan dst, int& resSize, const PositionEncodingOptions& options);
+template bool serializePointArray(const Eigen::MatrixXd& points, MutableByteSpan dst, int& resSize, const PositionEncodingOptions& options);
+template bool serializePointArray(const MatrixX3d& points, MutableByteSpan dst, int& resSize, const PositionEncodingOptions& options);
+template bool serializePointArray(const MatrixX3f& points, MutableByteSpan dst, int& resSize, const PositionEncodingOptions& options);
+template bool serializePointArray(const Eigen::Map<const MatrixX3d>& points, MutableByteSpan dst, int& resSize, const PositionEncodingOptions& options);
+template bool serializePointArray(const std::span<const Vector3d>& points, MutableByteSpan dst, int& resSize, const PositionEncodingOptions& options);
 
 // Explicit instantiations to ensure the template is compiled for these types
-template bool
-deserializePointArray(const uint8_t* data, int size, std::vector<Vector3d>& pointArray);
-template bool deserializePointArray(const uint8_t* data, int size, Eigen::MatrixXd& pointArray);
-
-// Serialize nested integer arrays (vector<vector<int>>)
-bool serializeNestedIntArray(const std::vector<std::vector<int>>& nestedArray,
-                             uint8_t*& resBuffer,
-                             int& resSize) {
-  flatbuffers::FlatBufferBuilder builder;
+template bool deserializePointArray(const uint8_t* data, int size, std::vector<Vector3d>& pointArray, VerifyPolicy policy);
+template bool deserializePointArray(const uint8_t* data, int size, Eigen::MatrixXd& pointArray, VerifyPolicy policy);
+template bool deserializePointArray(const uint8_t* data, int size, MatrixX3d& pointArray, VerifyPolicy policy);
+template bool deserializePointArray(const uint8_t* data, int size, MatrixX3f& pointArray, VerifyPolicy policy);
+template bool deserializePointArray(const uint8_t* data, int size, Eigen::Map<const MatrixX3d>& pointArray, VerifyPolicy policy);
+template bool deserializePointArray(const uint8_t* data, int size, std::span<const Vector3d>& pointArray, VerifyPolicy policy);
+// clang-format on
+
+size_t nestedIntArraySizeBound(size_t arrayCount, size_t valueCount) {
+  return kTableOverhead + 2 * kVectorOverhead + sizeof(int) * (valueCount + arrayCount);
+}
 
-  // Flatten the nested array and keep track of sizes
-  std::vector<int> flatArray;
-  std::vector<int> sizes;
+// Serialize nested integer arrays (vector<vector<int>>). Values and sizes are written straight
+// into the builder, without a flattened copy.
+static bool buildNestedIntArray(flatbuffers::FlatBufferBuilder& builder,
+                                const std::vector<std::vector<int>>& nestedArray) {
+  size_t valueCount = 0;
+  for (const auto& subArray : nestedArray) {
+    valueCount += subArray.size();
+  }
+  if (valueCount > static_cast<size_t>(INT_MAX)) {
+    return false;
+  }
 
+  int* values = nullptr;
+  auto valuesVector = builder.CreateUninitializedVector(valueCount, &values);
   for (const auto& subArray : nestedArray) {
-    sizes.push_back(static_cast<int>(subArray.size()));
-    for (int value : subArray) {
-      flatArray.push_back(value);
-    }
+    values = std::copy(subArray.begin(), subArray.end(), values);
   }
 
-  // Create vectors in flatbuffers
-  auto valuesVector = builder.CreateVector(flatArray);
-  auto sizesVector = builder.CreateVector(sizes);
+  int* sizes = nullptr;
+  auto sizesVector = builder.CreateUninitializedVector(nestedArray.size(), &sizes);
+  for (const auto& subArray : nestedArray) {
+    *sizes++ = static_cast<int>(subArray.size());
+  }
 
   // Create the nested array data
   auto nestedArrayOffset = GSP::FB::CreateIntNestedArrayData(builder, valuesVector, sizesVector);
   builder.Finish(nestedArrayOffset);
+  return true;
+}
 
-  // Copy the serialized data to the provided buffer
-  resSize = builder.GetSize();
-  resBuffer = static_cast<uint8_t*>(AllocateInteropMemory(resSize));
-  if (!resBuffer) {
-    return false;  // Handle allocation failure
+// CSR nested arrays: the values are one bulk copy, the sizes are the offset differences
+static bool buildNestedIntArray(flatbuffers::FlatBufferBuilder& builder,
+                                const CsrIntArray& nestedArray) {
+  const auto& offsets = nestedArray.offsets;
+  if (offsets.empty() || offsets.front() != 0 ||
+      static_cast<size_t>(offsets.back()) != nestedArray.values.size()) {
+    return false;  // Offsets do not span the values
   }
-  std::memcpy(resBuffer, builder.GetBufferPointer(), resSize);
 
+  auto valuesVector = builder.CreateVector(nestedArray.values);
+
+  int* sizes = nullptr;
+  auto sizesVector = builder.CreateUninitializedVector(nestedArray.size(), &sizes);
+  for (size_t i = 0; i < nestedArray.size(); ++i) {
+    sizes[i] = offsets[i + 1] - offsets[i];
+  }
+
+  builder.Finish(GSP::FB::CreateIntNestedArrayData(builder, valuesVector, sizesVector));
   return true;
 }
 
+bool serializeNestedIntArray(const std::vector<std::vector<int>>& nestedArray,
+                             uint8_t*& resBuffer,
+                             int& resSize) {
+  size_t valueCount = 0;
+  for (const auto& subArray : nestedArray) {
+    valueCount += subArray.size();
+  }
+
+  return serializeToInterop(
+      nestedIntArraySizeBound(nestedArray.size(), valueCount),
+      [&](auto& builder) { return buildNestedIntArray(builder, nestedArray); }, resBuffer,
+      resSize);
+}
+
+bool serializeNestedIntArray(const std::vector<std::vector<int>>& nestedArray,
+                             MutableByteSpan dst,
+                             int& resSize) {
+  return serializeToSpan(
+      [&](auto& builder) { return buildNestedIntArray(builder, nestedArray); }, dst, resSize);
+}
+
+bool serializeNestedIntArray(const CsrIntArray& nestedArray, uint8_t*& resBuffer, int& resSize) {
+  return serializeToInterop(
+      nestedIntArraySizeBound(nestedArray.size(), nestedArray.values.size()),
+      [&](auto& builder) { return buildNestedIntArray(builder, nestedArray); }, resBuffer,
+      resSize);
+}
+
+bool serializeNestedIntArray(const CsrIntArray& nestedArray, MutableByteSpan dst, int& resSize) {
+  return serializeToSpan(
+      [&](auto& builder) { return buildNestedIntArray(builder, nestedArray); }, dst, resSize);
+}
+
 // Deserialize nested integer arrays
 bool deserializeNestedIntArray(const uint8_t* data,
                                int size,
-                               std::vector<std::vector<int>>& nestedArray) {
-  // Verify the buffer integrity
-  flatbuffers::Verifier verifier(data, size);
-  if (!verifier.VerifyBuffer<GSP::FB::IntNestedArrayData>()) {
+                               std::vector<std::vector<int>>& nestedArray,
+                               VerifyPolicy policy) {
+  // Check the buffer according to the policy
+  CheckedRoot<GSP::FB::IntNestedArrayData> arrayData(data, size, policy);
+  if (!arrayData ||
+      !arrayData.readableSlots(arrayData.get(), {GSP::FB::IntNestedArrayData::VT_VALUES,
+                                                 GSP::FB::IntNestedArrayData::VT_SIZES}) ||
+      !arrayData.readable(arrayData->values()) || !arrayData.readable(arrayData->sizes())) {
     return false;
   }
 
-  // Get the nested array data from the buffer
-  auto arrayData = GSP::FB::GetIntNestedArrayData(data);
-  if (!arrayData || !arrayData->values() || !arrayData->sizes()) {
-    return false;
-  }
-
-  auto flatValues = arrayData->values();
   auto sizes = arrayData->sizes();
+  const int* next = arrayData->values()->data();
+  const int* end = next + arrayData->values()->size();
+
+  // Reconstruct the nested structure, reusing the storage of existing sub-arrays. Each
+  // sub-array is one bulk copy; sub-arrays past the end of the values come out short.
+  nestedArray.resize(sizes->size());
+  for (flatbuffers::uoffset_t i = 0; i < sizes->size(); ++i) {
+    const int count = sizes->Get(i);
+    if (count < 0) {
+      return false;
+    }
+    const int* last = next + std::min<ptrdiff_t>(count, end - next);
+    nestedArray[i].assign(next, last);
+    next = last;
+  }
 
-  // Clear the output vector
-  nestedArray.clear();
-  nestedArray.reserve(sizes->size());
-
-  // Reconstruct the nested structure
-  size_t flatIndex = 0;
-  for (size_t i = 0; i < sizes->size(); i++) {
-    int subArraySize = sizes->Get(i);
-    std::vector<int> subArray;
-    subArray.reserve(subArraySize);
+  return true;
+}
 
-    for (int j = 0; j < subArraySize; j++) {
-      if (flatIndex < flatValues->size()) {
-        subArray.push_back(flatValues->Get(flatIndex++));
-      }
-    }
-    nestedArray.push_back(std::move(subArray));
+bool deserializeNestedIntArray(const uint8_t* data,
+                               int size,
+                               CsrIntArray& nestedArray,
+                               VerifyPolicy policy) {
+  CheckedRoot<GSP::FB::IntNestedArrayData> arrayData(data, size, policy);
+  const bool slots =
+      arrayData && arrayData.readableSlots(arrayData.get(),
+                                           {GSP::FB::IntNestedArrayData::VT_VALUES,
+                                            GSP::FB::IntNestedArrayData::VT_SIZES});
+  auto values = slots ? arrayData->values() : nullptr;
+  auto sizes = slots ? arrayData->sizes() : nullptr;
+  if (!arrayData || !arrayData.readable(values) || !arrayData.readable(sizes) ||
+      !nestedArray.assignSizes(std::span<const int>(sizes->data(), sizes->size())) ||
+      static_cast<size_t>(nestedArray.offsets.back()) != values->size()) {
+    nestedArray.clear();
+    return false;
   }
 
+  nestedArray.values.assign(values->data(), values->data() + values->size());
   return true;
 }
 }  // namespace GeoSharPlusCPP::Serialization
@@ -0,0 +1,22 @@
+#include "GeoSharPlusCPP/Serialization/VerifyPolicy.h"
+
+#include <atomic>
+
+namespace GeoSharPlusCPP::Serialization {
+namespace {
+std::atomic<VerifyPolicy> gDefaultPolicy{VerifyPolicy::Full};
+}  // namespace
+
+void setDefaultVerifyPolicy(VerifyPolicy policy) {
+  gDefaultPolicy.store(policy, std::memory_order_relaxed);
+}
+
+VerifyPolicy defaultVerifyPolicy() {
+  return gDefaultPolicy.load(std::memory_order_relaxed);
+}
+
+bool isValidVerifyPolicy(int32_t policy) {
+  return policy >= static_cast<int32_t>(VerifyPolicy::Full) &&
+         policy <= static_cast<int32_t>(VerifyPolicy::Trusted);
+}
+}  // namespace GeoSharPlusCPP::Serialization
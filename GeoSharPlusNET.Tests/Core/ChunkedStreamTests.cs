@@ -0,0 +1,76 @@
+using Xunit;
+using GSP.Core;
+using GSP.Geometry;
+
+namespace GeoSharPlusNET.Tests.Core;
+
+/// <summary>
+/// Tests for GSP.Core.ChunkedStream
+/// </summary>
+public class ChunkedStreamTests {
+  [Fact]
+  public void Write_Vec3Array_RoundTripsAcrossChunks() {
+    var points = new Vec3[1000];
+    for (int i = 0; i < points.Length; i++) {
+      points[i] = new Vec3(i, -i * 0.5, i * 0.25);
+    }
+
+    using var stream = new MemoryStream();
+    // About 40 points per chunk
+    ChunkedStream.Write(stream, points, maxChunkBytes: 1000);
+    stream.Position = 0;
+    var result = ChunkedStream.ReadVec3Array(stream);
+
+    Assert.Equal(points, result);
+    Assert.Equal(stream.Length, stream.Position);
+  }
+
+  [Fact]
+  public void Write_Vec3Array_Empty() {
+    using var stream = new MemoryStream();
+    ChunkedStream.Write(stream, Array.Empty<Vec3>());
+    stream.Position = 0;
+
+    Assert.Empty(ChunkedStream.ReadVec3Array(stream));
+  }
+
+  [Fact]
+  public void Write_QuadMesh_RoundTripsAcrossChunks() {
+    var vertices = new Vec3[200];
+    for (int i = 0; i < vertices.Length; i++) {
+      vertices[i] = new Vec3(i % 10, i / 10, 0);
+    }
+    var quads = new (int, int, int, int)[150];
+    for (int i = 0; i < quads.Length; i++) {
+      quads[i] = (i, i + 1, i + 11, i + 10);
+    }
+    var mesh = new Mesh(vertices, quads);
+
+    using var stream = new MemoryStream();
+    ChunkedStream.Write(stream, mesh, maxChunkBytes: 256);
+    stream.Position = 0;
+    var result = ChunkedStream.ReadMesh(stream);
+
+    Assert.Equal(vertices, result.Vertices);
+    Assert.Equal(quads, result.QuadFaces);
+    Assert.False(result.HasTriangles);
+  }
+
+  [Fact]
+  public void ReadMesh_PointArrayStream_Throws() {
+    using var stream = new MemoryStream();
+    ChunkedStream.Write(stream, new[] { new Vec3(1, 2, 3) });
+    stream.Position = 0;
+
+    Assert.Throws<InvalidDataException>(() => ChunkedStream.ReadMesh(stream));
+  }
+
+  [Fact]
+  public void ReadVec3Array_TruncatedStream_Throws() {
+    using var stream = new MemoryStream();
+    ChunkedStream.Write(stream, new[] { new Vec3(1, 2, 3), new Vec3(4, 5, 6) }, maxChunkBytes: 24);
+    var truncated = new MemoryStream(stream.ToArray(), 0, (int)stream.Length - 4);
+
+    Assert.Throws<EndOfStreamException>(() => ChunkedStream.ReadVec3Array(truncated));
+  }
+}
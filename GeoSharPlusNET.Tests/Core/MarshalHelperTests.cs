@@ -1,5 +1,6 @@
 using Xunit;
 using GSP.Core;
+using System.Buffers;
 using System.Runtime.InteropServices;
 
 namespace GeoSharPlusNET.Tests.Core;
@@ -108,4 +109,92 @@ public class MarshalHelperTests {
     var exception = Record.Exception(() => MarshalHelper.Free(IntPtr.Zero));
     Assert.Null(exception);
   }
+  // Fake `*_into` export producing `payload`, counting how often it is called
+  private static MarshalHelper.WriteIntoBuffer FakeWriteInto(byte[] payload, Action onCall) {
+    return (byte[] outBuffer, int outCapacity, out int outSize) => {
+      onCall();
+      outSize = payload.Length;
+      if (outCapacity < payload.Length)
+        return false;
+      payload.CopyTo(outBuffer, 0);
+      return true;
+    };
+  }
+
+  [Fact]
+  public void WriteInto_WithLargeEnoughBuffer_ReusesBuffer() {
+    byte[] payload = { 1, 2, 3 };
+    int calls = 0;
+    byte[] buffer = ArrayPool<byte>.Shared.Rent(16);
+    var original = buffer;
+    try {
+      bool ok = MarshalHelper.WriteInto(FakeWriteInto(payload, () => calls++), 0, ref buffer, out int size);
+
+      Assert.True(ok);
+      Assert.Same(original, buffer);
+      Assert.Equal(1, calls);
+      Assert.Equal(payload, buffer.AsSpan(0, size).ToArray());
+    }
+    finally {
+      MarshalHelper.ReturnPooled(buffer);
+    }
+  }
+
+  [Fact]
+  public void WriteInto_WithTooSmallBuffer_GrowsAndRetries() {
+    byte[] payload = Enumerable.Range(0, 100).Select(i => (byte)i).ToArray();
+    int calls = 0;
+    byte[] buffer = Array.Empty<byte>();
+    try {
+      bool ok = MarshalHelper.WriteInto(FakeWriteInto(payload, () => calls++), 0, ref buffer, out int size);
+
+      Assert.True(ok);
+      Assert.Equal(2, calls);
+      Assert.True(buffer.Length >= payload.Length);
+      Assert.Equal(payload, buffer.AsSpan(0, size).ToArray());
+    }
+    finally {
+      MarshalHelper.ReturnPooled(buffer);
+    }
+  }
+
+  [Fact]
+  public void WriteInto_WithSizeHint_SucceedsOnFirstCall() {
+    byte[] payload = new byte[64];
+    int calls = 0;
+    byte[] buffer = Array.Empty<byte>();
+    try {
+      bool ok = MarshalHelper.WriteInto(FakeWriteInto(payload, () => calls++), payload.Length, ref buffer, out int size);
+
+      Assert.True(ok);
+      Assert.Equal(1, calls);
+      Assert.Equal(payload.Length, size);
+    }
+    finally {
+      MarshalHelper.ReturnPooled(buffer);
+    }
+  }
+
+  [Fact]
+  public void WriteInto_WhenNativeCallFails_ReturnsFalseWithoutRetry() {
+    int calls = 0;
+    MarshalHelper.WriteIntoBuffer failing = (byte[] outBuffer, int outCapacity, out int outSize) => {
+      calls++;
+      outSize = 0;
+      return false;
+    };
+    byte[] buffer = Array.Empty<byte>();
+
+    bool ok = MarshalHelper.WriteInto(failing, 0, ref buffer, out int size);
+
+    Assert.False(ok);
+    Assert.Equal(1, calls);
+    Assert.Equal(0, size);
+  }
+
+  [Fact]
+  public void ReturnPooled_WithEmptyArray_DoesNotThrow() {
+    var exception = Record.Exception(() => MarshalHelper.ReturnPooled(Array.Empty<byte>()));
+    Assert.Null(exception);
+  }
 }
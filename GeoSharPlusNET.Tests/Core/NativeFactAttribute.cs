@@ -0,0 +1,28 @@
+using System.Runtime.InteropServices;
+using GSP.Core;
+using Xunit;
+
+namespace GeoSharPlusNET.Tests.Core;
+
+/// <summary>
+/// A test that calls into the native library through CoreBridge. It is skipped where the
+/// library cannot be loaded, e.g. in the .NET-only CI jobs.
+/// </summary>
+public sealed class NativeFactAttribute : FactAttribute {
+  private static readonly bool Available = IsNativeLibraryAvailable();
+
+  public NativeFactAttribute() {
+    if (!Available)
+      Skip = "The native GeoSharPlusCPP library is not available";
+  }
+
+  private static bool IsNativeLibraryAvailable() {
+    // CoreBridge binds the Windows and macOS libraries only
+    if (!Platform.IsWindows && !Platform.IsMac)
+      return false;
+    if (!NativeLibrary.TryLoad(Platform.NativeLibrary, typeof(CoreBridge).Assembly, null, out IntPtr handle))
+      return false;
+    NativeLibrary.Free(handle);
+    return true;
+  }
+}
@@ -1,6 +1,9 @@
+using System.Runtime.InteropServices;
+using Google.FlatBuffers;
 using Xunit;
 using GSP.Core;
 using GSP.Geometry;
+using FB = GSP.FB;
 
 namespace GeoSharPlusNET.Tests.Core;
 
@@ -205,6 +208,293 @@ public class SerializerTests {
     Assert.Empty(result.QuadFaces);
   }
 
+  [Fact]
+  public void Serialize_Mesh_MixedMesh_KeepsQuads() {
+    var original = new Mesh {
+      Vertices = new Vec3[] {
+        new(0, 0, 0), new(1, 0, 0), new(1, 1, 0), new(0, 1, 0), new(2, 0, 0)
+      },
+      TriangleFaces = new (int, int, int)[] { (1, 4, 2) },
+      QuadFaces = new (int, int, int, int)[] { (0, 1, 2, 3) }
+    };
+
+    var buffer = Serializer.Serialize(original);
+    var meshData = FB.MeshData.GetRootAsMeshData(new ByteBuffer(buffer));
+    var result = Serializer.DeserializeMesh(buffer);
+
+    Assert.Equal(new[] { 0, 3, 7 }, meshData.GetFaceOffsetsArray());
+    Assert.Equal(original.TriangleFaces, result.TriangleFaces);
+    Assert.Equal(original.QuadFaces, result.QuadFaces);
+  }
+
+  [Fact]
+  public void Serialize_Mesh_Attributes_RoundTrip() {
+    var original = new Mesh {
+      Vertices = new Vec3[] {
+        new(0, 0, 0), new(1, 0, 0), new(1, 1, 0), new(0, 1, 0), new(2, 0, 0)
+      },
+      TriangleFaces = new (int, int, int)[] { (1, 4, 2) },
+      QuadFaces = new (int, int, int, int)[] { (0, 1, 2, 3) }
+    };
+    original.Attributes.Add(new MeshAttribute("curvature", AttributeDomain.Vertex, 1,
+                                              new double[] { 0.5, 1.5, 2.5, 3.5, 4.5 }));
+    original.Attributes.Add(new MeshAttribute("uv", AttributeDomain.Vertex, 2,
+                                              new float[] { 0, 0, 1, 0, 1, 1, 0, 1, 2, 0 }));
+    original.Attributes.Add(new MeshAttribute("label", AttributeDomain.Face, 1, new int[] { 7, 9 }));
+    original.Attributes.Add(new MeshAttribute("color", AttributeDomain.Face, 3,
+                                              new byte[] { 255, 0, 0, 0, 0, 255 }));
+
+    var result = Serializer.DeserializeMesh(Serializer.Serialize(original));
+
+    Assert.Equal(4, result.Attributes.Count);
+    Assert.Equal(original.Attributes[0].Values, result.GetAttribute("curvature")!.Values);
+    Assert.Equal(2, result.GetAttribute("uv")!.Dimension);
+    Assert.Equal(original.Attributes[1].Values, result.GetAttribute("uv")!.Values);
+    Assert.Equal(AttributeDomain.Face, result.GetAttribute("label")!.Domain);
+    Assert.Equal(new[] { 7, 9 }, result.GetAttribute("label")!.Values);
+    Assert.Equal(original.Attributes[3].Values, result.GetAttribute("color")!.Values);
+  }
+
+  [Fact]
+  public void Serialize_Mesh_FaceAttribute_FollowsFannedPolygons() {
+    var builder = new FlatBufferBuilder(256);
+    FB.MeshData.StartVerticesVector(builder, 8);
+    for (int i = 7; i >= 0; i--) {
+      FB.Vec3.CreateVec3(builder, i, i * i, 0);
+    }
+    var vertices = builder.EndVector();
+    // A pentagon, then a quad
+    var offsets = FB.MeshData.CreateFaceOffsetsVector(builder, new[] { 0, 5, 9 });
+    var indices = FB.MeshData.CreateFaceIndicesVector(builder, new[] { 0, 1, 2, 3, 4, 4, 5, 6, 7 });
+    var name = builder.CreateString("id");
+    var values = FB.MeshAttribute.CreateI32Vector(builder, new[] { 10, 20 });
+    FB.MeshAttribute.StartMeshAttribute(builder);
+    FB.MeshAttribute.AddName(builder, name);
+    FB.MeshAttribute.AddDomain(builder, FB.AttributeDomain.Face);
+    FB.MeshAttribute.AddI32(builder, values);
+    var attributes = FB.MeshData.CreateAttributesVector(builder, new[] { FB.MeshAttribute.EndMeshAttribute(builder) });
+    FB.MeshData.StartMeshData(builder);
+    FB.MeshData.AddVertices(builder, vertices);
+    FB.MeshData.AddFaceOffsets(builder, offsets);
+    FB.MeshData.AddFaceIndices(builder, indices);
+    FB.MeshData.AddAttributes(builder, attributes);
+    builder.Finish(FB.MeshData.EndMeshData(builder).Value);
+
+    var result = Serializer.DeserializeMesh(builder.SizedByteArray());
+
+    // Three fan triangles of the pentagon, then the quad
+    Assert.Equal(3, result.TriangleFaces.Length);
+    Assert.Single(result.QuadFaces);
+    Assert.Equal(new[] { 10, 10, 10, 20 }, result.GetAttribute("id")!.Values);
+  }
+
+  [Fact]
+  public void Serialize_Mesh_AttributeCountMismatch_Throws() {
+    var mesh = new Mesh(new Vec3[] { new(0, 0, 0), new(1, 0, 0), new(0, 1, 0) },
+                        new (int, int, int)[] { (0, 1, 2) });
+    mesh.Attributes.Add(new MeshAttribute("w", AttributeDomain.Vertex, 1, new double[] { 1, 2 }));
+
+    Assert.Throws<ArgumentException>(() => Serializer.Serialize(mesh));
+  }
+
+  [Fact]
+  public void Deserialize_Mesh_PolygonFaces_FansLargePolygons() {
+    var builder = new FlatBufferBuilder(256);
+    FB.MeshData.StartVerticesVector(builder, 5);
+    for (int i = 4; i >= 0; i--) {
+      FB.Vec3.CreateVec3(builder, i, i * i, 0);
+    }
+    var vertices = builder.EndVector();
+    var offsets = FB.MeshData.CreateFaceOffsetsVector(builder, new[] { 0, 5 });
+    var indices = FB.MeshData.CreateFaceIndicesVector(builder, new[] { 0, 1, 2, 3, 4 });
+    FB.MeshData.StartMeshData(builder);
+    FB.MeshData.AddVertices(builder, vertices);
+    FB.MeshData.AddFaceOffsets(builder, offsets);
+    FB.MeshData.AddFaceIndices(builder, indices);
+    builder.Finish(FB.MeshData.EndMeshData(builder).Value);
+
+    var result = Serializer.DeserializeMesh(builder.SizedByteArray());
+
+    Assert.Equal(new[] { (0, 1, 2), (0, 2, 3), (0, 3, 4) }, result.TriangleFaces);
+    Assert.Empty(result.QuadFaces);
+  }
+
+  #endregion
+
+  #region Batch Serialization
+
+  [Fact]
+  public void Serialize_MeshBatch_RoundTrip() {
+    var triangle = new Mesh {
+      Vertices = new Vec3[] { new(0, 0, 0), new(1, 0, 0), new(0, 1, 0) },
+      TriangleFaces = new (int, int, int)[] { (0, 1, 2) }
+    };
+    var quad = new Mesh {
+      Vertices = new Vec3[] { new(0, 0, 1), new(1, 0, 1), new(1, 1, 1), new(0, 1, 1) },
+      QuadFaces = new (int, int, int, int)[] { (0, 1, 2, 3) }
+    };
+
+    var buffer = Serializer.Serialize(new[] { triangle, quad, triangle });
+    var result = Serializer.DeserializeMeshBatch(buffer);
+
+    Assert.Equal(3, result.Length);
+    Assert.Equal(triangle.Vertices, result[0].Vertices);
+    Assert.Equal(triangle.TriangleFaces, result[0].TriangleFaces);
+    Assert.Equal(quad.Vertices, result[1].Vertices);
+    Assert.Equal(quad.QuadFaces, result[1].QuadFaces);
+    Assert.Equal(triangle.TriangleFaces, result[2].TriangleFaces);
+  }
+
+  [Fact]
+  public void Serialize_Vec3ArrayBatch_RoundTrip() {
+    var original = new[] {
+      new Vec3[] { new(1, 2, 3), new(4, 5, 6) },
+      Array.Empty<Vec3>(),
+      new Vec3[] { new(-1, -2, -3) }
+    };
+
+    var buffer = Serializer.Serialize(original);
+    var result = Serializer.DeserializeVec3ArrayBatch(buffer);
+
+    Assert.Equal(original, result);
+  }
+
+  [Fact]
+  public void Serialize_MeshBatch_Empty() {
+    var buffer = Serializer.Serialize(Array.Empty<Mesh>());
+
+    Assert.Empty(Serializer.DeserializeMeshBatch(buffer));
+  }
+
+  #endregion
+
+  #region Position Encodings
+
+  private static VectorOffset CreateFloatPositions(FlatBufferBuilder builder, Vec3[] points) {
+    builder.StartVector(12, points.Length, 4);
+    for (int i = points.Length - 1; i >= 0; i--) {
+      FB.Vec3f.CreateVec3f(builder, (float)points[i].X, (float)points[i].Y, (float)points[i].Z);
+    }
+    return builder.EndVector();
+  }
+
+  private static Offset<FB.QuantizedPositions> CreateQuantizedPositions(
+      FlatBufferBuilder builder, Vec3 min, Vec3 max, byte bits, ushort[] values) {
+    var valuesOffset = FB.QuantizedPositions.CreateValuesVector(builder, values);
+    FB.QuantizedPositions.StartQuantizedPositions(builder);
+    FB.QuantizedPositions.AddMin(builder, FB.Vec3.CreateVec3(builder, min.X, min.Y, min.Z));
+    FB.QuantizedPositions.AddMax(builder, FB.Vec3.CreateVec3(builder, max.X, max.Y, max.Z));
+    FB.QuantizedPositions.AddBits(builder, bits);
+    FB.QuantizedPositions.AddValues(builder, valuesOffset);
+    return FB.QuantizedPositions.EndQuantizedPositions(builder);
+  }
+
+  [Fact]
+  public void Deserialize_Vec3Array_FloatEncoding() {
+    var original = new Vec3[] { new(1.5, -2.25, 3), new(4, 5.125, -6) };
+
+    var builder = new FlatBufferBuilder(256);
+    var pointsF = CreateFloatPositions(builder, original);
+    FB.PointArrayData.StartPointArrayData(builder);
+    FB.PointArrayData.AddPointsF(builder, pointsF);
+    builder.Finish(FB.PointArrayData.EndPointArrayData(builder).Value);
+
+    var result = Serializer.DeserializeVec3Array(builder.SizedByteArray());
+
+    Assert.Equal(original, result);
+  }
+
+  [Fact]
+  public void Deserialize_Vec3Array_QuantizedEncoding() {
+    var min = new Vec3(-1, 0, 10);
+    var max = new Vec3(1, 4, 10);  // Flat z axis decodes to min.Z
+    var values = new ushort[] { 0, 0, 0, 65535, 65535, 0, 32768, 16384, 0 };
+
+    var builder = new FlatBufferBuilder(256);
+    var pointsQ = CreateQuantizedPositions(builder, min, max, 16, values);
+    FB.PointArrayData.StartPointArrayData(builder);
+    FB.PointArrayData.AddPointsQ(builder, pointsQ);
+    builder.Finish(FB.PointArrayData.EndPointArrayData(builder).Value);
+
+    var result = Serializer.DeserializeVec3Array(builder.SizedByteArray());
+
+    Assert.Equal(3, result.Length);
+    Assert.True(min.ApproximatelyEquals(result[0]));
+    Assert.True(new Vec3(1, 4, 10).ApproximatelyEquals(result[1]));
+    Assert.True(new Vec3(0, 1, 10).ApproximatelyEquals(result[2], 1e-4));
+  }
+
+  [Fact]
+  public void Deserialize_Mesh_QuantizedEncoding() {
+    var min = new Vec3(0, 0, 0);
+    var max = new Vec3(2, 2, 0);
+    var values = new ushort[] { 0, 0, 0, 255, 0, 0, 0, 255, 0 };
+
+    var builder = new FlatBufferBuilder(256);
+    FB.MeshData.StartFacesVector(builder, 1);
+    FB.Vec3i.CreateVec3i(builder, 0, 1, 2);
+    var faces = builder.EndVector();
+    var verticesQ = CreateQuantizedPositions(builder, min, max, 8, values);
+    FB.MeshData.StartMeshData(builder);
+    FB.MeshData.AddFaces(builder, faces);
+    FB.MeshData.AddVerticesQ(builder, verticesQ);
+    builder.Finish(FB.MeshData.EndMeshData(builder).Value);
+
+    var result = Serializer.DeserializeMesh(builder.SizedByteArray());
+
+    Assert.Equal(3, result.Vertices.Length);
+    Assert.True(new Vec3(2, 0, 0).ApproximatelyEquals(result.Vertices[1]));
+    Assert.True(new Vec3(0, 2, 0).ApproximatelyEquals(result.Vertices[2]));
+    Assert.Single(result.TriangleFaces);
+  }
+
+  private static byte[] CreateCompressedFaceMesh(FB.IndexEncoding encoding, byte faceVertexCount,
+                                                 uint faceCount, byte[] data) {
+    var builder = new FlatBufferBuilder(256);
+    FB.MeshData.StartVerticesVector(builder, 4);
+    for (int i = 3; i >= 0; i--) {
+      FB.Vec3.CreateVec3(builder, i, 0, 0);
+    }
+    var vertices = builder.EndVector();
+    var dataOffset = FB.CompressedFaces.CreateDataVector(builder, data);
+    var faces = FB.CompressedFaces.CreateCompressedFaces(builder, encoding, faceVertexCount,
+                                                         faceCount, dataOffset);
+    FB.MeshData.StartMeshData(builder);
+    FB.MeshData.AddVertices(builder, vertices);
+    FB.MeshData.AddFacesC(builder, faces);
+    builder.Finish(FB.MeshData.EndMeshData(builder).Value);
+    return builder.SizedByteArray();
+  }
+
+  [Fact]
+  public void Deserialize_Mesh_DeltaVarintFaces() {
+    // Faces (0,1,2), (2,1,3): deltas 0,1,1,0,-1,2 zigzag to 0,2,2,0,1,4
+    var buffer = CreateCompressedFaceMesh(FB.IndexEncoding.DeltaVarint, 3, 2,
+                                          new byte[] { 0, 2, 2, 0, 1, 4 });
+
+    var result = Serializer.DeserializeMesh(buffer);
+
+    Assert.Equal(new[] { (0, 1, 2), (2, 1, 3) }, result.TriangleFaces);
+  }
+
+  [Fact]
+  public void Deserialize_Mesh_U16QuadFaces() {
+    var buffer = CreateCompressedFaceMesh(FB.IndexEncoding.U16, 4, 1,
+                                          new byte[] { 0, 0, 1, 0, 3, 0, 2, 0 });
+
+    var result = Serializer.DeserializeMesh(buffer);
+
+    Assert.Equal(new[] { (0, 1, 3, 2) }, result.QuadFaces);
+  }
+
+  [Fact]
+  public void Deserialize_Mesh_TruncatedFaces_Throws() {
+    var buffer = CreateCompressedFaceMesh(FB.IndexEncoding.DeltaVarint, 3, 2,
+                                          new byte[] { 0, 2, 2, 0, 1 });
+
+    Assert.Throws<InvalidDataException>(() => Serializer.DeserializeMesh(buffer));
+  }
+
   #endregion
 
   #region Int Array Serialization
@@ -357,4 +647,375 @@ public class SerializerTests {
   }
 
   #endregion
+
+  #region Mass Properties
+
+  // Unit cube [0, 1]^3 with quad faces wound outward
+  private static Mesh UnitCube() => new(
+      new Vec3[] {
+        new(0, 0, 0), new(1, 0, 0), new(1, 1, 0), new(0, 1, 0),
+        new(0, 0, 1), new(1, 0, 1), new(1, 1, 1), new(0, 1, 1)
+      },
+      new (int, int, int, int)[] {
+        (0, 3, 2, 1), (4, 5, 6, 7), (0, 1, 5, 4), (1, 2, 6, 5), (2, 3, 7, 6), (3, 0, 4, 7)
+      });
+
+  [NativeFact]
+  public void MassProperties_UnitCube_MatchesClosedForm() {
+    var result = CoreBridge.MassProperties(new[] { UnitCube() });
+
+    Assert.Single(result);
+    Assert.Equal(6.0, result[0].Area, 1e-12);
+    Assert.Equal(1.0, result[0].Volume, 1e-12);
+    Assert.Equal(0.5, result[0].VolumeCentroid.X, 1e-12);
+    Assert.Equal(0.5, result[0].VolumeCentroid.Y, 1e-12);
+    Assert.Equal(0.5, result[0].VolumeCentroid.Z, 1e-12);
+    // Unit density about the centroid: (1^2 + 1^2) / 12 on the diagonal, no products
+    var tensor = result[0].InertiaTensor();
+    for (int i = 0; i < 3; i++) {
+      for (int j = 0; j < 3; j++)
+        Assert.Equal(i == j ? 1.0 / 6 : 0.0, tensor[i, j], 1e-12);
+    }
+  }
+
+  [Fact]
+  public void Deserialize_MassPropertiesBatch_ReadsItemsInOrder() {
+    var builder = new FlatBufferBuilder(256);
+    var items = new Offset<FB.MassPropertiesData>[2];
+    for (int i = 0; i < items.Length; i++) {
+      double side = i + 1;
+      double volume = side * side * side;
+      FB.MassPropertiesData.StartMassPropertiesData(builder);
+      FB.MassPropertiesData.AddArea(builder, 6 * side * side);
+      FB.MassPropertiesData.AddVolume(builder, volume);
+      FB.MassPropertiesData.AddAreaCentroid(builder, FB.Vec3.CreateVec3(builder, side / 2, side / 2, side / 2));
+      FB.MassPropertiesData.AddVolumeCentroid(builder, FB.Vec3.CreateVec3(builder, side / 2, side / 2, side / 2));
+      double moment = volume * side * side / 6;
+      FB.MassPropertiesData.AddInertiaDiagonal(builder, FB.Vec3.CreateVec3(builder, moment, moment, moment));
+      FB.MassPropertiesData.AddInertiaProducts(builder, FB.Vec3.CreateVec3(builder, 0, 0, 0));
+      items[i] = FB.MassPropertiesData.EndMassPropertiesData(builder);
+    }
+    var itemsOffset = FB.MassPropertiesBatch.CreateItemsVector(builder, items);
+    builder.Finish(FB.MassPropertiesBatch.CreateMassPropertiesBatch(builder, itemsOffset).Value);
+
+    var result = Serializer.DeserializeMassPropertiesBatch(builder.SizedByteArray());
+
+    Assert.Equal(2, result.Length);
+    Assert.Equal(6.0, result[0].Area);
+    Assert.Equal(8.0, result[1].Volume);
+    Assert.Equal(new Vec3(1, 1, 1), result[1].VolumeCentroid);
+    var tensor = result[1].InertiaTensor();
+    Assert.Equal(8.0 * 4 / 6, tensor[0, 0], 1e-12);
+    Assert.Equal(0.0, tensor[0, 1]);
+  }
+
+  #endregion
+
+  #region Bounding Boxes
+
+  [NativeFact]
+  public void BoundingBoxes_RotatedBox_RecoversItsFrame() {
+    // A 4 x 2 x 1 box turned 30 degrees about Z and centred at (1, 2, 3)
+    double cos = Math.Cos(Math.PI / 6), sin = Math.Sin(Math.PI / 6);
+    var box = UnitCube();
+    box.Vertices = box.Vertices.Select(v => {
+      double x = (v.X - 0.5) * 4, y = (v.Y - 0.5) * 2, z = v.Z - 0.5;
+      return new Vec3(1 + cos * x - sin * y, 2 + sin * x + cos * y, 3 + z);
+    }).ToArray();
+
+    var result = CoreBridge.BoundingBoxes(new[] { box }, BoxFit.MinimumArea);
+
+    Assert.Single(result);
+    var obb = result[0];
+    Assert.Equal(8.0, obb.Volume, 1e-9);
+    Assert.Equal(1.0, obb.Center.X, 1e-9);
+    Assert.Equal(2.0, obb.Center.Y, 1e-9);
+    Assert.Equal(3.0, obb.Center.Z, 1e-9);
+    // Axes may come out in any order or sign; match each box axis by its extent
+    var axes = new[] {
+      (Axis: obb.AxisX, HalfExtent: obb.HalfExtents.X),
+      (Axis: obb.AxisY, HalfExtent: obb.HalfExtents.Y),
+      (Axis: obb.AxisZ, HalfExtent: obb.HalfExtents.Z)
+    };
+    var expected = new[] {
+      (Axis: new Vec3(cos, sin, 0), HalfExtent: 2.0),
+      (Axis: new Vec3(-sin, cos, 0), HalfExtent: 1.0),
+      (Axis: new Vec3(0, 0, 1), HalfExtent: 0.5)
+    };
+    foreach (var (axis, halfExtent) in expected) {
+      var match = Assert.Single(axes, a => Math.Abs(a.HalfExtent - halfExtent) < 1e-9);
+      Assert.Equal(1.0, Math.Abs(Vec3.Dot(match.Axis, axis)), 1e-9);
+    }
+    Assert.All(box.Vertices, v => Assert.True(obb.Contains(v)));
+  }
+
+  [Fact]
+  public void Deserialize_BoundingBoxBatch_ReadsBoxesInOrder() {
+    var builder = new FlatBufferBuilder(256);
+    var boxes = new Offset<FB.BoundingBoxData>[2];
+    for (int i = 0; i < boxes.Length; i++) {
+      FB.BoundingBoxData.StartBoundingBoxData(builder);
+      FB.BoundingBoxData.AddCenter(builder, FB.Vec3.CreateVec3(builder, i, 0, 0));
+      // The second box is turned a quarter about Z
+      FB.BoundingBoxData.AddAxisX(builder, i == 0 ? FB.Vec3.CreateVec3(builder, 1, 0, 0) : FB.Vec3.CreateVec3(builder, 0, 1, 0));
+      FB.BoundingBoxData.AddAxisY(builder, i == 0 ? FB.Vec3.CreateVec3(builder, 0, 1, 0) : FB.Vec3.CreateVec3(builder, -1, 0, 0));
+      FB.BoundingBoxData.AddAxisZ(builder, FB.Vec3.CreateVec3(builder, 0, 0, 1));
+      FB.BoundingBoxData.AddHalfExtents(builder, FB.Vec3.CreateVec3(builder, 2, 1, 0.5));
+      boxes[i] = FB.BoundingBoxData.EndBoundingBoxData(builder);
+    }
+    var boxesOffset = FB.BoundingBoxBatch.CreateBoxesVector(builder, boxes);
+    builder.Finish(FB.BoundingBoxBatch.CreateBoundingBoxBatch(builder, boxesOffset).Value);
+
+    var result = Serializer.DeserializeBoundingBoxBatch(builder.SizedByteArray());
+
+    Assert.Equal(2, result.Length);
+    Assert.Equal(new Vec3(1, 0, 0), result[1].Center);
+    Assert.Equal(new Vec3(-1, 0, 0), result[1].AxisY);
+    Assert.Equal(8.0, result[1].Volume);
+    Assert.True(result[1].Contains(new Vec3(1.9, 1.9, 0)));
+    Assert.False(result[1].Contains(new Vec3(3, 0, 0)));
+    Assert.All(result[1].Corners(), corner => Assert.True(result[1].Contains(corner)));
+  }
+
+  #endregion
+
+  #region Topology Tests
+
+  [NativeFact]
+  public void CheckTopology_DuplicateFace_RepairsNonManifoldEdge() {
+    // Two triangles on edge (0, 1), the first one repeated, and a stray vertex 4
+    var mesh = new Mesh(
+        new Vec3[] { new(0, 0, 0), new(1, 0, 0), new(0, 1, 0), new(0, -1, 0), new(5, 5, 5) },
+        new (int, int, int)[] { (0, 1, 2), (1, 0, 3), (0, 1, 2) });
+
+    var report = CoreBridge.CheckTopology(mesh, MeshRepair.All, out var repaired);
+
+    Assert.Equal(new[] { (0, 1) }, report.NonManifoldEdges);
+    Assert.Equal(new[] { 2 }, report.DuplicateFaces);
+    Assert.Equal(new[] { 4 }, report.UnreferencedVertices);
+    Assert.False(report.IsClean);
+
+    Assert.Equal(4, repaired.VertexCount);
+    Assert.Equal(new (int, int, int)[] { (0, 1, 2), (1, 0, 3) }, repaired.TriangleFaces);
+    var check = CoreBridge.CheckTopology(repaired);
+    Assert.True(check.IsClean);
+    Assert.Equal(4, check.BoundaryEdgeCount);
+  }
+
+  [NativeFact]
+  public void CheckTopology_LargeGridWithDuplicates_FindsThemOnManyThreads() {
+    // A 100 x 100 grid is 20000 triangles, more than one chunk of the parallel duplicate scan
+    const int n = 100;
+    var vertices = new Vec3[(n + 1) * (n + 1)];
+    for (int j = 0; j <= n; ++j)
+      for (int i = 0; i <= n; ++i)
+        vertices[j * (n + 1) + i] = new Vec3(i, j, 0);
+    var faces = new List<(int, int, int)>(2 * n * n + 3);
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < n; ++i) {
+        int a = j * (n + 1) + i;
+        faces.Add((a, a + 1, a + n + 2));
+        faces.Add((a, a + n + 2, a + n + 1));
+      }
+    }
+    var (p, q, r) = faces[19999];
+    faces.Add(faces[5]);
+    faces.Add(faces[12345]);
+    faces.Add((q, r, p));
+    var mesh = new Mesh(vertices, faces.ToArray());
+
+    int threads = CoreBridge.ThreadCount;
+    try {
+      CoreBridge.ThreadCount = 8;
+      for (int run = 0; run < 10; ++run) {
+        var report = CoreBridge.CheckTopology(mesh);
+        Assert.Equal(new[] { 20000, 20001, 20002 }, report.DuplicateFaces);
+      }
+    } finally {
+      CoreBridge.ThreadCount = threads;
+    }
+  }
+
+  [Fact]
+  public void Deserialize_TopologyReport_SplitsBoundaryLoops() {
+    var builder = new FlatBufferBuilder(256);
+    var duplicates = FB.TopologyReport.CreateDuplicateFacesVector(builder, new[] { 5 });
+    FB.TopologyReport.StartInconsistentEdgesVector(builder, 1);
+    FB.Vec2i.CreateVec2i(builder, 2, 3);
+    var inconsistent = builder.EndVector();
+    var loopVertices = FB.TopologyReport.CreateBoundaryLoopVerticesVector(builder, new[] { 0, 1, 2, 4, 6, 5, 7 });
+    var loopSizes = FB.TopologyReport.CreateBoundaryLoopSizesVector(builder, new[] { 3, 4 });
+    FB.TopologyReport.StartTopologyReport(builder);
+    FB.TopologyReport.AddVertexCount(builder, 8);
+    FB.TopologyReport.AddFaceCount(builder, 6);
+    FB.TopologyReport.AddBoundaryEdgeCount(builder, 7);
+    FB.TopologyReport.AddDuplicateFaces(builder, duplicates);
+    FB.TopologyReport.AddInconsistentEdges(builder, inconsistent);
+    FB.TopologyReport.AddBoundaryLoopVertices(builder, loopVertices);
+    FB.TopologyReport.AddBoundaryLoopSizes(builder, loopSizes);
+    builder.Finish(FB.TopologyReport.EndTopologyReport(builder).Value);
+
+    var report = Serializer.DeserializeTopologyReport(builder.SizedByteArray());
+
+    Assert.Equal(8, report.VertexCount);
+    Assert.Equal(new[] { 5 }, report.DuplicateFaces);
+    Assert.Equal(new[] { (2, 3) }, report.InconsistentEdges);
+    Assert.Empty(report.DegenerateFaces);
+    Assert.Equal(2, report.BoundaryLoops.Length);
+    Assert.Equal(new[] { 0, 1, 2 }, report.BoundaryLoops[0]);
+    Assert.Equal(new[] { 4, 6, 5, 7 }, report.BoundaryLoops[1]);
+    Assert.False(report.IsClean);
+    Assert.False(report.IsClosed);
+  }
+
+  #endregion
+
+  #region Mesh Query Tests
+
+  [NativeFact]
+  public void SignedDistances_UnitCube_NegativeInside() {
+    using var cube = NativeMesh.Upload(UnitCube());
+    var points = new Vec3[] { new(0.5, 0.5, 0.5), new(0.5, 0.5, 0.25), new(2, 0.5, 0.5), new(2, 2, 2) };
+
+    var hits = CoreBridge.SignedDistances(cube, points);
+
+    Assert.Equal(4, hits.Length);
+    Assert.Equal(-0.5, hits[0].Distance, 1e-12);
+    Assert.Equal(-0.25, hits[1].Distance, 1e-12);
+    Assert.Equal(0.0, (hits[1].Point - new Vec3(0.5, 0.5, 0)).Length, 1e-12);
+    Assert.Equal(1.0, hits[2].Distance, 1e-12);
+    Assert.Equal(0.0, (hits[2].Point - new Vec3(1, 0.5, 0.5)).Length, 1e-12);
+    // Nearest to a corner, outside
+    Assert.Equal(Math.Sqrt(3), hits[3].Distance, 1e-12);
+    Assert.Equal(0.0, (hits[3].Point - new Vec3(1, 1, 1)).Length, 1e-12);
+    Assert.All(hits, hit => Assert.True(hit.IsHit));
+  }
+
+  [Fact]
+  public void Deserialize_FacesWithin_SplitsPerPoint() {
+    var builder = new FlatBufferBuilder(256);
+    var counts = FB.FacesWithinData.CreateCountsVector(builder, new[] { 2, 0, 1 });
+    var faces = FB.FacesWithinData.CreateFacesVector(builder, new[] { 4, 1, 7 });
+    var distances = FB.FacesWithinData.CreateDistancesVector(builder, new[] { 0.5, 0.5, 2.0 });
+    builder.Finish(FB.FacesWithinData.CreateFacesWithinData(builder, counts, faces, distances).Value);
+
+    var within = Serializer.DeserializeFacesWithin(builder.SizedByteArray());
+
+    Assert.Equal(3, within.Length);
+    Assert.Equal(new[] { (4, 0.5), (1, 0.5) }, within[0]);
+    Assert.Empty(within[1]);
+    Assert.Equal(new[] { (7, 2.0) }, within[2]);
+  }
+
+  #endregion
+
+  #region Example Extension Size Queries
+
+  // ExampleBridge needs RhinoCommon, so the exports under test are bound here
+  private static class ExampleExports {
+    [DllImport(Platform.WindowsLib, EntryPoint = "example_point3d_array_roundtrip_size", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool PointArraySizeWin(byte[] inBuffer, int inSize, out int outSize);
+
+    [DllImport(Platform.MacLib, EntryPoint = "example_point3d_array_roundtrip_size", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool PointArraySizeMac(byte[] inBuffer, int inSize, out int outSize);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "example_point3d_array_roundtrip_into", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool PointArrayIntoWin(byte[] inBuffer, int inSize, [Out] byte[] outBuffer, int outCapacity, out int outSize);
+
+    [DllImport(Platform.MacLib, EntryPoint = "example_point3d_array_roundtrip_into", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool PointArrayIntoMac(byte[] inBuffer, int inSize, [Out] byte[] outBuffer, int outCapacity, out int outSize);
+
+    public static bool PointArraySize(byte[] inBuffer, out int outSize) =>
+        Platform.IsWindows ? PointArraySizeWin(inBuffer, inBuffer.Length, out outSize)
+                           : PointArraySizeMac(inBuffer, inBuffer.Length, out outSize);
+
+    public static bool PointArrayInto(byte[] inBuffer, byte[] outBuffer, out int outSize) =>
+        Platform.IsWindows ? PointArrayIntoWin(inBuffer, inBuffer.Length, outBuffer, outBuffer.Length, out outSize)
+                           : PointArrayIntoMac(inBuffer, inBuffer.Length, outBuffer, outBuffer.Length, out outSize);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "example_mesh_roundtrip_size", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool MeshSizeWin(byte[] inBuffer, int inSize, out int outSize);
+
+    [DllImport(Platform.MacLib, EntryPoint = "example_mesh_roundtrip_size", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool MeshSizeMac(byte[] inBuffer, int inSize, out int outSize);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "example_mesh_roundtrip_into", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool MeshIntoWin(byte[] inBuffer, int inSize, [Out] byte[] outBuffer, int outCapacity, out int outSize);
+
+    [DllImport(Platform.MacLib, EntryPoint = "example_mesh_roundtrip_into", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool MeshIntoMac(byte[] inBuffer, int inSize, [Out] byte[] outBuffer, int outCapacity, out int outSize);
+
+    public static bool MeshSize(byte[] inBuffer, out int outSize) =>
+        Platform.IsWindows ? MeshSizeWin(inBuffer, inBuffer.Length, out outSize)
+                           : MeshSizeMac(inBuffer, inBuffer.Length, out outSize);
+
+    public static bool MeshInto(byte[] inBuffer, byte[] outBuffer, out int outSize) =>
+        Platform.IsWindows ? MeshIntoWin(inBuffer, inBuffer.Length, outBuffer, outBuffer.Length, out outSize)
+                           : MeshIntoMac(inBuffer, inBuffer.Length, outBuffer, outBuffer.Length, out outSize);
+  }
+
+  [NativeFact]
+  public void PointArrayRoundTripSize_EncodedPoints_FitsTheResult() {
+    var points = new Vec3[] { new(1.5, -2.25, 3), new(4, 5.125, -6), new(0, 0, 0) };
+    var builder = new FlatBufferBuilder(256);
+    var pointsF = CreateFloatPositions(builder, points);
+    FB.PointArrayData.StartPointArrayData(builder);
+    FB.PointArrayData.AddPointsF(builder, pointsF);
+    builder.Finish(FB.PointArrayData.EndPointArrayData(builder).Value);
+    var input = builder.SizedByteArray();
+
+    // One size query is enough for the decoded result, so no second round trip is needed
+    Assert.True(ExampleExports.PointArraySize(input, out int bound));
+    var output = new byte[bound];
+    Assert.True(ExampleExports.PointArrayInto(input, output, out int written));
+    Assert.InRange(written, 1, bound);
+    Assert.Equal(points, Serializer.DeserializeVec3Array(output[..written]));
+  }
+
+  [NativeFact]
+  public void MeshRoundTripSize_QuantizedVertices_FitsTheResult() {
+    var builder = new FlatBufferBuilder(256);
+    FB.MeshData.StartFacesVector(builder, 1);
+    FB.Vec3i.CreateVec3i(builder, 0, 1, 2);
+    var faces = builder.EndVector();
+    var verticesQ = CreateQuantizedPositions(builder, new Vec3(0, 0, 0), new Vec3(2, 2, 0), 8,
+                                             new ushort[] { 0, 0, 0, 255, 0, 0, 0, 255, 0 });
+    FB.MeshData.StartMeshData(builder);
+    FB.MeshData.AddFaces(builder, faces);
+    FB.MeshData.AddVerticesQ(builder, verticesQ);
+    builder.Finish(FB.MeshData.EndMeshData(builder).Value);
+    var input = builder.SizedByteArray();
+
+    Assert.True(ExampleExports.MeshSize(input, out int bound));
+    var output = new byte[bound];
+    Assert.True(ExampleExports.MeshInto(input, output, out int written));
+    Assert.InRange(written, 1, bound);
+    var result = Serializer.DeserializeMesh(output[..written]);
+    Assert.Equal(3, result.VertexCount);
+    Assert.True(new Vec3(2, 0, 0).ApproximatelyEquals(result.Vertices[1]));
+    Assert.Equal(new[] { (0, 1, 2) }, result.TriangleFaces);
+  }
+
+  [NativeFact]
+  public void MeshRoundTripSize_DeltaVarintFaces_FitsTheResult() {
+    var input = CreateCompressedFaceMesh(FB.IndexEncoding.DeltaVarint, 3, 2,
+                                         new byte[] { 0, 2, 2, 0, 1, 4 });
+
+    Assert.True(ExampleExports.MeshSize(input, out int bound));
+    var output = new byte[bound];
+    Assert.True(ExampleExports.MeshInto(input, output, out int written));
+    Assert.InRange(written, 1, bound);
+    var result = Serializer.DeserializeMesh(output[..written]);
+    Assert.Equal(4, result.VertexCount);
+    Assert.Equal(new[] { (0, 1, 2), (2, 1, 3) }, result.TriangleFaces);
+  }
+
+  [NativeFact]
+  public void PointArrayRoundTripSize_InvalidInput_Fails() {
+    Assert.False(ExampleExports.PointArraySize(Array.Empty<byte>(), out int bound));
+    Assert.Equal(0, bound);
+    Assert.False(ExampleExports.PointArraySize(new byte[] { 1, 2, 3 }, out bound));
+  }
+
+  #endregion
 }
@@ -151,6 +151,26 @@ public class MeshTests {
     Assert.Empty(mesh.QuadFaces);
   }
 
+  [Fact]
+  public void Triangulate_RemapsFaceAttributes() {
+    var mesh = new Mesh {
+      Vertices = new Vec3[] {
+        new(0, 0, 0), new(1, 0, 0), new(1, 1, 0), new(0, 1, 0), new(2, 0, 0)
+      },
+      TriangleFaces = new (int, int, int)[] { (1, 4, 2) },
+      QuadFaces = new (int, int, int, int)[] { (0, 1, 2, 3) }
+    };
+    mesh.Attributes.Add(new MeshAttribute("normal", AttributeDomain.Face, 3,
+                                          new float[] { 0, 0, 1, 0, 0, -1 }));
+    mesh.Attributes.Add(new MeshAttribute("w", AttributeDomain.Vertex, 1, new double[] { 1, 2, 3, 4, 5 }));
+
+    mesh.Triangulate();
+
+    Assert.Equal(3, mesh.TriangleFaces.Length);
+    Assert.Equal(new float[] { 0, 0, 1, 0, 0, -1, 0, 0, -1 }, mesh.Attributes[0].Values);
+    Assert.Equal(new double[] { 1, 2, 3, 4, 5 }, mesh.Attributes[1].Values);
+  }
+
   [Fact]
   public void Clone_CreatesDeepCopy() {
     var original = new Mesh {
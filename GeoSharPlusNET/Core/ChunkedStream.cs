@@ -0,0 +1,290 @@
+using System;
+using System.Buffers.Binary;
+using System.IO;
+using Google.FlatBuffers;
+
+namespace GSP.Core {
+  /// <summary>
+  /// Chunked streams for point arrays and meshes too large for one FlatBuffer (2 GB) or the
+  /// int-sized native buffer calls.
+  /// </summary>
+  /// <remarks>
+  /// A stream is a run of frames, each an int64 little-endian length followed by one FlatBuffer
+  /// (see stream.fbs): a header with the counts, then the points in PointArrayData chunks, then
+  /// the mesh faces in MeshData chunks. Every chunk is an ordinary buffer that verifies on its
+  /// own, so only one chunk is ever serialized in memory. Native code reads streams with
+  /// <see cref="NativeStreamReader"/> and writes them with <see cref="CoreBridge.WritePointStream"/>.
+  /// </remarks>
+  public static class ChunkedStream {
+    /// <summary>
+    /// Default target size of one chunk (64 MB).
+    /// </summary>
+    public const int DefaultMaxChunkBytes = 64 << 20;
+
+    // Serialized bytes per point and per index in the default (double, int32) encodings
+    private const int PointBytes = 24;
+    private const int IndexBytes = 4;
+
+    #region Writing
+
+    /// <summary>
+    /// Writes an array of points as a chunked stream.
+    /// </summary>
+    public static void Write(Stream output, Geometry.Vec3[] points, int maxChunkBytes = DefaultMaxChunkBytes) {
+      int chunkSize = ChunkSize(maxChunkBytes, PointBytes);
+      WriteHeader(output, FB.StreamPayload.PointArray, points.Length, 0, 3,
+                  ChunkCount(points.Length, chunkSize), 0);
+      WritePointChunks(output, points, chunkSize);
+    }
+
+    /// <summary>
+    /// Writes a mesh as a chunked stream. Mixed triangle/quad meshes are triangulated.
+    /// </summary>
+    public static void Write(Stream output, Geometry.Mesh mesh, int maxChunkBytes = DefaultMaxChunkBytes) {
+      var workingMesh = mesh;
+      if (mesh.HasQuads && mesh.HasTriangles) {
+        workingMesh = mesh.Clone();
+        workingMesh.Triangulate();
+      }
+
+      bool quads = workingMesh.HasQuads;
+      int faceVertexCount = quads ? 4 : 3;
+      int faceCount = workingMesh.FaceCount;
+      int pointChunkSize = ChunkSize(maxChunkBytes, PointBytes);
+      int faceChunkSize = ChunkSize(maxChunkBytes, faceVertexCount * IndexBytes);
+
+      WriteHeader(output, FB.StreamPayload.Mesh, workingMesh.Vertices.Length, faceCount,
+                  faceVertexCount, ChunkCount(workingMesh.Vertices.Length, pointChunkSize),
+                  ChunkCount(faceCount, faceChunkSize));
+      WritePointChunks(output, workingMesh.Vertices, pointChunkSize);
+
+      // Face chunks are meshes without vertices
+      for (int start = 0; start < faceCount; start += faceChunkSize) {
+        int count = Math.Min(faceChunkSize, faceCount - start);
+        var part = quads
+            ? new Geometry.Mesh(Array.Empty<Geometry.Vec3>(), workingMesh.QuadFaces.AsSpan(start, count).ToArray())
+            : new Geometry.Mesh(Array.Empty<Geometry.Vec3>(), workingMesh.TriangleFaces.AsSpan(start, count).ToArray());
+        WriteFrame(output, Serializer.Serialize(part));
+      }
+    }
+
+    private static void WriteHeader(Stream output, FB.StreamPayload payload, long pointCount, long faceCount,
+                                    int faceVertexCount, long pointChunks, long faceChunks) {
+      var builder = new FlatBufferBuilder(64);
+      var header = FB.StreamHeader.CreateStreamHeader(builder, payload, (ulong)pointCount, (ulong)faceCount,
+                                                      (byte)faceVertexCount, (ulong)pointChunks, (ulong)faceChunks);
+      builder.Finish(header.Value);
+      WriteFrame(output, builder.SizedByteArray());
+    }
+
+    private static void WritePointChunks(Stream output, Geometry.Vec3[] points, int chunkSize) {
+      for (int start = 0; start < points.Length; start += chunkSize) {
+        int count = Math.Min(chunkSize, points.Length - start);
+        WriteFrame(output, Serializer.Serialize(points.AsSpan(start, count).ToArray()));
+      }
+    }
+
+    private static void WriteFrame(Stream output, byte[] body) {
+      Span<byte> prefix = stackalloc byte[sizeof(long)];
+      BinaryPrimitives.WriteInt64LittleEndian(prefix, body.Length);
+      output.Write(prefix);
+      output.Write(body, 0, body.Length);
+    }
+
+    private static int ChunkSize(int maxChunkBytes, int bytesPerElement) {
+      if (maxChunkBytes <= 0)
+        throw new ArgumentOutOfRangeException(nameof(maxChunkBytes), maxChunkBytes, "Chunk size must be positive");
+      return Math.Max(1, maxChunkBytes / bytesPerElement);
+    }
+
+    private static long ChunkCount(long count, int chunkSize) => (count + chunkSize - 1) / chunkSize;
+
+    #endregion
+
+    #region Reading
+
+    /// <summary>
+    /// Reads a point array stream.
+    /// </summary>
+    /// <exception cref="InvalidDataException">The stream is malformed or not a point array.</exception>
+    /// <exception cref="EndOfStreamException">The stream is truncated.</exception>
+    public static Geometry.Vec3[] ReadVec3Array(Stream input) {
+      var header = ReadHeader(input);
+      if (header.Payload != FB.StreamPayload.PointArray)
+        throw new InvalidDataException("Stream does not hold a point array");
+      return ReadPoints(input, header);
+    }
+
+    /// <summary>
+    /// Reads a mesh stream.
+    /// </summary>
+    /// <exception cref="InvalidDataException">The stream is malformed or not a mesh.</exception>
+    /// <exception cref="EndOfStreamException">The stream is truncated.</exception>
+    public static Geometry.Mesh ReadMesh(Stream input) {
+      var header = ReadHeader(input);
+      if (header.Payload != FB.StreamPayload.Mesh)
+        throw new InvalidDataException("Stream does not hold a mesh");
+
+      var mesh = new Geometry.Mesh { Vertices = ReadPoints(input, header) };
+      int faceCount = CheckedCount(header.FaceCount, header.FaceChunks);
+      bool quads = header.FaceVertexCount == 4;
+      var tris = quads ? Array.Empty<(int, int, int)>() : new (int, int, int)[faceCount];
+      var quadFaces = quads ? new (int, int, int, int)[faceCount] : Array.Empty<(int, int, int, int)>();
+
+      int read = 0;
+      for (ulong chunk = 0; chunk < header.FaceChunks; chunk++) {
+        var part = Serializer.DeserializeMesh(ReadFrame(input));
+        if (part.VertexCount != 0 || part.HasTriangles == quads || part.FaceCount > faceCount - read)
+          throw new InvalidDataException("Face chunk does not match the stream header");
+
+        if (quads)
+          part.QuadFaces.CopyTo(quadFaces, read);
+        else
+          part.TriangleFaces.CopyTo(tris, read);
+        read += part.FaceCount;
+      }
+      if (read != faceCount)
+        throw new InvalidDataException("Face chunks do not add up to the stream header");
+
+      mesh.TriangleFaces = tris;
+      mesh.QuadFaces = quadFaces;
+      return mesh;
+    }
+
+    private static FB.StreamHeader ReadHeader(Stream input) {
+      var header = FB.StreamHeader.GetRootAsStreamHeader(new ByteBuffer(ReadFrame(input)));
+      if (header.FaceVertexCount != 3 && header.FaceVertexCount != 4)
+        throw new InvalidDataException("Unsupported face size in stream header");
+      return header;
+    }
+
+    private static Geometry.Vec3[] ReadPoints(Stream input, FB.StreamHeader header) {
+      int pointCount = CheckedCount(header.PointCount, header.PointChunks);
+      var points = new Geometry.Vec3[pointCount];
+
+      int read = 0;
+      for (ulong chunk = 0; chunk < header.PointChunks; chunk++) {
+        var part = Serializer.DeserializeVec3Array(ReadFrame(input));
+        if (part.Length == 0 || part.Length > pointCount - read)
+          throw new InvalidDataException("Point chunk does not match the stream header");
+        part.CopyTo(points, read);
+        read += part.Length;
+      }
+      if (read != pointCount)
+        throw new InvalidDataException("Point chunks do not add up to the stream header");
+      return points;
+    }
+
+    // Managed arrays are int-indexed; every chunk holds at least one element
+    private static int CheckedCount(ulong count, ulong chunks) {
+      if (count > int.MaxValue || chunks > count || (count > 0 && chunks == 0))
+        throw new InvalidDataException("Invalid counts in stream header");
+      return (int)count;
+    }
+
+    private static byte[] ReadFrame(Stream input) {
+      Span<byte> prefix = stackalloc byte[sizeof(long)];
+      input.ReadExactly(prefix);
+      long length = BinaryPrimitives.ReadInt64LittleEndian(prefix);
+      if (length <= 0 || length > int.MaxValue)
+        throw new InvalidDataException($"Invalid frame length {length}");
+
+      var body = new byte[length];
+      input.ReadExactly(body);
+      return body;
+    }
+
+    #endregion
+  }
+
+  /// <summary>
+  /// Native incremental reader for chunked streams. Append the stream in pieces of any size;
+  /// the native side decodes each frame as it completes and assembles the result in place.
+  /// </summary>
+  public sealed class NativeStreamReader : IDisposable {
+    private IntPtr _handle;
+
+    public NativeStreamReader() {
+      _handle = CoreBridge.StreamReaderCreate();
+      if (_handle == IntPtr.Zero)
+        throw new OutOfMemoryException("Failed to create native stream reader");
+    }
+
+    /// <summary>
+    /// True once every chunk announced by the stream header has been read.
+    /// </summary>
+    public bool IsComplete => CoreBridge.StreamReaderComplete(Handle);
+
+    /// <summary>
+    /// Feeds the next bytes of the stream.
+    /// </summary>
+    /// <exception cref="InvalidDataException">The stream is malformed.</exception>
+    public void Append(byte[] data, int offset, int count) {
+      ArgumentOutOfRangeException.ThrowIfNegative(offset);
+      ArgumentOutOfRangeException.ThrowIfNegative(count);
+      if (offset > data.Length - count)
+        throw new ArgumentOutOfRangeException(nameof(count));
+
+      if (!CoreBridge.StreamReaderAppend(Handle, data, offset, count))
+        throw new InvalidDataException("Malformed chunked stream");
+    }
+
+    /// <summary>
+    /// Feeds the rest of <paramref name="input"/>, one buffer at a time.
+    /// </summary>
+    public void ReadFrom(Stream input, int bufferSize = 1 << 20) {
+      var buffer = new byte[bufferSize];
+      int read;
+      while ((read = input.Read(buffer, 0, buffer.Length)) > 0) {
+        Append(buffer, 0, read);
+      }
+    }
+
+    /// <summary>
+    /// Copies the points (or mesh vertices) out as interleaved x, y, z doubles.
+    /// </summary>
+    public double[] GetPoints() {
+      GetCounts(out long pointCount, out _, out _);
+      var xyz = new double[checked(3 * pointCount)];
+      if (!CoreBridge.StreamReaderCopyPoints(Handle, xyz, pointCount))
+        throw new InvalidOperationException("Failed to copy stream points");
+      return xyz;
+    }
+
+    /// <summary>
+    /// Copies the mesh faces out as flat indices, <paramref name="faceVertexCount"/> per face.
+    /// </summary>
+    public int[] GetFaces(out int faceVertexCount) {
+      GetCounts(out _, out long faceCount, out faceVertexCount);
+      var indices = new int[checked(faceVertexCount * faceCount)];
+      if (!CoreBridge.StreamReaderCopyFaces(Handle, indices, faceCount))
+        throw new InvalidOperationException("Failed to copy stream faces");
+      return indices;
+    }
+
+    private void GetCounts(out long pointCount, out long faceCount, out int faceVertexCount) {
+      if (!CoreBridge.StreamReaderCounts(Handle, out pointCount, out faceCount, out faceVertexCount))
+        throw new InvalidOperationException("Stream is not complete");
+    }
+
+    private IntPtr Handle {
+      get {
+        ObjectDisposedException.ThrowIf(_handle == IntPtr.Zero, this);
+        return _handle;
+      }
+    }
+
+    public void Dispose() {
+      if (_handle != IntPtr.Zero) {
+        CoreBridge.StreamReaderDestroy(_handle);
+        _handle = IntPtr.Zero;
+      }
+      GC.SuppressFinalize(this);
+    }
+
+    ~NativeStreamReader() {
+      if (_handle != IntPtr.Zero)
+        CoreBridge.StreamReaderDestroy(_handle);
+    }
+  }
+}
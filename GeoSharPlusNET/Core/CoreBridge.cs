@@ -0,0 +1,825 @@
+using System.Runtime.InteropServices;
+using Google.FlatBuffers;
+
+namespace GSP.Core {
+  /// <summary>
+  /// How much of an incoming FlatBuffer the native deserializers check before reading it.
+  /// </summary>
+  public enum VerifyPolicy {
+    /// <summary>Full FlatBuffers verification (default).</summary>
+    Full = 0,
+
+    /// <summary>Root offset, table header and vector bounds only.</summary>
+    HeaderOnly = 1,
+
+    /// <summary>
+    /// No checks. Only safe for buffers produced by <see cref="Serializer"/> or the Rhino
+    /// <c>Wrapper</c> in this process.
+    /// </summary>
+    Trusted = 2,
+  }
+
+  /// <summary>
+  /// P/Invoke bridge for library-wide native settings.
+  /// </summary>
+  public static class CoreBridge {
+    // --------------------------------
+    // Buffer verification
+    // --------------------------------
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_set_verify_policy", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool SetVerifyPolicyWin(int policy);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_set_verify_policy", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool SetVerifyPolicyMac(int policy);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_get_verify_policy", CallingConvention = CallingConvention.Cdecl)]
+    private static extern int GetVerifyPolicyWin();
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_get_verify_policy", CallingConvention = CallingConvention.Cdecl)]
+    private static extern int GetVerifyPolicyMac();
+
+    /// <summary>
+    /// Process-wide verification policy used by every native deserializer.
+    /// </summary>
+    public static VerifyPolicy VerifyPolicy {
+      get => (VerifyPolicy)(Platform.IsWindows ? GetVerifyPolicyWin() : GetVerifyPolicyMac());
+      set {
+        bool ok = Platform.IsWindows ? SetVerifyPolicyWin((int)value) : SetVerifyPolicyMac((int)value);
+        if (!ok)
+          throw new ArgumentOutOfRangeException(nameof(value), value, "Unknown verification policy");
+      }
+    }
+
+    // --------------------------------
+    // Chunked streams
+    // --------------------------------
+    /// <summary>
+    /// Receives one frame of a native chunked stream, length prefix included. The bytes are only
+    /// valid during the call; return false to abort the stream.
+    /// </summary>
+    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+    public delegate bool FrameSink(IntPtr frame, long size, IntPtr context);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_stream_write_points", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool StreamWritePointsWin(double[] xyz, long count, long maxChunkBytes, FrameSink sink, IntPtr context);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_stream_write_points", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool StreamWritePointsMac(double[] xyz, long count, long maxChunkBytes, FrameSink sink, IntPtr context);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_stream_reader_create", CallingConvention = CallingConvention.Cdecl)]
+    private static extern IntPtr StreamReaderCreateWin();
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_stream_reader_create", CallingConvention = CallingConvention.Cdecl)]
+    private static extern IntPtr StreamReaderCreateMac();
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_stream_reader_destroy", CallingConvention = CallingConvention.Cdecl)]
+    private static extern void StreamReaderDestroyWin(IntPtr reader);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_stream_reader_destroy", CallingConvention = CallingConvention.Cdecl)]
+    private static extern void StreamReaderDestroyMac(IntPtr reader);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_stream_reader_append", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool StreamReaderAppendWin(IntPtr reader, ref byte data, long size);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_stream_reader_append", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool StreamReaderAppendMac(IntPtr reader, ref byte data, long size);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_stream_reader_complete", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool StreamReaderCompleteWin(IntPtr reader);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_stream_reader_complete", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool StreamReaderCompleteMac(IntPtr reader);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_stream_reader_counts", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool StreamReaderCountsWin(IntPtr reader, out long pointCount, out long faceCount, out int faceVertexCount);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_stream_reader_counts", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool StreamReaderCountsMac(IntPtr reader, out long pointCount, out long faceCount, out int faceVertexCount);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_stream_reader_copy_points", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool StreamReaderCopyPointsWin(IntPtr reader, [Out] double[] xyz, long count);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_stream_reader_copy_points", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool StreamReaderCopyPointsMac(IntPtr reader, [Out] double[] xyz, long count);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_stream_reader_copy_faces", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool StreamReaderCopyFacesWin(IntPtr reader, [Out] int[] indices, long count);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_stream_reader_copy_faces", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool StreamReaderCopyFacesMac(IntPtr reader, [Out] int[] indices, long count);
+
+    /// <summary>
+    /// Streams points (interleaved x, y, z) from native code to <paramref name="output"/> as a
+    /// chunked point array stream, without building one large buffer on either side.
+    /// </summary>
+    public static void WritePointStream(double[] xyz, Stream output, long maxChunkBytes = ChunkedStream.DefaultMaxChunkBytes) {
+      if (xyz.Length % 3 != 0)
+        throw new ArgumentException("Coordinate count must be a multiple of 3", nameof(xyz));
+
+      byte[] scratch = Array.Empty<byte>();
+      Exception? sinkError = null;
+      FrameSink sink = (frame, size, _) => {
+        try {
+          if (scratch.Length < size)
+            scratch = new byte[size];
+          Marshal.Copy(frame, scratch, 0, (int)size);
+          output.Write(scratch, 0, (int)size);
+          return true;
+        } catch (Exception e) {
+          sinkError = e;
+          return false;
+        }
+      };
+
+      bool ok = Platform.IsWindows
+          ? StreamWritePointsWin(xyz, xyz.Length / 3, maxChunkBytes, sink, IntPtr.Zero)
+          : StreamWritePointsMac(xyz, xyz.Length / 3, maxChunkBytes, sink, IntPtr.Zero);
+      GC.KeepAlive(sink);
+      if (sinkError != null)
+        throw new IOException("Failed to write chunked stream", sinkError);
+      if (!ok)
+        throw new InvalidOperationException("Native chunked stream serialization failed");
+    }
+
+    internal static IntPtr StreamReaderCreate() =>
+        Platform.IsWindows ? StreamReaderCreateWin() : StreamReaderCreateMac();
+
+    internal static void StreamReaderDestroy(IntPtr reader) {
+      if (Platform.IsWindows)
+        StreamReaderDestroyWin(reader);
+      else
+        StreamReaderDestroyMac(reader);
+    }
+
+    internal static bool StreamReaderAppend(IntPtr reader, byte[] data, int offset, int count) {
+      if (count == 0)
+        return true;
+      return Platform.IsWindows
+          ? StreamReaderAppendWin(reader, ref data[offset], count)
+          : StreamReaderAppendMac(reader, ref data[offset], count);
+    }
+
+    internal static bool StreamReaderComplete(IntPtr reader) =>
+        Platform.IsWindows ? StreamReaderCompleteWin(reader) : StreamReaderCompleteMac(reader);
+
+    internal static bool StreamReaderCounts(IntPtr reader, out long pointCount, out long faceCount, out int faceVertexCount) =>
+        Platform.IsWindows
+            ? StreamReaderCountsWin(reader, out pointCount, out faceCount, out faceVertexCount)
+            : StreamReaderCountsMac(reader, out pointCount, out faceCount, out faceVertexCount);
+
+    internal static bool StreamReaderCopyPoints(IntPtr reader, double[] xyz, long count) =>
+        Platform.IsWindows ? StreamReaderCopyPointsWin(reader, xyz, count) : StreamReaderCopyPointsMac(reader, xyz, count);
+
+    internal static bool StreamReaderCopyFaces(IntPtr reader, int[] indices, long count) =>
+        Platform.IsWindows ? StreamReaderCopyFacesWin(reader, indices, count) : StreamReaderCopyFacesMac(reader, indices, count);
+
+    // --------------------------------
+    // Resident meshes
+    // --------------------------------
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_mesh_upload", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool MeshUploadWin(byte[] buffer, int size, out ulong handle);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_mesh_upload", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool MeshUploadMac(byte[] buffer, int size, out ulong handle);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_mesh_download", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool MeshDownloadWin(ulong handle, out IntPtr outBuffer, out int outSize);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_mesh_download", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool MeshDownloadMac(ulong handle, out IntPtr outBuffer, out int outSize);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_release", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ReleaseWin(ulong handle);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_release", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ReleaseMac(ulong handle);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_resident_stats", CallingConvention = CallingConvention.Cdecl)]
+    private static extern void ResidentStatsWin(out long handleCount, out long residentBytes);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_resident_stats", CallingConvention = CallingConvention.Cdecl)]
+    private static extern void ResidentStatsMac(out long handleCount, out long residentBytes);
+
+    /// <summary>
+    /// Number of live resident-mesh handles and the native bytes held by their meshes.
+    /// </summary>
+    public static (long HandleCount, long ResidentBytes) ResidentStats {
+      get {
+        long handleCount, residentBytes;
+        if (Platform.IsWindows)
+          ResidentStatsWin(out handleCount, out residentBytes);
+        else
+          ResidentStatsMac(out handleCount, out residentBytes);
+        return (handleCount, residentBytes);
+      }
+    }
+
+    internal static bool MeshUpload(byte[] buffer, out ulong handle) =>
+        Platform.IsWindows ? MeshUploadWin(buffer, buffer.Length, out handle) : MeshUploadMac(buffer, buffer.Length, out handle);
+
+    internal static bool MeshDownload(ulong handle, out IntPtr outBuffer, out int outSize) =>
+        Platform.IsWindows ? MeshDownloadWin(handle, out outBuffer, out outSize) : MeshDownloadMac(handle, out outBuffer, out outSize);
+
+    internal static bool Release(ulong handle) =>
+        Platform.IsWindows ? ReleaseWin(handle) : ReleaseMac(handle);
+
+    // --------------------------------
+    // Mass properties
+    // --------------------------------
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_mass_properties", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool MassPropertiesWin(byte[] inBuffer, int inSize, int summation, out IntPtr outBuffer, out int outSize);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_mass_properties", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool MassPropertiesMac(byte[] inBuffer, int inSize, int summation, out IntPtr outBuffer, out int outSize);
+
+    /// <summary>
+    /// Area, volume, centroids and inertia tensor of every mesh of a MeshBatch buffer (see
+    /// <see cref="Serializer.Serialize(Geometry.Mesh[], bool)"/>), one result per mesh in order.
+    /// Meshes are measured in parallel on the native thread pool.
+    /// </summary>
+    /// <exception cref="InvalidDataException">The buffer is not a valid mesh batch.</exception>
+    public static Geometry.MassProperties[] MassProperties(byte[] meshBatchBuffer,
+        Geometry.MassSummation summation = Geometry.MassSummation.Deterministic) {
+      bool ok = Platform.IsWindows
+          ? MassPropertiesWin(meshBatchBuffer, meshBatchBuffer.Length, (int)summation, out IntPtr outBuffer, out int outSize)
+          : MassPropertiesMac(meshBatchBuffer, meshBatchBuffer.Length, (int)summation, out outBuffer, out outSize);
+      if (!ok)
+        throw new InvalidDataException("Failed to compute mass properties: invalid mesh batch");
+
+      return Serializer.DeserializeMassPropertiesBatch(MarshalHelper.CopyAndFree(outBuffer, outSize));
+    }
+
+    /// <inheritdoc cref="MassProperties(byte[], Geometry.MassSummation)"/>
+    public static Geometry.MassProperties[] MassProperties(Geometry.Mesh[] meshes,
+        Geometry.MassSummation summation = Geometry.MassSummation.Deterministic) =>
+        MassProperties(Serializer.Serialize(meshes), summation);
+
+    // --------------------------------
+    // Bounding boxes
+    // --------------------------------
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_mesh_bounding_boxes", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool MeshBoundingBoxesWin(byte[] inBuffer, int inSize, int fit, out IntPtr outBuffer, out int outSize);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_mesh_bounding_boxes", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool MeshBoundingBoxesMac(byte[] inBuffer, int inSize, int fit, out IntPtr outBuffer, out int outSize);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_point_bounding_boxes", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool PointBoundingBoxesWin(byte[] inBuffer, int inSize, int fit, out IntPtr outBuffer, out int outSize);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_point_bounding_boxes", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool PointBoundingBoxesMac(byte[] inBuffer, int inSize, int fit, out IntPtr outBuffer, out int outSize);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_resident_bounding_boxes", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ResidentBoundingBoxesWin(ulong[] handles, int count, int fit, out IntPtr outBuffer, out int outSize);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_resident_bounding_boxes", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ResidentBoundingBoxesMac(ulong[] handles, int count, int fit, out IntPtr outBuffer, out int outSize);
+
+    /// <summary>
+    /// Bounding box of every mesh of a MeshBatch buffer (see
+    /// <see cref="Serializer.Serialize(Geometry.Mesh[], bool)"/>), one box per mesh in order.
+    /// Boxes enclose the mesh vertices and are fitted in parallel on the native thread pool;
+    /// fitted boxes are never larger than the axis-aligned one.
+    /// </summary>
+    /// <exception cref="InvalidDataException">The buffer is not a valid mesh batch.</exception>
+    public static Geometry.OrientedBox[] BoundingBoxes(byte[] meshBatchBuffer,
+        Geometry.BoxFit fit = Geometry.BoxFit.MinimumArea) {
+      bool ok = Platform.IsWindows
+          ? MeshBoundingBoxesWin(meshBatchBuffer, meshBatchBuffer.Length, (int)fit, out IntPtr outBuffer, out int outSize)
+          : MeshBoundingBoxesMac(meshBatchBuffer, meshBatchBuffer.Length, (int)fit, out outBuffer, out outSize);
+      if (!ok)
+        throw new InvalidDataException("Failed to compute bounding boxes: invalid mesh batch");
+
+      return Serializer.DeserializeBoundingBoxBatch(MarshalHelper.CopyAndFree(outBuffer, outSize));
+    }
+
+    /// <inheritdoc cref="BoundingBoxes(byte[], Geometry.BoxFit)"/>
+    public static Geometry.OrientedBox[] BoundingBoxes(Geometry.Mesh[] meshes,
+        Geometry.BoxFit fit = Geometry.BoxFit.MinimumArea) =>
+        BoundingBoxes(Serializer.Serialize(meshes), fit);
+
+    /// <summary>
+    /// Bounding box of every point array of a PointArrayBatch buffer (see
+    /// <see cref="Serializer.Serialize(Geometry.Vec3[][])"/>), one box per array in order.
+    /// </summary>
+    /// <exception cref="InvalidDataException">The buffer is not a valid point array batch.</exception>
+    public static Geometry.OrientedBox[] PointBoundingBoxes(byte[] pointArrayBatchBuffer,
+        Geometry.BoxFit fit = Geometry.BoxFit.MinimumArea) {
+      bool ok = Platform.IsWindows
+          ? PointBoundingBoxesWin(pointArrayBatchBuffer, pointArrayBatchBuffer.Length, (int)fit, out IntPtr outBuffer, out int outSize)
+          : PointBoundingBoxesMac(pointArrayBatchBuffer, pointArrayBatchBuffer.Length, (int)fit, out outBuffer, out outSize);
+      if (!ok)
+        throw new InvalidDataException("Failed to compute bounding boxes: invalid point array batch");
+
+      return Serializer.DeserializeBoundingBoxBatch(MarshalHelper.CopyAndFree(outBuffer, outSize));
+    }
+
+    /// <inheritdoc cref="PointBoundingBoxes(byte[], Geometry.BoxFit)"/>
+    public static Geometry.OrientedBox[] PointBoundingBoxes(Geometry.Vec3[][] pointArrays,
+        Geometry.BoxFit fit = Geometry.BoxFit.MinimumArea) =>
+        PointBoundingBoxes(Serializer.Serialize(pointArrays), fit);
+
+    /// <summary>
+    /// Bounding box of every resident mesh, in order. Axis-aligned boxes are computed once per
+    /// mesh and cached natively, so repeated queries cost no pass over the vertices.
+    /// </summary>
+    /// <exception cref="ObjectDisposedException">A mesh has been disposed.</exception>
+    public static Geometry.OrientedBox[] BoundingBoxes(NativeMesh[] meshes,
+        Geometry.BoxFit fit = Geometry.BoxFit.MinimumArea) {
+      var handles = new ulong[meshes.Length];
+      for (int i = 0; i < meshes.Length; i++)
+        handles[i] = meshes[i].Handle;
+
+      bool ok = Platform.IsWindows
+          ? ResidentBoundingBoxesWin(handles, handles.Length, (int)fit, out IntPtr outBuffer, out int outSize)
+          : ResidentBoundingBoxesMac(handles, handles.Length, (int)fit, out outBuffer, out outSize);
+      if (!ok)
+        throw new InvalidOperationException("Failed to compute bounding boxes of resident meshes");
+
+      GC.KeepAlive(meshes);
+      return Serializer.DeserializeBoundingBoxBatch(MarshalHelper.CopyAndFree(outBuffer, outSize));
+    }
+
+    // --------------------------------
+    // Topology check and repair
+    // --------------------------------
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_check_topology", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool CheckTopologyWin(byte[] inBuffer, int inSize, int repair,
+        out IntPtr reportBuffer, out int reportSize, out IntPtr meshBuffer, out int meshSize);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_check_topology", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool CheckTopologyMac(byte[] inBuffer, int inSize, int repair,
+        out IntPtr reportBuffer, out int reportSize, out IntPtr meshBuffer, out int meshSize);
+
+    private static Geometry.TopologyReport CheckTopology(byte[] meshBuffer, Geometry.MeshRepair repair,
+        out byte[]? repairedBuffer) {
+      bool ok = Platform.IsWindows
+          ? CheckTopologyWin(meshBuffer, meshBuffer.Length, (int)repair,
+              out IntPtr reportBuffer, out int reportSize, out IntPtr outMesh, out int outMeshSize)
+          : CheckTopologyMac(meshBuffer, meshBuffer.Length, (int)repair,
+              out reportBuffer, out reportSize, out outMesh, out outMeshSize);
+      if (!ok)
+        throw new InvalidDataException("Failed to check topology: invalid mesh or repair flags");
+
+      repairedBuffer = outMesh != IntPtr.Zero ? MarshalHelper.CopyAndFree(outMesh, outMeshSize) : null;
+      return Serializer.DeserializeTopologyReport(MarshalHelper.CopyAndFree(reportBuffer, reportSize));
+    }
+
+    /// <summary>
+    /// Checks a MeshData buffer for degenerate and duplicate faces, non-manifold edges and
+    /// vertices, unreferenced vertices, flipped neighbours and boundary loops, in one parallel
+    /// pass on the native thread pool.
+    /// </summary>
+    /// <exception cref="InvalidDataException">The buffer is not a valid mesh, or a face indexes
+    /// a missing vertex.</exception>
+    public static Geometry.TopologyReport CheckTopology(byte[] meshBuffer) =>
+        CheckTopology(meshBuffer, Geometry.MeshRepair.None, out _);
+
+    /// <inheritdoc cref="CheckTopology(byte[])"/>
+    public static Geometry.TopologyReport CheckTopology(Geometry.Mesh mesh) =>
+        CheckTopology(Serializer.Serialize(mesh));
+
+    /// <summary>
+    /// Checks a mesh like <see cref="CheckTopology(byte[])"/> and applies the fixes in
+    /// <paramref name="repair"/> in the same call. The report describes the input mesh. Faces
+    /// and vertices keep their relative order, and attributes follow them; non-manifold and
+    /// orientation problems not caused by duplicates are left alone.
+    /// </summary>
+    /// <exception cref="InvalidDataException">The buffer is not a valid mesh, or a face indexes
+    /// a missing vertex.</exception>
+    public static Geometry.TopologyReport CheckTopology(Geometry.Mesh mesh, Geometry.MeshRepair repair,
+        out Geometry.Mesh repaired) {
+      var report = CheckTopology(Serializer.Serialize(mesh), repair, out byte[]? repairedBuffer);
+      repaired = repairedBuffer != null ? Serializer.DeserializeMesh(repairedBuffer) : mesh;
+      return report;
+    }
+
+    // --------------------------------
+    // Mesh queries
+    // --------------------------------
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_mesh_closest_points", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool MeshClosestPointsWin(ulong handle, byte[] inBuffer, int inSize, double maxDistance,
+        out IntPtr outBuffer, out int outSize);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_mesh_closest_points", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool MeshClosestPointsMac(ulong handle, byte[] inBuffer, int inSize, double maxDistance,
+        out IntPtr outBuffer, out int outSize);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_mesh_signed_distances", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool MeshSignedDistancesWin(ulong handle, byte[] inBuffer, int inSize, double maxDistance,
+        out IntPtr outBuffer, out int outSize);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_mesh_signed_distances", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool MeshSignedDistancesMac(ulong handle, byte[] inBuffer, int inSize, double maxDistance,
+        out IntPtr outBuffer, out int outSize);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_mesh_faces_within", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool MeshFacesWithinWin(ulong handle, byte[] inBuffer, int inSize, double radius,
+        out IntPtr outBuffer, out int outSize);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_mesh_faces_within", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool MeshFacesWithinMac(ulong handle, byte[] inBuffer, int inSize, double radius,
+        out IntPtr outBuffer, out int outSize);
+
+    /// <summary>
+    /// Closest point of a resident mesh to every point of a PointArrayData buffer (see
+    /// <see cref="Serializer.Serialize(Geometry.Vec3[])"/>), in order. The mesh's spatial index
+    /// is built natively on its first query and reused until the mesh is disposed; points are
+    /// queried in parallel on the native thread pool. Points farther than
+    /// <paramref name="maxDistance"/> get a hit with face -1.
+    /// </summary>
+    /// <exception cref="ObjectDisposedException">The mesh has been disposed.</exception>
+    /// <exception cref="InvalidOperationException">The mesh has a face indexing a missing vertex,
+    /// the distance is negative or NaN, or the buffer is not a valid point array.</exception>
+    public static Geometry.MeshHit[] ClosestPoints(NativeMesh mesh, byte[] pointsBuffer,
+        double maxDistance = double.PositiveInfinity) {
+      bool ok = Platform.IsWindows
+          ? MeshClosestPointsWin(mesh.Handle, pointsBuffer, pointsBuffer.Length, maxDistance,
+              out IntPtr outBuffer, out int outSize)
+          : MeshClosestPointsMac(mesh.Handle, pointsBuffer, pointsBuffer.Length, maxDistance,
+              out outBuffer, out outSize);
+      if (!ok)
+        throw new InvalidOperationException("Failed to query closest points: invalid mesh, distance or points");
+
+      GC.KeepAlive(mesh);
+      return Serializer.DeserializeMeshHits(MarshalHelper.CopyAndFree(outBuffer, outSize));
+    }
+
+    /// <inheritdoc cref="ClosestPoints(NativeMesh, byte[], double)"/>
+    public static Geometry.MeshHit[] ClosestPoints(NativeMesh mesh, Geometry.Vec3[] points,
+        double maxDistance = double.PositiveInfinity) =>
+        ClosestPoints(mesh, Serializer.Serialize(points), maxDistance);
+
+    /// <summary>
+    /// <see cref="ClosestPoints(NativeMesh, byte[], double)"/> with the distance negated for
+    /// points inside the mesh. The side is exact for closed meshes with faces oriented
+    /// outward; elsewhere it follows the nearest face.
+    /// </summary>
+    /// <exception cref="ObjectDisposedException">The mesh has been disposed.</exception>
+    /// <exception cref="InvalidOperationException">The mesh has a face indexing a missing vertex,
+    /// the distance is negative or NaN, or the buffer is not a valid point array.</exception>
+    public static Geometry.MeshHit[] SignedDistances(NativeMesh mesh, byte[] pointsBuffer,
+        double maxDistance = double.PositiveInfinity) {
+      bool ok = Platform.IsWindows
+          ? MeshSignedDistancesWin(mesh.Handle, pointsBuffer, pointsBuffer.Length, maxDistance,
+              out IntPtr outBuffer, out int outSize)
+          : MeshSignedDistancesMac(mesh.Handle, pointsBuffer, pointsBuffer.Length, maxDistance,
+              out outBuffer, out outSize);
+      if (!ok)
+        throw new InvalidOperationException("Failed to query signed distances: invalid mesh, distance or points");
+
+      GC.KeepAlive(mesh);
+      return Serializer.DeserializeMeshHits(MarshalHelper.CopyAndFree(outBuffer, outSize));
+    }
+
+    /// <inheritdoc cref="SignedDistances(NativeMesh, byte[], double)"/>
+    public static Geometry.MeshHit[] SignedDistances(NativeMesh mesh, Geometry.Vec3[] points,
+        double maxDistance = double.PositiveInfinity) =>
+        SignedDistances(mesh, Serializer.Serialize(points), maxDistance);
+
+    /// <summary>
+    /// Faces of a resident mesh within <paramref name="radius"/> of every point of a
+    /// PointArrayData buffer, nearest first (by face on ties), using the same spatial index as
+    /// <see cref="ClosestPoints(NativeMesh, byte[], double)"/>.
+    /// </summary>
+    /// <exception cref="ObjectDisposedException">The mesh has been disposed.</exception>
+    /// <exception cref="InvalidOperationException">The mesh has a face indexing a missing vertex,
+    /// the radius is negative or NaN, or the buffer is not a valid point array.</exception>
+    public static (int Face, double Distance)[][] FacesWithin(NativeMesh mesh, byte[] pointsBuffer,
+        double radius) {
+      bool ok = Platform.IsWindows
+          ? MeshFacesWithinWin(mesh.Handle, pointsBuffer, pointsBuffer.Length, radius,
+              out IntPtr outBuffer, out int outSize)
+          : MeshFacesWithinMac(mesh.Handle, pointsBuffer, pointsBuffer.Length, radius,
+              out outBuffer, out outSize);
+      if (!ok)
+        throw new InvalidOperationException("Failed to query faces within radius: invalid mesh, radius or points");
+
+      GC.KeepAlive(mesh);
+      return Serializer.DeserializeFacesWithin(MarshalHelper.CopyAndFree(outBuffer, outSize));
+    }
+
+    /// <inheritdoc cref="FacesWithin(NativeMesh, byte[], double)"/>
+    public static (int Face, double Distance)[][] FacesWithin(NativeMesh mesh, Geometry.Vec3[] points,
+        double radius) =>
+        FacesWithin(mesh, Serializer.Serialize(points), radius);
+
+    // --------------------------------
+    // Result cache
+    // --------------------------------
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_cache_set_budget", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool CacheSetBudgetWin(long bytes);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_cache_set_budget", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool CacheSetBudgetMac(long bytes);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_cache_clear", CallingConvention = CallingConvention.Cdecl)]
+    private static extern void CacheClearWin();
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_cache_clear", CallingConvention = CallingConvention.Cdecl)]
+    private static extern void CacheClearMac();
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_cache_stats", CallingConvention = CallingConvention.Cdecl)]
+    private static extern void CacheStatsWin(out long hits, out long misses, out long entries, out long bytes);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_cache_stats", CallingConvention = CallingConvention.Cdecl)]
+    private static extern void CacheStatsMac(out long hits, out long misses, out long entries, out long bytes);
+
+    /// <summary>
+    /// Enables memoization of native results for exports that opt in, keeping at most
+    /// <paramref name="bytes"/> of results; 0 disables the cache and drops every entry.
+    /// </summary>
+    /// <remarks>
+    /// Useful when the same inputs are recomputed repeatedly, e.g. a Grasshopper solution that
+    /// re-runs while only unrelated parameters change. The cache is off by default.
+    /// </remarks>
+    public static void SetCacheBudget(long bytes) {
+      bool ok = Platform.IsWindows ? CacheSetBudgetWin(bytes) : CacheSetBudgetMac(bytes);
+      if (!ok)
+        throw new ArgumentOutOfRangeException(nameof(bytes), bytes, "Cache budget must not be negative");
+    }
+
+    /// <summary>
+    /// Drops every cached result and resets the hit/miss counters.
+    /// </summary>
+    public static void ClearCache() {
+      if (Platform.IsWindows)
+        CacheClearWin();
+      else
+        CacheClearMac();
+    }
+
+    /// <summary>
+    /// Cache hits and misses since the last clear, and the results currently cached.
+    /// </summary>
+    public static (long Hits, long Misses, long Entries, long Bytes) CacheStats {
+      get {
+        long hits, misses, entries, bytes;
+        if (Platform.IsWindows)
+          CacheStatsWin(out hits, out misses, out entries, out bytes);
+        else
+          CacheStatsMac(out hits, out misses, out entries, out bytes);
+        return (hits, misses, entries, bytes);
+      }
+    }
+
+    // --------------------------------
+    // Performance counters
+    // --------------------------------
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_set_stats_enabled", CallingConvention = CallingConvention.Cdecl)]
+    private static extern void SetStatsEnabledWin(bool enabled);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_set_stats_enabled", CallingConvention = CallingConvention.Cdecl)]
+    private static extern void SetStatsEnabledMac(bool enabled);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_get_stats", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool GetStatsWin(out IntPtr outBuffer, out int outSize);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_get_stats", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool GetStatsMac(out IntPtr outBuffer, out int outSize);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_reset_stats", CallingConvention = CallingConvention.Cdecl)]
+    private static extern void ResetStatsWin();
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_reset_stats", CallingConvention = CallingConvention.Cdecl)]
+    private static extern void ResetStatsMac();
+
+    /// <summary>
+    /// Starts or stops recording per-export performance counters. Recording is off by default;
+    /// counters are kept while it is stopped.
+    /// </summary>
+    /// <remarks>
+    /// Native builds configured with <c>GSP_ENABLE_STATS=OFF</c> never record.
+    /// </remarks>
+    public static void EnableStats(bool enabled) {
+      if (Platform.IsWindows)
+        SetStatsEnabledWin(enabled);
+      else
+        SetStatsEnabledMac(enabled);
+    }
+
+    /// <summary>
+    /// Counters of every export called since the last reset: calls, bytes in and out, and
+    /// latency histograms (in nanoseconds) of the whole call and of each phase of it.
+    /// </summary>
+    public static FB.StatsDataT GetStats() {
+      bool ok = Platform.IsWindows ? GetStatsWin(out IntPtr outBuffer, out int outSize) : GetStatsMac(out outBuffer, out outSize);
+      if (!ok)
+        throw new InvalidOperationException("Failed to read native performance counters");
+
+      var buffer = MarshalHelper.CopyAndFree(outBuffer, outSize);
+      return FB.StatsData.GetRootAsStatsData(new ByteBuffer(buffer)).UnPack();
+    }
+
+    /// <summary>
+    /// Zeroes every performance counter.
+    /// </summary>
+    public static void ResetStats() {
+      if (Platform.IsWindows)
+        ResetStatsWin();
+      else
+        ResetStatsMac();
+    }
+
+    // --------------------------------
+    // Interop memory accounting
+    // --------------------------------
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_set_memory_tracking", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool SetMemoryTrackingWin(int mode);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_set_memory_tracking", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool SetMemoryTrackingMac(int mode);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_memory_stats", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool MemoryStatsWin(out IntPtr outBuffer, out int outSize);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_memory_stats", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool MemoryStatsMac(out IntPtr outBuffer, out int outSize);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_free_buffer", CallingConvention = CallingConvention.Cdecl)]
+    private static extern void FreeBufferWin(IntPtr buffer);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_free_buffer", CallingConvention = CallingConvention.Cdecl)]
+    private static extern void FreeBufferMac(IntPtr buffer);
+
+    /// <summary>
+    /// Sets how result buffers of native exports are accounted: off (default), counters of
+    /// live buffers and bytes with their high-water marks per export, or, in
+    /// <see cref="FB.MemoryTracking.Debug"/>, also every live buffer with the export that
+    /// allocated it. Switching off drops the records.
+    /// </summary>
+    /// <remarks>
+    /// While tracking is on, <see cref="MarshalHelper"/> frees result buffers through
+    /// <see cref="FreeBuffer"/>, so they leave the accounting; buffers freed directly with
+    /// <c>Marshal.FreeCoTaskMem</c> are reported as live. Buffers returned before tracking
+    /// was enabled were never recorded, so freeing them with <see cref="FreeBuffer"/> changes
+    /// no counts.
+    /// </remarks>
+    public static void SetMemoryTracking(FB.MemoryTracking mode) {
+      bool ok = Platform.IsWindows ? SetMemoryTrackingWin((int)mode) : SetMemoryTrackingMac((int)mode);
+      if (!ok)
+        throw new ArgumentOutOfRangeException(nameof(mode), mode, "Unknown memory tracking mode");
+      MarshalHelper.FreeNatively = mode != FB.MemoryTracking.Off;
+    }
+
+    /// <summary>
+    /// Live result buffers and bytes, in total and per export, since tracking was enabled. In
+    /// <see cref="FB.MemoryTracking.Debug"/> mode, buffers still live once a workload is done
+    /// are leaks: <see cref="FB.MemoryStatsT.Live"/> lists them, oldest first.
+    /// </summary>
+    public static FB.MemoryStatsT GetMemoryStats() {
+      bool ok = Platform.IsWindows ? MemoryStatsWin(out IntPtr outBuffer, out int outSize) : MemoryStatsMac(out outBuffer, out outSize);
+      if (!ok)
+        throw new InvalidOperationException("Failed to read native memory statistics");
+
+      var buffer = MarshalHelper.CopyAndFree(outBuffer, outSize);
+      return FB.MemoryStats.GetRootAsMemoryStats(new ByteBuffer(buffer)).UnPack();
+    }
+
+    /// <summary>
+    /// Frees a result buffer returned by a native export; <see cref="IntPtr.Zero"/> is ignored.
+    /// </summary>
+    public static void FreeBuffer(IntPtr buffer) {
+      if (Platform.IsWindows)
+        FreeBufferWin(buffer);
+      else
+        FreeBufferMac(buffer);
+    }
+
+    // --------------------------------
+    // Tracing
+    // --------------------------------
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_trace_enable", CallingConvention = CallingConvention.Cdecl)]
+    private static extern void TraceEnableWin(bool enabled);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_trace_enable", CallingConvention = CallingConvention.Cdecl)]
+    private static extern void TraceEnableMac(bool enabled);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_trace_dump", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool TraceDumpWin([MarshalAs(UnmanagedType.LPUTF8Str)] string path);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_trace_dump", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool TraceDumpMac([MarshalAs(UnmanagedType.LPUTF8Str)] string path);
+
+    /// <summary>
+    /// Starts or stops recording a timeline of native calls and their phases on every native
+    /// thread. Tracing is off by default; spans already recorded are kept while it is stopped.
+    /// </summary>
+    /// <remarks>
+    /// Useful to find stalls in long Grasshopper solutions: enable it, run the solution, then
+    /// <see cref="DumpTrace"/> and open the file in chrome://tracing or ui.perfetto.dev.
+    /// </remarks>
+    public static void EnableTracing(bool enabled) {
+      if (Platform.IsWindows)
+        TraceEnableWin(enabled);
+      else
+        TraceEnableMac(enabled);
+    }
+
+    /// <summary>
+    /// Writes the spans recorded since the last dump to <paramref name="path"/> as Chrome trace
+    /// JSON, and drops them.
+    /// </summary>
+    /// <exception cref="IOException">The file could not be written.</exception>
+    public static void DumpTrace(string path) {
+      ArgumentNullException.ThrowIfNull(path);
+      bool ok = Platform.IsWindows ? TraceDumpWin(path) : TraceDumpMac(path);
+      if (!ok)
+        throw new IOException($"Failed to write native trace to '{path}'");
+    }
+
+    // --------------------------------
+    // Threading
+    // --------------------------------
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_set_thread_count", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool SetThreadCountWin(int count);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_set_thread_count", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool SetThreadCountMac(int count);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_get_thread_count", CallingConvention = CallingConvention.Cdecl)]
+    private static extern int GetThreadCountWin();
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_get_thread_count", CallingConvention = CallingConvention.Cdecl)]
+    private static extern int GetThreadCountMac();
+
+    /// <summary>
+    /// Threads of the native pool shared by parallel kernels and <see cref="NativeJob"/>s.
+    /// Set 0 to restore the default of one per hardware thread, or a small value to leave cores
+    /// to the host (e.g. Grasshopper solving components in parallel).
+    /// </summary>
+    public static int ThreadCount {
+      get => Platform.IsWindows ? GetThreadCountWin() : GetThreadCountMac();
+      set {
+        bool ok = Platform.IsWindows ? SetThreadCountWin(value) : SetThreadCountMac(value);
+        if (!ok)
+          throw new ArgumentOutOfRangeException(nameof(value), value, "Thread count must not be negative");
+      }
+    }
+
+    // --------------------------------
+    // Asynchronous jobs
+    // --------------------------------
+    /// <summary>
+    /// Called on a native worker thread when a job finishes; see <see cref="NativeJob"/>.
+    /// </summary>
+    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+    internal delegate void JobCallback(ulong job, int status, IntPtr userData);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_submit", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool SubmitWin(IntPtr fn, byte[] inBuffer, int inSize, JobCallback? callback, IntPtr userData, out ulong job);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_submit", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool SubmitMac(IntPtr fn, byte[] inBuffer, int inSize, JobCallback? callback, IntPtr userData, out ulong job);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_poll", CallingConvention = CallingConvention.Cdecl)]
+    private static extern int PollWin(ulong job);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_poll", CallingConvention = CallingConvention.Cdecl)]
+    private static extern int PollMac(ulong job);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_wait", CallingConvention = CallingConvention.Cdecl)]
+    private static extern int WaitWin(ulong job, int timeoutMs);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_wait", CallingConvention = CallingConvention.Cdecl)]
+    private static extern int WaitMac(ulong job, int timeoutMs);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_cancel", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool CancelWin(ulong job);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_cancel", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool CancelMac(ulong job);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_job_result", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool JobResultWin(ulong job, out IntPtr outBuffer, out int outSize);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_job_result", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool JobResultMac(ulong job, out IntPtr outBuffer, out int outSize);
+
+    [DllImport(Platform.WindowsLib, EntryPoint = "gsp_job_release", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool JobReleaseWin(ulong job);
+
+    [DllImport(Platform.MacLib, EntryPoint = "gsp_job_release", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool JobReleaseMac(ulong job);
+
+    internal static bool Submit(IntPtr fn, byte[] input, JobCallback? callback, IntPtr userData, out ulong job) =>
+        Platform.IsWindows ? SubmitWin(fn, input, input.Length, callback, userData, out job) : SubmitMac(fn, input, input.Length, callback, userData, out job);
+
+    internal static JobStatus Poll(ulong job) =>
+        (JobStatus)(Platform.IsWindows ? PollWin(job) : PollMac(job));
+
+    internal static JobStatus Wait(ulong job, int timeoutMs) =>
+        (JobStatus)(Platform.IsWindows ? WaitWin(job, timeoutMs) : WaitMac(job, timeoutMs));
+
+    internal static bool Cancel(ulong job) =>
+        Platform.IsWindows ? CancelWin(job) : CancelMac(job);
+
+    internal static bool JobResult(ulong job, out IntPtr outBuffer, out int outSize) =>
+        Platform.IsWindows ? JobResultWin(job, out outBuffer, out outSize) : JobResultMac(job, out outBuffer, out outSize);
+
+    internal static bool JobRelease(ulong job) =>
+        Platform.IsWindows ? JobReleaseWin(job) : JobReleaseMac(job);
+  }
+}
@@ -1,4 +1,5 @@
 using System;
+using System.Buffers;
 using System.Runtime.InteropServices;
 
 namespace GSP.Core {
@@ -7,6 +8,17 @@ namespace GSP.Core {
   /// Works on Windows, macOS, and Linux.
   /// </summary>
   public static class MarshalHelper {
+    /// <summary>
+    /// A native export using the caller-provided buffer convention (the <c>*_into</c> exports).
+    /// It writes its result into <paramref name="outBuffer"/> and sets <paramref name="outSize"/>
+    /// to the result size. If the buffer is too small it returns false and sets
+    /// <paramref name="outSize"/> to the required size.
+    /// </summary>
+    public delegate bool WriteIntoBuffer(byte[] outBuffer, int outCapacity, out int outSize);
+
+    // Set by CoreBridge.SetMemoryTracking, so freed buffers leave the native accounting
+    internal static volatile bool FreeNatively;
+
     /// <summary>
     /// Copies data from unmanaged memory to a managed byte array and frees the unmanaged memory.
     /// This method handles the common pattern of receiving data from C++ code.
@@ -19,7 +31,8 @@ namespace GSP.Core {
     /// - Windows: CoTaskMemAlloc
     /// - macOS/Linux: malloc (with appropriate .NET runtime mapping)
     /// 
-    /// This method uses Marshal.FreeCoTaskMem which works cross-platform in .NET Core/.NET 5+.
+    /// This method uses Marshal.FreeCoTaskMem which works cross-platform in .NET Core/.NET 5+,
+    /// or <see cref="CoreBridge.FreeBuffer"/> while native memory tracking is on.
     /// </remarks>
     public static byte[] CopyAndFree(IntPtr ptr, int size) {
       if (ptr == IntPtr.Zero || size <= 0)
@@ -31,7 +44,7 @@ namespace GSP.Core {
         return buffer;
       }
       finally {
-        Marshal.FreeCoTaskMem(ptr);
+        Free(ptr);
       }
     }
 
@@ -56,8 +69,58 @@ namespace GSP.Core {
     /// </summary>
     /// <param name="ptr">Pointer to unmanaged memory to free.</param>
     public static void Free(IntPtr ptr) {
-      if (ptr != IntPtr.Zero)
+      if (ptr == IntPtr.Zero)
+        return;
+      if (FreeNatively)
+        CoreBridge.FreeBuffer(ptr);
+      else
         Marshal.FreeCoTaskMem(ptr);
     }
+  
+    /// <summary>
+    /// Calls a native export that writes into a caller-provided buffer, reusing
+    /// <paramref name="buffer"/> across calls instead of allocating a result per call.
+    /// </summary>
+    /// <param name="write">The native call, e.g. a lambda around a <c>*_into</c> export.</param>
+    /// <param name="sizeHint">Expected result size (e.g. from a <c>*_size</c> export), or 0.</param>
+    /// <param name="buffer">
+    /// A buffer rented from <see cref="ArrayPool{T}.Shared"/>, or an empty array. When it is too
+    /// small it is returned to the pool and replaced by a larger rented one.
+    /// </param>
+    /// <param name="size">Number of valid bytes at the start of <paramref name="buffer"/>.</param>
+    /// <returns>True if the native call succeeded.</returns>
+    /// <remarks>
+    /// The result may be shorter than <paramref name="buffer"/>; FlatBuffers readers only need the
+    /// buffer to start at the root, so it can be read in place.
+    /// The caller owns <paramref name="buffer"/> and returns it with <see cref="ReturnPooled"/>.
+    /// </remarks>
+    public static bool WriteInto(WriteIntoBuffer write, int sizeHint, ref byte[] buffer, out int size) {
+      if (buffer.Length < sizeHint)
+        Regrow(ref buffer, sizeHint);
+
+      if (write(buffer, buffer.Length, out size))
+        return true;
+
+      // Failed for a reason other than the buffer size
+      if (size <= buffer.Length)
+        return false;
+
+      Regrow(ref buffer, size);
+      return write(buffer, buffer.Length, out size);
+    }
+
+    /// <summary>
+    /// Returns a buffer used with <see cref="WriteInto"/> to the shared pool.
+    /// </summary>
+    /// <param name="buffer">The buffer to return; empty arrays are ignored.</param>
+    public static void ReturnPooled(byte[] buffer) {
+      if (buffer.Length > 0)
+        ArrayPool<byte>.Shared.Return(buffer);
+    }
+
+    private static void Regrow(ref byte[] buffer, int size) {
+      ReturnPooled(buffer);
+      buffer = ArrayPool<byte>.Shared.Rent(size);
+    }
   }
 }
@@ -0,0 +1,141 @@
+using System;
+using System.Runtime.InteropServices;
+using System.Threading;
+
+namespace GSP.Core {
+  /// <summary>
+  /// Status of a <see cref="NativeJob"/>.
+  /// </summary>
+  public enum JobStatus {
+    /// <summary>The job is unknown to the native side, e.g. already released.</summary>
+    Unknown = -1,
+    Pending = 0,
+    Running = 1,
+    Succeeded = 2,
+    Failed = 3,
+    Cancelled = 4,
+  }
+
+  /// <summary>
+  /// A native function call running on the native thread pool.
+  /// </summary>
+  /// <remarks>
+  /// Works with any export that has the <c>(inBuffer, inSize, outBuffer, outSize)</c> signature,
+  /// e.g. <c>example_mesh_roundtrip</c>. The input is copied on submit, so the caller can build
+  /// the next input while the job runs instead of blocking the UI thread. Dispose releases the
+  /// job, cancelling it if it has not finished.
+  /// </remarks>
+  public sealed class NativeJob : IDisposable {
+    // Static, so the delegate handed to native code is never collected
+    private static readonly CoreBridge.JobCallback s_completed = OnCompleted;
+
+    private static readonly Lazy<IntPtr> s_library = new(() =>
+        NativeLibrary.Load(Platform.IsWindows ? Platform.WindowsLib : Platform.MacLib, typeof(NativeJob).Assembly, null));
+
+    private readonly object _gate = new();
+    private readonly Action<NativeJob>? _onCompleted;
+    private ulong _handle;
+
+    private NativeJob(Action<NativeJob>? onCompleted) {
+      _onCompleted = onCompleted;
+    }
+
+    /// <summary>
+    /// Runs the native export <paramref name="function"/> of GeoSharPlusCPP on
+    /// <paramref name="input"/>.
+    /// </summary>
+    /// <param name="onCompleted">
+    /// Called on a native worker thread once the job succeeds, fails or is cancelled. Exceptions
+    /// it throws are swallowed, as they cannot propagate to a native thread.
+    /// </param>
+    public static NativeJob Submit(string function, byte[] input, Action<NativeJob>? onCompleted = null) =>
+        Submit(NativeLibrary.GetExport(s_library.Value, function), input, onCompleted);
+
+    /// <summary>
+    /// Runs a native function pointer with the <c>(inBuffer, inSize, outBuffer, outSize)</c>
+    /// signature on <paramref name="input"/>.
+    /// </summary>
+    public static NativeJob Submit(IntPtr function, byte[] input, Action<NativeJob>? onCompleted = null) {
+      if (function == IntPtr.Zero)
+        throw new ArgumentNullException(nameof(function));
+
+      var job = new NativeJob(onCompleted);
+      // Keeps the job alive until its callback has run
+      IntPtr userData = onCompleted != null ? GCHandle.ToIntPtr(GCHandle.Alloc(job)) : IntPtr.Zero;
+      lock (job._gate) {
+        if (!CoreBridge.Submit(function, input, onCompleted != null ? s_completed : null, userData, out job._handle)) {
+          if (userData != IntPtr.Zero)
+            GCHandle.FromIntPtr(userData).Free();
+          throw new InvalidOperationException("Failed to submit native job");
+        }
+      }
+      return job;
+    }
+
+    /// <summary>
+    /// The native job id, valid until this object is disposed.
+    /// </summary>
+    public ulong Handle {
+      get {
+        ObjectDisposedException.ThrowIf(_handle == 0, this);
+        return _handle;
+      }
+    }
+
+    public JobStatus Status => CoreBridge.Poll(Handle);
+
+    /// <summary>
+    /// Blocks until the job finishes or the timeout passes, and returns its status then.
+    /// </summary>
+    public JobStatus Wait(int millisecondsTimeout = Timeout.Infinite) => CoreBridge.Wait(Handle, millisecondsTimeout);
+
+    /// <summary>
+    /// Requests cancellation; false if the job already finished.
+    /// </summary>
+    public bool Cancel() => CoreBridge.Cancel(Handle);
+
+    /// <summary>
+    /// Waits for the job and returns its result buffer. The result can be taken once.
+    /// </summary>
+    /// <exception cref="OperationCanceledException">The job was cancelled.</exception>
+    /// <exception cref="InvalidOperationException">The job failed, or its result was already taken.</exception>
+    public byte[] GetResult() {
+      var status = Wait();
+      if (status == JobStatus.Cancelled)
+        throw new OperationCanceledException("Native job was cancelled");
+      if (status != JobStatus.Succeeded || !CoreBridge.JobResult(Handle, out IntPtr outBuffer, out int outSize))
+        throw new InvalidOperationException("Native job failed or its result was already taken");
+      return MarshalHelper.CopyAndFree(outBuffer, outSize);
+    }
+
+    public void Dispose() {
+      if (_handle != 0) {
+        CoreBridge.JobRelease(_handle);
+        _handle = 0;
+      }
+      GC.SuppressFinalize(this);
+    }
+
+    ~NativeJob() {
+      if (_handle != 0)
+        CoreBridge.JobRelease(_handle);
+    }
+
+    private static void OnCompleted(ulong job, int status, IntPtr userData) {
+      var gcHandle = GCHandle.FromIntPtr(userData);
+      var nativeJob = (NativeJob)gcHandle.Target!;
+      gcHandle.Free();
+
+      // Submit stores the handle under this lock, so it is set before the callback proceeds
+      lock (nativeJob._gate) {
+        if (nativeJob._handle == 0)
+          return;
+      }
+      try {
+        nativeJob._onCompleted!(nativeJob);
+      } catch (Exception) {
+        // Must not escape to the native worker thread
+      }
+    }
+  }
+}
@@ -0,0 +1,82 @@
+using System;
+using System.IO;
+
+namespace GSP.Core {
+  /// <summary>
+  /// A mesh kept resident in native memory, addressed by a handle.
+  /// </summary>
+  /// <remarks>
+  /// Upload a mesh that is reused across calls (e.g. a Grasshopper input that stays the same
+  /// while a slider is dragged) once, then pass <see cref="Handle"/> to native operations
+  /// instead of re-serializing it every time. Operations that return a mesh as a handle are
+  /// wrapped with <see cref="FromHandle"/>. Dispose releases the native mesh.
+  /// </remarks>
+  public sealed class NativeMesh : IDisposable {
+    private ulong _handle;
+
+    private NativeMesh(ulong handle) {
+      _handle = handle;
+    }
+
+    /// <summary>
+    /// Uploads a mesh.
+    /// </summary>
+    public static NativeMesh Upload(Geometry.Mesh mesh) => Upload(Serializer.Serialize(mesh));
+
+    /// <summary>
+    /// Uploads a serialized MeshData buffer, e.g. from <c>Wrapper.ToMeshBuffer</c>.
+    /// </summary>
+    /// <exception cref="InvalidDataException">The buffer is not a valid mesh.</exception>
+    public static NativeMesh Upload(byte[] meshBuffer) {
+      if (!CoreBridge.MeshUpload(meshBuffer, out ulong handle))
+        throw new InvalidDataException("Failed to upload mesh");
+      return new NativeMesh(handle);
+    }
+
+    /// <summary>
+    /// Takes ownership of a handle returned by a native operation.
+    /// </summary>
+    public static NativeMesh FromHandle(ulong handle) {
+      if (handle == 0)
+        throw new ArgumentException("Invalid mesh handle", nameof(handle));
+      return new NativeMesh(handle);
+    }
+
+    /// <summary>
+    /// The native handle, valid until this object is disposed.
+    /// </summary>
+    public ulong Handle {
+      get {
+        ObjectDisposedException.ThrowIf(_handle == 0, this);
+        return _handle;
+      }
+    }
+
+    /// <summary>
+    /// Serializes the resident mesh into a MeshData buffer.
+    /// </summary>
+    public byte[] Download() {
+      if (!CoreBridge.MeshDownload(Handle, out IntPtr outBuffer, out int outSize))
+        throw new InvalidOperationException("Failed to download resident mesh");
+      return MarshalHelper.CopyAndFree(outBuffer, outSize);
+    }
+
+    /// <summary>
+    /// Copies the resident mesh back to managed memory.
+    /// </summary>
+    public Geometry.Mesh ToMesh() => Serializer.DeserializeMesh(Download());
+
+    public void Dispose() {
+      if (_handle != 0) {
+        CoreBridge.Release(_handle);
+        _handle = 0;
+      }
+      GC.SuppressFinalize(this);
+    }
+
+    ~NativeMesh() {
+      if (_handle != 0)
+        CoreBridge.Release(_handle);
+    }
+  }
+}
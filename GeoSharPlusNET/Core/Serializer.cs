@@ -1,4 +1,5 @@
 using System;
+using System.Buffers.Binary;
 using System.Collections.Generic;
 using System.Linq;
 using Google.FlatBuffers;
@@ -53,17 +54,20 @@ namespace GSP.Core {
     /// </summary>
     public static byte[] Serialize(Geometry.Vec3[] points) {
       var builder = new FlatBufferBuilder(1024);
+      var arrayOffset = BuildPointArray(builder, points);
+      builder.Finish(arrayOffset.Value);
 
+      return builder.SizedByteArray();
+    }
+
+    private static Offset<FB.PointArrayData> BuildPointArray(FlatBufferBuilder builder, Geometry.Vec3[] points) {
       FB.PointArrayData.StartPointsVector(builder, points.Length);
       for (int i = points.Length - 1; i >= 0; i--) {
         FB.Vec3.CreateVec3(builder, points[i].X, points[i].Y, points[i].Z);
       }
       var ptOffset = builder.EndVector();
 
-      var arrayOffset = FB.PointArrayData.CreatePointArrayData(builder, ptOffset);
-      builder.Finish(arrayOffset.Value);
-
-      return builder.SizedByteArray();
+      return FB.PointArrayData.CreatePointArrayData(builder, ptOffset);
     }
 
     /// <summary>
@@ -76,17 +80,17 @@ namespace GSP.Core {
     /// </summary>
     public static Geometry.Vec3[] DeserializeVec3Array(byte[] buffer) {
       var byteBuffer = new ByteBuffer(buffer);
-      var pointArray = FB.PointArrayData.GetRootAsPointArrayData(byteBuffer);
+      return ReadVec3Array(FB.PointArrayData.GetRootAsPointArrayData(byteBuffer));
+    }
 
-      if (pointArray.PointsLength == 0)
+    private static Geometry.Vec3[] ReadVec3Array(FB.PointArrayData pointArray) {
+      var coords = DecodePositions(pointArray);
+      if (coords.Length == 0)
         return Array.Empty<Geometry.Vec3>();
 
-      var result = new Geometry.Vec3[pointArray.PointsLength];
-      for (int i = 0; i < pointArray.PointsLength; i++) {
-        var pt = pointArray.Points(i);
-        result[i] = pt.HasValue
-            ? new Geometry.Vec3(pt.Value.X, pt.Value.Y, pt.Value.Z)
-            : Geometry.Vec3.Zero;
+      var result = new Geometry.Vec3[coords.Length / 3];
+      for (int i = 0; i < result.Length; i++) {
+        result[i] = new Geometry.Vec3(coords[3 * i], coords[3 * i + 1], coords[3 * i + 2]);
       }
       return result;
     }
@@ -105,10 +109,17 @@ namespace GSP.Core {
     /// Serializes a Mesh to a FlatBuffer byte array.
     /// </summary>
     /// <param name="mesh">The mesh to serialize.</param>
-    /// <param name="triangulate">If true, converts quads to triangles before serializing.</param>
+    /// <param name="triangulate">If true, converts quads to triangles before serializing.
+    /// Otherwise mixed triangle/quad meshes are sent as polygon (CSR) faces.</param>
     public static byte[] Serialize(Geometry.Mesh mesh, bool triangulate = false) {
       var builder = new FlatBufferBuilder(1024);
+      var meshOffset = BuildMesh(builder, mesh, triangulate);
+      builder.Finish(meshOffset.Value);
+
+      return builder.SizedByteArray();
+    }
 
+    private static Offset<FB.MeshData> BuildMesh(FlatBufferBuilder builder, Geometry.Mesh mesh, bool triangulate) {
       // Optionally triangulate
       var workingMesh = mesh;
       if (triangulate && mesh.HasQuads) {
@@ -126,8 +137,34 @@ namespace GSP.Core {
 
       VectorOffset facesOffset = default;
       VectorOffset quadFacesOffset = default;
-
-      if (workingMesh.HasQuads && !workingMesh.HasTriangles) {
+      VectorOffset faceOffsetsOffset = default;
+      VectorOffset faceIndicesOffset = default;
+      bool mixed = workingMesh.HasQuads && workingMesh.HasTriangles;
+
+      if (mixed) {
+        // Mixed mesh as polygon (CSR) faces: triangles, then quads
+        var offsets = new int[workingMesh.FaceCount + 1];
+        var indices = new int[3 * workingMesh.TriangleFaces.Length + 4 * workingMesh.QuadFaces.Length];
+        int face = 0;
+        int next = 0;
+        foreach (var f in workingMesh.TriangleFaces) {
+          indices[next] = f.A;
+          indices[next + 1] = f.B;
+          indices[next + 2] = f.C;
+          next += 3;
+          offsets[++face] = next;
+        }
+        foreach (var f in workingMesh.QuadFaces) {
+          indices[next] = f.A;
+          indices[next + 1] = f.B;
+          indices[next + 2] = f.C;
+          indices[next + 3] = f.D;
+          next += 4;
+          offsets[++face] = next;
+        }
+        faceOffsetsOffset = FB.MeshData.CreateFaceOffsetsVectorBlock(builder, offsets);
+        faceIndicesOffset = FB.MeshData.CreateFaceIndicesVectorBlock(builder, indices);
+      } else if (workingMesh.HasQuads) {
         // Pure quad mesh
         FB.MeshData.StartQuadFacesVector(builder, workingMesh.QuadFaces.Length);
         for (int i = workingMesh.QuadFaces.Length - 1; i >= 0; i--) {
@@ -136,7 +173,7 @@ namespace GSP.Core {
         }
         quadFacesOffset = builder.EndVector();
       } else {
-        // Triangle mesh (or mixed, triangulated)
+        // Triangle mesh
         FB.MeshData.StartFacesVector(builder, workingMesh.TriangleFaces.Length);
         for (int i = workingMesh.TriangleFaces.Length - 1; i >= 0; i--) {
           var f = workingMesh.TriangleFaces[i];
@@ -145,18 +182,93 @@ namespace GSP.Core {
         facesOffset = builder.EndVector();
       }
 
+      var attributesOffset = BuildAttributes(builder, workingMesh);
+
       // Create the mesh data
       FB.MeshData.StartMeshData(builder);
       FB.MeshData.AddVertices(builder, verticesOffset);
-      if (workingMesh.HasQuads && !workingMesh.HasTriangles) {
+      if (mixed) {
+        FB.MeshData.AddFaceOffsets(builder, faceOffsetsOffset);
+        FB.MeshData.AddFaceIndices(builder, faceIndicesOffset);
+      } else if (workingMesh.HasQuads) {
         FB.MeshData.AddQuadFaces(builder, quadFacesOffset);
       } else {
         FB.MeshData.AddFaces(builder, facesOffset);
       }
-      var meshOffset = FB.MeshData.EndMeshData(builder);
-      builder.Finish(meshOffset.Value);
+      if (workingMesh.Attributes.Count > 0)
+        FB.MeshData.AddAttributes(builder, attributesOffset);
+      return FB.MeshData.EndMeshData(builder);
+    }
 
-      return builder.SizedByteArray();
+    // Attribute channels, values written as one block each. Per-face channels follow the
+    // TriangleFaces-then-QuadFaces order, which is also the order of the CSR faces above.
+    private static VectorOffset BuildAttributes(FlatBufferBuilder builder, Geometry.Mesh mesh) {
+      if (mesh.Attributes.Count == 0)
+        return default;
+
+      var items = new Offset<FB.MeshAttribute>[mesh.Attributes.Count];
+      for (int i = 0; i < items.Length; i++) {
+        var attribute = mesh.Attributes[i];
+        int expected = attribute.Domain == Geometry.AttributeDomain.Vertex ? mesh.VertexCount : mesh.FaceCount;
+        if (attribute.Count != expected)
+          throw new ArgumentException(
+              $"Attribute '{attribute.Name}' has {attribute.Count} elements, expected {expected}.", nameof(mesh));
+
+        var nameOffset = builder.CreateString(attribute.Name);
+        var valuesOffset = attribute.Values switch {
+          float[] v => FB.MeshAttribute.CreateF32VectorBlock(builder, v),
+          double[] v => FB.MeshAttribute.CreateF64VectorBlock(builder, v),
+          int[] v => FB.MeshAttribute.CreateI32VectorBlock(builder, v),
+          byte[] v => FB.MeshAttribute.CreateU8VectorBlock(builder, v),
+          _ => throw new ArgumentException($"Unsupported value type of attribute '{attribute.Name}'.", nameof(mesh))
+        };
+
+        FB.MeshAttribute.StartMeshAttribute(builder);
+        FB.MeshAttribute.AddName(builder, nameOffset);
+        FB.MeshAttribute.AddDomain(builder, (FB.AttributeDomain)attribute.Domain);
+        FB.MeshAttribute.AddDimension(builder, (byte)attribute.Dimension);
+        switch (attribute.Values) {
+          case float[]: FB.MeshAttribute.AddF32(builder, valuesOffset); break;
+          case double[]: FB.MeshAttribute.AddF64(builder, valuesOffset); break;
+          case int[]: FB.MeshAttribute.AddI32(builder, valuesOffset); break;
+          default: FB.MeshAttribute.AddU8(builder, valuesOffset); break;
+        }
+        items[i] = FB.MeshAttribute.EndMeshAttribute(builder);
+      }
+      return FB.MeshData.CreateAttributesVectorBlock(builder, items);
+    }
+
+    // Reads the attribute channels of a mesh table. `faceSource` maps each face of the result
+    // to its face in the buffer when faces were regrouped (polygon faces), else null.
+    private static List<Geometry.MeshAttribute> ReadAttributes(FB.MeshData meshData, int[]? faceSource) {
+      var attributes = new List<Geometry.MeshAttribute>(meshData.AttributesLength);
+      for (int i = 0; i < meshData.AttributesLength; i++) {
+        var item = meshData.Attributes(i);
+        if (!item.HasValue)
+          continue;
+
+        var a = item.Value;
+        if (a.Dimension < 1 || a.Dimension > 4)
+          throw new InvalidDataException($"Invalid attribute dimension {a.Dimension}.");
+        var domain = (Geometry.AttributeDomain)a.Domain;
+        string name = a.Name ?? string.Empty;
+        Geometry.MeshAttribute attribute;
+        if (a.F32Length > 0)
+          attribute = new Geometry.MeshAttribute(name, domain, a.Dimension, a.GetF32Array());
+        else if (a.F64Length > 0)
+          attribute = new Geometry.MeshAttribute(name, domain, a.Dimension, a.GetF64Array());
+        else if (a.I32Length > 0)
+          attribute = new Geometry.MeshAttribute(name, domain, a.Dimension, a.GetI32Array());
+        else if (a.U8Length > 0)
+          attribute = new Geometry.MeshAttribute(name, domain, a.Dimension, a.GetU8Array());
+        else
+          attribute = new Geometry.MeshAttribute(name, domain, a.Dimension, Array.Empty<double>());
+
+        if (faceSource != null && domain == Geometry.AttributeDomain.Face)
+          attribute = attribute.Gather(faceSource);
+        attributes.Add(attribute);
+      }
+      return attributes;
     }
 
     /// <summary>
@@ -164,20 +276,68 @@ namespace GSP.Core {
     /// </summary>
     public static Geometry.Mesh DeserializeMesh(byte[] buffer) {
       var byteBuffer = new ByteBuffer(buffer);
-      var meshData = FB.MeshData.GetRootAsMeshData(byteBuffer);
+      return ReadMesh(FB.MeshData.GetRootAsMeshData(byteBuffer));
+    }
 
+    private static Geometry.Mesh ReadMesh(FB.MeshData meshData) {
       var mesh = new Geometry.Mesh();
 
-      // Extract vertices
-      var vertices = new Geometry.Vec3[meshData.VerticesLength];
-      for (int i = 0; i < meshData.VerticesLength; i++) {
-        var v = meshData.Vertices(i);
-        vertices[i] = v.HasValue
-            ? new Geometry.Vec3(v.Value.X, v.Value.Y, v.Value.Z)
-            : Geometry.Vec3.Zero;
+      // Extract vertices (double, float32 or quantized)
+      var coords = DecodePositions(meshData);
+      var vertices = new Geometry.Vec3[coords.Length / 3];
+      for (int i = 0; i < vertices.Length; i++) {
+        vertices[i] = new Geometry.Vec3(coords[3 * i], coords[3 * i + 1], coords[3 * i + 2]);
       }
       mesh.Vertices = vertices;
 
+      // Polygon faces: triangles and quads are kept, larger polygons are fanned into triangles
+      if (meshData.FaceOffsetsLength > 0) {
+        var (offsets, indices) = DecodePolygonFaces(meshData);
+        var tris = new List<(int, int, int)>();
+        var quads = new List<(int, int, int, int)>();
+        // Source polygon of every triangle and quad, for per-face attributes
+        var triSource = new List<int>();
+        var quadSource = new List<int>();
+        for (int f = 0; f + 1 < offsets.Length; f++) {
+          int start = offsets[f];
+          int count = offsets[f + 1] - start;
+          if (count == 4) {
+            quads.Add((indices[start], indices[start + 1], indices[start + 2], indices[start + 3]));
+            quadSource.Add(f);
+          } else {
+            for (int k = 2; k < count; k++) {
+              tris.Add((indices[start], indices[start + k - 1], indices[start + k]));
+              triSource.Add(f);
+            }
+          }
+        }
+        mesh.TriangleFaces = tris.ToArray();
+        mesh.QuadFaces = quads.ToArray();
+        mesh.Attributes = ReadAttributes(meshData, triSource.Concat(quadSource).ToArray());
+        return mesh;
+      }
+
+      // Compact index stream (16/32-bit or delta varint) replaces the face vectors
+      if (meshData.FacesC.HasValue) {
+        var compressed = meshData.FacesC.Value;
+        var indices = DecodeCompressedFaces(compressed);
+        if (compressed.FaceVertexCount == 4) {
+          var quads = new (int, int, int, int)[indices.Length / 4];
+          for (int i = 0; i < quads.Length; i++) {
+            quads[i] = (indices[4 * i], indices[4 * i + 1], indices[4 * i + 2], indices[4 * i + 3]);
+          }
+          mesh.QuadFaces = quads;
+        } else {
+          var tris = new (int, int, int)[indices.Length / 3];
+          for (int i = 0; i < tris.Length; i++) {
+            tris[i] = (indices[3 * i], indices[3 * i + 1], indices[3 * i + 2]);
+          }
+          mesh.TriangleFaces = tris;
+        }
+        mesh.Attributes = ReadAttributes(meshData, null);
+        return mesh;
+      }
+
       // Check for quad faces first
       if (meshData.QuadFacesLength > 0) {
         var quads = new (int, int, int, int)[meshData.QuadFacesLength];
@@ -196,11 +356,246 @@ namespace GSP.Core {
         mesh.TriangleFaces = tris;
       }
 
+      mesh.Attributes = ReadAttributes(meshData, null);
       return mesh;
     }
 
     #endregion
 
+    #region Batch Serialization
+
+    /// <summary>
+    /// Serializes several meshes into one MeshBatch buffer, so they cross to native code in a
+    /// single call. Each mesh is encoded exactly as by <see cref="Serialize(Geometry.Mesh, bool)"/>.
+    /// </summary>
+    public static byte[] Serialize(Geometry.Mesh[] meshes, bool triangulate = false) {
+      var builder = new FlatBufferBuilder(1024);
+
+      var items = new Offset<FB.MeshData>[meshes.Length];
+      for (int i = 0; i < meshes.Length; i++) {
+        items[i] = BuildMesh(builder, meshes[i], triangulate);
+      }
+      var meshesOffset = FB.MeshBatch.CreateMeshesVector(builder, items);
+      var batchOffset = FB.MeshBatch.CreateMeshBatch(builder, meshesOffset);
+      builder.Finish(batchOffset.Value);
+
+      return builder.SizedByteArray();
+    }
+
+    /// <summary>
+    /// Deserializes a MeshBatch buffer to an array of meshes.
+    /// </summary>
+    public static Geometry.Mesh[] DeserializeMeshBatch(byte[] buffer) {
+      var batch = FB.MeshBatch.GetRootAsMeshBatch(new ByteBuffer(buffer));
+
+      var meshes = new Geometry.Mesh[batch.MeshesLength];
+      for (int i = 0; i < meshes.Length; i++) {
+        var item = batch.Meshes(i);
+        meshes[i] = item.HasValue ? ReadMesh(item.Value) : new Geometry.Mesh();
+      }
+      return meshes;
+    }
+
+    /// <summary>
+    /// Serializes several point arrays into one PointArrayBatch buffer.
+    /// </summary>
+    public static byte[] Serialize(Geometry.Vec3[][] pointArrays) {
+      var builder = new FlatBufferBuilder(1024);
+
+      var items = new Offset<FB.PointArrayData>[pointArrays.Length];
+      for (int i = 0; i < pointArrays.Length; i++) {
+        items[i] = BuildPointArray(builder, pointArrays[i]);
+      }
+      var arraysOffset = FB.PointArrayBatch.CreatePointArraysVector(builder, items);
+      var batchOffset = FB.PointArrayBatch.CreatePointArrayBatch(builder, arraysOffset);
+      builder.Finish(batchOffset.Value);
+
+      return builder.SizedByteArray();
+    }
+
+    /// <summary>
+    /// Deserializes a PointArrayBatch buffer to an array of point arrays.
+    /// </summary>
+    public static Geometry.Vec3[][] DeserializeVec3ArrayBatch(byte[] buffer) {
+      var batch = FB.PointArrayBatch.GetRootAsPointArrayBatch(new ByteBuffer(buffer));
+
+      var pointArrays = new Geometry.Vec3[batch.PointArraysLength][];
+      for (int i = 0; i < pointArrays.Length; i++) {
+        var item = batch.PointArrays(i);
+        pointArrays[i] = item.HasValue ? ReadVec3Array(item.Value) : Array.Empty<Geometry.Vec3>();
+      }
+      return pointArrays;
+    }
+
+    #endregion
+
+    #region Compact Encodings
+
+    /// <summary>
+    /// Decodes the points of a point array buffer to interleaved x, y, z doubles.
+    /// Points may be sent as doubles (default), float32 or quantized against their bounding box.
+    /// </summary>
+    internal static double[] DecodePositions(FB.PointArrayData pointArray) {
+      if (pointArray.PointsLength > 0) {
+        var result = new double[3 * pointArray.PointsLength];
+        for (int i = 0; i < pointArray.PointsLength; i++) {
+          var pt = pointArray.Points(i);
+          if (pt.HasValue) {
+            (result[3 * i], result[3 * i + 1], result[3 * i + 2]) =
+                (pt.Value.X, pt.Value.Y, pt.Value.Z);
+          }
+        }
+        return result;
+      }
+      if (pointArray.PointsFLength > 0) {
+        var result = new double[3 * pointArray.PointsFLength];
+        for (int i = 0; i < pointArray.PointsFLength; i++) {
+          var pt = pointArray.PointsF(i);
+          if (pt.HasValue) {
+            (result[3 * i], result[3 * i + 1], result[3 * i + 2]) =
+                (pt.Value.X, pt.Value.Y, pt.Value.Z);
+          }
+        }
+        return result;
+      }
+      return pointArray.PointsQ.HasValue ? Dequantize(pointArray.PointsQ.Value)
+                                         : Array.Empty<double>();
+    }
+
+    /// <summary>
+    /// Decodes the vertices of a mesh buffer to interleaved x, y, z doubles.
+    /// Vertices may be sent as doubles (default), float32 or quantized against their bounding box.
+    /// </summary>
+    internal static double[] DecodePositions(FB.MeshData meshData) {
+      if (meshData.VerticesLength > 0) {
+        var result = new double[3 * meshData.VerticesLength];
+        for (int i = 0; i < meshData.VerticesLength; i++) {
+          var v = meshData.Vertices(i);
+          if (v.HasValue) {
+            (result[3 * i], result[3 * i + 1], result[3 * i + 2]) =
+                (v.Value.X, v.Value.Y, v.Value.Z);
+          }
+        }
+        return result;
+      }
+      if (meshData.VerticesFLength > 0) {
+        var result = new double[3 * meshData.VerticesFLength];
+        for (int i = 0; i < meshData.VerticesFLength; i++) {
+          var v = meshData.VerticesF(i);
+          if (v.HasValue) {
+            (result[3 * i], result[3 * i + 1], result[3 * i + 2]) =
+                (v.Value.X, v.Value.Y, v.Value.Z);
+          }
+        }
+        return result;
+      }
+      return meshData.VerticesQ.HasValue ? Dequantize(meshData.VerticesQ.Value)
+                                         : Array.Empty<double>();
+    }
+
+    /// <summary>
+    /// Decodes quantized positions: each value is min + q * (max - min) / (2^bits - 1).
+    /// </summary>
+    private static double[] Dequantize(FB.QuantizedPositions quantized) {
+      int bits = quantized.Bits;
+      if (bits < 1 || bits > 16 || !quantized.Min.HasValue || !quantized.Max.HasValue)
+        throw new InvalidDataException($"Invalid quantized positions (bits = {bits}).");
+
+      var min = quantized.Min.Value;
+      var max = quantized.Max.Value;
+      double levels = (1 << bits) - 1;
+      var scale = new[] { (max.X - min.X) / levels, (max.Y - min.Y) / levels,
+                          (max.Z - min.Z) / levels };
+      var offset = new[] { min.X, min.Y, min.Z };
+
+      var result = new double[quantized.ValuesLength - quantized.ValuesLength % 3];
+      for (int i = 0; i < result.Length; i++) {
+        result[i] = quantized.Values(i) * scale[i % 3] + offset[i % 3];
+      }
+      return result;
+    }
+
+    /// <summary>
+    /// Decodes a compact face index stream to flat indices, face after face.
+    /// </summary>
+    /// <exception cref="InvalidDataException">The stream does not match its face count.</exception>
+    internal static int[] DecodeCompressedFaces(FB.CompressedFaces compressed) {
+      int faceVertexCount = compressed.FaceVertexCount;
+      long indexCount = (long)compressed.FaceCount * faceVertexCount;
+      var bytes = (compressed.GetDataBytes() ?? default).AsSpan();
+
+      bool valid = (faceVertexCount == 3 || faceVertexCount == 4) && compressed.Encoding switch {
+        FB.IndexEncoding.U16 => bytes.Length == 2 * indexCount,
+        FB.IndexEncoding.U32 => bytes.Length == 4 * indexCount,
+        FB.IndexEncoding.DeltaVarint => bytes.Length >= indexCount,
+        _ => false
+      };
+      if (!valid)
+        throw new InvalidDataException("Invalid compressed face data.");
+
+      var result = new int[indexCount];
+      switch (compressed.Encoding) {
+        case FB.IndexEncoding.U16:
+          for (int i = 0; i < result.Length; i++)
+            result[i] = BinaryPrimitives.ReadUInt16LittleEndian(bytes.Slice(2 * i));
+          break;
+        case FB.IndexEncoding.U32:
+          for (int i = 0; i < result.Length; i++)
+            result[i] = BinaryPrimitives.ReadInt32LittleEndian(bytes.Slice(4 * i));
+          break;
+        default:
+          DecodeDeltaVarint(bytes, result);
+          break;
+      }
+      return result;
+    }
+
+    /// <summary>
+    /// Decodes zigzag LEB128 deltas (each index minus the previous one, starting from 0).
+    /// </summary>
+    private static void DecodeDeltaVarint(ReadOnlySpan<byte> bytes, int[] result) {
+      int pos = 0;
+      long previous = 0;
+      for (int i = 0; i < result.Length; i++) {
+        uint value = 0;
+        for (int shift = 0;; shift += 7) {
+          if (pos >= bytes.Length || shift > 28)
+            throw new InvalidDataException("Truncated or overlong varint in face data.");
+          byte b = bytes[pos++];
+          value |= (uint)(b & 0x7F) << shift;
+          if ((b & 0x80) == 0)
+            break;
+        }
+
+        previous += (int)(value >> 1) ^ -(int)(value & 1);
+        if (previous < 0 || previous > int.MaxValue)
+          throw new InvalidDataException("Face index out of range.");
+        result[i] = (int)previous;
+      }
+      if (pos != bytes.Length)
+        throw new InvalidDataException("Trailing bytes in face data.");
+    }
+
+    /// <summary>
+    /// Reads the polygon (CSR) faces of a mesh buffer: face i is
+    /// <c>Indices[Offsets[i] .. Offsets[i + 1])</c>.
+    /// </summary>
+    /// <exception cref="InvalidDataException">The offsets do not describe the index array.</exception>
+    internal static (int[] Offsets, int[] Indices) DecodePolygonFaces(FB.MeshData meshData) {
+      var offsets = meshData.GetFaceOffsetsArray() ?? Array.Empty<int>();
+      var indices = meshData.GetFaceIndicesArray() ?? Array.Empty<int>();
+      if (offsets.Length == 0 || offsets[0] != 0 || offsets[^1] != indices.Length)
+        throw new InvalidDataException("Invalid polygon face offsets.");
+
+      for (int i = 1; i < offsets.Length; i++) {
+        if (offsets[i] - offsets[i - 1] < 3)
+          throw new InvalidDataException("Polygon face with fewer than 3 vertices.");
+      }
+      return (offsets, indices);
+    }
+
+    #endregion
+
     #region Primitive Array Serialization
 
     /// <summary>
@@ -343,16 +738,22 @@ namespace GSP.Core {
     public static byte[] Serialize(List<List<int>> nestedArray) {
       var builder = new FlatBufferBuilder(1024);
 
-      var flatList = new List<int>();
-      var sizes = new List<int>();
-
+      // Flatten into arrays sized up front: one pass for the sizes, one copy per sub-array
+      var sizes = new int[nestedArray.Count];
+      int valueCount = 0;
+      for (int i = 0; i < sizes.Length; i++) {
+        sizes[i] = nestedArray[i].Count;
+        valueCount += sizes[i];
+      }
+      var values = new int[valueCount];
+      int next = 0;
       foreach (var subArray in nestedArray) {
-        sizes.Add(subArray.Count);
-        flatList.AddRange(subArray);
+        subArray.CopyTo(values, next);
+        next += subArray.Count;
       }
 
-      var valuesOffset = FB.IntNestedArrayData.CreateValuesVector(builder, flatList.ToArray());
-      var sizesOffset = FB.IntNestedArrayData.CreateSizesVector(builder, sizes.ToArray());
+      var valuesOffset = FB.IntNestedArrayData.CreateValuesVectorBlock(builder, values);
+      var sizesOffset = FB.IntNestedArrayData.CreateSizesVectorBlock(builder, sizes);
 
       var arrayOffset = FB.IntNestedArrayData.CreateIntNestedArrayData(builder, valuesOffset, sizesOffset);
       builder.Finish(arrayOffset.Value);
@@ -388,5 +789,135 @@ namespace GSP.Core {
     }
 
     #endregion
+
+    #region Mass Properties
+
+    /// <summary>
+    /// Deserializes a MassPropertiesBatch buffer, as returned by <c>gsp_mass_properties</c>.
+    /// </summary>
+    public static Geometry.MassProperties[] DeserializeMassPropertiesBatch(byte[] buffer) {
+      var batch = FB.MassPropertiesBatch.GetRootAsMassPropertiesBatch(new ByteBuffer(buffer));
+
+      var items = new Geometry.MassProperties[batch.ItemsLength];
+      for (int i = 0; i < items.Length; i++) {
+        var item = batch.Items(i);
+        if (!item.HasValue)
+          continue;
+        var data = item.Value;
+        items[i] = new Geometry.MassProperties(data.Area, data.Volume, ToVec3(data.AreaCentroid),
+            ToVec3(data.VolumeCentroid), ToVec3(data.InertiaDiagonal), ToVec3(data.InertiaProducts));
+      }
+      return items;
+    }
+
+    private static Geometry.Vec3 ToVec3(FB.Vec3? v) =>
+        v.HasValue ? new Geometry.Vec3(v.Value.X, v.Value.Y, v.Value.Z) : Geometry.Vec3.Zero;
+
+    #endregion
+
+    #region Bounding Boxes
+
+    /// <summary>
+    /// Deserializes a BoundingBoxBatch buffer, as returned by the <c>gsp_*_bounding_boxes</c>
+    /// exports.
+    /// </summary>
+    public static Geometry.OrientedBox[] DeserializeBoundingBoxBatch(byte[] buffer) {
+      var batch = FB.BoundingBoxBatch.GetRootAsBoundingBoxBatch(new ByteBuffer(buffer));
+
+      var boxes = new Geometry.OrientedBox[batch.BoxesLength];
+      for (int i = 0; i < boxes.Length; i++) {
+        var box = batch.Boxes(i);
+        if (!box.HasValue)
+          continue;
+        var data = box.Value;
+        boxes[i] = new Geometry.OrientedBox(ToVec3(data.Center), ToVec3(data.AxisX),
+            ToVec3(data.AxisY), ToVec3(data.AxisZ), ToVec3(data.HalfExtents));
+      }
+      return boxes;
+    }
+
+    #endregion
+
+    #region Topology
+
+    /// <summary>
+    /// Deserializes a TopologyReport buffer, as returned by <c>gsp_check_topology</c>.
+    /// </summary>
+    public static Geometry.TopologyReport DeserializeTopologyReport(byte[] buffer) {
+      var report = FB.TopologyReport.GetRootAsTopologyReport(new ByteBuffer(buffer));
+
+      var loopVertices = report.GetBoundaryLoopVerticesArray() ?? Array.Empty<int>();
+      var loops = new int[report.BoundaryLoopSizesLength][];
+      for (int i = 0, offset = 0; i < loops.Length; i++) {
+        int size = report.BoundaryLoopSizes(i);
+        loops[i] = loopVertices.AsSpan(offset, size).ToArray();
+        offset += size;
+      }
+
+      var nonManifoldEdges = new (int, int)[report.NonManifoldEdgesLength];
+      for (int i = 0; i < nonManifoldEdges.Length; i++) {
+        var edge = report.NonManifoldEdges(i);
+        nonManifoldEdges[i] = edge.HasValue ? (edge.Value.X, edge.Value.Y) : (0, 0);
+      }
+      var inconsistentEdges = new (int, int)[report.InconsistentEdgesLength];
+      for (int i = 0; i < inconsistentEdges.Length; i++) {
+        var edge = report.InconsistentEdges(i);
+        inconsistentEdges[i] = edge.HasValue ? (edge.Value.X, edge.Value.Y) : (0, 0);
+      }
+
+      return new Geometry.TopologyReport {
+        VertexCount = report.VertexCount,
+        FaceCount = report.FaceCount,
+        EdgeCount = report.EdgeCount,
+        BoundaryEdgeCount = report.BoundaryEdgeCount,
+        DegenerateFaces = report.GetDegenerateFacesArray() ?? Array.Empty<int>(),
+        DuplicateFaces = report.GetDuplicateFacesArray() ?? Array.Empty<int>(),
+        NonManifoldEdges = nonManifoldEdges,
+        NonManifoldVertices = report.GetNonManifoldVerticesArray() ?? Array.Empty<int>(),
+        UnreferencedVertices = report.GetUnreferencedVerticesArray() ?? Array.Empty<int>(),
+        InconsistentEdges = inconsistentEdges,
+        BoundaryLoops = loops,
+      };
+    }
+
+    #endregion
+
+    #region Mesh Queries
+
+    /// <summary>
+    /// Deserializes a MeshHitsData buffer, as returned by <c>gsp_mesh_closest_points</c> and
+    /// <c>gsp_mesh_signed_distances</c>: one hit per query point, in order.
+    /// </summary>
+    public static Geometry.MeshHit[] DeserializeMeshHits(byte[] buffer) {
+      var data = FB.MeshHitsData.GetRootAsMeshHitsData(new ByteBuffer(buffer));
+
+      var hits = new Geometry.MeshHit[data.FacesLength];
+      for (int i = 0; i < hits.Length; i++) {
+        var v = data.Vertices(i);
+        hits[i] = new Geometry.MeshHit(data.Faces(i),
+            v.HasValue ? (v.Value.X, v.Value.Y, v.Value.Z) : (-1, -1, -1),
+            ToVec3(data.Barycentrics(i)), ToVec3(data.Points(i)), data.Distances(i));
+      }
+      return hits;
+    }
+
+    /// <summary>
+    /// Deserializes a FacesWithinData buffer, as returned by <c>gsp_mesh_faces_within</c>: per
+    /// query point, its faces within the radius, nearest first.
+    /// </summary>
+    public static (int Face, double Distance)[][] DeserializeFacesWithin(byte[] buffer) {
+      var data = FB.FacesWithinData.GetRootAsFacesWithinData(new ByteBuffer(buffer));
+
+      var faces = new (int Face, double Distance)[data.CountsLength][];
+      for (int i = 0, offset = 0; i < faces.Length; i++) {
+        var list = new (int Face, double Distance)[data.Counts(i)];
+        for (int j = 0; j < list.Length; j++, offset++)
+          list[j] = (data.Faces(offset), data.Distances(offset));
+        faces[i] = list;
+      }
+      return faces;
+    }
+
+    #endregion
   }
 }
@@ -1,5 +1,6 @@
 using System;
 using System.Runtime.InteropServices;
+using GSP.Core;
 using Rhino.Geometry;
 
 namespace GSP.Extensions {
@@ -39,6 +40,32 @@ namespace GSP.Extensions {
         return ExamplePoint3dRoundTripMac(inBuffer, inSize, out outBuffer, out outSize);
     }
 
+    [DllImport(WinLibName, EntryPoint = "example_point3d_roundtrip_size", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ExamplePoint3dRoundTripSizeWin(byte[] inBuffer, int inSize, out int outSize);
+
+    [DllImport(MacLibName, EntryPoint = "example_point3d_roundtrip_size", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ExamplePoint3dRoundTripSizeMac(byte[] inBuffer, int inSize, out int outSize);
+
+    public static bool Point3dRoundTripSize(byte[] inBuffer, int inSize, out int outSize) {
+      if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+        return ExamplePoint3dRoundTripSizeWin(inBuffer, inSize, out outSize);
+      else
+        return ExamplePoint3dRoundTripSizeMac(inBuffer, inSize, out outSize);
+    }
+
+    [DllImport(WinLibName, EntryPoint = "example_point3d_roundtrip_into", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ExamplePoint3dRoundTripIntoWin(byte[] inBuffer, int inSize, [Out] byte[] outBuffer, int outCapacity, out int outSize);
+
+    [DllImport(MacLibName, EntryPoint = "example_point3d_roundtrip_into", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ExamplePoint3dRoundTripIntoMac(byte[] inBuffer, int inSize, [Out] byte[] outBuffer, int outCapacity, out int outSize);
+
+    public static bool Point3dRoundTripInto(byte[] inBuffer, int inSize, byte[] outBuffer, int outCapacity, out int outSize) {
+      if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+        return ExamplePoint3dRoundTripIntoWin(inBuffer, inSize, outBuffer, outCapacity, out outSize);
+      else
+        return ExamplePoint3dRoundTripIntoMac(inBuffer, inSize, outBuffer, outCapacity, out outSize);
+    }
+
     // --------------------------------
     // Point3d Array Roundtrip
     // --------------------------------
@@ -55,6 +82,32 @@ namespace GSP.Extensions {
         return ExamplePoint3dArrayRoundTripMac(inBuffer, inSize, out outBuffer, out outSize);
     }
 
+    [DllImport(WinLibName, EntryPoint = "example_point3d_array_roundtrip_size", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ExamplePoint3dArrayRoundTripSizeWin(byte[] inBuffer, int inSize, out int outSize);
+
+    [DllImport(MacLibName, EntryPoint = "example_point3d_array_roundtrip_size", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ExamplePoint3dArrayRoundTripSizeMac(byte[] inBuffer, int inSize, out int outSize);
+
+    public static bool Point3dArrayRoundTripSize(byte[] inBuffer, int inSize, out int outSize) {
+      if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+        return ExamplePoint3dArrayRoundTripSizeWin(inBuffer, inSize, out outSize);
+      else
+        return ExamplePoint3dArrayRoundTripSizeMac(inBuffer, inSize, out outSize);
+    }
+
+    [DllImport(WinLibName, EntryPoint = "example_point3d_array_roundtrip_into", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ExamplePoint3dArrayRoundTripIntoWin(byte[] inBuffer, int inSize, [Out] byte[] outBuffer, int outCapacity, out int outSize);
+
+    [DllImport(MacLibName, EntryPoint = "example_point3d_array_roundtrip_into", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ExamplePoint3dArrayRoundTripIntoMac(byte[] inBuffer, int inSize, [Out] byte[] outBuffer, int outCapacity, out int outSize);
+
+    public static bool Point3dArrayRoundTripInto(byte[] inBuffer, int inSize, byte[] outBuffer, int outCapacity, out int outSize) {
+      if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+        return ExamplePoint3dArrayRoundTripIntoWin(inBuffer, inSize, outBuffer, outCapacity, out outSize);
+      else
+        return ExamplePoint3dArrayRoundTripIntoMac(inBuffer, inSize, outBuffer, outCapacity, out outSize);
+    }
+
     // --------------------------------
     // Mesh Roundtrip
     // --------------------------------
@@ -70,6 +123,90 @@ namespace GSP.Extensions {
       else
         return ExampleMeshRoundTripMac(inBuffer, inSize, out outBuffer, out outSize);
     }
+
+    [DllImport(WinLibName, EntryPoint = "example_mesh_roundtrip_size", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ExampleMeshRoundTripSizeWin(byte[] inBuffer, int inSize, out int outSize);
+
+    [DllImport(MacLibName, EntryPoint = "example_mesh_roundtrip_size", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ExampleMeshRoundTripSizeMac(byte[] inBuffer, int inSize, out int outSize);
+
+    public static bool MeshRoundTripSize(byte[] inBuffer, int inSize, out int outSize) {
+      if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+        return ExampleMeshRoundTripSizeWin(inBuffer, inSize, out outSize);
+      else
+        return ExampleMeshRoundTripSizeMac(inBuffer, inSize, out outSize);
+    }
+
+    [DllImport(WinLibName, EntryPoint = "example_mesh_roundtrip_into", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ExampleMeshRoundTripIntoWin(byte[] inBuffer, int inSize, [Out] byte[] outBuffer, int outCapacity, out int outSize);
+
+    [DllImport(MacLibName, EntryPoint = "example_mesh_roundtrip_into", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ExampleMeshRoundTripIntoMac(byte[] inBuffer, int inSize, [Out] byte[] outBuffer, int outCapacity, out int outSize);
+
+    public static bool MeshRoundTripInto(byte[] inBuffer, int inSize, byte[] outBuffer, int outCapacity, out int outSize) {
+      if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+        return ExampleMeshRoundTripIntoWin(inBuffer, inSize, outBuffer, outCapacity, out outSize);
+      else
+        return ExampleMeshRoundTripIntoMac(inBuffer, inSize, outBuffer, outCapacity, out outSize);
+    }
+
+    // --------------------------------
+    // Mesh Batch Roundtrip
+    // --------------------------------
+    [DllImport(WinLibName, EntryPoint = "example_mesh_batch_roundtrip", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ExampleMeshBatchRoundTripWin(byte[] inBuffer, int inSize, out IntPtr outBuffer, out int outSize);
+
+    [DllImport(MacLibName, EntryPoint = "example_mesh_batch_roundtrip", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ExampleMeshBatchRoundTripMac(byte[] inBuffer, int inSize, out IntPtr outBuffer, out int outSize);
+
+    public static bool MeshBatchRoundTrip(byte[] inBuffer, int inSize, out IntPtr outBuffer, out int outSize) {
+      if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+        return ExampleMeshBatchRoundTripWin(inBuffer, inSize, out outBuffer, out outSize);
+      else
+        return ExampleMeshBatchRoundTripMac(inBuffer, inSize, out outBuffer, out outSize);
+    }
+
+    [DllImport(WinLibName, EntryPoint = "example_mesh_batch_roundtrip_size", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ExampleMeshBatchRoundTripSizeWin(byte[] inBuffer, int inSize, out int outSize);
+
+    [DllImport(MacLibName, EntryPoint = "example_mesh_batch_roundtrip_size", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ExampleMeshBatchRoundTripSizeMac(byte[] inBuffer, int inSize, out int outSize);
+
+    public static bool MeshBatchRoundTripSize(byte[] inBuffer, int inSize, out int outSize) {
+      if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+        return ExampleMeshBatchRoundTripSizeWin(inBuffer, inSize, out outSize);
+      else
+        return ExampleMeshBatchRoundTripSizeMac(inBuffer, inSize, out outSize);
+    }
+
+    [DllImport(WinLibName, EntryPoint = "example_mesh_batch_roundtrip_into", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ExampleMeshBatchRoundTripIntoWin(byte[] inBuffer, int inSize, [Out] byte[] outBuffer, int outCapacity, out int outSize);
+
+    [DllImport(MacLibName, EntryPoint = "example_mesh_batch_roundtrip_into", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ExampleMeshBatchRoundTripIntoMac(byte[] inBuffer, int inSize, [Out] byte[] outBuffer, int outCapacity, out int outSize);
+
+    public static bool MeshBatchRoundTripInto(byte[] inBuffer, int inSize, byte[] outBuffer, int outCapacity, out int outSize) {
+      if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+        return ExampleMeshBatchRoundTripIntoWin(inBuffer, inSize, outBuffer, outCapacity, out outSize);
+      else
+        return ExampleMeshBatchRoundTripIntoMac(inBuffer, inSize, outBuffer, outCapacity, out outSize);
+    }
+
+    // --------------------------------
+    // Resident Mesh
+    // --------------------------------
+    [DllImport(WinLibName, EntryPoint = "example_mesh_scale_resident", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ExampleMeshScaleResidentWin(ulong meshHandle, double factor, out ulong outHandle);
+
+    [DllImport(MacLibName, EntryPoint = "example_mesh_scale_resident", CallingConvention = CallingConvention.Cdecl)]
+    private static extern bool ExampleMeshScaleResidentMac(ulong meshHandle, double factor, out ulong outHandle);
+
+    public static bool MeshScaleResident(ulong meshHandle, double factor, out ulong outHandle) {
+      if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+        return ExampleMeshScaleResidentWin(meshHandle, factor, out outHandle);
+      else
+        return ExampleMeshScaleResidentMac(meshHandle, factor, out outHandle);
+    }
   }
 
   /// <summary>
@@ -77,6 +214,10 @@ namespace GSP.Extensions {
   /// Wraps the low-level P/Invoke calls with Rhino types.
   /// </summary>
   public static class ExampleUtils {
+    // Per-thread result buffer for the pooled roundtrips, rented from ArrayPool<byte>.Shared
+    // and kept across calls, so repeated calls neither allocate nor copy a native result.
+    [ThreadStatic]
+    private static byte[]? _resultBuffer;
 
     /// <summary>
     /// Send a Point3d to C++ and back (roundtrip example).
@@ -88,7 +229,7 @@ namespace GSP.Extensions {
 
       var result = new byte[outSize];
       Marshal.Copy(outPtr, result, 0, outSize);
-      Marshal.FreeCoTaskMem(outPtr);
+      MarshalHelper.Free(outPtr);
 
       return Wrapper.FromPointBuffer(result);
     }
@@ -103,7 +244,7 @@ namespace GSP.Extensions {
 
       var result = new byte[outSize];
       Marshal.Copy(outPtr, result, 0, outSize);
-      Marshal.FreeCoTaskMem(outPtr);
+      MarshalHelper.Free(outPtr);
 
       return Wrapper.FromPointArrayBuffer(result);
     }
@@ -118,9 +259,127 @@ namespace GSP.Extensions {
 
       var result = new byte[outSize];
       Marshal.Copy(outPtr, result, 0, outSize);
-      Marshal.FreeCoTaskMem(outPtr);
+      MarshalHelper.Free(outPtr);
 
       return Wrapper.FromMeshBuffer(result);
     }
+
+    /// <summary>
+    /// Send several meshes to C++ and back in one call (batch roundtrip example).
+    /// </summary>
+    public static Mesh[]? RoundTrip(Mesh[] meshes) {
+      var buffer = Wrapper.ToMeshBatchBuffer(meshes);
+      if (!ExampleBridge.MeshBatchRoundTrip(buffer, buffer.Length, out IntPtr outPtr, out int outSize))
+        return null;
+
+      var result = new byte[outSize];
+      Marshal.Copy(outPtr, result, 0, outSize);
+      MarshalHelper.Free(outPtr);
+
+      return Wrapper.FromMeshBatchBuffer(result);
+    }
+
+    /// <summary>
+    /// Send a Point3d to C++ and back, writing the result into a reused pooled buffer.
+    /// </summary>
+    public static Point3d? RoundTripPooled(Point3d point) {
+      var buffer = Wrapper.ToPointBuffer(point);
+      if (!ExampleBridge.Point3dRoundTripSize(buffer, buffer.Length, out int sizeHint))
+        return null;
+
+      var result = _resultBuffer ?? Array.Empty<byte>();
+      bool ok = MarshalHelper.WriteInto(
+          (byte[] outBuffer, int outCapacity, out int outSize) =>
+              ExampleBridge.Point3dRoundTripInto(buffer, buffer.Length, outBuffer, outCapacity, out outSize),
+          sizeHint, ref result, out _);
+      _resultBuffer = result;
+
+      return ok ? Wrapper.FromPointBuffer(result) : null;
+    }
+
+    /// <summary>
+    /// Send a Point3d array to C++ and back, writing the result into a reused pooled buffer.
+    /// </summary>
+    public static Point3d[]? RoundTripPooled(Point3d[] points) {
+      var buffer = Wrapper.ToPointArrayBuffer(points);
+      if (!ExampleBridge.Point3dArrayRoundTripSize(buffer, buffer.Length, out int sizeHint))
+        return null;
+
+      var result = _resultBuffer ?? Array.Empty<byte>();
+      bool ok = MarshalHelper.WriteInto(
+          (byte[] outBuffer, int outCapacity, out int outSize) =>
+              ExampleBridge.Point3dArrayRoundTripInto(buffer, buffer.Length, outBuffer, outCapacity, out outSize),
+          sizeHint, ref result, out _);
+      _resultBuffer = result;
+
+      return ok ? Wrapper.FromPointArrayBuffer(result) : null;
+    }
+
+    /// <summary>
+    /// Send a Mesh to C++ and back, writing the result into a reused pooled buffer.
+    /// </summary>
+    public static Mesh? RoundTripPooled(Mesh mesh) {
+      var buffer = Wrapper.ToMeshBuffer(mesh);
+      if (!ExampleBridge.MeshRoundTripSize(buffer, buffer.Length, out int sizeHint))
+        return null;
+
+      var result = _resultBuffer ?? Array.Empty<byte>();
+      bool ok = MarshalHelper.WriteInto(
+          (byte[] outBuffer, int outCapacity, out int outSize) =>
+              ExampleBridge.MeshRoundTripInto(buffer, buffer.Length, outBuffer, outCapacity, out outSize),
+          sizeHint, ref result, out _);
+      _resultBuffer = result;
+
+      return ok ? Wrapper.FromMeshBuffer(result) : null;
+    }
+
+    /// <summary>
+    /// Send several meshes to C++ and back in one call, writing the result into a reused pooled buffer.
+    /// </summary>
+    public static Mesh[]? RoundTripPooled(Mesh[] meshes) {
+      var buffer = Wrapper.ToMeshBatchBuffer(meshes);
+      if (!ExampleBridge.MeshBatchRoundTripSize(buffer, buffer.Length, out int sizeHint))
+        return null;
+
+      var result = _resultBuffer ?? Array.Empty<byte>();
+      bool ok = MarshalHelper.WriteInto(
+          (byte[] outBuffer, int outCapacity, out int outSize) =>
+              ExampleBridge.MeshBatchRoundTripInto(buffer, buffer.Length, outBuffer, outCapacity, out outSize),
+          sizeHint, ref result, out _);
+      _resultBuffer = result;
+
+      return ok ? Wrapper.FromMeshBatchBuffer(result) : null;
+    }
+
+    /// <summary>
+    /// Upload a Mesh once, to be reused by resident-mesh operations such as <see cref="Scale"/>.
+    /// </summary>
+    public static NativeMesh Upload(Mesh mesh) => NativeMesh.Upload(Wrapper.ToMeshBuffer(mesh));
+
+    /// <summary>
+    /// Scale a resident mesh without sending it again; the result stays resident too.
+    /// </summary>
+    public static NativeMesh? Scale(NativeMesh mesh, double factor) {
+      if (!ExampleBridge.MeshScaleResident(mesh.Handle, factor, out ulong outHandle))
+        return null;
+      return NativeMesh.FromHandle(outHandle);
+    }
+
+    /// <summary>
+    /// Copy a resident mesh back to a Rhino Mesh.
+    /// </summary>
+    public static Mesh Download(NativeMesh mesh) => Wrapper.FromMeshBuffer(mesh.Download());
+
+    /// <summary>
+    /// Start the batch roundtrip on a native worker thread instead of blocking the caller.
+    /// Read the result with <see cref="GetMeshes"/>; dispose the job when done.
+    /// </summary>
+    public static NativeJob SubmitRoundTrip(Mesh[] meshes, Action<NativeJob>? onCompleted = null) =>
+        NativeJob.Submit("example_mesh_batch_roundtrip", Wrapper.ToMeshBatchBuffer(meshes), onCompleted);
+
+    /// <summary>
+    /// Wait for a job started by <see cref="SubmitRoundTrip"/> and return its meshes.
+    /// </summary>
+    public static Mesh[] GetMeshes(NativeJob job) => Wrapper.FromMeshBatchBuffer(job.GetResult());
   }
 }
@@ -0,0 +1,59 @@
+namespace GSP.Geometry {
+  /// <summary>
+  /// How the native mass properties engine sums face contributions.
+  /// </summary>
+  public enum MassSummation {
+    /// <summary>One chunk per thread; the last bits may vary with the thread count.</summary>
+    Fast = 0,
+    /// <summary>Bitwise identical results for every thread count and run (default).</summary>
+    Deterministic = 1,
+    /// <summary>Deterministic, with compensated sums: slower, but close to correctly rounded.</summary>
+    Compensated = 2,
+  }
+
+  /// <summary>
+  /// Area, volume, centroids and inertia tensor of a mesh, as computed by
+  /// <c>CoreBridge.MassProperties</c>.
+  /// </summary>
+  /// <remarks>
+  /// Volume terms are signed: positive for closed meshes with outward faces, and only meaningful
+  /// for closed meshes. The inertia tensor is for unit density, about
+  /// <see cref="VolumeCentroid"/> with world-aligned axes; multiply by the density for a mass
+  /// moment of inertia.
+  /// </remarks>
+  public readonly struct MassProperties {
+    public double Area { get; }
+    public double Volume { get; }
+    public Vec3 AreaCentroid { get; }
+    public Vec3 VolumeCentroid { get; }
+
+    /// <summary>
+    /// Diagonal of the inertia tensor: (Ixx, Iyy, Izz).
+    /// </summary>
+    public Vec3 InertiaDiagonal { get; }
+
+    /// <summary>
+    /// Off-diagonal entries of the symmetric inertia tensor: (Ixy, Iyz, Izx).
+    /// </summary>
+    public Vec3 InertiaProducts { get; }
+
+    public MassProperties(double area, double volume, Vec3 areaCentroid, Vec3 volumeCentroid,
+                          Vec3 inertiaDiagonal, Vec3 inertiaProducts) {
+      Area = area;
+      Volume = volume;
+      AreaCentroid = areaCentroid;
+      VolumeCentroid = volumeCentroid;
+      InertiaDiagonal = inertiaDiagonal;
+      InertiaProducts = inertiaProducts;
+    }
+
+    /// <summary>
+    /// The inertia tensor as a 3x3 matrix.
+    /// </summary>
+    public double[,] InertiaTensor() => new[,] {
+      { InertiaDiagonal.X, InertiaProducts.X, InertiaProducts.Z },
+      { InertiaProducts.X, InertiaDiagonal.Y, InertiaProducts.Y },
+      { InertiaProducts.Z, InertiaProducts.Y, InertiaDiagonal.Z },
+    };
+  }
+}
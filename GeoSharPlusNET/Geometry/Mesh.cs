@@ -27,6 +27,11 @@ namespace GSP.Geometry {
     /// </summary>
     public (int A, int B, int C, int D)[] QuadFaces { get; set; } = Array.Empty<(int, int, int, int)>();
 
+    /// <summary>
+    /// Named per-vertex and per-face data channels; see <see cref="MeshAttribute"/>.
+    /// </summary>
+    public List<MeshAttribute> Attributes { get; set; } = new List<MeshAttribute>();
+
     /// <summary>
     /// Creates an empty mesh.
     /// </summary>
@@ -73,19 +78,36 @@ namespace GSP.Geometry {
     /// </summary>
     public bool IsValid => Vertices.Length >= 3 && FaceCount > 0;
 
+    /// <summary>
+    /// Returns the first attribute channel with the given name, or null.
+    /// </summary>
+    public MeshAttribute? GetAttribute(string name) => Attributes.Find(a => a.Name == name);
+
     /// <summary>
     /// Converts all quad faces to triangles.
     /// Each quad (A, B, C, D) becomes two triangles: (A, B, C) and (A, C, D).
+    /// Per-face attributes are copied to both triangles of a quad.
     /// </summary>
     public void Triangulate() {
       if (!HasQuads) return;
 
       var newTriangles = new List<(int, int, int)>(TriangleFaces);
-      foreach (var (A, B, C, D) in QuadFaces) {
+      var source = new int[TriangleFaces.Length + 2 * QuadFaces.Length];
+      for (int i = 0; i < TriangleFaces.Length; i++) {
+        source[i] = i;
+      }
+      for (int q = 0; q < QuadFaces.Length; q++) {
+        var (A, B, C, D) = QuadFaces[q];
         newTriangles.Add((A, B, C));
         newTriangles.Add((A, C, D));
+        source[TriangleFaces.Length + 2 * q] = source[TriangleFaces.Length + 2 * q + 1] =
+            TriangleFaces.Length + q;
       }
 
+      for (int i = 0; i < Attributes.Count; i++) {
+        if (Attributes[i].Domain == AttributeDomain.Face)
+          Attributes[i] = Attributes[i].Gather(source);
+      }
       TriangleFaces = newTriangles.ToArray();
       QuadFaces = Array.Empty<(int, int, int, int)>();
     }
@@ -97,7 +119,8 @@ namespace GSP.Geometry {
       return new Mesh {
         Vertices = Vertices.ToArray(),
         TriangleFaces = TriangleFaces.ToArray(),
-        QuadFaces = QuadFaces.ToArray()
+        QuadFaces = QuadFaces.ToArray(),
+        Attributes = Attributes.Select(a => a.Clone()).ToList()
       };
     }
 
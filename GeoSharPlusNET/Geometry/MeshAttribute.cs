@@ -0,0 +1,92 @@
+using System;
+
+namespace GSP.Geometry {
+  /// <summary>
+  /// The mesh element an attribute channel is attached to.
+  /// </summary>
+  public enum AttributeDomain {
+    Vertex = 0,
+    Face = 1
+  }
+
+  /// <summary>
+  /// A named, typed per-vertex or per-face data channel of a <see cref="Mesh"/>
+  /// (colors, normals, UVs, curvature, labels, ...).
+  /// </summary>
+  /// <remarks>
+  /// Values are stored flat, <see cref="Dimension"/> components per element, as one of
+  /// float[], double[], int[] or byte[]. Per-face channels follow the face order of the mesh:
+  /// TriangleFaces, then QuadFaces.
+  /// </remarks>
+  public class MeshAttribute {
+    /// <summary>
+    /// Channel name, e.g. "normal" or "uv".
+    /// </summary>
+    public string Name { get; }
+
+    /// <summary>
+    /// Whether the channel holds one element per vertex or per face.
+    /// </summary>
+    public AttributeDomain Domain { get; }
+
+    /// <summary>
+    /// Number of components per element (1-4).
+    /// </summary>
+    public int Dimension { get; }
+
+    /// <summary>
+    /// The flat values: float[], double[], int[] or byte[].
+    /// </summary>
+    public Array Values { get; }
+
+    /// <summary>
+    /// Number of elements (vertices or faces) in the channel.
+    /// </summary>
+    public int Count => Values.Length / Dimension;
+
+    public MeshAttribute(string name, AttributeDomain domain, int dimension, float[] values)
+        : this(name, domain, dimension, (Array)values) { }
+
+    public MeshAttribute(string name, AttributeDomain domain, int dimension, double[] values)
+        : this(name, domain, dimension, (Array)values) { }
+
+    public MeshAttribute(string name, AttributeDomain domain, int dimension, int[] values)
+        : this(name, domain, dimension, (Array)values) { }
+
+    public MeshAttribute(string name, AttributeDomain domain, int dimension, byte[] values)
+        : this(name, domain, dimension, (Array)values) { }
+
+    private MeshAttribute(string name, AttributeDomain domain, int dimension, Array values) {
+      if (dimension < 1 || dimension > 4)
+        throw new ArgumentOutOfRangeException(nameof(dimension), dimension, "Dimension must be 1-4");
+      ArgumentNullException.ThrowIfNull(values);
+      if (values.Length % dimension != 0)
+        throw new ArgumentException("Value count must be a multiple of the dimension", nameof(values));
+
+      Name = name ?? string.Empty;
+      Domain = domain;
+      Dimension = dimension;
+      Values = values;
+    }
+
+    /// <summary>
+    /// Creates a copy holding element <c>source[i]</c> of this channel at element i,
+    /// e.g. to follow faces that were split or reordered.
+    /// </summary>
+    public MeshAttribute Gather(int[] source) {
+      var values = Array.CreateInstance(Values.GetType().GetElementType()!, source.Length * Dimension);
+      for (int i = 0; i < source.Length; i++) {
+        Array.Copy(Values, source[i] * Dimension, values, i * Dimension, Dimension);
+      }
+      return new MeshAttribute(Name, Domain, Dimension, values);
+    }
+
+    /// <summary>
+    /// Creates a deep copy of this channel.
+    /// </summary>
+    public MeshAttribute Clone() => new MeshAttribute(Name, Domain, Dimension, (Array)Values.Clone());
+
+    public override string ToString() =>
+        $"MeshAttribute [{Name}, {Domain}, {Values.GetType().GetElementType()?.Name}x{Dimension}, N:{Count}]";
+  }
+}
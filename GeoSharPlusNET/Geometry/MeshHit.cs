@@ -0,0 +1,38 @@
+namespace GSP.Geometry {
+  /// <summary>
+  /// Closest point of a mesh to a query point, as found by <c>CoreBridge.ClosestPoints</c> and
+  /// <c>CoreBridge.SignedDistances</c>.
+  /// </summary>
+  /// <remarks>
+  /// Quads and polygons are queried as triangle fans (corners 0, k, k + 1), so
+  /// <see cref="Vertices"/> is the fan triangle of <see cref="Face"/> that holds the point.
+  /// </remarks>
+  public readonly struct MeshHit {
+    /// <summary>Face of the mesh, or -1 if no face was within the search distance.</summary>
+    public int Face { get; }
+
+    /// <summary>Vertices of the triangle the point lies on.</summary>
+    public (int, int, int) Vertices { get; }
+
+    /// <summary>Weights of <see cref="Vertices"/> that give <see cref="Point"/>.</summary>
+    public Vec3 Barycentric { get; }
+
+    public Vec3 Point { get; }
+
+    /// <summary>
+    /// Distance to the query point; negative inside a closed mesh for signed queries, and
+    /// infinite when nothing was found.
+    /// </summary>
+    public double Distance { get; }
+
+    public MeshHit(int face, (int, int, int) vertices, Vec3 barycentric, Vec3 point, double distance) {
+      Face = face;
+      Vertices = vertices;
+      Barycentric = barycentric;
+      Point = point;
+      Distance = distance;
+    }
+
+    public bool IsHit => Face >= 0;
+  }
+}
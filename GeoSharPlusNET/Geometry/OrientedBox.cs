@@ -0,0 +1,64 @@
+namespace GSP.Geometry {
+  /// <summary>
+  /// How the native bounding box fit orients each box.
+  /// </summary>
+  public enum BoxFit {
+    /// <summary>World axes; cached per resident mesh.</summary>
+    Aligned = 0,
+    /// <summary>Principal axes of the points (PCA).</summary>
+    Principal = 1,
+    /// <summary>Principal axes refined with rotating calipers: the tightest and slowest (default).</summary>
+    MinimumArea = 2,
+  }
+
+  /// <summary>
+  /// A box in a frame of its own, as computed by <c>CoreBridge.BoundingBoxes</c>.
+  /// </summary>
+  /// <remarks>
+  /// The axes are unit vectors of a right-handed frame; axis-aligned boxes have the world axes.
+  /// </remarks>
+  public readonly struct OrientedBox {
+    public Vec3 Center { get; }
+    public Vec3 AxisX { get; }
+    public Vec3 AxisY { get; }
+    public Vec3 AxisZ { get; }
+
+    /// <summary>
+    /// Half the box size along <see cref="AxisX"/>, <see cref="AxisY"/> and <see cref="AxisZ"/>.
+    /// </summary>
+    public Vec3 HalfExtents { get; }
+
+    public OrientedBox(Vec3 center, Vec3 axisX, Vec3 axisY, Vec3 axisZ, Vec3 halfExtents) {
+      Center = center;
+      AxisX = axisX;
+      AxisY = axisY;
+      AxisZ = axisZ;
+      HalfExtents = halfExtents;
+    }
+
+    public double Volume => 8 * HalfExtents.X * HalfExtents.Y * HalfExtents.Z;
+
+    /// <summary>
+    /// True if the point lies in the box, up to <paramref name="tolerance"/> along each axis.
+    /// </summary>
+    public bool Contains(Vec3 point, double tolerance = 1e-9) {
+      var d = point - Center;
+      return Math.Abs(Vec3.Dot(d, AxisX)) <= HalfExtents.X + tolerance &&
+             Math.Abs(Vec3.Dot(d, AxisY)) <= HalfExtents.Y + tolerance &&
+             Math.Abs(Vec3.Dot(d, AxisZ)) <= HalfExtents.Z + tolerance;
+    }
+
+    /// <summary>
+    /// The eight corners; the first four at -<see cref="AxisZ"/>, counter-clockwise about it.
+    /// </summary>
+    public Vec3[] Corners() {
+      var x = AxisX * HalfExtents.X;
+      var y = AxisY * HalfExtents.Y;
+      var z = AxisZ * HalfExtents.Z;
+      return new[] {
+        Center - x - y - z, Center + x - y - z, Center + x + y - z, Center - x + y - z,
+        Center - x - y + z, Center + x - y + z, Center + x + y + z, Center - x + y + z,
+      };
+    }
+  }
+}
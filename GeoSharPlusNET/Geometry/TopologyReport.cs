@@ -0,0 +1,71 @@
+using System;
+
+namespace GSP.Geometry {
+  /// <summary>
+  /// Fixes <c>CoreBridge.CheckTopology</c> can apply to a checked mesh.
+  /// </summary>
+  [Flags]
+  public enum MeshRepair {
+    None = 0,
+    /// <summary>Removes faces that repeat a vertex or have no area.</summary>
+    DegenerateFaces = 1,
+    /// <summary>Removes faces with the same vertices as an earlier face.</summary>
+    DuplicateFaces = 2,
+    /// <summary>Removes vertices of no face, including those orphaned by removed faces.</summary>
+    UnreferencedVertices = 4,
+    All = DegenerateFaces | DuplicateFaces | UnreferencedVertices,
+  }
+
+  /// <summary>
+  /// Topology problems of a mesh, as found by <c>CoreBridge.CheckTopology</c>.
+  /// </summary>
+  /// <remarks>
+  /// Ids refer to the checked mesh and every list is sorted. Edges are vertex pairs (a, b) with
+  /// a &lt; b.
+  /// </remarks>
+  public sealed class TopologyReport {
+    public long VertexCount { get; init; }
+    public long FaceCount { get; init; }
+    public long EdgeCount { get; init; }
+
+    /// <summary>Edges of a single face.</summary>
+    public long BoundaryEdgeCount { get; init; }
+
+    /// <summary>Faces that repeat a vertex or whose area vanishes next to their longest edge.</summary>
+    public int[] DegenerateFaces { get; init; } = Array.Empty<int>();
+
+    /// <summary>Faces with the same vertex set as an earlier face, in any order or orientation.</summary>
+    public int[] DuplicateFaces { get; init; } = Array.Empty<int>();
+
+    /// <summary>Edges of three or more faces.</summary>
+    public (int, int)[] NonManifoldEdges { get; init; } = Array.Empty<(int, int)>();
+
+    /// <summary>Vertices whose faces form more than one fan, e.g. two cones touching at their tips.</summary>
+    public int[] NonManifoldVertices { get; init; } = Array.Empty<int>();
+
+    /// <summary>Vertices of no face.</summary>
+    public int[] UnreferencedVertices { get; init; } = Array.Empty<int>();
+
+    /// <summary>Edges of two faces that run it in the same direction, i.e. flipped neighbours.</summary>
+    public (int, int)[] InconsistentEdges { get; init; } = Array.Empty<(int, int)>();
+
+    /// <summary>
+    /// Chains of boundary edges in face winding order, each starting at its smallest vertex.
+    /// </summary>
+    public int[][] BoundaryLoops { get; init; } = Array.Empty<int[]>();
+
+    /// <summary>
+    /// True when the mesh is manifold and consistently oriented, with no degenerate, duplicate
+    /// or unused elements; boundaries are allowed.
+    /// </summary>
+    public bool IsClean =>
+        DegenerateFaces.Length == 0 && DuplicateFaces.Length == 0 && NonManifoldEdges.Length == 0 &&
+        NonManifoldVertices.Length == 0 && UnreferencedVertices.Length == 0 &&
+        InconsistentEdges.Length == 0;
+
+    /// <summary>
+    /// True when the mesh is clean and has no boundary, i.e. it encloses a volume.
+    /// </summary>
+    public bool IsClosed => IsClean && BoundaryEdgeCount == 0;
+  }
+}
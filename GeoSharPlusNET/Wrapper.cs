@@ -73,17 +73,15 @@ public static class Wrapper {
     var byteBuffer = new ByteBuffer(buffer);
     var pointArray = FB.PointArrayData.GetRootAsPointArrayData(byteBuffer);
 
-    var pts = pointArray.Points;
-    // 1. Check if the array is valid
-    if (pointArray.PointsLength == 0)
+    // 1. Decode the points (double, float32 or quantized)
+    var coords = Core.Serializer.DecodePositions(pointArray);
+    if (coords.Length == 0)
       return Array.Empty<Point3d>();
 
-    // 2. Extract structs directly
-    var res = new Point3d[pointArray.PointsLength];
-    for (int i = 0; i < pointArray.PointsLength; i++) {
-      var pt = pointArray.Points(i);
-      res[i] = pt.HasValue ? new Point3d(pt.Value.X, pt.Value.Y, pt.Value.Z)
-                           : new Point3d(0, 0, 0);  // Default value if null
+    // 2. Build the points from the interleaved coordinates
+    var res = new Point3d[coords.Length / 3];
+    for (int i = 0; i < res.Length; i++) {
+      res[i] = new Point3d(coords[3 * i], coords[3 * i + 1], coords[3 * i + 2]);
     }
     return res;
   }
@@ -105,62 +103,79 @@ public static class Wrapper {
 
   public static byte[] ToMeshBuffer(Mesh mesh, bool preserveQuads = false) {
     var builder = new FlatBufferBuilder(1024);
+    var meshOffset = BuildMesh(builder, mesh, preserveQuads);
+    builder.Finish(meshOffset.Value);
 
-    // Check if mesh has quads
-    bool hasQuads = false;
-    bool hasTriangles = false;
-
-    foreach (var face in mesh.Faces) {
-      if (face.IsTriangle) {
-        hasTriangles = true;
-      } else {
-        hasQuads = true;
-      }
+    return builder.SizedByteArray();
+  }
 
-      // If we find a mixed mesh, break early
-      if (hasQuads && hasTriangles) {
-        break;
-      }
-    }
+  private static Offset<FB.MeshData> BuildMesh(FlatBufferBuilder builder, Mesh mesh, bool preserveQuads) {
+    var faces = mesh.Faces;
+    int quadCount = faces.QuadCount;
+    int triangleCount = faces.TriangleCount;
 
-    Mesh workingMesh = mesh;
-
-    // Strategy:
-    // - If mixed mesh OR (has quads AND not preserving), triangulate
-    // - Otherwise keep as-is
-    bool isMixed = hasQuads && hasTriangles;
-    if (isMixed || (hasQuads && !preserveQuads)) {
-      workingMesh = mesh.DuplicateMesh();
-      workingMesh.Faces.ConvertQuadsToTriangles();
-      hasQuads = false;
-      hasTriangles = true;
-    }
+    // Strategy (the input mesh is never duplicated):
+    // - Not preserving quads: quads are split into triangles while writing
+    // - Pure triangle or pure quad mesh: sent as-is
+    // - Mixed mesh: sent as polygon (CSR) faces
+    bool splitQuads = quadCount > 0 && !preserveQuads;
+    bool mixed = !splitQuads && quadCount > 0 && triangleCount > 0;
 
     // Add vertices
-    FB.MeshData.StartVerticesVector(builder, workingMesh.Vertices.Count);
-    for (int i = workingMesh.Vertices.Count - 1; i >= 0; i--) {
-      var vertex = workingMesh.Vertices[i];
+    FB.MeshData.StartVerticesVector(builder, mesh.Vertices.Count);
+    for (int i = mesh.Vertices.Count - 1; i >= 0; i--) {
+      var vertex = mesh.Vertices[i];
       FB.Vec3.CreateVec3(builder, vertex.X, vertex.Y, vertex.Z);
     }
     var verticesOffset = builder.EndVector();
 
     VectorOffset facesOffset = default;
     VectorOffset quadFacesOffset = default;
-
-    if (hasQuads && !hasTriangles) {
+    VectorOffset faceOffsetsOffset = default;
+    VectorOffset faceIndicesOffset = default;
+
+    if (mixed) {
+      // Mixed mesh: polygon faces in the original face order
+      var offsets = new int[faces.Count + 1];
+      var indices = new int[3 * triangleCount + 4 * quadCount];
+      int next = 0;
+      for (int i = 0; i < faces.Count; i++) {
+        var face = faces[i];
+        indices[next] = face.A;
+        indices[next + 1] = face.B;
+        indices[next + 2] = face.C;
+        if (face.IsQuad) {
+          indices[next + 3] = face.D;
+        }
+        next += face.IsQuad ? 4 : 3;
+        offsets[i + 1] = next;
+      }
+      faceOffsetsOffset = FB.MeshData.CreateFaceOffsetsVectorBlock(builder, offsets);
+      faceIndicesOffset = FB.MeshData.CreateFaceIndicesVectorBlock(builder, indices);
+    } else if (quadCount > 0 && !splitQuads) {
       // Pure quad mesh
-      FB.MeshData.StartQuadFacesVector(builder, workingMesh.Faces.Count);
-      for (int i = workingMesh.Faces.Count - 1; i >= 0; i--) {
-        var face = workingMesh.Faces[i];
+      FB.MeshData.StartQuadFacesVector(builder, faces.Count);
+      for (int i = faces.Count - 1; i >= 0; i--) {
+        var face = faces[i];
         FB.Vec4i.CreateVec4i(builder, face.A, face.B, face.C, face.D);
       }
       quadFacesOffset = builder.EndVector();
     } else {
-      // Pure triangle mesh (or was converted to triangles)
-      FB.MeshData.StartFacesVector(builder, workingMesh.Faces.Count);
-      for (int i = workingMesh.Faces.Count - 1; i >= 0; i--) {
-        var face = workingMesh.Faces[i];
-        FB.Vec3i.CreateVec3i(builder, face.A, face.B, face.C);
+      // Triangle mesh; quads are split along their shorter diagonal
+      // (FlatBuffers vectors are built back to front)
+      FB.MeshData.StartFacesVector(builder, triangleCount + 2 * quadCount);
+      for (int i = faces.Count - 1; i >= 0; i--) {
+        var face = faces[i];
+        if (!face.IsQuad) {
+          FB.Vec3i.CreateVec3i(builder, face.A, face.B, face.C);
+        } else if (mesh.Vertices[face.A].DistanceToSquared(mesh.Vertices[face.C]) <=
+                   mesh.Vertices[face.B].DistanceToSquared(mesh.Vertices[face.D])) {
+          FB.Vec3i.CreateVec3i(builder, face.A, face.C, face.D);
+          FB.Vec3i.CreateVec3i(builder, face.A, face.B, face.C);
+        } else {
+          FB.Vec3i.CreateVec3i(builder, face.B, face.C, face.D);
+          FB.Vec3i.CreateVec3i(builder, face.A, face.B, face.D);
+        }
       }
       facesOffset = builder.EndVector();
     }
@@ -168,35 +183,62 @@ public static class Wrapper {
     // Create the mesh data
     FB.MeshData.StartMeshData(builder);
     FB.MeshData.AddVertices(builder, verticesOffset);
-    if (hasQuads && !hasTriangles) {
+    if (mixed) {
+      FB.MeshData.AddFaceOffsets(builder, faceOffsetsOffset);
+      FB.MeshData.AddFaceIndices(builder, faceIndicesOffset);
+    } else if (quadCount > 0 && !splitQuads) {
       FB.MeshData.AddQuadFaces(builder, quadFacesOffset);
     } else {
       FB.MeshData.AddFaces(builder, facesOffset);
     }
-    var meshOffset = FB.MeshData.EndMeshData(builder);
-    builder.Finish(meshOffset.Value);
-
-    return builder.SizedByteArray();
+    return FB.MeshData.EndMeshData(builder);
   }
 
   public static Mesh FromMeshBuffer(byte[] buffer) {
     var byteBuffer = new ByteBuffer(buffer);
-    var meshData = FB.MeshData.GetRootAsMeshData(byteBuffer);
+    return ReadMesh(FB.MeshData.GetRootAsMeshData(byteBuffer));
+  }
 
+  private static Mesh ReadMesh(FB.MeshData meshData) {
     var mesh = new Mesh();
 
-    // Add vertices
-    for (int i = 0; i < meshData.VerticesLength; i++) {
-      var vertex = meshData.Vertices(i);
-      if (vertex.HasValue) {
-        mesh.Vertices.Add(vertex.Value.X, vertex.Value.Y, vertex.Value.Z);
-      }
+    // Add vertices (double, float32 or quantized)
+    var coords = Core.Serializer.DecodePositions(meshData);
+    for (int i = 0; i + 2 < coords.Length; i += 3) {
+      mesh.Vertices.Add(coords[i], coords[i + 1], coords[i + 2]);
     }
 
     // Check if we have quad faces
     bool hasQuadFaces = meshData.QuadFacesLength > 0;
 
-    if (hasQuadFaces) {
+    if (meshData.FaceOffsetsLength > 0) {
+      // Polygon faces: triangles and quads map to Rhino faces, larger polygons are fanned
+      var (offsets, indices) = Core.Serializer.DecodePolygonFaces(meshData);
+      for (int f = 0; f + 1 < offsets.Length; f++) {
+        int start = offsets[f];
+        int count = offsets[f + 1] - start;
+        if (count == 4) {
+          mesh.Faces.AddFace(indices[start], indices[start + 1], indices[start + 2], indices[start + 3]);
+        } else {
+          for (int k = 2; k < count; k++) {
+            mesh.Faces.AddFace(indices[start], indices[start + k - 1], indices[start + k]);
+          }
+        }
+      }
+    } else if (meshData.FacesC.HasValue) {
+      // Compact index stream (16/32-bit or delta varint)
+      var compressed = meshData.FacesC.Value;
+      var indices = Core.Serializer.DecodeCompressedFaces(compressed);
+      if (compressed.FaceVertexCount == 4) {
+        for (int i = 0; i + 3 < indices.Length; i += 4) {
+          mesh.Faces.AddFace(indices[i], indices[i + 1], indices[i + 2], indices[i + 3]);
+        }
+      } else {
+        for (int i = 0; i + 2 < indices.Length; i += 3) {
+          mesh.Faces.AddFace(indices[i], indices[i + 1], indices[i + 2]);
+        }
+      }
+    } else if (hasQuadFaces) {
       // Add quad faces
       for (int i = 0; i < meshData.QuadFacesLength; i++) {
         var face = meshData.QuadFaces(i);
@@ -222,6 +264,32 @@ public static class Wrapper {
     return mesh;
   }
 
+  // Several meshes in one MeshBatch buffer, for a single native call over all of them
+  public static byte[] ToMeshBatchBuffer(Mesh[] meshes, bool preserveQuads = false) {
+    var builder = new FlatBufferBuilder(1024);
+
+    var items = new Offset<FB.MeshData>[meshes.Length];
+    for (int i = 0; i < meshes.Length; i++) {
+      items[i] = BuildMesh(builder, meshes[i], preserveQuads);
+    }
+    var meshesOffset = FB.MeshBatch.CreateMeshesVector(builder, items);
+    var batchOffset = FB.MeshBatch.CreateMeshBatch(builder, meshesOffset);
+    builder.Finish(batchOffset.Value);
+
+    return builder.SizedByteArray();
+  }
+
+  public static Mesh[] FromMeshBatchBuffer(byte[] buffer) {
+    var batch = FB.MeshBatch.GetRootAsMeshBatch(new ByteBuffer(buffer));
+
+    var meshes = new Mesh[batch.MeshesLength];
+    for (int i = 0; i < meshes.Length; i++) {
+      var item = batch.Meshes(i);
+      meshes[i] = item.HasValue ? ReadMesh(item.Value) : new Mesh();
+    }
+    return meshes;
+  }
+
 #endregion
 
 #region Int Array Operations
@@ -393,18 +461,22 @@ public static class Wrapper {
   public static byte[] ToNestedIntArrayBuffer(List<List<int>> nestedArray) {
     var builder = new FlatBufferBuilder(1024);
 
-    // Flatten the nested array and keep track of sizes
-    var flatList = new List<int>();
-    var sizes = new List<int>();
-
+    // Flatten into arrays sized up front: one pass for the sizes, one copy per sub-array
+    var sizes = new int[nestedArray.Count];
+    int valueCount = 0;
+    for (int i = 0; i < sizes.Length; i++) {
+      sizes[i] = nestedArray[i].Count;
+      valueCount += sizes[i];
+    }
+    var values = new int[valueCount];
+    int next = 0;
     foreach (var subArray in nestedArray) {
-      sizes.Add(subArray.Count);
-      flatList.AddRange(subArray);
+      subArray.CopyTo(values, next);
+      next += subArray.Count;
     }
 
-    // Create the values and sizes vectors
-    var valuesOffset = FB.IntNestedArrayData.CreateValuesVector(builder, flatList.ToArray());
-    var sizesOffset = FB.IntNestedArrayData.CreateSizesVector(builder, sizes.ToArray());
+    var valuesOffset = FB.IntNestedArrayData.CreateValuesVectorBlock(builder, values);
+    var sizesOffset = FB.IntNestedArrayData.CreateSizesVectorBlock(builder, sizes);
 
     // Create the nested array data
     var arrayOffset =
@@ -26,6 +26,11 @@ struct Vec2i;
 
 struct Vec4i;
 
+struct Vec3f;
+
+struct QuantizedPositions;
+struct QuantizedPositionsBuilder;
+
 FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(8) Vec3 FLATBUFFERS_FINAL_CLASS {
  private:
   double x_;
@@ -165,6 +170,122 @@ FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Vec4i FLATBUFFERS_FINAL_CLASS {
 };
 FLATBUFFERS_STRUCT_END(Vec4i, 16);
 
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Vec3f FLATBUFFERS_FINAL_CLASS {
+ private:
+  float x_;
+  float y_;
+  float z_;
+
+ public:
+  Vec3f()
+      : x_(0),
+        y_(0),
+        z_(0) {
+  }
+  Vec3f(float _x, float _y, float _z)
+      : x_(::flatbuffers::EndianScalar(_x)),
+        y_(::flatbuffers::EndianScalar(_y)),
+        z_(::flatbuffers::EndianScalar(_z)) {
+  }
+  float x() const {
+    return ::flatbuffers::EndianScalar(x_);
+  }
+  float y() const {
+    return ::flatbuffers::EndianScalar(y_);
+  }
+  float z() const {
+    return ::flatbuffers::EndianScalar(z_);
+  }
+};
+FLATBUFFERS_STRUCT_END(Vec3f, 12);
+
+struct QuantizedPositions FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef QuantizedPositionsBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_MIN = 4,
+    VT_MAX = 6,
+    VT_BITS = 8,
+    VT_VALUES = 10
+  };
+  const GSP::FB::Vec3 *min() const {
+    return GetStruct<const GSP::FB::Vec3 *>(VT_MIN);
+  }
+  const GSP::FB::Vec3 *max() const {
+    return GetStruct<const GSP::FB::Vec3 *>(VT_MAX);
+  }
+  uint8_t bits() const {
+    return GetField<uint8_t>(VT_BITS, 16);
+  }
+  const ::flatbuffers::Vector<uint16_t> *values() const {
+    return GetPointer<const ::flatbuffers::Vector<uint16_t> *>(VT_VALUES);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<GSP::FB::Vec3>(verifier, VT_MIN, 8) &&
+           VerifyField<GSP::FB::Vec3>(verifier, VT_MAX, 8) &&
+           VerifyField<uint8_t>(verifier, VT_BITS, 1) &&
+           VerifyOffset(verifier, VT_VALUES) &&
+           verifier.VerifyVector(values()) &&
+           verifier.EndTable();
+  }
+};
+
+struct QuantizedPositionsBuilder {
+  typedef QuantizedPositions Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_min(const GSP::FB::Vec3 *min) {
+    fbb_.AddStruct(QuantizedPositions::VT_MIN, min);
+  }
+  void add_max(const GSP::FB::Vec3 *max) {
+    fbb_.AddStruct(QuantizedPositions::VT_MAX, max);
+  }
+  void add_bits(uint8_t bits) {
+    fbb_.AddElement<uint8_t>(QuantizedPositions::VT_BITS, bits, 16);
+  }
+  void add_values(::flatbuffers::Offset<::flatbuffers::Vector<uint16_t>> values) {
+    fbb_.AddOffset(QuantizedPositions::VT_VALUES, values);
+  }
+  explicit QuantizedPositionsBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<QuantizedPositions> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<QuantizedPositions>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<QuantizedPositions> CreateQuantizedPositions(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const GSP::FB::Vec3 *min = nullptr,
+    const GSP::FB::Vec3 *max = nullptr,
+    uint8_t bits = 16,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint16_t>> values = 0) {
+  QuantizedPositionsBuilder builder_(_fbb);
+  builder_.add_values(values);
+  builder_.add_max(max);
+  builder_.add_min(min);
+  builder_.add_bits(bits);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<QuantizedPositions> CreateQuantizedPositionsDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const GSP::FB::Vec3 *min = nullptr,
+    const GSP::FB::Vec3 *max = nullptr,
+    uint8_t bits = 16,
+    const std::vector<uint16_t> *values = nullptr) {
+  auto values__ = values ? _fbb.CreateVector<uint16_t>(*values) : 0;
+  return GSP::FB::CreateQuantizedPositions(
+      _fbb,
+      min,
+      max,
+      bits,
+      values__);
+}
+
 }  // namespace FB
 }  // namespace GSP
 
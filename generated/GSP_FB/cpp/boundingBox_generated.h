@@ -0,0 +1,193 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_BOUNDINGBOX_GSP_FB_H_
+#define FLATBUFFERS_GENERATED_BOUNDINGBOX_GSP_FB_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 2 &&
+              FLATBUFFERS_VERSION_REVISION == 10,
+             "Non-compatible flatbuffers version included");
+
+#include "base_generated.h"
+
+namespace GSP {
+namespace FB {
+
+struct BoundingBoxData;
+struct BoundingBoxDataBuilder;
+
+struct BoundingBoxBatch;
+struct BoundingBoxBatchBuilder;
+
+struct BoundingBoxData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef BoundingBoxDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_CENTER = 4,
+    VT_AXIS_X = 6,
+    VT_AXIS_Y = 8,
+    VT_AXIS_Z = 10,
+    VT_HALF_EXTENTS = 12
+  };
+  const GSP::FB::Vec3 *center() const {
+    return GetStruct<const GSP::FB::Vec3 *>(VT_CENTER);
+  }
+  const GSP::FB::Vec3 *axis_x() const {
+    return GetStruct<const GSP::FB::Vec3 *>(VT_AXIS_X);
+  }
+  const GSP::FB::Vec3 *axis_y() const {
+    return GetStruct<const GSP::FB::Vec3 *>(VT_AXIS_Y);
+  }
+  const GSP::FB::Vec3 *axis_z() const {
+    return GetStruct<const GSP::FB::Vec3 *>(VT_AXIS_Z);
+  }
+  const GSP::FB::Vec3 *half_extents() const {
+    return GetStruct<const GSP::FB::Vec3 *>(VT_HALF_EXTENTS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<GSP::FB::Vec3>(verifier, VT_CENTER, 8) &&
+           VerifyField<GSP::FB::Vec3>(verifier, VT_AXIS_X, 8) &&
+           VerifyField<GSP::FB::Vec3>(verifier, VT_AXIS_Y, 8) &&
+           VerifyField<GSP::FB::Vec3>(verifier, VT_AXIS_Z, 8) &&
+           VerifyField<GSP::FB::Vec3>(verifier, VT_HALF_EXTENTS, 8) &&
+           verifier.EndTable();
+  }
+};
+
+struct BoundingBoxDataBuilder {
+  typedef BoundingBoxData Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_center(const GSP::FB::Vec3 *center) {
+    fbb_.AddStruct(BoundingBoxData::VT_CENTER, center);
+  }
+  void add_axis_x(const GSP::FB::Vec3 *axis_x) {
+    fbb_.AddStruct(BoundingBoxData::VT_AXIS_X, axis_x);
+  }
+  void add_axis_y(const GSP::FB::Vec3 *axis_y) {
+    fbb_.AddStruct(BoundingBoxData::VT_AXIS_Y, axis_y);
+  }
+  void add_axis_z(const GSP::FB::Vec3 *axis_z) {
+    fbb_.AddStruct(BoundingBoxData::VT_AXIS_Z, axis_z);
+  }
+  void add_half_extents(const GSP::FB::Vec3 *half_extents) {
+    fbb_.AddStruct(BoundingBoxData::VT_HALF_EXTENTS, half_extents);
+  }
+  explicit BoundingBoxDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<BoundingBoxData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<BoundingBoxData>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<BoundingBoxData> CreateBoundingBoxData(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const GSP::FB::Vec3 *center = nullptr,
+    const GSP::FB::Vec3 *axis_x = nullptr,
+    const GSP::FB::Vec3 *axis_y = nullptr,
+    const GSP::FB::Vec3 *axis_z = nullptr,
+    const GSP::FB::Vec3 *half_extents = nullptr) {
+  BoundingBoxDataBuilder builder_(_fbb);
+  builder_.add_half_extents(half_extents);
+  builder_.add_axis_z(axis_z);
+  builder_.add_axis_y(axis_y);
+  builder_.add_axis_x(axis_x);
+  builder_.add_center(center);
+  return builder_.Finish();
+}
+
+struct BoundingBoxBatch FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef BoundingBoxBatchBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_BOXES = 4
+  };
+  const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::BoundingBoxData>> *boxes() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::BoundingBoxData>> *>(VT_BOXES);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_BOXES) &&
+           verifier.VerifyVector(boxes()) &&
+           verifier.VerifyVectorOfTables(boxes()) &&
+           verifier.EndTable();
+  }
+};
+
+struct BoundingBoxBatchBuilder {
+  typedef BoundingBoxBatch Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_boxes(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::BoundingBoxData>>> boxes) {
+    fbb_.AddOffset(BoundingBoxBatch::VT_BOXES, boxes);
+  }
+  explicit BoundingBoxBatchBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<BoundingBoxBatch> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<BoundingBoxBatch>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<BoundingBoxBatch> CreateBoundingBoxBatch(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::BoundingBoxData>>> boxes = 0) {
+  BoundingBoxBatchBuilder builder_(_fbb);
+  builder_.add_boxes(boxes);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<BoundingBoxBatch> CreateBoundingBoxBatchDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<::flatbuffers::Offset<GSP::FB::BoundingBoxData>> *boxes = nullptr) {
+  auto boxes__ = boxes ? _fbb.CreateVector<::flatbuffers::Offset<GSP::FB::BoundingBoxData>>(*boxes) : 0;
+  return GSP::FB::CreateBoundingBoxBatch(
+      _fbb,
+      boxes__);
+}
+
+inline const GSP::FB::BoundingBoxBatch *GetBoundingBoxBatch(const void *buf) {
+  return ::flatbuffers::GetRoot<GSP::FB::BoundingBoxBatch>(buf);
+}
+
+inline const GSP::FB::BoundingBoxBatch *GetSizePrefixedBoundingBoxBatch(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<GSP::FB::BoundingBoxBatch>(buf);
+}
+
+inline bool VerifyBoundingBoxBatchBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<GSP::FB::BoundingBoxBatch>(nullptr);
+}
+
+inline bool VerifySizePrefixedBoundingBoxBatchBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<GSP::FB::BoundingBoxBatch>(nullptr);
+}
+
+inline void FinishBoundingBoxBatchBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::BoundingBoxBatch> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedBoundingBoxBatchBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::BoundingBoxBatch> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace FB
+}  // namespace GSP
+
+#endif  // FLATBUFFERS_GENERATED_BOUNDINGBOX_GSP_FB_H_
@@ -0,0 +1,203 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_MASSPROPERTIES_GSP_FB_H_
+#define FLATBUFFERS_GENERATED_MASSPROPERTIES_GSP_FB_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 2 &&
+              FLATBUFFERS_VERSION_REVISION == 10,
+             "Non-compatible flatbuffers version included");
+
+#include "base_generated.h"
+
+namespace GSP {
+namespace FB {
+
+struct MassPropertiesData;
+struct MassPropertiesDataBuilder;
+
+struct MassPropertiesBatch;
+struct MassPropertiesBatchBuilder;
+
+struct MassPropertiesData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef MassPropertiesDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_AREA = 4,
+    VT_VOLUME = 6,
+    VT_AREA_CENTROID = 8,
+    VT_VOLUME_CENTROID = 10,
+    VT_INERTIA_DIAGONAL = 12,
+    VT_INERTIA_PRODUCTS = 14
+  };
+  double area() const {
+    return GetField<double>(VT_AREA, 0.0);
+  }
+  double volume() const {
+    return GetField<double>(VT_VOLUME, 0.0);
+  }
+  const GSP::FB::Vec3 *area_centroid() const {
+    return GetStruct<const GSP::FB::Vec3 *>(VT_AREA_CENTROID);
+  }
+  const GSP::FB::Vec3 *volume_centroid() const {
+    return GetStruct<const GSP::FB::Vec3 *>(VT_VOLUME_CENTROID);
+  }
+  const GSP::FB::Vec3 *inertia_diagonal() const {
+    return GetStruct<const GSP::FB::Vec3 *>(VT_INERTIA_DIAGONAL);
+  }
+  const GSP::FB::Vec3 *inertia_products() const {
+    return GetStruct<const GSP::FB::Vec3 *>(VT_INERTIA_PRODUCTS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<double>(verifier, VT_AREA, 8) &&
+           VerifyField<double>(verifier, VT_VOLUME, 8) &&
+           VerifyField<GSP::FB::Vec3>(verifier, VT_AREA_CENTROID, 8) &&
+           VerifyField<GSP::FB::Vec3>(verifier, VT_VOLUME_CENTROID, 8) &&
+           VerifyField<GSP::FB::Vec3>(verifier, VT_INERTIA_DIAGONAL, 8) &&
+           VerifyField<GSP::FB::Vec3>(verifier, VT_INERTIA_PRODUCTS, 8) &&
+           verifier.EndTable();
+  }
+};
+
+struct MassPropertiesDataBuilder {
+  typedef MassPropertiesData Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_area(double area) {
+    fbb_.AddElement<double>(MassPropertiesData::VT_AREA, area, 0.0);
+  }
+  void add_volume(double volume) {
+    fbb_.AddElement<double>(MassPropertiesData::VT_VOLUME, volume, 0.0);
+  }
+  void add_area_centroid(const GSP::FB::Vec3 *area_centroid) {
+    fbb_.AddStruct(MassPropertiesData::VT_AREA_CENTROID, area_centroid);
+  }
+  void add_volume_centroid(const GSP::FB::Vec3 *volume_centroid) {
+    fbb_.AddStruct(MassPropertiesData::VT_VOLUME_CENTROID, volume_centroid);
+  }
+  void add_inertia_diagonal(const GSP::FB::Vec3 *inertia_diagonal) {
+    fbb_.AddStruct(MassPropertiesData::VT_INERTIA_DIAGONAL, inertia_diagonal);
+  }
+  void add_inertia_products(const GSP::FB::Vec3 *inertia_products) {
+    fbb_.AddStruct(MassPropertiesData::VT_INERTIA_PRODUCTS, inertia_products);
+  }
+  explicit MassPropertiesDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<MassPropertiesData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<MassPropertiesData>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<MassPropertiesData> CreateMassPropertiesData(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    double area = 0.0,
+    double volume = 0.0,
+    const GSP::FB::Vec3 *area_centroid = nullptr,
+    const GSP::FB::Vec3 *volume_centroid = nullptr,
+    const GSP::FB::Vec3 *inertia_diagonal = nullptr,
+    const GSP::FB::Vec3 *inertia_products = nullptr) {
+  MassPropertiesDataBuilder builder_(_fbb);
+  builder_.add_volume(volume);
+  builder_.add_area(area);
+  builder_.add_inertia_products(inertia_products);
+  builder_.add_inertia_diagonal(inertia_diagonal);
+  builder_.add_volume_centroid(volume_centroid);
+  builder_.add_area_centroid(area_centroid);
+  return builder_.Finish();
+}
+
+struct MassPropertiesBatch FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef MassPropertiesBatchBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ITEMS = 4
+  };
+  const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::MassPropertiesData>> *items() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::MassPropertiesData>> *>(VT_ITEMS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_ITEMS) &&
+           verifier.VerifyVector(items()) &&
+           verifier.VerifyVectorOfTables(items()) &&
+           verifier.EndTable();
+  }
+};
+
+struct MassPropertiesBatchBuilder {
+  typedef MassPropertiesBatch Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_items(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::MassPropertiesData>>> items) {
+    fbb_.AddOffset(MassPropertiesBatch::VT_ITEMS, items);
+  }
+  explicit MassPropertiesBatchBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<MassPropertiesBatch> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<MassPropertiesBatch>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<MassPropertiesBatch> CreateMassPropertiesBatch(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::MassPropertiesData>>> items = 0) {
+  MassPropertiesBatchBuilder builder_(_fbb);
+  builder_.add_items(items);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<MassPropertiesBatch> CreateMassPropertiesBatchDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<::flatbuffers::Offset<GSP::FB::MassPropertiesData>> *items = nullptr) {
+  auto items__ = items ? _fbb.CreateVector<::flatbuffers::Offset<GSP::FB::MassPropertiesData>>(*items) : 0;
+  return GSP::FB::CreateMassPropertiesBatch(
+      _fbb,
+      items__);
+}
+
+inline const GSP::FB::MassPropertiesBatch *GetMassPropertiesBatch(const void *buf) {
+  return ::flatbuffers::GetRoot<GSP::FB::MassPropertiesBatch>(buf);
+}
+
+inline const GSP::FB::MassPropertiesBatch *GetSizePrefixedMassPropertiesBatch(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<GSP::FB::MassPropertiesBatch>(buf);
+}
+
+inline bool VerifyMassPropertiesBatchBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<GSP::FB::MassPropertiesBatch>(nullptr);
+}
+
+inline bool VerifySizePrefixedMassPropertiesBatchBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<GSP::FB::MassPropertiesBatch>(nullptr);
+}
+
+inline void FinishMassPropertiesBatchBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::MassPropertiesBatch> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedMassPropertiesBatchBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::MassPropertiesBatch> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace FB
+}  // namespace GSP
+
+#endif  // FLATBUFFERS_GENERATED_MASSPROPERTIES_GSP_FB_H_
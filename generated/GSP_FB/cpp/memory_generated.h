@@ -0,0 +1,407 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_MEMORY_GSP_FB_H_
+#define FLATBUFFERS_GENERATED_MEMORY_GSP_FB_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 2 &&
+              FLATBUFFERS_VERSION_REVISION == 10,
+             "Non-compatible flatbuffers version included");
+
+namespace GSP {
+namespace FB {
+
+struct ExportMemoryStats;
+struct ExportMemoryStatsBuilder;
+
+struct LiveBuffer;
+struct LiveBufferBuilder;
+
+struct MemoryStats;
+struct MemoryStatsBuilder;
+
+enum class MemoryTracking : uint8_t {
+  Off = 0,
+  Counters = 1,
+  Debug = 2,
+  MIN = Off,
+  MAX = Debug
+};
+
+inline const MemoryTracking (&EnumValuesMemoryTracking())[3] {
+  static const MemoryTracking values[] = {
+    MemoryTracking::Off,
+    MemoryTracking::Counters,
+    MemoryTracking::Debug
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesMemoryTracking() {
+  static const char * const names[4] = {
+    "Off",
+    "Counters",
+    "Debug",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameMemoryTracking(MemoryTracking e) {
+  if (::flatbuffers::IsOutRange(e, MemoryTracking::Off, MemoryTracking::Debug)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesMemoryTracking()[index];
+}
+
+struct ExportMemoryStats FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef ExportMemoryStatsBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_ALLOCATIONS = 6,
+    VT_ALLOCATED_BYTES = 8,
+    VT_LIVE_BUFFERS = 10,
+    VT_LIVE_BYTES = 12,
+    VT_PEAK_BYTES = 14
+  };
+  const ::flatbuffers::String *name() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_NAME);
+  }
+  uint64_t allocations() const {
+    return GetField<uint64_t>(VT_ALLOCATIONS, 0);
+  }
+  uint64_t allocated_bytes() const {
+    return GetField<uint64_t>(VT_ALLOCATED_BYTES, 0);
+  }
+  uint64_t live_buffers() const {
+    return GetField<uint64_t>(VT_LIVE_BUFFERS, 0);
+  }
+  uint64_t live_bytes() const {
+    return GetField<uint64_t>(VT_LIVE_BYTES, 0);
+  }
+  uint64_t peak_bytes() const {
+    return GetField<uint64_t>(VT_PEAK_BYTES, 0);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyField<uint64_t>(verifier, VT_ALLOCATIONS, 8) &&
+           VerifyField<uint64_t>(verifier, VT_ALLOCATED_BYTES, 8) &&
+           VerifyField<uint64_t>(verifier, VT_LIVE_BUFFERS, 8) &&
+           VerifyField<uint64_t>(verifier, VT_LIVE_BYTES, 8) &&
+           VerifyField<uint64_t>(verifier, VT_PEAK_BYTES, 8) &&
+           verifier.EndTable();
+  }
+};
+
+struct ExportMemoryStatsBuilder {
+  typedef ExportMemoryStats Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_name(::flatbuffers::Offset<::flatbuffers::String> name) {
+    fbb_.AddOffset(ExportMemoryStats::VT_NAME, name);
+  }
+  void add_allocations(uint64_t allocations) {
+    fbb_.AddElement<uint64_t>(ExportMemoryStats::VT_ALLOCATIONS, allocations, 0);
+  }
+  void add_allocated_bytes(uint64_t allocated_bytes) {
+    fbb_.AddElement<uint64_t>(ExportMemoryStats::VT_ALLOCATED_BYTES, allocated_bytes, 0);
+  }
+  void add_live_buffers(uint64_t live_buffers) {
+    fbb_.AddElement<uint64_t>(ExportMemoryStats::VT_LIVE_BUFFERS, live_buffers, 0);
+  }
+  void add_live_bytes(uint64_t live_bytes) {
+    fbb_.AddElement<uint64_t>(ExportMemoryStats::VT_LIVE_BYTES, live_bytes, 0);
+  }
+  void add_peak_bytes(uint64_t peak_bytes) {
+    fbb_.AddElement<uint64_t>(ExportMemoryStats::VT_PEAK_BYTES, peak_bytes, 0);
+  }
+  explicit ExportMemoryStatsBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<ExportMemoryStats> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<ExportMemoryStats>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<ExportMemoryStats> CreateExportMemoryStats(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> name = 0,
+    uint64_t allocations = 0,
+    uint64_t allocated_bytes = 0,
+    uint64_t live_buffers = 0,
+    uint64_t live_bytes = 0,
+    uint64_t peak_bytes = 0) {
+  ExportMemoryStatsBuilder builder_(_fbb);
+  builder_.add_peak_bytes(peak_bytes);
+  builder_.add_live_bytes(live_bytes);
+  builder_.add_live_buffers(live_buffers);
+  builder_.add_allocated_bytes(allocated_bytes);
+  builder_.add_allocations(allocations);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<ExportMemoryStats> CreateExportMemoryStatsDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    uint64_t allocations = 0,
+    uint64_t allocated_bytes = 0,
+    uint64_t live_buffers = 0,
+    uint64_t live_bytes = 0,
+    uint64_t peak_bytes = 0) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  return GSP::FB::CreateExportMemoryStats(
+      _fbb,
+      name__,
+      allocations,
+      allocated_bytes,
+      live_buffers,
+      live_bytes,
+      peak_bytes);
+}
+
+struct LiveBuffer FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef LiveBufferBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_EXPORT_NAME = 4,
+    VT_ADDRESS = 6,
+    VT_SIZE = 8,
+    VT_SEQUENCE = 10
+  };
+  const ::flatbuffers::String *export_name() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_EXPORT_NAME);
+  }
+  uint64_t address() const {
+    return GetField<uint64_t>(VT_ADDRESS, 0);
+  }
+  uint64_t size() const {
+    return GetField<uint64_t>(VT_SIZE, 0);
+  }
+  uint64_t sequence() const {
+    return GetField<uint64_t>(VT_SEQUENCE, 0);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_EXPORT_NAME) &&
+           verifier.VerifyString(export_name()) &&
+           VerifyField<uint64_t>(verifier, VT_ADDRESS, 8) &&
+           VerifyField<uint64_t>(verifier, VT_SIZE, 8) &&
+           VerifyField<uint64_t>(verifier, VT_SEQUENCE, 8) &&
+           verifier.EndTable();
+  }
+};
+
+struct LiveBufferBuilder {
+  typedef LiveBuffer Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_export_name(::flatbuffers::Offset<::flatbuffers::String> export_name) {
+    fbb_.AddOffset(LiveBuffer::VT_EXPORT_NAME, export_name);
+  }
+  void add_address(uint64_t address) {
+    fbb_.AddElement<uint64_t>(LiveBuffer::VT_ADDRESS, address, 0);
+  }
+  void add_size(uint64_t size) {
+    fbb_.AddElement<uint64_t>(LiveBuffer::VT_SIZE, size, 0);
+  }
+  void add_sequence(uint64_t sequence) {
+    fbb_.AddElement<uint64_t>(LiveBuffer::VT_SEQUENCE, sequence, 0);
+  }
+  explicit LiveBufferBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<LiveBuffer> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<LiveBuffer>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<LiveBuffer> CreateLiveBuffer(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> export_name = 0,
+    uint64_t address = 0,
+    uint64_t size = 0,
+    uint64_t sequence = 0) {
+  LiveBufferBuilder builder_(_fbb);
+  builder_.add_sequence(sequence);
+  builder_.add_size(size);
+  builder_.add_address(address);
+  builder_.add_export_name(export_name);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<LiveBuffer> CreateLiveBufferDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *export_name = nullptr,
+    uint64_t address = 0,
+    uint64_t size = 0,
+    uint64_t sequence = 0) {
+  auto export_name__ = export_name ? _fbb.CreateString(export_name) : 0;
+  return GSP::FB::CreateLiveBuffer(
+      _fbb,
+      export_name__,
+      address,
+      size,
+      sequence);
+}
+
+struct MemoryStats FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef MemoryStatsBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_MODE = 4,
+    VT_LIVE_BUFFERS = 6,
+    VT_LIVE_BYTES = 8,
+    VT_PEAK_BYTES = 10,
+    VT_EXPORTS = 12,
+    VT_LIVE = 14
+  };
+  GSP::FB::MemoryTracking mode() const {
+    return static_cast<GSP::FB::MemoryTracking>(GetField<uint8_t>(VT_MODE, 0));
+  }
+  uint64_t live_buffers() const {
+    return GetField<uint64_t>(VT_LIVE_BUFFERS, 0);
+  }
+  uint64_t live_bytes() const {
+    return GetField<uint64_t>(VT_LIVE_BYTES, 0);
+  }
+  uint64_t peak_bytes() const {
+    return GetField<uint64_t>(VT_PEAK_BYTES, 0);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::ExportMemoryStats>> *exports() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::ExportMemoryStats>> *>(VT_EXPORTS);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::LiveBuffer>> *live() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::LiveBuffer>> *>(VT_LIVE);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_MODE, 1) &&
+           VerifyField<uint64_t>(verifier, VT_LIVE_BUFFERS, 8) &&
+           VerifyField<uint64_t>(verifier, VT_LIVE_BYTES, 8) &&
+           VerifyField<uint64_t>(verifier, VT_PEAK_BYTES, 8) &&
+           VerifyOffset(verifier, VT_EXPORTS) &&
+           verifier.VerifyVector(exports()) &&
+           verifier.VerifyVectorOfTables(exports()) &&
+           VerifyOffset(verifier, VT_LIVE) &&
+           verifier.VerifyVector(live()) &&
+           verifier.VerifyVectorOfTables(live()) &&
+           verifier.EndTable();
+  }
+};
+
+struct MemoryStatsBuilder {
+  typedef MemoryStats Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_mode(GSP::FB::MemoryTracking mode) {
+    fbb_.AddElement<uint8_t>(MemoryStats::VT_MODE, static_cast<uint8_t>(mode), 0);
+  }
+  void add_live_buffers(uint64_t live_buffers) {
+    fbb_.AddElement<uint64_t>(MemoryStats::VT_LIVE_BUFFERS, live_buffers, 0);
+  }
+  void add_live_bytes(uint64_t live_bytes) {
+    fbb_.AddElement<uint64_t>(MemoryStats::VT_LIVE_BYTES, live_bytes, 0);
+  }
+  void add_peak_bytes(uint64_t peak_bytes) {
+    fbb_.AddElement<uint64_t>(MemoryStats::VT_PEAK_BYTES, peak_bytes, 0);
+  }
+  void add_exports(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::ExportMemoryStats>>> exports) {
+    fbb_.AddOffset(MemoryStats::VT_EXPORTS, exports);
+  }
+  void add_live(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::LiveBuffer>>> live) {
+    fbb_.AddOffset(MemoryStats::VT_LIVE, live);
+  }
+  explicit MemoryStatsBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<MemoryStats> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<MemoryStats>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<MemoryStats> CreateMemoryStats(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    GSP::FB::MemoryTracking mode = GSP::FB::MemoryTracking::Off,
+    uint64_t live_buffers = 0,
+    uint64_t live_bytes = 0,
+    uint64_t peak_bytes = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::ExportMemoryStats>>> exports = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::LiveBuffer>>> live = 0) {
+  MemoryStatsBuilder builder_(_fbb);
+  builder_.add_peak_bytes(peak_bytes);
+  builder_.add_live_bytes(live_bytes);
+  builder_.add_live_buffers(live_buffers);
+  builder_.add_live(live);
+  builder_.add_exports(exports);
+  builder_.add_mode(mode);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<MemoryStats> CreateMemoryStatsDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    GSP::FB::MemoryTracking mode = GSP::FB::MemoryTracking::Off,
+    uint64_t live_buffers = 0,
+    uint64_t live_bytes = 0,
+    uint64_t peak_bytes = 0,
+    const std::vector<::flatbuffers::Offset<GSP::FB::ExportMemoryStats>> *exports = nullptr,
+    const std::vector<::flatbuffers::Offset<GSP::FB::LiveBuffer>> *live = nullptr) {
+  auto exports__ = exports ? _fbb.CreateVector<::flatbuffers::Offset<GSP::FB::ExportMemoryStats>>(*exports) : 0;
+  auto live__ = live ? _fbb.CreateVector<::flatbuffers::Offset<GSP::FB::LiveBuffer>>(*live) : 0;
+  return GSP::FB::CreateMemoryStats(
+      _fbb,
+      mode,
+      live_buffers,
+      live_bytes,
+      peak_bytes,
+      exports__,
+      live__);
+}
+
+inline const GSP::FB::MemoryStats *GetMemoryStats(const void *buf) {
+  return ::flatbuffers::GetRoot<GSP::FB::MemoryStats>(buf);
+}
+
+inline const GSP::FB::MemoryStats *GetSizePrefixedMemoryStats(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<GSP::FB::MemoryStats>(buf);
+}
+
+inline bool VerifyMemoryStatsBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<GSP::FB::MemoryStats>(nullptr);
+}
+
+inline bool VerifySizePrefixedMemoryStatsBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<GSP::FB::MemoryStats>(nullptr);
+}
+
+inline void FinishMemoryStatsBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::MemoryStats> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedMemoryStatsBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::MemoryStats> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace FB
+}  // namespace GSP
+
+#endif  // FLATBUFFERS_GENERATED_MEMORY_GSP_FB_H_
@@ -0,0 +1,246 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_MESHQUERY_GSP_FB_H_
+#define FLATBUFFERS_GENERATED_MESHQUERY_GSP_FB_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 2 &&
+              FLATBUFFERS_VERSION_REVISION == 10,
+             "Non-compatible flatbuffers version included");
+
+#include "base_generated.h"
+
+namespace GSP {
+namespace FB {
+
+struct MeshHitsData;
+struct MeshHitsDataBuilder;
+
+struct FacesWithinData;
+struct FacesWithinDataBuilder;
+
+struct MeshHitsData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef MeshHitsDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_FACES = 4,
+    VT_DISTANCES = 6,
+    VT_VERTICES = 8,
+    VT_BARYCENTRICS = 10,
+    VT_POINTS = 12
+  };
+  const ::flatbuffers::Vector<int32_t> *faces() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_FACES);
+  }
+  const ::flatbuffers::Vector<double> *distances() const {
+    return GetPointer<const ::flatbuffers::Vector<double> *>(VT_DISTANCES);
+  }
+  const ::flatbuffers::Vector<const GSP::FB::Vec3i *> *vertices() const {
+    return GetPointer<const ::flatbuffers::Vector<const GSP::FB::Vec3i *> *>(VT_VERTICES);
+  }
+  const ::flatbuffers::Vector<const GSP::FB::Vec3 *> *barycentrics() const {
+    return GetPointer<const ::flatbuffers::Vector<const GSP::FB::Vec3 *> *>(VT_BARYCENTRICS);
+  }
+  const ::flatbuffers::Vector<const GSP::FB::Vec3 *> *points() const {
+    return GetPointer<const ::flatbuffers::Vector<const GSP::FB::Vec3 *> *>(VT_POINTS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_FACES) &&
+           verifier.VerifyVector(faces()) &&
+           VerifyOffset(verifier, VT_DISTANCES) &&
+           verifier.VerifyVector(distances()) &&
+           VerifyOffset(verifier, VT_VERTICES) &&
+           verifier.VerifyVector(vertices()) &&
+           VerifyOffset(verifier, VT_BARYCENTRICS) &&
+           verifier.VerifyVector(barycentrics()) &&
+           VerifyOffset(verifier, VT_POINTS) &&
+           verifier.VerifyVector(points()) &&
+           verifier.EndTable();
+  }
+};
+
+struct MeshHitsDataBuilder {
+  typedef MeshHitsData Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_faces(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> faces) {
+    fbb_.AddOffset(MeshHitsData::VT_FACES, faces);
+  }
+  void add_distances(::flatbuffers::Offset<::flatbuffers::Vector<double>> distances) {
+    fbb_.AddOffset(MeshHitsData::VT_DISTANCES, distances);
+  }
+  void add_vertices(::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3i *>> vertices) {
+    fbb_.AddOffset(MeshHitsData::VT_VERTICES, vertices);
+  }
+  void add_barycentrics(::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3 *>> barycentrics) {
+    fbb_.AddOffset(MeshHitsData::VT_BARYCENTRICS, barycentrics);
+  }
+  void add_points(::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3 *>> points) {
+    fbb_.AddOffset(MeshHitsData::VT_POINTS, points);
+  }
+  explicit MeshHitsDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<MeshHitsData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<MeshHitsData>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<MeshHitsData> CreateMeshHitsData(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> faces = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<double>> distances = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3i *>> vertices = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3 *>> barycentrics = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3 *>> points = 0) {
+  MeshHitsDataBuilder builder_(_fbb);
+  builder_.add_points(points);
+  builder_.add_barycentrics(barycentrics);
+  builder_.add_vertices(vertices);
+  builder_.add_distances(distances);
+  builder_.add_faces(faces);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<MeshHitsData> CreateMeshHitsDataDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<int32_t> *faces = nullptr,
+    const std::vector<double> *distances = nullptr,
+    const std::vector<GSP::FB::Vec3i> *vertices = nullptr,
+    const std::vector<GSP::FB::Vec3> *barycentrics = nullptr,
+    const std::vector<GSP::FB::Vec3> *points = nullptr) {
+  auto faces__ = faces ? _fbb.CreateVector<int32_t>(*faces) : 0;
+  auto distances__ = distances ? _fbb.CreateVector<double>(*distances) : 0;
+  auto vertices__ = vertices ? _fbb.CreateVectorOfStructs<GSP::FB::Vec3i>(*vertices) : 0;
+  auto barycentrics__ = barycentrics ? _fbb.CreateVectorOfStructs<GSP::FB::Vec3>(*barycentrics) : 0;
+  auto points__ = points ? _fbb.CreateVectorOfStructs<GSP::FB::Vec3>(*points) : 0;
+  return GSP::FB::CreateMeshHitsData(
+      _fbb,
+      faces__,
+      distances__,
+      vertices__,
+      barycentrics__,
+      points__);
+}
+
+struct FacesWithinData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef FacesWithinDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_COUNTS = 4,
+    VT_FACES = 6,
+    VT_DISTANCES = 8
+  };
+  const ::flatbuffers::Vector<int32_t> *counts() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_COUNTS);
+  }
+  const ::flatbuffers::Vector<int32_t> *faces() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_FACES);
+  }
+  const ::flatbuffers::Vector<double> *distances() const {
+    return GetPointer<const ::flatbuffers::Vector<double> *>(VT_DISTANCES);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_COUNTS) &&
+           verifier.VerifyVector(counts()) &&
+           VerifyOffset(verifier, VT_FACES) &&
+           verifier.VerifyVector(faces()) &&
+           VerifyOffset(verifier, VT_DISTANCES) &&
+           verifier.VerifyVector(distances()) &&
+           verifier.EndTable();
+  }
+};
+
+struct FacesWithinDataBuilder {
+  typedef FacesWithinData Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_counts(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> counts) {
+    fbb_.AddOffset(FacesWithinData::VT_COUNTS, counts);
+  }
+  void add_faces(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> faces) {
+    fbb_.AddOffset(FacesWithinData::VT_FACES, faces);
+  }
+  void add_distances(::flatbuffers::Offset<::flatbuffers::Vector<double>> distances) {
+    fbb_.AddOffset(FacesWithinData::VT_DISTANCES, distances);
+  }
+  explicit FacesWithinDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<FacesWithinData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<FacesWithinData>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<FacesWithinData> CreateFacesWithinData(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> counts = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> faces = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<double>> distances = 0) {
+  FacesWithinDataBuilder builder_(_fbb);
+  builder_.add_distances(distances);
+  builder_.add_faces(faces);
+  builder_.add_counts(counts);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<FacesWithinData> CreateFacesWithinDataDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<int32_t> *counts = nullptr,
+    const std::vector<int32_t> *faces = nullptr,
+    const std::vector<double> *distances = nullptr) {
+  auto counts__ = counts ? _fbb.CreateVector<int32_t>(*counts) : 0;
+  auto faces__ = faces ? _fbb.CreateVector<int32_t>(*faces) : 0;
+  auto distances__ = distances ? _fbb.CreateVector<double>(*distances) : 0;
+  return GSP::FB::CreateFacesWithinData(
+      _fbb,
+      counts__,
+      faces__,
+      distances__);
+}
+
+inline const GSP::FB::MeshHitsData *GetMeshHitsData(const void *buf) {
+  return ::flatbuffers::GetRoot<GSP::FB::MeshHitsData>(buf);
+}
+
+inline const GSP::FB::MeshHitsData *GetSizePrefixedMeshHitsData(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<GSP::FB::MeshHitsData>(buf);
+}
+
+inline bool VerifyMeshHitsDataBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<GSP::FB::MeshHitsData>(nullptr);
+}
+
+inline bool VerifySizePrefixedMeshHitsDataBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<GSP::FB::MeshHitsData>(nullptr);
+}
+
+inline void FinishMeshHitsDataBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::MeshHitsData> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedMeshHitsDataBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::MeshHitsData> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace FB
+}  // namespace GSP
+
+#endif  // FLATBUFFERS_GENERATED_MESHQUERY_GSP_FB_H_
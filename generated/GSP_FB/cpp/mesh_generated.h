@@ -18,15 +18,308 @@ static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
 namespace GSP {
 namespace FB {
 
+struct CompressedFaces;
+struct CompressedFacesBuilder;
+
+struct MeshAttribute;
+struct MeshAttributeBuilder;
+
 struct MeshData;
 struct MeshDataBuilder;
 
+enum class IndexEncoding : uint8_t {
+  U16 = 0,
+  U32 = 1,
+  DeltaVarint = 2,
+  MIN = U16,
+  MAX = DeltaVarint
+};
+
+inline const IndexEncoding (&EnumValuesIndexEncoding())[3] {
+  static const IndexEncoding values[] = {
+    IndexEncoding::U16,
+    IndexEncoding::U32,
+    IndexEncoding::DeltaVarint
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesIndexEncoding() {
+  static const char * const names[4] = {
+    "U16",
+    "U32",
+    "DeltaVarint",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameIndexEncoding(IndexEncoding e) {
+  if (::flatbuffers::IsOutRange(e, IndexEncoding::U16, IndexEncoding::DeltaVarint)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesIndexEncoding()[index];
+}
+
+enum class AttributeDomain : uint8_t {
+  Vertex = 0,
+  Face = 1,
+  MIN = Vertex,
+  MAX = Face
+};
+
+inline const AttributeDomain (&EnumValuesAttributeDomain())[2] {
+  static const AttributeDomain values[] = {
+    AttributeDomain::Vertex,
+    AttributeDomain::Face
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesAttributeDomain() {
+  static const char * const names[3] = {
+    "Vertex",
+    "Face",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameAttributeDomain(AttributeDomain e) {
+  if (::flatbuffers::IsOutRange(e, AttributeDomain::Vertex, AttributeDomain::Face)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesAttributeDomain()[index];
+}
+
+struct CompressedFaces FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef CompressedFacesBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ENCODING = 4,
+    VT_FACE_VERTEX_COUNT = 6,
+    VT_FACE_COUNT = 8,
+    VT_DATA = 10
+  };
+  GSP::FB::IndexEncoding encoding() const {
+    return static_cast<GSP::FB::IndexEncoding>(GetField<uint8_t>(VT_ENCODING, 0));
+  }
+  uint8_t face_vertex_count() const {
+    return GetField<uint8_t>(VT_FACE_VERTEX_COUNT, 3);
+  }
+  uint32_t face_count() const {
+    return GetField<uint32_t>(VT_FACE_COUNT, 0);
+  }
+  const ::flatbuffers::Vector<uint8_t> *data() const {
+    return GetPointer<const ::flatbuffers::Vector<uint8_t> *>(VT_DATA);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_ENCODING, 1) &&
+           VerifyField<uint8_t>(verifier, VT_FACE_VERTEX_COUNT, 1) &&
+           VerifyField<uint32_t>(verifier, VT_FACE_COUNT, 4) &&
+           VerifyOffset(verifier, VT_DATA) &&
+           verifier.VerifyVector(data()) &&
+           verifier.EndTable();
+  }
+};
+
+struct CompressedFacesBuilder {
+  typedef CompressedFaces Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_encoding(GSP::FB::IndexEncoding encoding) {
+    fbb_.AddElement<uint8_t>(CompressedFaces::VT_ENCODING, static_cast<uint8_t>(encoding), 0);
+  }
+  void add_face_vertex_count(uint8_t face_vertex_count) {
+    fbb_.AddElement<uint8_t>(CompressedFaces::VT_FACE_VERTEX_COUNT, face_vertex_count, 3);
+  }
+  void add_face_count(uint32_t face_count) {
+    fbb_.AddElement<uint32_t>(CompressedFaces::VT_FACE_COUNT, face_count, 0);
+  }
+  void add_data(::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> data) {
+    fbb_.AddOffset(CompressedFaces::VT_DATA, data);
+  }
+  explicit CompressedFacesBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<CompressedFaces> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<CompressedFaces>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<CompressedFaces> CreateCompressedFaces(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    GSP::FB::IndexEncoding encoding = GSP::FB::IndexEncoding::U16,
+    uint8_t face_vertex_count = 3,
+    uint32_t face_count = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> data = 0) {
+  CompressedFacesBuilder builder_(_fbb);
+  builder_.add_data(data);
+  builder_.add_face_count(face_count);
+  builder_.add_face_vertex_count(face_vertex_count);
+  builder_.add_encoding(encoding);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<CompressedFaces> CreateCompressedFacesDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    GSP::FB::IndexEncoding encoding = GSP::FB::IndexEncoding::U16,
+    uint8_t face_vertex_count = 3,
+    uint32_t face_count = 0,
+    const std::vector<uint8_t> *data = nullptr) {
+  auto data__ = data ? _fbb.CreateVector<uint8_t>(*data) : 0;
+  return GSP::FB::CreateCompressedFaces(
+      _fbb,
+      encoding,
+      face_vertex_count,
+      face_count,
+      data__);
+}
+
+struct MeshAttribute FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef MeshAttributeBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_DOMAIN = 6,
+    VT_DIMENSION = 8,
+    VT_F32 = 10,
+    VT_F64 = 12,
+    VT_I32 = 14,
+    VT_U8 = 16
+  };
+  const ::flatbuffers::String *name() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_NAME);
+  }
+  GSP::FB::AttributeDomain domain() const {
+    return static_cast<GSP::FB::AttributeDomain>(GetField<uint8_t>(VT_DOMAIN, 0));
+  }
+  uint8_t dimension() const {
+    return GetField<uint8_t>(VT_DIMENSION, 1);
+  }
+  const ::flatbuffers::Vector<float> *f32() const {
+    return GetPointer<const ::flatbuffers::Vector<float> *>(VT_F32);
+  }
+  const ::flatbuffers::Vector<double> *f64() const {
+    return GetPointer<const ::flatbuffers::Vector<double> *>(VT_F64);
+  }
+  const ::flatbuffers::Vector<int32_t> *i32() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_I32);
+  }
+  const ::flatbuffers::Vector<uint8_t> *u8() const {
+    return GetPointer<const ::flatbuffers::Vector<uint8_t> *>(VT_U8);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyField<uint8_t>(verifier, VT_DOMAIN, 1) &&
+           VerifyField<uint8_t>(verifier, VT_DIMENSION, 1) &&
+           VerifyOffset(verifier, VT_F32) &&
+           verifier.VerifyVector(f32()) &&
+           VerifyOffset(verifier, VT_F64) &&
+           verifier.VerifyVector(f64()) &&
+           VerifyOffset(verifier, VT_I32) &&
+           verifier.VerifyVector(i32()) &&
+           VerifyOffset(verifier, VT_U8) &&
+           verifier.VerifyVector(u8()) &&
+           verifier.EndTable();
+  }
+};
+
+struct MeshAttributeBuilder {
+  typedef MeshAttribute Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_name(::flatbuffers::Offset<::flatbuffers::String> name) {
+    fbb_.AddOffset(MeshAttribute::VT_NAME, name);
+  }
+  void add_domain(GSP::FB::AttributeDomain domain) {
+    fbb_.AddElement<uint8_t>(MeshAttribute::VT_DOMAIN, static_cast<uint8_t>(domain), 0);
+  }
+  void add_dimension(uint8_t dimension) {
+    fbb_.AddElement<uint8_t>(MeshAttribute::VT_DIMENSION, dimension, 1);
+  }
+  void add_f32(::flatbuffers::Offset<::flatbuffers::Vector<float>> f32) {
+    fbb_.AddOffset(MeshAttribute::VT_F32, f32);
+  }
+  void add_f64(::flatbuffers::Offset<::flatbuffers::Vector<double>> f64) {
+    fbb_.AddOffset(MeshAttribute::VT_F64, f64);
+  }
+  void add_i32(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> i32) {
+    fbb_.AddOffset(MeshAttribute::VT_I32, i32);
+  }
+  void add_u8(::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> u8) {
+    fbb_.AddOffset(MeshAttribute::VT_U8, u8);
+  }
+  explicit MeshAttributeBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<MeshAttribute> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<MeshAttribute>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<MeshAttribute> CreateMeshAttribute(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> name = 0,
+    GSP::FB::AttributeDomain domain = GSP::FB::AttributeDomain::Vertex,
+    uint8_t dimension = 1,
+    ::flatbuffers::Offset<::flatbuffers::Vector<float>> f32 = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<double>> f64 = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> i32 = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> u8 = 0) {
+  MeshAttributeBuilder builder_(_fbb);
+  builder_.add_u8(u8);
+  builder_.add_i32(i32);
+  builder_.add_f64(f64);
+  builder_.add_f32(f32);
+  builder_.add_name(name);
+  builder_.add_dimension(dimension);
+  builder_.add_domain(domain);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<MeshAttribute> CreateMeshAttributeDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    GSP::FB::AttributeDomain domain = GSP::FB::AttributeDomain::Vertex,
+    uint8_t dimension = 1,
+    const std::vector<float> *f32 = nullptr,
+    const std::vector<double> *f64 = nullptr,
+    const std::vector<int32_t> *i32 = nullptr,
+    const std::vector<uint8_t> *u8 = nullptr) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  auto f32__ = f32 ? _fbb.CreateVector<float>(*f32) : 0;
+  auto f64__ = f64 ? _fbb.CreateVector<double>(*f64) : 0;
+  auto i32__ = i32 ? _fbb.CreateVector<int32_t>(*i32) : 0;
+  auto u8__ = u8 ? _fbb.CreateVector<uint8_t>(*u8) : 0;
+  return GSP::FB::CreateMeshAttribute(
+      _fbb,
+      name__,
+      domain,
+      dimension,
+      f32__,
+      f64__,
+      i32__,
+      u8__);
+}
+
 struct MeshData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   typedef MeshDataBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
     VT_VERTICES = 4,
     VT_FACES = 6,
-    VT_QUAD_FACES = 8
+    VT_QUAD_FACES = 8,
+    VT_VERTICES_F = 10,
+    VT_VERTICES_Q = 12,
+    VT_FACES_C = 14,
+    VT_FACE_OFFSETS = 16,
+    VT_FACE_INDICES = 18,
+    VT_ATTRIBUTES = 20
   };
   const ::flatbuffers::Vector<const GSP::FB::Vec3 *> *vertices() const {
     return GetPointer<const ::flatbuffers::Vector<const GSP::FB::Vec3 *> *>(VT_VERTICES);
@@ -37,6 +330,24 @@ struct MeshData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   const ::flatbuffers::Vector<const GSP::FB::Vec4i *> *quad_faces() const {
     return GetPointer<const ::flatbuffers::Vector<const GSP::FB::Vec4i *> *>(VT_QUAD_FACES);
   }
+  const ::flatbuffers::Vector<const GSP::FB::Vec3f *> *vertices_f() const {
+    return GetPointer<const ::flatbuffers::Vector<const GSP::FB::Vec3f *> *>(VT_VERTICES_F);
+  }
+  const GSP::FB::QuantizedPositions *vertices_q() const {
+    return GetPointer<const GSP::FB::QuantizedPositions *>(VT_VERTICES_Q);
+  }
+  const GSP::FB::CompressedFaces *faces_c() const {
+    return GetPointer<const GSP::FB::CompressedFaces *>(VT_FACES_C);
+  }
+  const ::flatbuffers::Vector<int32_t> *face_offsets() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_FACE_OFFSETS);
+  }
+  const ::flatbuffers::Vector<int32_t> *face_indices() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_FACE_INDICES);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::MeshAttribute>> *attributes() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::MeshAttribute>> *>(VT_ATTRIBUTES);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_VERTICES) &&
@@ -45,6 +356,19 @@ struct MeshData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            verifier.VerifyVector(faces()) &&
            VerifyOffset(verifier, VT_QUAD_FACES) &&
            verifier.VerifyVector(quad_faces()) &&
+           VerifyOffset(verifier, VT_VERTICES_F) &&
+           verifier.VerifyVector(vertices_f()) &&
+           VerifyOffset(verifier, VT_VERTICES_Q) &&
+           verifier.VerifyTable(vertices_q()) &&
+           VerifyOffset(verifier, VT_FACES_C) &&
+           verifier.VerifyTable(faces_c()) &&
+           VerifyOffset(verifier, VT_FACE_OFFSETS) &&
+           verifier.VerifyVector(face_offsets()) &&
+           VerifyOffset(verifier, VT_FACE_INDICES) &&
+           verifier.VerifyVector(face_indices()) &&
+           VerifyOffset(verifier, VT_ATTRIBUTES) &&
+           verifier.VerifyVector(attributes()) &&
+           verifier.VerifyVectorOfTables(attributes()) &&
            verifier.EndTable();
   }
 };
@@ -62,6 +386,24 @@ struct MeshDataBuilder {
   void add_quad_faces(::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec4i *>> quad_faces) {
     fbb_.AddOffset(MeshData::VT_QUAD_FACES, quad_faces);
   }
+  void add_vertices_f(::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3f *>> vertices_f) {
+    fbb_.AddOffset(MeshData::VT_VERTICES_F, vertices_f);
+  }
+  void add_vertices_q(::flatbuffers::Offset<GSP::FB::QuantizedPositions> vertices_q) {
+    fbb_.AddOffset(MeshData::VT_VERTICES_Q, vertices_q);
+  }
+  void add_faces_c(::flatbuffers::Offset<GSP::FB::CompressedFaces> faces_c) {
+    fbb_.AddOffset(MeshData::VT_FACES_C, faces_c);
+  }
+  void add_face_offsets(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> face_offsets) {
+    fbb_.AddOffset(MeshData::VT_FACE_OFFSETS, face_offsets);
+  }
+  void add_face_indices(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> face_indices) {
+    fbb_.AddOffset(MeshData::VT_FACE_INDICES, face_indices);
+  }
+  void add_attributes(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::MeshAttribute>>> attributes) {
+    fbb_.AddOffset(MeshData::VT_ATTRIBUTES, attributes);
+  }
   explicit MeshDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -77,8 +419,20 @@ inline ::flatbuffers::Offset<MeshData> CreateMeshData(
     ::flatbuffers::FlatBufferBuilder &_fbb,
     ::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3 *>> vertices = 0,
     ::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3i *>> faces = 0,
-    ::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec4i *>> quad_faces = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec4i *>> quad_faces = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3f *>> vertices_f = 0,
+    ::flatbuffers::Offset<GSP::FB::QuantizedPositions> vertices_q = 0,
+    ::flatbuffers::Offset<GSP::FB::CompressedFaces> faces_c = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> face_offsets = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> face_indices = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::MeshAttribute>>> attributes = 0) {
   MeshDataBuilder builder_(_fbb);
+  builder_.add_attributes(attributes);
+  builder_.add_face_indices(face_indices);
+  builder_.add_face_offsets(face_offsets);
+  builder_.add_faces_c(faces_c);
+  builder_.add_vertices_q(vertices_q);
+  builder_.add_vertices_f(vertices_f);
   builder_.add_quad_faces(quad_faces);
   builder_.add_faces(faces);
   builder_.add_vertices(vertices);
@@ -89,15 +443,31 @@ inline ::flatbuffers::Offset<MeshData> CreateMeshDataDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
     const std::vector<GSP::FB::Vec3> *vertices = nullptr,
     const std::vector<GSP::FB::Vec3i> *faces = nullptr,
-    const std::vector<GSP::FB::Vec4i> *quad_faces = nullptr) {
+    const std::vector<GSP::FB::Vec4i> *quad_faces = nullptr,
+    const std::vector<GSP::FB::Vec3f> *vertices_f = nullptr,
+    ::flatbuffers::Offset<GSP::FB::QuantizedPositions> vertices_q = 0,
+    ::flatbuffers::Offset<GSP::FB::CompressedFaces> faces_c = 0,
+    const std::vector<int32_t> *face_offsets = nullptr,
+    const std::vector<int32_t> *face_indices = nullptr,
+    const std::vector<::flatbuffers::Offset<GSP::FB::MeshAttribute>> *attributes = nullptr) {
   auto vertices__ = vertices ? _fbb.CreateVectorOfStructs<GSP::FB::Vec3>(*vertices) : 0;
   auto faces__ = faces ? _fbb.CreateVectorOfStructs<GSP::FB::Vec3i>(*faces) : 0;
   auto quad_faces__ = quad_faces ? _fbb.CreateVectorOfStructs<GSP::FB::Vec4i>(*quad_faces) : 0;
+  auto vertices_f__ = vertices_f ? _fbb.CreateVectorOfStructs<GSP::FB::Vec3f>(*vertices_f) : 0;
+  auto face_offsets__ = face_offsets ? _fbb.CreateVector<int32_t>(*face_offsets) : 0;
+  auto face_indices__ = face_indices ? _fbb.CreateVector<int32_t>(*face_indices) : 0;
+  auto attributes__ = attributes ? _fbb.CreateVector<::flatbuffers::Offset<GSP::FB::MeshAttribute>>(*attributes) : 0;
   return GSP::FB::CreateMeshData(
       _fbb,
       vertices__,
       faces__,
-      quad_faces__);
+      quad_faces__,
+      vertices_f__,
+      vertices_q,
+      faces_c,
+      face_offsets__,
+      face_indices__,
+      attributes__);
 }
 
 inline const GSP::FB::MeshData *GetMeshData(const void *buf) {
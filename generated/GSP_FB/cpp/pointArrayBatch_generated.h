@@ -0,0 +1,109 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_POINTARRAYBATCH_GSP_FB_H_
+#define FLATBUFFERS_GENERATED_POINTARRAYBATCH_GSP_FB_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 2 &&
+              FLATBUFFERS_VERSION_REVISION == 10,
+             "Non-compatible flatbuffers version included");
+
+#include "pointArray_generated.h"
+
+namespace GSP {
+namespace FB {
+
+struct PointArrayBatch;
+struct PointArrayBatchBuilder;
+
+struct PointArrayBatch FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef PointArrayBatchBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_POINT_ARRAYS = 4
+  };
+  const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::PointArrayData>> *point_arrays() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::PointArrayData>> *>(VT_POINT_ARRAYS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_POINT_ARRAYS) &&
+           verifier.VerifyVector(point_arrays()) &&
+           verifier.VerifyVectorOfTables(point_arrays()) &&
+           verifier.EndTable();
+  }
+};
+
+struct PointArrayBatchBuilder {
+  typedef PointArrayBatch Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_point_arrays(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::PointArrayData>>> point_arrays) {
+    fbb_.AddOffset(PointArrayBatch::VT_POINT_ARRAYS, point_arrays);
+  }
+  explicit PointArrayBatchBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<PointArrayBatch> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<PointArrayBatch>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<PointArrayBatch> CreatePointArrayBatch(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::PointArrayData>>> point_arrays = 0) {
+  PointArrayBatchBuilder builder_(_fbb);
+  builder_.add_point_arrays(point_arrays);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<PointArrayBatch> CreatePointArrayBatchDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<::flatbuffers::Offset<GSP::FB::PointArrayData>> *point_arrays = nullptr) {
+  auto point_arrays__ = point_arrays ? _fbb.CreateVector<::flatbuffers::Offset<GSP::FB::PointArrayData>>(*point_arrays) : 0;
+  return GSP::FB::CreatePointArrayBatch(
+      _fbb,
+      point_arrays__);
+}
+
+inline const GSP::FB::PointArrayBatch *GetPointArrayBatch(const void *buf) {
+  return ::flatbuffers::GetRoot<GSP::FB::PointArrayBatch>(buf);
+}
+
+inline const GSP::FB::PointArrayBatch *GetSizePrefixedPointArrayBatch(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<GSP::FB::PointArrayBatch>(buf);
+}
+
+inline bool VerifyPointArrayBatchBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<GSP::FB::PointArrayBatch>(nullptr);
+}
+
+inline bool VerifySizePrefixedPointArrayBatchBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<GSP::FB::PointArrayBatch>(nullptr);
+}
+
+inline void FinishPointArrayBatchBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::PointArrayBatch> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedPointArrayBatchBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::PointArrayBatch> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace FB
+}  // namespace GSP
+
+#endif  // FLATBUFFERS_GENERATED_POINTARRAYBATCH_GSP_FB_H_
@@ -24,15 +24,27 @@ struct PointArrayDataBuilder;
 struct PointArrayData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   typedef PointArrayDataBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_POINTS = 4
+    VT_POINTS = 4,
+    VT_POINTS_F = 6,
+    VT_POINTS_Q = 8
   };
   const ::flatbuffers::Vector<const GSP::FB::Vec3 *> *points() const {
     return GetPointer<const ::flatbuffers::Vector<const GSP::FB::Vec3 *> *>(VT_POINTS);
   }
+  const ::flatbuffers::Vector<const GSP::FB::Vec3f *> *points_f() const {
+    return GetPointer<const ::flatbuffers::Vector<const GSP::FB::Vec3f *> *>(VT_POINTS_F);
+  }
+  const GSP::FB::QuantizedPositions *points_q() const {
+    return GetPointer<const GSP::FB::QuantizedPositions *>(VT_POINTS_Q);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_POINTS) &&
            verifier.VerifyVector(points()) &&
+           VerifyOffset(verifier, VT_POINTS_F) &&
+           verifier.VerifyVector(points_f()) &&
+           VerifyOffset(verifier, VT_POINTS_Q) &&
+           verifier.VerifyTable(points_q()) &&
            verifier.EndTable();
   }
 };
@@ -44,6 +56,12 @@ struct PointArrayDataBuilder {
   void add_points(::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3 *>> points) {
     fbb_.AddOffset(PointArrayData::VT_POINTS, points);
   }
+  void add_points_f(::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3f *>> points_f) {
+    fbb_.AddOffset(PointArrayData::VT_POINTS_F, points_f);
+  }
+  void add_points_q(::flatbuffers::Offset<GSP::FB::QuantizedPositions> points_q) {
+    fbb_.AddOffset(PointArrayData::VT_POINTS_Q, points_q);
+  }
   explicit PointArrayDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -57,19 +75,28 @@ struct PointArrayDataBuilder {
 
 inline ::flatbuffers::Offset<PointArrayData> CreatePointArrayData(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    ::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3 *>> points = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3 *>> points = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3f *>> points_f = 0,
+    ::flatbuffers::Offset<GSP::FB::QuantizedPositions> points_q = 0) {
   PointArrayDataBuilder builder_(_fbb);
+  builder_.add_points_q(points_q);
+  builder_.add_points_f(points_f);
   builder_.add_points(points);
   return builder_.Finish();
 }
 
 inline ::flatbuffers::Offset<PointArrayData> CreatePointArrayDataDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    const std::vector<GSP::FB::Vec3> *points = nullptr) {
+    const std::vector<GSP::FB::Vec3> *points = nullptr,
+    const std::vector<GSP::FB::Vec3f> *points_f = nullptr,
+    ::flatbuffers::Offset<GSP::FB::QuantizedPositions> points_q = 0) {
   auto points__ = points ? _fbb.CreateVectorOfStructs<GSP::FB::Vec3>(*points) : 0;
+  auto points_f__ = points_f ? _fbb.CreateVectorOfStructs<GSP::FB::Vec3f>(*points_f) : 0;
   return GSP::FB::CreatePointArrayData(
       _fbb,
-      points__);
+      points__,
+      points_f__,
+      points_q);
 }
 
 inline const GSP::FB::PointArrayData *GetPointArrayData(const void *buf) {
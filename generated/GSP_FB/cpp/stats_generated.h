@@ -0,0 +1,404 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_STATS_GSP_FB_H_
+#define FLATBUFFERS_GENERATED_STATS_GSP_FB_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 2 &&
+              FLATBUFFERS_VERSION_REVISION == 10,
+             "Non-compatible flatbuffers version included");
+
+namespace GSP {
+namespace FB {
+
+struct PhaseStats;
+struct PhaseStatsBuilder;
+
+struct ExportStats;
+struct ExportStatsBuilder;
+
+struct StatsData;
+struct StatsDataBuilder;
+
+enum class StatsPhase : uint8_t {
+  Call = 0,
+  Deserialize = 1,
+  Verify = 2,
+  Compute = 3,
+  Serialize = 4,
+  Allocate = 5,
+  MIN = Call,
+  MAX = Allocate
+};
+
+inline const StatsPhase (&EnumValuesStatsPhase())[6] {
+  static const StatsPhase values[] = {
+    StatsPhase::Call,
+    StatsPhase::Deserialize,
+    StatsPhase::Verify,
+    StatsPhase::Compute,
+    StatsPhase::Serialize,
+    StatsPhase::Allocate
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesStatsPhase() {
+  static const char * const names[7] = {
+    "Call",
+    "Deserialize",
+    "Verify",
+    "Compute",
+    "Serialize",
+    "Allocate",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameStatsPhase(StatsPhase e) {
+  if (::flatbuffers::IsOutRange(e, StatsPhase::Call, StatsPhase::Allocate)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesStatsPhase()[index];
+}
+
+struct PhaseStats FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef PhaseStatsBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_PHASE = 4,
+    VT_COUNT = 6,
+    VT_TOTAL_NS = 8,
+    VT_MAX_NS = 10,
+    VT_P50_NS = 12,
+    VT_P90_NS = 14,
+    VT_P99_NS = 16,
+    VT_BUCKETS = 18
+  };
+  GSP::FB::StatsPhase phase() const {
+    return static_cast<GSP::FB::StatsPhase>(GetField<uint8_t>(VT_PHASE, 0));
+  }
+  uint64_t count() const {
+    return GetField<uint64_t>(VT_COUNT, 0);
+  }
+  uint64_t total_ns() const {
+    return GetField<uint64_t>(VT_TOTAL_NS, 0);
+  }
+  uint64_t max_ns() const {
+    return GetField<uint64_t>(VT_MAX_NS, 0);
+  }
+  uint64_t p50_ns() const {
+    return GetField<uint64_t>(VT_P50_NS, 0);
+  }
+  uint64_t p90_ns() const {
+    return GetField<uint64_t>(VT_P90_NS, 0);
+  }
+  uint64_t p99_ns() const {
+    return GetField<uint64_t>(VT_P99_NS, 0);
+  }
+  const ::flatbuffers::Vector<uint64_t> *buckets() const {
+    return GetPointer<const ::flatbuffers::Vector<uint64_t> *>(VT_BUCKETS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_PHASE, 1) &&
+           VerifyField<uint64_t>(verifier, VT_COUNT, 8) &&
+           VerifyField<uint64_t>(verifier, VT_TOTAL_NS, 8) &&
+           VerifyField<uint64_t>(verifier, VT_MAX_NS, 8) &&
+           VerifyField<uint64_t>(verifier, VT_P50_NS, 8) &&
+           VerifyField<uint64_t>(verifier, VT_P90_NS, 8) &&
+           VerifyField<uint64_t>(verifier, VT_P99_NS, 8) &&
+           VerifyOffset(verifier, VT_BUCKETS) &&
+           verifier.VerifyVector(buckets()) &&
+           verifier.EndTable();
+  }
+};
+
+struct PhaseStatsBuilder {
+  typedef PhaseStats Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_phase(GSP::FB::StatsPhase phase) {
+    fbb_.AddElement<uint8_t>(PhaseStats::VT_PHASE, static_cast<uint8_t>(phase), 0);
+  }
+  void add_count(uint64_t count) {
+    fbb_.AddElement<uint64_t>(PhaseStats::VT_COUNT, count, 0);
+  }
+  void add_total_ns(uint64_t total_ns) {
+    fbb_.AddElement<uint64_t>(PhaseStats::VT_TOTAL_NS, total_ns, 0);
+  }
+  void add_max_ns(uint64_t max_ns) {
+    fbb_.AddElement<uint64_t>(PhaseStats::VT_MAX_NS, max_ns, 0);
+  }
+  void add_p50_ns(uint64_t p50_ns) {
+    fbb_.AddElement<uint64_t>(PhaseStats::VT_P50_NS, p50_ns, 0);
+  }
+  void add_p90_ns(uint64_t p90_ns) {
+    fbb_.AddElement<uint64_t>(PhaseStats::VT_P90_NS, p90_ns, 0);
+  }
+  void add_p99_ns(uint64_t p99_ns) {
+    fbb_.AddElement<uint64_t>(PhaseStats::VT_P99_NS, p99_ns, 0);
+  }
+  void add_buckets(::flatbuffers::Offset<::flatbuffers::Vector<uint64_t>> buckets) {
+    fbb_.AddOffset(PhaseStats::VT_BUCKETS, buckets);
+  }
+  explicit PhaseStatsBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<PhaseStats> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<PhaseStats>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<PhaseStats> CreatePhaseStats(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    GSP::FB::StatsPhase phase = GSP::FB::StatsPhase::Call,
+    uint64_t count = 0,
+    uint64_t total_ns = 0,
+    uint64_t max_ns = 0,
+    uint64_t p50_ns = 0,
+    uint64_t p90_ns = 0,
+    uint64_t p99_ns = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint64_t>> buckets = 0) {
+  PhaseStatsBuilder builder_(_fbb);
+  builder_.add_p99_ns(p99_ns);
+  builder_.add_p90_ns(p90_ns);
+  builder_.add_p50_ns(p50_ns);
+  builder_.add_max_ns(max_ns);
+  builder_.add_total_ns(total_ns);
+  builder_.add_count(count);
+  builder_.add_buckets(buckets);
+  builder_.add_phase(phase);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<PhaseStats> CreatePhaseStatsDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    GSP::FB::StatsPhase phase = GSP::FB::StatsPhase::Call,
+    uint64_t count = 0,
+    uint64_t total_ns = 0,
+    uint64_t max_ns = 0,
+    uint64_t p50_ns = 0,
+    uint64_t p90_ns = 0,
+    uint64_t p99_ns = 0,
+    const std::vector<uint64_t> *buckets = nullptr) {
+  auto buckets__ = buckets ? _fbb.CreateVector<uint64_t>(*buckets) : 0;
+  return GSP::FB::CreatePhaseStats(
+      _fbb,
+      phase,
+      count,
+      total_ns,
+      max_ns,
+      p50_ns,
+      p90_ns,
+      p99_ns,
+      buckets__);
+}
+
+struct ExportStats FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef ExportStatsBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_CALLS = 6,
+    VT_BYTES_IN = 8,
+    VT_BYTES_OUT = 10,
+    VT_PHASES = 12
+  };
+  const ::flatbuffers::String *name() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_NAME);
+  }
+  uint64_t calls() const {
+    return GetField<uint64_t>(VT_CALLS, 0);
+  }
+  uint64_t bytes_in() const {
+    return GetField<uint64_t>(VT_BYTES_IN, 0);
+  }
+  uint64_t bytes_out() const {
+    return GetField<uint64_t>(VT_BYTES_OUT, 0);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::PhaseStats>> *phases() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::PhaseStats>> *>(VT_PHASES);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyField<uint64_t>(verifier, VT_CALLS, 8) &&
+           VerifyField<uint64_t>(verifier, VT_BYTES_IN, 8) &&
+           VerifyField<uint64_t>(verifier, VT_BYTES_OUT, 8) &&
+           VerifyOffset(verifier, VT_PHASES) &&
+           verifier.VerifyVector(phases()) &&
+           verifier.VerifyVectorOfTables(phases()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ExportStatsBuilder {
+  typedef ExportStats Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_name(::flatbuffers::Offset<::flatbuffers::String> name) {
+    fbb_.AddOffset(ExportStats::VT_NAME, name);
+  }
+  void add_calls(uint64_t calls) {
+    fbb_.AddElement<uint64_t>(ExportStats::VT_CALLS, calls, 0);
+  }
+  void add_bytes_in(uint64_t bytes_in) {
+    fbb_.AddElement<uint64_t>(ExportStats::VT_BYTES_IN, bytes_in, 0);
+  }
+  void add_bytes_out(uint64_t bytes_out) {
+    fbb_.AddElement<uint64_t>(ExportStats::VT_BYTES_OUT, bytes_out, 0);
+  }
+  void add_phases(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::PhaseStats>>> phases) {
+    fbb_.AddOffset(ExportStats::VT_PHASES, phases);
+  }
+  explicit ExportStatsBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<ExportStats> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<ExportStats>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<ExportStats> CreateExportStats(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> name = 0,
+    uint64_t calls = 0,
+    uint64_t bytes_in = 0,
+    uint64_t bytes_out = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::PhaseStats>>> phases = 0) {
+  ExportStatsBuilder builder_(_fbb);
+  builder_.add_bytes_out(bytes_out);
+  builder_.add_bytes_in(bytes_in);
+  builder_.add_calls(calls);
+  builder_.add_phases(phases);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<ExportStats> CreateExportStatsDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    uint64_t calls = 0,
+    uint64_t bytes_in = 0,
+    uint64_t bytes_out = 0,
+    const std::vector<::flatbuffers::Offset<GSP::FB::PhaseStats>> *phases = nullptr) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  auto phases__ = phases ? _fbb.CreateVector<::flatbuffers::Offset<GSP::FB::PhaseStats>>(*phases) : 0;
+  return GSP::FB::CreateExportStats(
+      _fbb,
+      name__,
+      calls,
+      bytes_in,
+      bytes_out,
+      phases__);
+}
+
+struct StatsData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef StatsDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ENABLED = 4,
+    VT_EXPORTS = 6
+  };
+  bool enabled() const {
+    return GetField<uint8_t>(VT_ENABLED, 0) != 0;
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::ExportStats>> *exports() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::ExportStats>> *>(VT_EXPORTS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_ENABLED, 1) &&
+           VerifyOffset(verifier, VT_EXPORTS) &&
+           verifier.VerifyVector(exports()) &&
+           verifier.VerifyVectorOfTables(exports()) &&
+           verifier.EndTable();
+  }
+};
+
+struct StatsDataBuilder {
+  typedef StatsData Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_enabled(bool enabled) {
+    fbb_.AddElement<uint8_t>(StatsData::VT_ENABLED, static_cast<uint8_t>(enabled), 0);
+  }
+  void add_exports(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::ExportStats>>> exports) {
+    fbb_.AddOffset(StatsData::VT_EXPORTS, exports);
+  }
+  explicit StatsDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<StatsData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<StatsData>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<StatsData> CreateStatsData(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    bool enabled = false,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::ExportStats>>> exports = 0) {
+  StatsDataBuilder builder_(_fbb);
+  builder_.add_exports(exports);
+  builder_.add_enabled(enabled);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<StatsData> CreateStatsDataDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    bool enabled = false,
+    const std::vector<::flatbuffers::Offset<GSP::FB::ExportStats>> *exports = nullptr) {
+  auto exports__ = exports ? _fbb.CreateVector<::flatbuffers::Offset<GSP::FB::ExportStats>>(*exports) : 0;
+  return GSP::FB::CreateStatsData(
+      _fbb,
+      enabled,
+      exports__);
+}
+
+inline const GSP::FB::StatsData *GetStatsData(const void *buf) {
+  return ::flatbuffers::GetRoot<GSP::FB::StatsData>(buf);
+}
+
+inline const GSP::FB::StatsData *GetSizePrefixedStatsData(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<GSP::FB::StatsData>(buf);
+}
+
+inline bool VerifyStatsDataBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<GSP::FB::StatsData>(nullptr);
+}
+
+inline bool VerifySizePrefixedStatsDataBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<GSP::FB::StatsData>(nullptr);
+}
+
+inline void FinishStatsDataBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::StatsData> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedStatsDataBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::StatsData> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace FB
+}  // namespace GSP
+
+#endif  // FLATBUFFERS_GENERATED_STATS_GSP_FB_H_
@@ -0,0 +1,176 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_STREAM_GSP_FB_H_
+#define FLATBUFFERS_GENERATED_STREAM_GSP_FB_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 2 &&
+              FLATBUFFERS_VERSION_REVISION == 10,
+             "Non-compatible flatbuffers version included");
+
+namespace GSP {
+namespace FB {
+
+struct StreamHeader;
+struct StreamHeaderBuilder;
+
+enum class StreamPayload : uint8_t {
+  PointArray = 0,
+  Mesh = 1,
+  MIN = PointArray,
+  MAX = Mesh
+};
+
+inline const StreamPayload (&EnumValuesStreamPayload())[2] {
+  static const StreamPayload values[] = {
+    StreamPayload::PointArray,
+    StreamPayload::Mesh
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesStreamPayload() {
+  static const char * const names[3] = {
+    "PointArray",
+    "Mesh",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameStreamPayload(StreamPayload e) {
+  if (::flatbuffers::IsOutRange(e, StreamPayload::PointArray, StreamPayload::Mesh)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesStreamPayload()[index];
+}
+
+struct StreamHeader FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef StreamHeaderBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_PAYLOAD = 4,
+    VT_POINT_COUNT = 6,
+    VT_FACE_COUNT = 8,
+    VT_FACE_VERTEX_COUNT = 10,
+    VT_POINT_CHUNKS = 12,
+    VT_FACE_CHUNKS = 14
+  };
+  GSP::FB::StreamPayload payload() const {
+    return static_cast<GSP::FB::StreamPayload>(GetField<uint8_t>(VT_PAYLOAD, 0));
+  }
+  uint64_t point_count() const {
+    return GetField<uint64_t>(VT_POINT_COUNT, 0);
+  }
+  uint64_t face_count() const {
+    return GetField<uint64_t>(VT_FACE_COUNT, 0);
+  }
+  uint8_t face_vertex_count() const {
+    return GetField<uint8_t>(VT_FACE_VERTEX_COUNT, 3);
+  }
+  uint64_t point_chunks() const {
+    return GetField<uint64_t>(VT_POINT_CHUNKS, 0);
+  }
+  uint64_t face_chunks() const {
+    return GetField<uint64_t>(VT_FACE_CHUNKS, 0);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_PAYLOAD, 1) &&
+           VerifyField<uint64_t>(verifier, VT_POINT_COUNT, 8) &&
+           VerifyField<uint64_t>(verifier, VT_FACE_COUNT, 8) &&
+           VerifyField<uint8_t>(verifier, VT_FACE_VERTEX_COUNT, 1) &&
+           VerifyField<uint64_t>(verifier, VT_POINT_CHUNKS, 8) &&
+           VerifyField<uint64_t>(verifier, VT_FACE_CHUNKS, 8) &&
+           verifier.EndTable();
+  }
+};
+
+struct StreamHeaderBuilder {
+  typedef StreamHeader Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_payload(GSP::FB::StreamPayload payload) {
+    fbb_.AddElement<uint8_t>(StreamHeader::VT_PAYLOAD, static_cast<uint8_t>(payload), 0);
+  }
+  void add_point_count(uint64_t point_count) {
+    fbb_.AddElement<uint64_t>(StreamHeader::VT_POINT_COUNT, point_count, 0);
+  }
+  void add_face_count(uint64_t face_count) {
+    fbb_.AddElement<uint64_t>(StreamHeader::VT_FACE_COUNT, face_count, 0);
+  }
+  void add_face_vertex_count(uint8_t face_vertex_count) {
+    fbb_.AddElement<uint8_t>(StreamHeader::VT_FACE_VERTEX_COUNT, face_vertex_count, 3);
+  }
+  void add_point_chunks(uint64_t point_chunks) {
+    fbb_.AddElement<uint64_t>(StreamHeader::VT_POINT_CHUNKS, point_chunks, 0);
+  }
+  void add_face_chunks(uint64_t face_chunks) {
+    fbb_.AddElement<uint64_t>(StreamHeader::VT_FACE_CHUNKS, face_chunks, 0);
+  }
+  explicit StreamHeaderBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<StreamHeader> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<StreamHeader>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<StreamHeader> CreateStreamHeader(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    GSP::FB::StreamPayload payload = GSP::FB::StreamPayload::PointArray,
+    uint64_t point_count = 0,
+    uint64_t face_count = 0,
+    uint8_t face_vertex_count = 3,
+    uint64_t point_chunks = 0,
+    uint64_t face_chunks = 0) {
+  StreamHeaderBuilder builder_(_fbb);
+  builder_.add_face_chunks(face_chunks);
+  builder_.add_point_chunks(point_chunks);
+  builder_.add_face_count(face_count);
+  builder_.add_point_count(point_count);
+  builder_.add_face_vertex_count(face_vertex_count);
+  builder_.add_payload(payload);
+  return builder_.Finish();
+}
+
+inline const GSP::FB::StreamHeader *GetStreamHeader(const void *buf) {
+  return ::flatbuffers::GetRoot<GSP::FB::StreamHeader>(buf);
+}
+
+inline const GSP::FB::StreamHeader *GetSizePrefixedStreamHeader(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<GSP::FB::StreamHeader>(buf);
+}
+
+inline bool VerifyStreamHeaderBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<GSP::FB::StreamHeader>(nullptr);
+}
+
+inline bool VerifySizePrefixedStreamHeaderBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<GSP::FB::StreamHeader>(nullptr);
+}
+
+inline void FinishStreamHeaderBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::StreamHeader> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedStreamHeaderBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::StreamHeader> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace FB
+}  // namespace GSP
+
+#endif  // FLATBUFFERS_GENERATED_STREAM_GSP_FB_H_
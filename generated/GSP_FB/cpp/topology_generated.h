@@ -0,0 +1,254 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_TOPOLOGY_GSP_FB_H_
+#define FLATBUFFERS_GENERATED_TOPOLOGY_GSP_FB_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 2 &&
+              FLATBUFFERS_VERSION_REVISION == 10,
+             "Non-compatible flatbuffers version included");
+
+#include "base_generated.h"
+
+namespace GSP {
+namespace FB {
+
+struct TopologyReport;
+struct TopologyReportBuilder;
+
+struct TopologyReport FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef TopologyReportBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_VERTEX_COUNT = 4,
+    VT_FACE_COUNT = 6,
+    VT_EDGE_COUNT = 8,
+    VT_BOUNDARY_EDGE_COUNT = 10,
+    VT_DEGENERATE_FACES = 12,
+    VT_DUPLICATE_FACES = 14,
+    VT_NON_MANIFOLD_EDGES = 16,
+    VT_NON_MANIFOLD_VERTICES = 18,
+    VT_UNREFERENCED_VERTICES = 20,
+    VT_INCONSISTENT_EDGES = 22,
+    VT_BOUNDARY_LOOP_VERTICES = 24,
+    VT_BOUNDARY_LOOP_SIZES = 26
+  };
+  int64_t vertex_count() const {
+    return GetField<int64_t>(VT_VERTEX_COUNT, 0);
+  }
+  int64_t face_count() const {
+    return GetField<int64_t>(VT_FACE_COUNT, 0);
+  }
+  int64_t edge_count() const {
+    return GetField<int64_t>(VT_EDGE_COUNT, 0);
+  }
+  int64_t boundary_edge_count() const {
+    return GetField<int64_t>(VT_BOUNDARY_EDGE_COUNT, 0);
+  }
+  const ::flatbuffers::Vector<int32_t> *degenerate_faces() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_DEGENERATE_FACES);
+  }
+  const ::flatbuffers::Vector<int32_t> *duplicate_faces() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_DUPLICATE_FACES);
+  }
+  const ::flatbuffers::Vector<const GSP::FB::Vec2i *> *non_manifold_edges() const {
+    return GetPointer<const ::flatbuffers::Vector<const GSP::FB::Vec2i *> *>(VT_NON_MANIFOLD_EDGES);
+  }
+  const ::flatbuffers::Vector<int32_t> *non_manifold_vertices() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_NON_MANIFOLD_VERTICES);
+  }
+  const ::flatbuffers::Vector<int32_t> *unreferenced_vertices() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_UNREFERENCED_VERTICES);
+  }
+  const ::flatbuffers::Vector<const GSP::FB::Vec2i *> *inconsistent_edges() const {
+    return GetPointer<const ::flatbuffers::Vector<const GSP::FB::Vec2i *> *>(VT_INCONSISTENT_EDGES);
+  }
+  const ::flatbuffers::Vector<int32_t> *boundary_loop_vertices() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_BOUNDARY_LOOP_VERTICES);
+  }
+  const ::flatbuffers::Vector<int32_t> *boundary_loop_sizes() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_BOUNDARY_LOOP_SIZES);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int64_t>(verifier, VT_VERTEX_COUNT, 8) &&
+           VerifyField<int64_t>(verifier, VT_FACE_COUNT, 8) &&
+           VerifyField<int64_t>(verifier, VT_EDGE_COUNT, 8) &&
+           VerifyField<int64_t>(verifier, VT_BOUNDARY_EDGE_COUNT, 8) &&
+           VerifyOffset(verifier, VT_DEGENERATE_FACES) &&
+           verifier.VerifyVector(degenerate_faces()) &&
+           VerifyOffset(verifier, VT_DUPLICATE_FACES) &&
+           verifier.VerifyVector(duplicate_faces()) &&
+           VerifyOffset(verifier, VT_NON_MANIFOLD_EDGES) &&
+           verifier.VerifyVector(non_manifold_edges()) &&
+           VerifyOffset(verifier, VT_NON_MANIFOLD_VERTICES) &&
+           verifier.VerifyVector(non_manifold_vertices()) &&
+           VerifyOffset(verifier, VT_UNREFERENCED_VERTICES) &&
+           verifier.VerifyVector(unreferenced_vertices()) &&
+           VerifyOffset(verifier, VT_INCONSISTENT_EDGES) &&
+           verifier.VerifyVector(inconsistent_edges()) &&
+           VerifyOffset(verifier, VT_BOUNDARY_LOOP_VERTICES) &&
+           verifier.VerifyVector(boundary_loop_vertices()) &&
+           VerifyOffset(verifier, VT_BOUNDARY_LOOP_SIZES) &&
+           verifier.VerifyVector(boundary_loop_sizes()) &&
+           verifier.EndTable();
+  }
+};
+
+struct TopologyReportBuilder {
+  typedef TopologyReport Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_vertex_count(int64_t vertex_count) {
+    fbb_.AddElement<int64_t>(TopologyReport::VT_VERTEX_COUNT, vertex_count, 0);
+  }
+  void add_face_count(int64_t face_count) {
+    fbb_.AddElement<int64_t>(TopologyReport::VT_FACE_COUNT, face_count, 0);
+  }
+  void add_edge_count(int64_t edge_count) {
+    fbb_.AddElement<int64_t>(TopologyReport::VT_EDGE_COUNT, edge_count, 0);
+  }
+  void add_boundary_edge_count(int64_t boundary_edge_count) {
+    fbb_.AddElement<int64_t>(TopologyReport::VT_BOUNDARY_EDGE_COUNT, boundary_edge_count, 0);
+  }
+  void add_degenerate_faces(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> degenerate_faces) {
+    fbb_.AddOffset(TopologyReport::VT_DEGENERATE_FACES, degenerate_faces);
+  }
+  void add_duplicate_faces(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> duplicate_faces) {
+    fbb_.AddOffset(TopologyReport::VT_DUPLICATE_FACES, duplicate_faces);
+  }
+  void add_non_manifold_edges(::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec2i *>> non_manifold_edges) {
+    fbb_.AddOffset(TopologyReport::VT_NON_MANIFOLD_EDGES, non_manifold_edges);
+  }
+  void add_non_manifold_vertices(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> non_manifold_vertices) {
+    fbb_.AddOffset(TopologyReport::VT_NON_MANIFOLD_VERTICES, non_manifold_vertices);
+  }
+  void add_unreferenced_vertices(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> unreferenced_vertices) {
+    fbb_.AddOffset(TopologyReport::VT_UNREFERENCED_VERTICES, unreferenced_vertices);
+  }
+  void add_inconsistent_edges(::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec2i *>> inconsistent_edges) {
+    fbb_.AddOffset(TopologyReport::VT_INCONSISTENT_EDGES, inconsistent_edges);
+  }
+  void add_boundary_loop_vertices(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> boundary_loop_vertices) {
+    fbb_.AddOffset(TopologyReport::VT_BOUNDARY_LOOP_VERTICES, boundary_loop_vertices);
+  }
+  void add_boundary_loop_sizes(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> boundary_loop_sizes) {
+    fbb_.AddOffset(TopologyReport::VT_BOUNDARY_LOOP_SIZES, boundary_loop_sizes);
+  }
+  explicit TopologyReportBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<TopologyReport> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<TopologyReport>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<TopologyReport> CreateTopologyReport(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    int64_t vertex_count = 0,
+    int64_t face_count = 0,
+    int64_t edge_count = 0,
+    int64_t boundary_edge_count = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> degenerate_faces = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> duplicate_faces = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec2i *>> non_manifold_edges = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> non_manifold_vertices = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> unreferenced_vertices = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec2i *>> inconsistent_edges = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> boundary_loop_vertices = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> boundary_loop_sizes = 0) {
+  TopologyReportBuilder builder_(_fbb);
+  builder_.add_boundary_edge_count(boundary_edge_count);
+  builder_.add_edge_count(edge_count);
+  builder_.add_face_count(face_count);
+  builder_.add_vertex_count(vertex_count);
+  builder_.add_boundary_loop_sizes(boundary_loop_sizes);
+  builder_.add_boundary_loop_vertices(boundary_loop_vertices);
+  builder_.add_inconsistent_edges(inconsistent_edges);
+  builder_.add_unreferenced_vertices(unreferenced_vertices);
+  builder_.add_non_manifold_vertices(non_manifold_vertices);
+  builder_.add_non_manifold_edges(non_manifold_edges);
+  builder_.add_duplicate_faces(duplicate_faces);
+  builder_.add_degenerate_faces(degenerate_faces);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<TopologyReport> CreateTopologyReportDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    int64_t vertex_count = 0,
+    int64_t face_count = 0,
+    int64_t edge_count = 0,
+    int64_t boundary_edge_count = 0,
+    const std::vector<int32_t> *degenerate_faces = nullptr,
+    const std::vector<int32_t> *duplicate_faces = nullptr,
+    const std::vector<GSP::FB::Vec2i> *non_manifold_edges = nullptr,
+    const std::vector<int32_t> *non_manifold_vertices = nullptr,
+    const std::vector<int32_t> *unreferenced_vertices = nullptr,
+    const std::vector<GSP::FB::Vec2i> *inconsistent_edges = nullptr,
+    const std::vector<int32_t> *boundary_loop_vertices = nullptr,
+    const std::vector<int32_t> *boundary_loop_sizes = nullptr) {
+  auto degenerate_faces__ = degenerate_faces ? _fbb.CreateVector<int32_t>(*degenerate_faces) : 0;
+  auto duplicate_faces__ = duplicate_faces ? _fbb.CreateVector<int32_t>(*duplicate_faces) : 0;
+  auto non_manifold_edges__ = non_manifold_edges ? _fbb.CreateVectorOfStructs<GSP::FB::Vec2i>(*non_manifold_edges) : 0;
+  auto non_manifold_vertices__ = non_manifold_vertices ? _fbb.CreateVector<int32_t>(*non_manifold_vertices) : 0;
+  auto unreferenced_vertices__ = unreferenced_vertices ? _fbb.CreateVector<int32_t>(*unreferenced_vertices) : 0;
+  auto inconsistent_edges__ = inconsistent_edges ? _fbb.CreateVectorOfStructs<GSP::FB::Vec2i>(*inconsistent_edges) : 0;
+  auto boundary_loop_vertices__ = boundary_loop_vertices ? _fbb.CreateVector<int32_t>(*boundary_loop_vertices) : 0;
+  auto boundary_loop_sizes__ = boundary_loop_sizes ? _fbb.CreateVector<int32_t>(*boundary_loop_sizes) : 0;
+  return GSP::FB::CreateTopologyReport(
+      _fbb,
+      vertex_count,
+      face_count,
+      edge_count,
+      boundary_edge_count,
+      degenerate_faces__,
+      duplicate_faces__,
+      non_manifold_edges__,
+      non_manifold_vertices__,
+      unreferenced_vertices__,
+      inconsistent_edges__,
+      boundary_loop_vertices__,
+      boundary_loop_sizes__);
+}
+
+inline const GSP::FB::TopologyReport *GetTopologyReport(const void *buf) {
+  return ::flatbuffers::GetRoot<GSP::FB::TopologyReport>(buf);
+}
+
+inline const GSP::FB::TopologyReport *GetSizePrefixedTopologyReport(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<GSP::FB::TopologyReport>(buf);
+}
+
+inline bool VerifyTopologyReportBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<GSP::FB::TopologyReport>(nullptr);
+}
+
+inline bool VerifySizePrefixedTopologyReportBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<GSP::FB::TopologyReport>(nullptr);
+}
+
+inline void FinishTopologyReportBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::TopologyReport> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedTopologyReportBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::TopologyReport> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace FB
+}  // namespace GSP
+
+#endif  // FLATBUFFERS_GENERATED_TOPOLOGY_GSP_FB_H_
@@ -258,5 +258,149 @@ public class Vec4iT
   }
 }
 
+public struct Vec3f : IFlatbufferObject
+{
+  private Struct __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Struct(_i, _bb); }
+  public Vec3f __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public float X { get { return __p.bb.GetFloat(__p.bb_pos + 0); } }
+  public float Y { get { return __p.bb.GetFloat(__p.bb_pos + 4); } }
+  public float Z { get { return __p.bb.GetFloat(__p.bb_pos + 8); } }
+
+  public static Offset<GSP.FB.Vec3f> CreateVec3f(FlatBufferBuilder builder, float X, float Y, float Z) {
+    builder.Prep(4, 12);
+    builder.PutFloat(Z);
+    builder.PutFloat(Y);
+    builder.PutFloat(X);
+    return new Offset<GSP.FB.Vec3f>(builder.Offset);
+  }
+  public Vec3fT UnPack() {
+    var _o = new Vec3fT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(Vec3fT _o) {
+    _o.X = this.X;
+    _o.Y = this.Y;
+    _o.Z = this.Z;
+  }
+  public static Offset<GSP.FB.Vec3f> Pack(FlatBufferBuilder builder, Vec3fT _o) {
+    if (_o == null) return default(Offset<GSP.FB.Vec3f>);
+    return CreateVec3f(
+      builder,
+      _o.X,
+      _o.Y,
+      _o.Z);
+  }
+}
+
+public class Vec3fT
+{
+  public float X { get; set; }
+  public float Y { get; set; }
+  public float Z { get; set; }
+
+  public Vec3fT() {
+    this.X = 0.0f;
+    this.Y = 0.0f;
+    this.Z = 0.0f;
+  }
+}
+
+public struct QuantizedPositions : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static QuantizedPositions GetRootAsQuantizedPositions(ByteBuffer _bb) { return GetRootAsQuantizedPositions(_bb, new QuantizedPositions()); }
+  public static QuantizedPositions GetRootAsQuantizedPositions(ByteBuffer _bb, QuantizedPositions obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyQuantizedPositions(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, QuantizedPositionsVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public QuantizedPositions __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public GSP.FB.Vec3? Min { get { int o = __p.__offset(4); return o != 0 ? (GSP.FB.Vec3?)(new GSP.FB.Vec3()).__assign(o + __p.bb_pos, __p.bb) : null; } }
+  public GSP.FB.Vec3? Max { get { int o = __p.__offset(6); return o != 0 ? (GSP.FB.Vec3?)(new GSP.FB.Vec3()).__assign(o + __p.bb_pos, __p.bb) : null; } }
+  public byte Bits { get { int o = __p.__offset(8); return o != 0 ? __p.bb.Get(o + __p.bb_pos) : (byte)16; } }
+  public ushort Values(int j) { int o = __p.__offset(10); return o != 0 ? __p.bb.GetUshort(__p.__vector(o) + j * 2) : (ushort)0; }
+  public int ValuesLength { get { int o = __p.__offset(10); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<ushort> GetValuesBytes() { return __p.__vector_as_span<ushort>(10, 2); }
+#else
+  public ArraySegment<byte>? GetValuesBytes() { return __p.__vector_as_arraysegment(10); }
+#endif
+  public ushort[] GetValuesArray() { return __p.__vector_as_array<ushort>(10); }
+
+  public static void StartQuantizedPositions(FlatBufferBuilder builder) { builder.StartTable(4); }
+  public static void AddMin(FlatBufferBuilder builder, Offset<GSP.FB.Vec3> minOffset) { builder.AddStruct(0, minOffset.Value, 0); }
+  public static void AddMax(FlatBufferBuilder builder, Offset<GSP.FB.Vec3> maxOffset) { builder.AddStruct(1, maxOffset.Value, 0); }
+  public static void AddBits(FlatBufferBuilder builder, byte bits) { builder.AddByte(2, bits, 16); }
+  public static void AddValues(FlatBufferBuilder builder, VectorOffset valuesOffset) { builder.AddOffset(3, valuesOffset.Value, 0); }
+  public static VectorOffset CreateValuesVector(FlatBufferBuilder builder, ushort[] data) { builder.StartVector(2, data.Length, 2); for (int i = data.Length - 1; i >= 0; i--) builder.AddUshort(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateValuesVectorBlock(FlatBufferBuilder builder, ushort[] data) { builder.StartVector(2, data.Length, 2); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateValuesVectorBlock(FlatBufferBuilder builder, ArraySegment<ushort> data) { builder.StartVector(2, data.Count, 2); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateValuesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<ushort>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartValuesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(2, numElems, 2); }
+  public static Offset<GSP.FB.QuantizedPositions> EndQuantizedPositions(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.QuantizedPositions>(o);
+  }
+  public QuantizedPositionsT UnPack() {
+    var _o = new QuantizedPositionsT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(QuantizedPositionsT _o) {
+    _o.Min = this.Min.HasValue ? this.Min.Value.UnPack() : null;
+    _o.Max = this.Max.HasValue ? this.Max.Value.UnPack() : null;
+    _o.Bits = this.Bits;
+    _o.Values = new List<ushort>();
+    for (var _j = 0; _j < this.ValuesLength; ++_j) {_o.Values.Add(this.Values(_j));}
+  }
+  public static Offset<GSP.FB.QuantizedPositions> Pack(FlatBufferBuilder builder, QuantizedPositionsT _o) {
+    if (_o == null) return default(Offset<GSP.FB.QuantizedPositions>);
+    var _values = default(VectorOffset);
+    if (_o.Values != null) {
+      var __values = _o.Values.ToArray();
+      _values = CreateValuesVector(builder, __values);
+    }
+    StartQuantizedPositions(builder);
+    AddMin(builder, GSP.FB.Vec3.Pack(builder, _o.Min));
+    AddMax(builder, GSP.FB.Vec3.Pack(builder, _o.Max));
+    AddBits(builder, _o.Bits);
+    AddValues(builder, _values);
+    return EndQuantizedPositions(builder);
+  }
+}
+
+public class QuantizedPositionsT
+{
+  public GSP.FB.Vec3T Min { get; set; }
+  public GSP.FB.Vec3T Max { get; set; }
+  public byte Bits { get; set; }
+  public List<ushort> Values { get; set; }
+
+  public QuantizedPositionsT() {
+    this.Min = new GSP.FB.Vec3T();
+    this.Max = new GSP.FB.Vec3T();
+    this.Bits = 16;
+    this.Values = null;
+  }
+}
+
+
+static public class QuantizedPositionsVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyField(tablePos, 4 /*Min*/, 24 /*GSP.FB.Vec3*/, 8, false)
+      && verifier.VerifyField(tablePos, 6 /*Max*/, 24 /*GSP.FB.Vec3*/, 8, false)
+      && verifier.VerifyField(tablePos, 8 /*Bits*/, 1 /*byte*/, 1, false)
+      && verifier.VerifyVectorOfData(tablePos, 10 /*Values*/, 2 /*ushort*/, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
 
 }
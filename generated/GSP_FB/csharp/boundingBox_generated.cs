@@ -0,0 +1,180 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace GSP.FB
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct BoundingBoxData : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static BoundingBoxData GetRootAsBoundingBoxData(ByteBuffer _bb) { return GetRootAsBoundingBoxData(_bb, new BoundingBoxData()); }
+  public static BoundingBoxData GetRootAsBoundingBoxData(ByteBuffer _bb, BoundingBoxData obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyBoundingBoxData(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, BoundingBoxDataVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public BoundingBoxData __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public GSP.FB.Vec3? Center { get { int o = __p.__offset(4); return o != 0 ? (GSP.FB.Vec3?)(new GSP.FB.Vec3()).__assign(o + __p.bb_pos, __p.bb) : null; } }
+  public GSP.FB.Vec3? AxisX { get { int o = __p.__offset(6); return o != 0 ? (GSP.FB.Vec3?)(new GSP.FB.Vec3()).__assign(o + __p.bb_pos, __p.bb) : null; } }
+  public GSP.FB.Vec3? AxisY { get { int o = __p.__offset(8); return o != 0 ? (GSP.FB.Vec3?)(new GSP.FB.Vec3()).__assign(o + __p.bb_pos, __p.bb) : null; } }
+  public GSP.FB.Vec3? AxisZ { get { int o = __p.__offset(10); return o != 0 ? (GSP.FB.Vec3?)(new GSP.FB.Vec3()).__assign(o + __p.bb_pos, __p.bb) : null; } }
+  public GSP.FB.Vec3? HalfExtents { get { int o = __p.__offset(12); return o != 0 ? (GSP.FB.Vec3?)(new GSP.FB.Vec3()).__assign(o + __p.bb_pos, __p.bb) : null; } }
+
+  public static void StartBoundingBoxData(FlatBufferBuilder builder) { builder.StartTable(5); }
+  public static void AddCenter(FlatBufferBuilder builder, Offset<GSP.FB.Vec3> centerOffset) { builder.AddStruct(0, centerOffset.Value, 0); }
+  public static void AddAxisX(FlatBufferBuilder builder, Offset<GSP.FB.Vec3> axisXOffset) { builder.AddStruct(1, axisXOffset.Value, 0); }
+  public static void AddAxisY(FlatBufferBuilder builder, Offset<GSP.FB.Vec3> axisYOffset) { builder.AddStruct(2, axisYOffset.Value, 0); }
+  public static void AddAxisZ(FlatBufferBuilder builder, Offset<GSP.FB.Vec3> axisZOffset) { builder.AddStruct(3, axisZOffset.Value, 0); }
+  public static void AddHalfExtents(FlatBufferBuilder builder, Offset<GSP.FB.Vec3> halfExtentsOffset) { builder.AddStruct(4, halfExtentsOffset.Value, 0); }
+  public static Offset<GSP.FB.BoundingBoxData> EndBoundingBoxData(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.BoundingBoxData>(o);
+  }
+  public BoundingBoxDataT UnPack() {
+    var _o = new BoundingBoxDataT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(BoundingBoxDataT _o) {
+    _o.Center = this.Center.HasValue ? this.Center.Value.UnPack() : null;
+    _o.AxisX = this.AxisX.HasValue ? this.AxisX.Value.UnPack() : null;
+    _o.AxisY = this.AxisY.HasValue ? this.AxisY.Value.UnPack() : null;
+    _o.AxisZ = this.AxisZ.HasValue ? this.AxisZ.Value.UnPack() : null;
+    _o.HalfExtents = this.HalfExtents.HasValue ? this.HalfExtents.Value.UnPack() : null;
+  }
+  public static Offset<GSP.FB.BoundingBoxData> Pack(FlatBufferBuilder builder, BoundingBoxDataT _o) {
+    if (_o == null) return default(Offset<GSP.FB.BoundingBoxData>);
+    StartBoundingBoxData(builder);
+    AddCenter(builder, GSP.FB.Vec3.Pack(builder, _o.Center));
+    AddAxisX(builder, GSP.FB.Vec3.Pack(builder, _o.AxisX));
+    AddAxisY(builder, GSP.FB.Vec3.Pack(builder, _o.AxisY));
+    AddAxisZ(builder, GSP.FB.Vec3.Pack(builder, _o.AxisZ));
+    AddHalfExtents(builder, GSP.FB.Vec3.Pack(builder, _o.HalfExtents));
+    return EndBoundingBoxData(builder);
+  }
+}
+
+public class BoundingBoxDataT
+{
+  public GSP.FB.Vec3T Center { get; set; }
+  public GSP.FB.Vec3T AxisX { get; set; }
+  public GSP.FB.Vec3T AxisY { get; set; }
+  public GSP.FB.Vec3T AxisZ { get; set; }
+  public GSP.FB.Vec3T HalfExtents { get; set; }
+
+  public BoundingBoxDataT() {
+    this.Center = new GSP.FB.Vec3T();
+    this.AxisX = new GSP.FB.Vec3T();
+    this.AxisY = new GSP.FB.Vec3T();
+    this.AxisZ = new GSP.FB.Vec3T();
+    this.HalfExtents = new GSP.FB.Vec3T();
+  }
+}
+
+
+static public class BoundingBoxDataVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyField(tablePos, 4 /*Center*/, 24 /*GSP.FB.Vec3*/, 8, false)
+      && verifier.VerifyField(tablePos, 6 /*AxisX*/, 24 /*GSP.FB.Vec3*/, 8, false)
+      && verifier.VerifyField(tablePos, 8 /*AxisY*/, 24 /*GSP.FB.Vec3*/, 8, false)
+      && verifier.VerifyField(tablePos, 10 /*AxisZ*/, 24 /*GSP.FB.Vec3*/, 8, false)
+      && verifier.VerifyField(tablePos, 12 /*HalfExtents*/, 24 /*GSP.FB.Vec3*/, 8, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+public struct BoundingBoxBatch : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static BoundingBoxBatch GetRootAsBoundingBoxBatch(ByteBuffer _bb) { return GetRootAsBoundingBoxBatch(_bb, new BoundingBoxBatch()); }
+  public static BoundingBoxBatch GetRootAsBoundingBoxBatch(ByteBuffer _bb, BoundingBoxBatch obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyBoundingBoxBatch(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, BoundingBoxBatchVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public BoundingBoxBatch __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public GSP.FB.BoundingBoxData? Boxes(int j) { int o = __p.__offset(4); return o != 0 ? (GSP.FB.BoundingBoxData?)(new GSP.FB.BoundingBoxData()).__assign(__p.__indirect(__p.__vector(o) + j * 4), __p.bb) : null; }
+  public int BoxesLength { get { int o = __p.__offset(4); return o != 0 ? __p.__vector_len(o) : 0; } }
+
+  public static Offset<GSP.FB.BoundingBoxBatch> CreateBoundingBoxBatch(FlatBufferBuilder builder,
+      VectorOffset boxesOffset = default(VectorOffset)) {
+    builder.StartTable(1);
+    BoundingBoxBatch.AddBoxes(builder, boxesOffset);
+    return BoundingBoxBatch.EndBoundingBoxBatch(builder);
+  }
+
+  public static void StartBoundingBoxBatch(FlatBufferBuilder builder) { builder.StartTable(1); }
+  public static void AddBoxes(FlatBufferBuilder builder, VectorOffset boxesOffset) { builder.AddOffset(0, boxesOffset.Value, 0); }
+  public static VectorOffset CreateBoxesVector(FlatBufferBuilder builder, Offset<GSP.FB.BoundingBoxData>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
+  public static VectorOffset CreateBoxesVectorBlock(FlatBufferBuilder builder, Offset<GSP.FB.BoundingBoxData>[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateBoxesVectorBlock(FlatBufferBuilder builder, ArraySegment<Offset<GSP.FB.BoundingBoxData>> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateBoxesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<Offset<GSP.FB.BoundingBoxData>>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartBoxesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static Offset<GSP.FB.BoundingBoxBatch> EndBoundingBoxBatch(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.BoundingBoxBatch>(o);
+  }
+  public static void FinishBoundingBoxBatchBuffer(FlatBufferBuilder builder, Offset<GSP.FB.BoundingBoxBatch> offset) { builder.Finish(offset.Value); }
+  public static void FinishSizePrefixedBoundingBoxBatchBuffer(FlatBufferBuilder builder, Offset<GSP.FB.BoundingBoxBatch> offset) { builder.FinishSizePrefixed(offset.Value); }
+  public BoundingBoxBatchT UnPack() {
+    var _o = new BoundingBoxBatchT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(BoundingBoxBatchT _o) {
+    _o.Boxes = new List<GSP.FB.BoundingBoxDataT>();
+    for (var _j = 0; _j < this.BoxesLength; ++_j) {_o.Boxes.Add(this.Boxes(_j).HasValue ? this.Boxes(_j).Value.UnPack() : null);}
+  }
+  public static Offset<GSP.FB.BoundingBoxBatch> Pack(FlatBufferBuilder builder, BoundingBoxBatchT _o) {
+    if (_o == null) return default(Offset<GSP.FB.BoundingBoxBatch>);
+    var _boxes = default(VectorOffset);
+    if (_o.Boxes != null) {
+      var __boxes = new Offset<GSP.FB.BoundingBoxData>[_o.Boxes.Count];
+      for (var _j = 0; _j < __boxes.Length; ++_j) { __boxes[_j] = GSP.FB.BoundingBoxData.Pack(builder, _o.Boxes[_j]); }
+      _boxes = CreateBoxesVector(builder, __boxes);
+    }
+    return CreateBoundingBoxBatch(
+      builder,
+      _boxes);
+  }
+}
+
+public class BoundingBoxBatchT
+{
+  public List<GSP.FB.BoundingBoxDataT> Boxes { get; set; }
+
+  public BoundingBoxBatchT() {
+    this.Boxes = null;
+  }
+  public static BoundingBoxBatchT DeserializeFromBinary(byte[] fbBuffer) {
+    return BoundingBoxBatch.GetRootAsBoundingBoxBatch(new ByteBuffer(fbBuffer)).UnPack();
+  }
+  public byte[] SerializeToBinary() {
+    var fbb = new FlatBufferBuilder(0x10000);
+    BoundingBoxBatch.FinishBoundingBoxBatchBuffer(fbb, BoundingBoxBatch.Pack(fbb, this));
+    return fbb.DataBuffer.ToSizedArray();
+  }
+}
+
+
+static public class BoundingBoxBatchVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyVectorOfTables(tablePos, 4 /*Boxes*/, GSP.FB.BoundingBoxDataVerify.Verify, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
@@ -0,0 +1,187 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace GSP.FB
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct MassPropertiesData : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static MassPropertiesData GetRootAsMassPropertiesData(ByteBuffer _bb) { return GetRootAsMassPropertiesData(_bb, new MassPropertiesData()); }
+  public static MassPropertiesData GetRootAsMassPropertiesData(ByteBuffer _bb, MassPropertiesData obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyMassPropertiesData(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, MassPropertiesDataVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public MassPropertiesData __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public double Area { get { int o = __p.__offset(4); return o != 0 ? __p.bb.GetDouble(o + __p.bb_pos) : (double)0.0; } }
+  public double Volume { get { int o = __p.__offset(6); return o != 0 ? __p.bb.GetDouble(o + __p.bb_pos) : (double)0.0; } }
+  public GSP.FB.Vec3? AreaCentroid { get { int o = __p.__offset(8); return o != 0 ? (GSP.FB.Vec3?)(new GSP.FB.Vec3()).__assign(o + __p.bb_pos, __p.bb) : null; } }
+  public GSP.FB.Vec3? VolumeCentroid { get { int o = __p.__offset(10); return o != 0 ? (GSP.FB.Vec3?)(new GSP.FB.Vec3()).__assign(o + __p.bb_pos, __p.bb) : null; } }
+  public GSP.FB.Vec3? InertiaDiagonal { get { int o = __p.__offset(12); return o != 0 ? (GSP.FB.Vec3?)(new GSP.FB.Vec3()).__assign(o + __p.bb_pos, __p.bb) : null; } }
+  public GSP.FB.Vec3? InertiaProducts { get { int o = __p.__offset(14); return o != 0 ? (GSP.FB.Vec3?)(new GSP.FB.Vec3()).__assign(o + __p.bb_pos, __p.bb) : null; } }
+
+  public static void StartMassPropertiesData(FlatBufferBuilder builder) { builder.StartTable(6); }
+  public static void AddArea(FlatBufferBuilder builder, double area) { builder.AddDouble(0, area, 0.0); }
+  public static void AddVolume(FlatBufferBuilder builder, double volume) { builder.AddDouble(1, volume, 0.0); }
+  public static void AddAreaCentroid(FlatBufferBuilder builder, Offset<GSP.FB.Vec3> areaCentroidOffset) { builder.AddStruct(2, areaCentroidOffset.Value, 0); }
+  public static void AddVolumeCentroid(FlatBufferBuilder builder, Offset<GSP.FB.Vec3> volumeCentroidOffset) { builder.AddStruct(3, volumeCentroidOffset.Value, 0); }
+  public static void AddInertiaDiagonal(FlatBufferBuilder builder, Offset<GSP.FB.Vec3> inertiaDiagonalOffset) { builder.AddStruct(4, inertiaDiagonalOffset.Value, 0); }
+  public static void AddInertiaProducts(FlatBufferBuilder builder, Offset<GSP.FB.Vec3> inertiaProductsOffset) { builder.AddStruct(5, inertiaProductsOffset.Value, 0); }
+  public static Offset<GSP.FB.MassPropertiesData> EndMassPropertiesData(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.MassPropertiesData>(o);
+  }
+  public MassPropertiesDataT UnPack() {
+    var _o = new MassPropertiesDataT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(MassPropertiesDataT _o) {
+    _o.Area = this.Area;
+    _o.Volume = this.Volume;
+    _o.AreaCentroid = this.AreaCentroid.HasValue ? this.AreaCentroid.Value.UnPack() : null;
+    _o.VolumeCentroid = this.VolumeCentroid.HasValue ? this.VolumeCentroid.Value.UnPack() : null;
+    _o.InertiaDiagonal = this.InertiaDiagonal.HasValue ? this.InertiaDiagonal.Value.UnPack() : null;
+    _o.InertiaProducts = this.InertiaProducts.HasValue ? this.InertiaProducts.Value.UnPack() : null;
+  }
+  public static Offset<GSP.FB.MassPropertiesData> Pack(FlatBufferBuilder builder, MassPropertiesDataT _o) {
+    if (_o == null) return default(Offset<GSP.FB.MassPropertiesData>);
+    StartMassPropertiesData(builder);
+    AddArea(builder, _o.Area);
+    AddVolume(builder, _o.Volume);
+    AddAreaCentroid(builder, GSP.FB.Vec3.Pack(builder, _o.AreaCentroid));
+    AddVolumeCentroid(builder, GSP.FB.Vec3.Pack(builder, _o.VolumeCentroid));
+    AddInertiaDiagonal(builder, GSP.FB.Vec3.Pack(builder, _o.InertiaDiagonal));
+    AddInertiaProducts(builder, GSP.FB.Vec3.Pack(builder, _o.InertiaProducts));
+    return EndMassPropertiesData(builder);
+  }
+}
+
+public class MassPropertiesDataT
+{
+  public double Area { get; set; }
+  public double Volume { get; set; }
+  public GSP.FB.Vec3T AreaCentroid { get; set; }
+  public GSP.FB.Vec3T VolumeCentroid { get; set; }
+  public GSP.FB.Vec3T InertiaDiagonal { get; set; }
+  public GSP.FB.Vec3T InertiaProducts { get; set; }
+
+  public MassPropertiesDataT() {
+    this.Area = 0.0;
+    this.Volume = 0.0;
+    this.AreaCentroid = new GSP.FB.Vec3T();
+    this.VolumeCentroid = new GSP.FB.Vec3T();
+    this.InertiaDiagonal = new GSP.FB.Vec3T();
+    this.InertiaProducts = new GSP.FB.Vec3T();
+  }
+}
+
+
+static public class MassPropertiesDataVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyField(tablePos, 4 /*Area*/, 8 /*double*/, 8, false)
+      && verifier.VerifyField(tablePos, 6 /*Volume*/, 8 /*double*/, 8, false)
+      && verifier.VerifyField(tablePos, 8 /*AreaCentroid*/, 24 /*GSP.FB.Vec3*/, 8, false)
+      && verifier.VerifyField(tablePos, 10 /*VolumeCentroid*/, 24 /*GSP.FB.Vec3*/, 8, false)
+      && verifier.VerifyField(tablePos, 12 /*InertiaDiagonal*/, 24 /*GSP.FB.Vec3*/, 8, false)
+      && verifier.VerifyField(tablePos, 14 /*InertiaProducts*/, 24 /*GSP.FB.Vec3*/, 8, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+public struct MassPropertiesBatch : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static MassPropertiesBatch GetRootAsMassPropertiesBatch(ByteBuffer _bb) { return GetRootAsMassPropertiesBatch(_bb, new MassPropertiesBatch()); }
+  public static MassPropertiesBatch GetRootAsMassPropertiesBatch(ByteBuffer _bb, MassPropertiesBatch obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyMassPropertiesBatch(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, MassPropertiesBatchVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public MassPropertiesBatch __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public GSP.FB.MassPropertiesData? Items(int j) { int o = __p.__offset(4); return o != 0 ? (GSP.FB.MassPropertiesData?)(new GSP.FB.MassPropertiesData()).__assign(__p.__indirect(__p.__vector(o) + j * 4), __p.bb) : null; }
+  public int ItemsLength { get { int o = __p.__offset(4); return o != 0 ? __p.__vector_len(o) : 0; } }
+
+  public static Offset<GSP.FB.MassPropertiesBatch> CreateMassPropertiesBatch(FlatBufferBuilder builder,
+      VectorOffset itemsOffset = default(VectorOffset)) {
+    builder.StartTable(1);
+    MassPropertiesBatch.AddItems(builder, itemsOffset);
+    return MassPropertiesBatch.EndMassPropertiesBatch(builder);
+  }
+
+  public static void StartMassPropertiesBatch(FlatBufferBuilder builder) { builder.StartTable(1); }
+  public static void AddItems(FlatBufferBuilder builder, VectorOffset itemsOffset) { builder.AddOffset(0, itemsOffset.Value, 0); }
+  public static VectorOffset CreateItemsVector(FlatBufferBuilder builder, Offset<GSP.FB.MassPropertiesData>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
+  public static VectorOffset CreateItemsVectorBlock(FlatBufferBuilder builder, Offset<GSP.FB.MassPropertiesData>[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateItemsVectorBlock(FlatBufferBuilder builder, ArraySegment<Offset<GSP.FB.MassPropertiesData>> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateItemsVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<Offset<GSP.FB.MassPropertiesData>>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartItemsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static Offset<GSP.FB.MassPropertiesBatch> EndMassPropertiesBatch(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.MassPropertiesBatch>(o);
+  }
+  public static void FinishMassPropertiesBatchBuffer(FlatBufferBuilder builder, Offset<GSP.FB.MassPropertiesBatch> offset) { builder.Finish(offset.Value); }
+  public static void FinishSizePrefixedMassPropertiesBatchBuffer(FlatBufferBuilder builder, Offset<GSP.FB.MassPropertiesBatch> offset) { builder.FinishSizePrefixed(offset.Value); }
+  public MassPropertiesBatchT UnPack() {
+    var _o = new MassPropertiesBatchT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(MassPropertiesBatchT _o) {
+    _o.Items = new List<GSP.FB.MassPropertiesDataT>();
+    for (var _j = 0; _j < this.ItemsLength; ++_j) {_o.Items.Add(this.Items(_j).HasValue ? this.Items(_j).Value.UnPack() : null);}
+  }
+  public static Offset<GSP.FB.MassPropertiesBatch> Pack(FlatBufferBuilder builder, MassPropertiesBatchT _o) {
+    if (_o == null) return default(Offset<GSP.FB.MassPropertiesBatch>);
+    var _items = default(VectorOffset);
+    if (_o.Items != null) {
+      var __items = new Offset<GSP.FB.MassPropertiesData>[_o.Items.Count];
+      for (var _j = 0; _j < __items.Length; ++_j) { __items[_j] = GSP.FB.MassPropertiesData.Pack(builder, _o.Items[_j]); }
+      _items = CreateItemsVector(builder, __items);
+    }
+    return CreateMassPropertiesBatch(
+      builder,
+      _items);
+  }
+}
+
+public class MassPropertiesBatchT
+{
+  public List<GSP.FB.MassPropertiesDataT> Items { get; set; }
+
+  public MassPropertiesBatchT() {
+    this.Items = null;
+  }
+  public static MassPropertiesBatchT DeserializeFromBinary(byte[] fbBuffer) {
+    return MassPropertiesBatch.GetRootAsMassPropertiesBatch(new ByteBuffer(fbBuffer)).UnPack();
+  }
+  public byte[] SerializeToBinary() {
+    var fbb = new FlatBufferBuilder(0x10000);
+    MassPropertiesBatch.FinishMassPropertiesBatchBuffer(fbb, MassPropertiesBatch.Pack(fbb, this));
+    return fbb.DataBuffer.ToSizedArray();
+  }
+}
+
+
+static public class MassPropertiesBatchVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyVectorOfTables(tablePos, 4 /*Items*/, GSP.FB.MassPropertiesDataVerify.Verify, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
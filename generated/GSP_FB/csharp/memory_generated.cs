@@ -0,0 +1,373 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace GSP.FB
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public enum MemoryTracking : byte
+{
+  Off = 0,
+  Counters = 1,
+  Debug = 2,
+};
+
+
+public struct ExportMemoryStats : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static ExportMemoryStats GetRootAsExportMemoryStats(ByteBuffer _bb) { return GetRootAsExportMemoryStats(_bb, new ExportMemoryStats()); }
+  public static ExportMemoryStats GetRootAsExportMemoryStats(ByteBuffer _bb, ExportMemoryStats obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyExportMemoryStats(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, ExportMemoryStatsVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public ExportMemoryStats __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public string Name { get { int o = __p.__offset(4); return o != 0 ? __p.__string(o + __p.bb_pos) : null; } }
+#if ENABLE_SPAN_T
+  public Span<byte> GetNameBytes() { return __p.__vector_as_span<byte>(4, 1); }
+#else
+  public ArraySegment<byte>? GetNameBytes() { return __p.__vector_as_arraysegment(4); }
+#endif
+  public byte[] GetNameArray() { return __p.__vector_as_array<byte>(4); }
+  public ulong Allocations { get { int o = __p.__offset(6); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong AllocatedBytes { get { int o = __p.__offset(8); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong LiveBuffers { get { int o = __p.__offset(10); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong LiveBytes { get { int o = __p.__offset(12); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong PeakBytes { get { int o = __p.__offset(14); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+
+  public static Offset<GSP.FB.ExportMemoryStats> CreateExportMemoryStats(FlatBufferBuilder builder,
+      StringOffset nameOffset = default(StringOffset),
+      ulong allocations = 0,
+      ulong allocatedBytes = 0,
+      ulong liveBuffers = 0,
+      ulong liveBytes = 0,
+      ulong peakBytes = 0) {
+    builder.StartTable(6);
+    ExportMemoryStats.AddPeakBytes(builder, peakBytes);
+    ExportMemoryStats.AddLiveBytes(builder, liveBytes);
+    ExportMemoryStats.AddLiveBuffers(builder, liveBuffers);
+    ExportMemoryStats.AddAllocatedBytes(builder, allocatedBytes);
+    ExportMemoryStats.AddAllocations(builder, allocations);
+    ExportMemoryStats.AddName(builder, nameOffset);
+    return ExportMemoryStats.EndExportMemoryStats(builder);
+  }
+
+  public static void StartExportMemoryStats(FlatBufferBuilder builder) { builder.StartTable(6); }
+  public static void AddName(FlatBufferBuilder builder, StringOffset nameOffset) { builder.AddOffset(0, nameOffset.Value, 0); }
+  public static void AddAllocations(FlatBufferBuilder builder, ulong allocations) { builder.AddUlong(1, allocations, 0); }
+  public static void AddAllocatedBytes(FlatBufferBuilder builder, ulong allocatedBytes) { builder.AddUlong(2, allocatedBytes, 0); }
+  public static void AddLiveBuffers(FlatBufferBuilder builder, ulong liveBuffers) { builder.AddUlong(3, liveBuffers, 0); }
+  public static void AddLiveBytes(FlatBufferBuilder builder, ulong liveBytes) { builder.AddUlong(4, liveBytes, 0); }
+  public static void AddPeakBytes(FlatBufferBuilder builder, ulong peakBytes) { builder.AddUlong(5, peakBytes, 0); }
+  public static Offset<GSP.FB.ExportMemoryStats> EndExportMemoryStats(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.ExportMemoryStats>(o);
+  }
+  public ExportMemoryStatsT UnPack() {
+    var _o = new ExportMemoryStatsT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(ExportMemoryStatsT _o) {
+    _o.Name = this.Name;
+    _o.Allocations = this.Allocations;
+    _o.AllocatedBytes = this.AllocatedBytes;
+    _o.LiveBuffers = this.LiveBuffers;
+    _o.LiveBytes = this.LiveBytes;
+    _o.PeakBytes = this.PeakBytes;
+  }
+  public static Offset<GSP.FB.ExportMemoryStats> Pack(FlatBufferBuilder builder, ExportMemoryStatsT _o) {
+    if (_o == null) return default(Offset<GSP.FB.ExportMemoryStats>);
+    var _name = _o.Name == null ? default(StringOffset) : builder.CreateString(_o.Name);
+    return CreateExportMemoryStats(
+      builder,
+      _name,
+      _o.Allocations,
+      _o.AllocatedBytes,
+      _o.LiveBuffers,
+      _o.LiveBytes,
+      _o.PeakBytes);
+  }
+}
+
+public class ExportMemoryStatsT
+{
+  public string Name { get; set; }
+  public ulong Allocations { get; set; }
+  public ulong AllocatedBytes { get; set; }
+  public ulong LiveBuffers { get; set; }
+  public ulong LiveBytes { get; set; }
+  public ulong PeakBytes { get; set; }
+
+  public ExportMemoryStatsT() {
+    this.Name = null;
+    this.Allocations = 0;
+    this.AllocatedBytes = 0;
+    this.LiveBuffers = 0;
+    this.LiveBytes = 0;
+    this.PeakBytes = 0;
+  }
+}
+
+
+static public class ExportMemoryStatsVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyString(tablePos, 4 /*Name*/, false)
+      && verifier.VerifyField(tablePos, 6 /*Allocations*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 8 /*AllocatedBytes*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 10 /*LiveBuffers*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 12 /*LiveBytes*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 14 /*PeakBytes*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+public struct LiveBuffer : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static LiveBuffer GetRootAsLiveBuffer(ByteBuffer _bb) { return GetRootAsLiveBuffer(_bb, new LiveBuffer()); }
+  public static LiveBuffer GetRootAsLiveBuffer(ByteBuffer _bb, LiveBuffer obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyLiveBuffer(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, LiveBufferVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public LiveBuffer __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public string ExportName { get { int o = __p.__offset(4); return o != 0 ? __p.__string(o + __p.bb_pos) : null; } }
+#if ENABLE_SPAN_T
+  public Span<byte> GetExportNameBytes() { return __p.__vector_as_span<byte>(4, 1); }
+#else
+  public ArraySegment<byte>? GetExportNameBytes() { return __p.__vector_as_arraysegment(4); }
+#endif
+  public byte[] GetExportNameArray() { return __p.__vector_as_array<byte>(4); }
+  public ulong Address { get { int o = __p.__offset(6); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong Size { get { int o = __p.__offset(8); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong Sequence { get { int o = __p.__offset(10); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+
+  public static Offset<GSP.FB.LiveBuffer> CreateLiveBuffer(FlatBufferBuilder builder,
+      StringOffset exportNameOffset = default(StringOffset),
+      ulong address = 0,
+      ulong size = 0,
+      ulong sequence = 0) {
+    builder.StartTable(4);
+    LiveBuffer.AddSequence(builder, sequence);
+    LiveBuffer.AddSize(builder, size);
+    LiveBuffer.AddAddress(builder, address);
+    LiveBuffer.AddExportName(builder, exportNameOffset);
+    return LiveBuffer.EndLiveBuffer(builder);
+  }
+
+  public static void StartLiveBuffer(FlatBufferBuilder builder) { builder.StartTable(4); }
+  public static void AddExportName(FlatBufferBuilder builder, StringOffset exportNameOffset) { builder.AddOffset(0, exportNameOffset.Value, 0); }
+  public static void AddAddress(FlatBufferBuilder builder, ulong address) { builder.AddUlong(1, address, 0); }
+  public static void AddSize(FlatBufferBuilder builder, ulong size) { builder.AddUlong(2, size, 0); }
+  public static void AddSequence(FlatBufferBuilder builder, ulong sequence) { builder.AddUlong(3, sequence, 0); }
+  public static Offset<GSP.FB.LiveBuffer> EndLiveBuffer(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.LiveBuffer>(o);
+  }
+  public LiveBufferT UnPack() {
+    var _o = new LiveBufferT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(LiveBufferT _o) {
+    _o.ExportName = this.ExportName;
+    _o.Address = this.Address;
+    _o.Size = this.Size;
+    _o.Sequence = this.Sequence;
+  }
+  public static Offset<GSP.FB.LiveBuffer> Pack(FlatBufferBuilder builder, LiveBufferT _o) {
+    if (_o == null) return default(Offset<GSP.FB.LiveBuffer>);
+    var _export_name = _o.ExportName == null ? default(StringOffset) : builder.CreateString(_o.ExportName);
+    return CreateLiveBuffer(
+      builder,
+      _export_name,
+      _o.Address,
+      _o.Size,
+      _o.Sequence);
+  }
+}
+
+public class LiveBufferT
+{
+  public string ExportName { get; set; }
+  public ulong Address { get; set; }
+  public ulong Size { get; set; }
+  public ulong Sequence { get; set; }
+
+  public LiveBufferT() {
+    this.ExportName = null;
+    this.Address = 0;
+    this.Size = 0;
+    this.Sequence = 0;
+  }
+}
+
+
+static public class LiveBufferVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyString(tablePos, 4 /*ExportName*/, false)
+      && verifier.VerifyField(tablePos, 6 /*Address*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 8 /*Size*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 10 /*Sequence*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+public struct MemoryStats : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static MemoryStats GetRootAsMemoryStats(ByteBuffer _bb) { return GetRootAsMemoryStats(_bb, new MemoryStats()); }
+  public static MemoryStats GetRootAsMemoryStats(ByteBuffer _bb, MemoryStats obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyMemoryStats(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, MemoryStatsVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public MemoryStats __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public GSP.FB.MemoryTracking Mode { get { int o = __p.__offset(4); return o != 0 ? (GSP.FB.MemoryTracking)__p.bb.Get(o + __p.bb_pos) : GSP.FB.MemoryTracking.Off; } }
+  public ulong LiveBuffers { get { int o = __p.__offset(6); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong LiveBytes { get { int o = __p.__offset(8); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong PeakBytes { get { int o = __p.__offset(10); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public GSP.FB.ExportMemoryStats? Exports(int j) { int o = __p.__offset(12); return o != 0 ? (GSP.FB.ExportMemoryStats?)(new GSP.FB.ExportMemoryStats()).__assign(__p.__indirect(__p.__vector(o) + j * 4), __p.bb) : null; }
+  public int ExportsLength { get { int o = __p.__offset(12); return o != 0 ? __p.__vector_len(o) : 0; } }
+  public GSP.FB.LiveBuffer? Live(int j) { int o = __p.__offset(14); return o != 0 ? (GSP.FB.LiveBuffer?)(new GSP.FB.LiveBuffer()).__assign(__p.__indirect(__p.__vector(o) + j * 4), __p.bb) : null; }
+  public int LiveLength { get { int o = __p.__offset(14); return o != 0 ? __p.__vector_len(o) : 0; } }
+
+  public static Offset<GSP.FB.MemoryStats> CreateMemoryStats(FlatBufferBuilder builder,
+      GSP.FB.MemoryTracking mode = GSP.FB.MemoryTracking.Off,
+      ulong liveBuffers = 0,
+      ulong liveBytes = 0,
+      ulong peakBytes = 0,
+      VectorOffset exportsOffset = default(VectorOffset),
+      VectorOffset liveOffset = default(VectorOffset)) {
+    builder.StartTable(6);
+    MemoryStats.AddPeakBytes(builder, peakBytes);
+    MemoryStats.AddLiveBytes(builder, liveBytes);
+    MemoryStats.AddLiveBuffers(builder, liveBuffers);
+    MemoryStats.AddLive(builder, liveOffset);
+    MemoryStats.AddExports(builder, exportsOffset);
+    MemoryStats.AddMode(builder, mode);
+    return MemoryStats.EndMemoryStats(builder);
+  }
+
+  public static void StartMemoryStats(FlatBufferBuilder builder) { builder.StartTable(6); }
+  public static void AddMode(FlatBufferBuilder builder, GSP.FB.MemoryTracking mode) { builder.AddByte(0, (byte)mode, 0); }
+  public static void AddLiveBuffers(FlatBufferBuilder builder, ulong liveBuffers) { builder.AddUlong(1, liveBuffers, 0); }
+  public static void AddLiveBytes(FlatBufferBuilder builder, ulong liveBytes) { builder.AddUlong(2, liveBytes, 0); }
+  public static void AddPeakBytes(FlatBufferBuilder builder, ulong peakBytes) { builder.AddUlong(3, peakBytes, 0); }
+  public static void AddExports(FlatBufferBuilder builder, VectorOffset exportsOffset) { builder.AddOffset(4, exportsOffset.Value, 0); }
+  public static VectorOffset CreateExportsVector(FlatBufferBuilder builder, Offset<GSP.FB.ExportMemoryStats>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
+  public static VectorOffset CreateExportsVectorBlock(FlatBufferBuilder builder, Offset<GSP.FB.ExportMemoryStats>[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateExportsVectorBlock(FlatBufferBuilder builder, ArraySegment<Offset<GSP.FB.ExportMemoryStats>> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateExportsVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<Offset<GSP.FB.ExportMemoryStats>>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartExportsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddLive(FlatBufferBuilder builder, VectorOffset liveOffset) { builder.AddOffset(5, liveOffset.Value, 0); }
+  public static VectorOffset CreateLiveVector(FlatBufferBuilder builder, Offset<GSP.FB.LiveBuffer>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
+  public static VectorOffset CreateLiveVectorBlock(FlatBufferBuilder builder, Offset<GSP.FB.LiveBuffer>[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateLiveVectorBlock(FlatBufferBuilder builder, ArraySegment<Offset<GSP.FB.LiveBuffer>> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateLiveVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<Offset<GSP.FB.LiveBuffer>>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartLiveVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static Offset<GSP.FB.MemoryStats> EndMemoryStats(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.MemoryStats>(o);
+  }
+  public static void FinishMemoryStatsBuffer(FlatBufferBuilder builder, Offset<GSP.FB.MemoryStats> offset) { builder.Finish(offset.Value); }
+  public static void FinishSizePrefixedMemoryStatsBuffer(FlatBufferBuilder builder, Offset<GSP.FB.MemoryStats> offset) { builder.FinishSizePrefixed(offset.Value); }
+  public MemoryStatsT UnPack() {
+    var _o = new MemoryStatsT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(MemoryStatsT _o) {
+    _o.Mode = this.Mode;
+    _o.LiveBuffers = this.LiveBuffers;
+    _o.LiveBytes = this.LiveBytes;
+    _o.PeakBytes = this.PeakBytes;
+    _o.Exports = new List<GSP.FB.ExportMemoryStatsT>();
+    for (var _j = 0; _j < this.ExportsLength; ++_j) {_o.Exports.Add(this.Exports(_j).HasValue ? this.Exports(_j).Value.UnPack() : null);}
+    _o.Live = new List<GSP.FB.LiveBufferT>();
+    for (var _j = 0; _j < this.LiveLength; ++_j) {_o.Live.Add(this.Live(_j).HasValue ? this.Live(_j).Value.UnPack() : null);}
+  }
+  public static Offset<GSP.FB.MemoryStats> Pack(FlatBufferBuilder builder, MemoryStatsT _o) {
+    if (_o == null) return default(Offset<GSP.FB.MemoryStats>);
+    var _exports = default(VectorOffset);
+    if (_o.Exports != null) {
+      var __exports = new Offset<GSP.FB.ExportMemoryStats>[_o.Exports.Count];
+      for (var _j = 0; _j < __exports.Length; ++_j) { __exports[_j] = GSP.FB.ExportMemoryStats.Pack(builder, _o.Exports[_j]); }
+      _exports = CreateExportsVector(builder, __exports);
+    }
+    var _live = default(VectorOffset);
+    if (_o.Live != null) {
+      var __live = new Offset<GSP.FB.LiveBuffer>[_o.Live.Count];
+      for (var _j = 0; _j < __live.Length; ++_j) { __live[_j] = GSP.FB.LiveBuffer.Pack(builder, _o.Live[_j]); }
+      _live = CreateLiveVector(builder, __live);
+    }
+    return CreateMemoryStats(
+      builder,
+      _o.Mode,
+      _o.LiveBuffers,
+      _o.LiveBytes,
+      _o.PeakBytes,
+      _exports,
+      _live);
+  }
+}
+
+public class MemoryStatsT
+{
+  public GSP.FB.MemoryTracking Mode { get; set; }
+  public ulong LiveBuffers { get; set; }
+  public ulong LiveBytes { get; set; }
+  public ulong PeakBytes { get; set; }
+  public List<GSP.FB.ExportMemoryStatsT> Exports { get; set; }
+  public List<GSP.FB.LiveBufferT> Live { get; set; }
+
+  public MemoryStatsT() {
+    this.Mode = GSP.FB.MemoryTracking.Off;
+    this.LiveBuffers = 0;
+    this.LiveBytes = 0;
+    this.PeakBytes = 0;
+    this.Exports = null;
+    this.Live = null;
+  }
+  public static MemoryStatsT DeserializeFromBinary(byte[] fbBuffer) {
+    return MemoryStats.GetRootAsMemoryStats(new ByteBuffer(fbBuffer)).UnPack();
+  }
+  public byte[] SerializeToBinary() {
+    var fbb = new FlatBufferBuilder(0x10000);
+    MemoryStats.FinishMemoryStatsBuffer(fbb, MemoryStats.Pack(fbb, this));
+    return fbb.DataBuffer.ToSizedArray();
+  }
+}
+
+
+static public class MemoryStatsVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyField(tablePos, 4 /*Mode*/, 1 /*GSP.FB.MemoryTracking*/, 1, false)
+      && verifier.VerifyField(tablePos, 6 /*LiveBuffers*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 8 /*LiveBytes*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 10 /*PeakBytes*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyVectorOfTables(tablePos, 12 /*Exports*/, GSP.FB.ExportMemoryStatsVerify.Verify, false)
+      && verifier.VerifyVectorOfTables(tablePos, 14 /*Live*/, GSP.FB.LiveBufferVerify.Verify, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
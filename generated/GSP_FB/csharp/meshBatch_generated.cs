@@ -0,0 +1,97 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace GSP.FB
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct MeshBatch : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static MeshBatch GetRootAsMeshBatch(ByteBuffer _bb) { return GetRootAsMeshBatch(_bb, new MeshBatch()); }
+  public static MeshBatch GetRootAsMeshBatch(ByteBuffer _bb, MeshBatch obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyMeshBatch(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, MeshBatchVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public MeshBatch __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public GSP.FB.MeshData? Meshes(int j) { int o = __p.__offset(4); return o != 0 ? (GSP.FB.MeshData?)(new GSP.FB.MeshData()).__assign(__p.__indirect(__p.__vector(o) + j * 4), __p.bb) : null; }
+  public int MeshesLength { get { int o = __p.__offset(4); return o != 0 ? __p.__vector_len(o) : 0; } }
+
+  public static Offset<GSP.FB.MeshBatch> CreateMeshBatch(FlatBufferBuilder builder,
+      VectorOffset meshesOffset = default(VectorOffset)) {
+    builder.StartTable(1);
+    MeshBatch.AddMeshes(builder, meshesOffset);
+    return MeshBatch.EndMeshBatch(builder);
+  }
+
+  public static void StartMeshBatch(FlatBufferBuilder builder) { builder.StartTable(1); }
+  public static void AddMeshes(FlatBufferBuilder builder, VectorOffset meshesOffset) { builder.AddOffset(0, meshesOffset.Value, 0); }
+  public static VectorOffset CreateMeshesVector(FlatBufferBuilder builder, Offset<GSP.FB.MeshData>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
+  public static VectorOffset CreateMeshesVectorBlock(FlatBufferBuilder builder, Offset<GSP.FB.MeshData>[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateMeshesVectorBlock(FlatBufferBuilder builder, ArraySegment<Offset<GSP.FB.MeshData>> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateMeshesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<Offset<GSP.FB.MeshData>>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartMeshesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static Offset<GSP.FB.MeshBatch> EndMeshBatch(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.MeshBatch>(o);
+  }
+  public static void FinishMeshBatchBuffer(FlatBufferBuilder builder, Offset<GSP.FB.MeshBatch> offset) { builder.Finish(offset.Value); }
+  public static void FinishSizePrefixedMeshBatchBuffer(FlatBufferBuilder builder, Offset<GSP.FB.MeshBatch> offset) { builder.FinishSizePrefixed(offset.Value); }
+  public MeshBatchT UnPack() {
+    var _o = new MeshBatchT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(MeshBatchT _o) {
+    _o.Meshes = new List<GSP.FB.MeshDataT>();
+    for (var _j = 0; _j < this.MeshesLength; ++_j) {_o.Meshes.Add(this.Meshes(_j).HasValue ? this.Meshes(_j).Value.UnPack() : null);}
+  }
+  public static Offset<GSP.FB.MeshBatch> Pack(FlatBufferBuilder builder, MeshBatchT _o) {
+    if (_o == null) return default(Offset<GSP.FB.MeshBatch>);
+    var _meshes = default(VectorOffset);
+    if (_o.Meshes != null) {
+      var __meshes = new Offset<GSP.FB.MeshData>[_o.Meshes.Count];
+      for (var _j = 0; _j < __meshes.Length; ++_j) { __meshes[_j] = GSP.FB.MeshData.Pack(builder, _o.Meshes[_j]); }
+      _meshes = CreateMeshesVector(builder, __meshes);
+    }
+    return CreateMeshBatch(
+      builder,
+      _meshes);
+  }
+}
+
+public class MeshBatchT
+{
+  public List<GSP.FB.MeshDataT> Meshes { get; set; }
+
+  public MeshBatchT() {
+    this.Meshes = null;
+  }
+  public static MeshBatchT DeserializeFromBinary(byte[] fbBuffer) {
+    return MeshBatch.GetRootAsMeshBatch(new ByteBuffer(fbBuffer)).UnPack();
+  }
+  public byte[] SerializeToBinary() {
+    var fbb = new FlatBufferBuilder(0x10000);
+    MeshBatch.FinishMeshBatchBuffer(fbb, MeshBatch.Pack(fbb, this));
+    return fbb.DataBuffer.ToSizedArray();
+  }
+}
+
+
+static public class MeshBatchVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyVectorOfTables(tablePos, 4 /*Meshes*/, GSP.FB.MeshDataVerify.Verify, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
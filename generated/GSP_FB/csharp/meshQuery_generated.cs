@@ -0,0 +1,317 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace GSP.FB
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct MeshHitsData : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static MeshHitsData GetRootAsMeshHitsData(ByteBuffer _bb) { return GetRootAsMeshHitsData(_bb, new MeshHitsData()); }
+  public static MeshHitsData GetRootAsMeshHitsData(ByteBuffer _bb, MeshHitsData obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyMeshHitsData(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, MeshHitsDataVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public MeshHitsData __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public int Faces(int j) { int o = __p.__offset(4); return o != 0 ? __p.bb.GetInt(__p.__vector(o) + j * 4) : (int)0; }
+  public int FacesLength { get { int o = __p.__offset(4); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<int> GetFacesBytes() { return __p.__vector_as_span<int>(4, 4); }
+#else
+  public ArraySegment<byte>? GetFacesBytes() { return __p.__vector_as_arraysegment(4); }
+#endif
+  public int[] GetFacesArray() { return __p.__vector_as_array<int>(4); }
+  public double Distances(int j) { int o = __p.__offset(6); return o != 0 ? __p.bb.GetDouble(__p.__vector(o) + j * 8) : (double)0; }
+  public int DistancesLength { get { int o = __p.__offset(6); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<double> GetDistancesBytes() { return __p.__vector_as_span<double>(6, 8); }
+#else
+  public ArraySegment<byte>? GetDistancesBytes() { return __p.__vector_as_arraysegment(6); }
+#endif
+  public double[] GetDistancesArray() { return __p.__vector_as_array<double>(6); }
+  public GSP.FB.Vec3i? Vertices(int j) { int o = __p.__offset(8); return o != 0 ? (GSP.FB.Vec3i?)(new GSP.FB.Vec3i()).__assign(__p.__vector(o) + j * 12, __p.bb) : null; }
+  public int VerticesLength { get { int o = __p.__offset(8); return o != 0 ? __p.__vector_len(o) : 0; } }
+  public GSP.FB.Vec3? Barycentrics(int j) { int o = __p.__offset(10); return o != 0 ? (GSP.FB.Vec3?)(new GSP.FB.Vec3()).__assign(__p.__vector(o) + j * 24, __p.bb) : null; }
+  public int BarycentricsLength { get { int o = __p.__offset(10); return o != 0 ? __p.__vector_len(o) : 0; } }
+  public GSP.FB.Vec3? Points(int j) { int o = __p.__offset(12); return o != 0 ? (GSP.FB.Vec3?)(new GSP.FB.Vec3()).__assign(__p.__vector(o) + j * 24, __p.bb) : null; }
+  public int PointsLength { get { int o = __p.__offset(12); return o != 0 ? __p.__vector_len(o) : 0; } }
+
+  public static Offset<GSP.FB.MeshHitsData> CreateMeshHitsData(FlatBufferBuilder builder,
+      VectorOffset facesOffset = default(VectorOffset),
+      VectorOffset distancesOffset = default(VectorOffset),
+      VectorOffset verticesOffset = default(VectorOffset),
+      VectorOffset barycentricsOffset = default(VectorOffset),
+      VectorOffset pointsOffset = default(VectorOffset)) {
+    builder.StartTable(5);
+    MeshHitsData.AddPoints(builder, pointsOffset);
+    MeshHitsData.AddBarycentrics(builder, barycentricsOffset);
+    MeshHitsData.AddVertices(builder, verticesOffset);
+    MeshHitsData.AddDistances(builder, distancesOffset);
+    MeshHitsData.AddFaces(builder, facesOffset);
+    return MeshHitsData.EndMeshHitsData(builder);
+  }
+
+  public static void StartMeshHitsData(FlatBufferBuilder builder) { builder.StartTable(5); }
+  public static void AddFaces(FlatBufferBuilder builder, VectorOffset facesOffset) { builder.AddOffset(0, facesOffset.Value, 0); }
+  public static VectorOffset CreateFacesVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateFacesVectorBlock(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateFacesVectorBlock(FlatBufferBuilder builder, ArraySegment<int> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateFacesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<int>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartFacesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddDistances(FlatBufferBuilder builder, VectorOffset distancesOffset) { builder.AddOffset(1, distancesOffset.Value, 0); }
+  public static VectorOffset CreateDistancesVector(FlatBufferBuilder builder, double[] data) { builder.StartVector(8, data.Length, 8); for (int i = data.Length - 1; i >= 0; i--) builder.AddDouble(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateDistancesVectorBlock(FlatBufferBuilder builder, double[] data) { builder.StartVector(8, data.Length, 8); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateDistancesVectorBlock(FlatBufferBuilder builder, ArraySegment<double> data) { builder.StartVector(8, data.Count, 8); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateDistancesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<double>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartDistancesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(8, numElems, 8); }
+  public static void AddVertices(FlatBufferBuilder builder, VectorOffset verticesOffset) { builder.AddOffset(2, verticesOffset.Value, 0); }
+  public static void StartVerticesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(12, numElems, 4); }
+  public static void AddBarycentrics(FlatBufferBuilder builder, VectorOffset barycentricsOffset) { builder.AddOffset(3, barycentricsOffset.Value, 0); }
+  public static void StartBarycentricsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(24, numElems, 8); }
+  public static void AddPoints(FlatBufferBuilder builder, VectorOffset pointsOffset) { builder.AddOffset(4, pointsOffset.Value, 0); }
+  public static void StartPointsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(24, numElems, 8); }
+  public static Offset<GSP.FB.MeshHitsData> EndMeshHitsData(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.MeshHitsData>(o);
+  }
+  public static void FinishMeshHitsDataBuffer(FlatBufferBuilder builder, Offset<GSP.FB.MeshHitsData> offset) { builder.Finish(offset.Value); }
+  public static void FinishSizePrefixedMeshHitsDataBuffer(FlatBufferBuilder builder, Offset<GSP.FB.MeshHitsData> offset) { builder.FinishSizePrefixed(offset.Value); }
+  public MeshHitsDataT UnPack() {
+    var _o = new MeshHitsDataT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(MeshHitsDataT _o) {
+    _o.Faces = new List<int>();
+    for (var _j = 0; _j < this.FacesLength; ++_j) {_o.Faces.Add(this.Faces(_j));}
+    _o.Distances = new List<double>();
+    for (var _j = 0; _j < this.DistancesLength; ++_j) {_o.Distances.Add(this.Distances(_j));}
+    _o.Vertices = new List<GSP.FB.Vec3iT>();
+    for (var _j = 0; _j < this.VerticesLength; ++_j) {_o.Vertices.Add(this.Vertices(_j).HasValue ? this.Vertices(_j).Value.UnPack() : null);}
+    _o.Barycentrics = new List<GSP.FB.Vec3T>();
+    for (var _j = 0; _j < this.BarycentricsLength; ++_j) {_o.Barycentrics.Add(this.Barycentrics(_j).HasValue ? this.Barycentrics(_j).Value.UnPack() : null);}
+    _o.Points = new List<GSP.FB.Vec3T>();
+    for (var _j = 0; _j < this.PointsLength; ++_j) {_o.Points.Add(this.Points(_j).HasValue ? this.Points(_j).Value.UnPack() : null);}
+  }
+  public static Offset<GSP.FB.MeshHitsData> Pack(FlatBufferBuilder builder, MeshHitsDataT _o) {
+    if (_o == null) return default(Offset<GSP.FB.MeshHitsData>);
+    var _faces = default(VectorOffset);
+    if (_o.Faces != null) {
+      var __faces = _o.Faces.ToArray();
+      _faces = CreateFacesVector(builder, __faces);
+    }
+    var _distances = default(VectorOffset);
+    if (_o.Distances != null) {
+      var __distances = _o.Distances.ToArray();
+      _distances = CreateDistancesVector(builder, __distances);
+    }
+    var _vertices = default(VectorOffset);
+    if (_o.Vertices != null) {
+      StartVerticesVector(builder, _o.Vertices.Count);
+      for (var _j = _o.Vertices.Count - 1; _j >= 0; --_j) { GSP.FB.Vec3i.Pack(builder, _o.Vertices[_j]); }
+      _vertices = builder.EndVector();
+    }
+    var _barycentrics = default(VectorOffset);
+    if (_o.Barycentrics != null) {
+      StartBarycentricsVector(builder, _o.Barycentrics.Count);
+      for (var _j = _o.Barycentrics.Count - 1; _j >= 0; --_j) { GSP.FB.Vec3.Pack(builder, _o.Barycentrics[_j]); }
+      _barycentrics = builder.EndVector();
+    }
+    var _points = default(VectorOffset);
+    if (_o.Points != null) {
+      StartPointsVector(builder, _o.Points.Count);
+      for (var _j = _o.Points.Count - 1; _j >= 0; --_j) { GSP.FB.Vec3.Pack(builder, _o.Points[_j]); }
+      _points = builder.EndVector();
+    }
+    return CreateMeshHitsData(
+      builder,
+      _faces,
+      _distances,
+      _vertices,
+      _barycentrics,
+      _points);
+  }
+}
+
+public class MeshHitsDataT
+{
+  public List<int> Faces { get; set; }
+  public List<double> Distances { get; set; }
+  public List<GSP.FB.Vec3iT> Vertices { get; set; }
+  public List<GSP.FB.Vec3T> Barycentrics { get; set; }
+  public List<GSP.FB.Vec3T> Points { get; set; }
+
+  public MeshHitsDataT() {
+    this.Faces = null;
+    this.Distances = null;
+    this.Vertices = null;
+    this.Barycentrics = null;
+    this.Points = null;
+  }
+  public static MeshHitsDataT DeserializeFromBinary(byte[] fbBuffer) {
+    return MeshHitsData.GetRootAsMeshHitsData(new ByteBuffer(fbBuffer)).UnPack();
+  }
+  public byte[] SerializeToBinary() {
+    var fbb = new FlatBufferBuilder(0x10000);
+    MeshHitsData.FinishMeshHitsDataBuffer(fbb, MeshHitsData.Pack(fbb, this));
+    return fbb.DataBuffer.ToSizedArray();
+  }
+}
+
+
+static public class MeshHitsDataVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyVectorOfData(tablePos, 4 /*Faces*/, 4 /*int*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 6 /*Distances*/, 8 /*double*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 8 /*Vertices*/, 12 /*GSP.FB.Vec3i*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 10 /*Barycentrics*/, 24 /*GSP.FB.Vec3*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 12 /*Points*/, 24 /*GSP.FB.Vec3*/, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+public struct FacesWithinData : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static FacesWithinData GetRootAsFacesWithinData(ByteBuffer _bb) { return GetRootAsFacesWithinData(_bb, new FacesWithinData()); }
+  public static FacesWithinData GetRootAsFacesWithinData(ByteBuffer _bb, FacesWithinData obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyFacesWithinData(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, FacesWithinDataVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public FacesWithinData __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public int Counts(int j) { int o = __p.__offset(4); return o != 0 ? __p.bb.GetInt(__p.__vector(o) + j * 4) : (int)0; }
+  public int CountsLength { get { int o = __p.__offset(4); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<int> GetCountsBytes() { return __p.__vector_as_span<int>(4, 4); }
+#else
+  public ArraySegment<byte>? GetCountsBytes() { return __p.__vector_as_arraysegment(4); }
+#endif
+  public int[] GetCountsArray() { return __p.__vector_as_array<int>(4); }
+  public int Faces(int j) { int o = __p.__offset(6); return o != 0 ? __p.bb.GetInt(__p.__vector(o) + j * 4) : (int)0; }
+  public int FacesLength { get { int o = __p.__offset(6); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<int> GetFacesBytes() { return __p.__vector_as_span<int>(6, 4); }
+#else
+  public ArraySegment<byte>? GetFacesBytes() { return __p.__vector_as_arraysegment(6); }
+#endif
+  public int[] GetFacesArray() { return __p.__vector_as_array<int>(6); }
+  public double Distances(int j) { int o = __p.__offset(8); return o != 0 ? __p.bb.GetDouble(__p.__vector(o) + j * 8) : (double)0; }
+  public int DistancesLength { get { int o = __p.__offset(8); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<double> GetDistancesBytes() { return __p.__vector_as_span<double>(8, 8); }
+#else
+  public ArraySegment<byte>? GetDistancesBytes() { return __p.__vector_as_arraysegment(8); }
+#endif
+  public double[] GetDistancesArray() { return __p.__vector_as_array<double>(8); }
+
+  public static Offset<GSP.FB.FacesWithinData> CreateFacesWithinData(FlatBufferBuilder builder,
+      VectorOffset countsOffset = default(VectorOffset),
+      VectorOffset facesOffset = default(VectorOffset),
+      VectorOffset distancesOffset = default(VectorOffset)) {
+    builder.StartTable(3);
+    FacesWithinData.AddDistances(builder, distancesOffset);
+    FacesWithinData.AddFaces(builder, facesOffset);
+    FacesWithinData.AddCounts(builder, countsOffset);
+    return FacesWithinData.EndFacesWithinData(builder);
+  }
+
+  public static void StartFacesWithinData(FlatBufferBuilder builder) { builder.StartTable(3); }
+  public static void AddCounts(FlatBufferBuilder builder, VectorOffset countsOffset) { builder.AddOffset(0, countsOffset.Value, 0); }
+  public static VectorOffset CreateCountsVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateCountsVectorBlock(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateCountsVectorBlock(FlatBufferBuilder builder, ArraySegment<int> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateCountsVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<int>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartCountsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddFaces(FlatBufferBuilder builder, VectorOffset facesOffset) { builder.AddOffset(1, facesOffset.Value, 0); }
+  public static VectorOffset CreateFacesVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateFacesVectorBlock(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateFacesVectorBlock(FlatBufferBuilder builder, ArraySegment<int> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateFacesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<int>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartFacesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddDistances(FlatBufferBuilder builder, VectorOffset distancesOffset) { builder.AddOffset(2, distancesOffset.Value, 0); }
+  public static VectorOffset CreateDistancesVector(FlatBufferBuilder builder, double[] data) { builder.StartVector(8, data.Length, 8); for (int i = data.Length - 1; i >= 0; i--) builder.AddDouble(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateDistancesVectorBlock(FlatBufferBuilder builder, double[] data) { builder.StartVector(8, data.Length, 8); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateDistancesVectorBlock(FlatBufferBuilder builder, ArraySegment<double> data) { builder.StartVector(8, data.Count, 8); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateDistancesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<double>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartDistancesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(8, numElems, 8); }
+  public static Offset<GSP.FB.FacesWithinData> EndFacesWithinData(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.FacesWithinData>(o);
+  }
+  public FacesWithinDataT UnPack() {
+    var _o = new FacesWithinDataT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(FacesWithinDataT _o) {
+    _o.Counts = new List<int>();
+    for (var _j = 0; _j < this.CountsLength; ++_j) {_o.Counts.Add(this.Counts(_j));}
+    _o.Faces = new List<int>();
+    for (var _j = 0; _j < this.FacesLength; ++_j) {_o.Faces.Add(this.Faces(_j));}
+    _o.Distances = new List<double>();
+    for (var _j = 0; _j < this.DistancesLength; ++_j) {_o.Distances.Add(this.Distances(_j));}
+  }
+  public static Offset<GSP.FB.FacesWithinData> Pack(FlatBufferBuilder builder, FacesWithinDataT _o) {
+    if (_o == null) return default(Offset<GSP.FB.FacesWithinData>);
+    var _counts = default(VectorOffset);
+    if (_o.Counts != null) {
+      var __counts = _o.Counts.ToArray();
+      _counts = CreateCountsVector(builder, __counts);
+    }
+    var _faces = default(VectorOffset);
+    if (_o.Faces != null) {
+      var __faces = _o.Faces.ToArray();
+      _faces = CreateFacesVector(builder, __faces);
+    }
+    var _distances = default(VectorOffset);
+    if (_o.Distances != null) {
+      var __distances = _o.Distances.ToArray();
+      _distances = CreateDistancesVector(builder, __distances);
+    }
+    return CreateFacesWithinData(
+      builder,
+      _counts,
+      _faces,
+      _distances);
+  }
+}
+
+public class FacesWithinDataT
+{
+  public List<int> Counts { get; set; }
+  public List<int> Faces { get; set; }
+  public List<double> Distances { get; set; }
+
+  public FacesWithinDataT() {
+    this.Counts = null;
+    this.Faces = null;
+    this.Distances = null;
+  }
+}
+
+
+static public class FacesWithinDataVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyVectorOfData(tablePos, 4 /*Counts*/, 4 /*int*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 6 /*Faces*/, 4 /*int*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 8 /*Distances*/, 8 /*double*/, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
@@ -9,6 +9,323 @@ using global::System;
 using global::System.Collections.Generic;
 using global::Google.FlatBuffers;
 
+public enum IndexEncoding : byte
+{
+  U16 = 0,
+  U32 = 1,
+  DeltaVarint = 2,
+};
+
+
+public struct CompressedFaces : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static CompressedFaces GetRootAsCompressedFaces(ByteBuffer _bb) { return GetRootAsCompressedFaces(_bb, new CompressedFaces()); }
+  public static CompressedFaces GetRootAsCompressedFaces(ByteBuffer _bb, CompressedFaces obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyCompressedFaces(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, CompressedFacesVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public CompressedFaces __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public GSP.FB.IndexEncoding Encoding { get { int o = __p.__offset(4); return o != 0 ? (GSP.FB.IndexEncoding)__p.bb.Get(o + __p.bb_pos) : GSP.FB.IndexEncoding.U16; } }
+  public byte FaceVertexCount { get { int o = __p.__offset(6); return o != 0 ? __p.bb.Get(o + __p.bb_pos) : (byte)3; } }
+  public uint FaceCount { get { int o = __p.__offset(8); return o != 0 ? __p.bb.GetUint(o + __p.bb_pos) : (uint)0; } }
+  public byte Data(int j) { int o = __p.__offset(10); return o != 0 ? __p.bb.Get(__p.__vector(o) + j * 1) : (byte)0; }
+  public int DataLength { get { int o = __p.__offset(10); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<byte> GetDataBytes() { return __p.__vector_as_span<byte>(10, 1); }
+#else
+  public ArraySegment<byte>? GetDataBytes() { return __p.__vector_as_arraysegment(10); }
+#endif
+  public byte[] GetDataArray() { return __p.__vector_as_array<byte>(10); }
+
+  public static Offset<GSP.FB.CompressedFaces> CreateCompressedFaces(FlatBufferBuilder builder,
+      GSP.FB.IndexEncoding encoding = GSP.FB.IndexEncoding.U16,
+      byte faceVertexCount = 3,
+      uint faceCount = 0,
+      VectorOffset dataOffset = default(VectorOffset)) {
+    builder.StartTable(4);
+    CompressedFaces.AddData(builder, dataOffset);
+    CompressedFaces.AddFaceCount(builder, faceCount);
+    CompressedFaces.AddFaceVertexCount(builder, faceVertexCount);
+    CompressedFaces.AddEncoding(builder, encoding);
+    return CompressedFaces.EndCompressedFaces(builder);
+  }
+
+  public static void StartCompressedFaces(FlatBufferBuilder builder) { builder.StartTable(4); }
+  public static void AddEncoding(FlatBufferBuilder builder, GSP.FB.IndexEncoding encoding) { builder.AddByte(0, (byte)encoding, 0); }
+  public static void AddFaceVertexCount(FlatBufferBuilder builder, byte faceVertexCount) { builder.AddByte(1, faceVertexCount, 3); }
+  public static void AddFaceCount(FlatBufferBuilder builder, uint faceCount) { builder.AddUint(2, faceCount, 0); }
+  public static void AddData(FlatBufferBuilder builder, VectorOffset dataOffset) { builder.AddOffset(3, dataOffset.Value, 0); }
+  public static VectorOffset CreateDataVector(FlatBufferBuilder builder, byte[] data) { builder.StartVector(1, data.Length, 1); for (int i = data.Length - 1; i >= 0; i--) builder.AddByte(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateDataVectorBlock(FlatBufferBuilder builder, byte[] data) { builder.StartVector(1, data.Length, 1); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateDataVectorBlock(FlatBufferBuilder builder, ArraySegment<byte> data) { builder.StartVector(1, data.Count, 1); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateDataVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<byte>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartDataVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(1, numElems, 1); }
+  public static Offset<GSP.FB.CompressedFaces> EndCompressedFaces(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.CompressedFaces>(o);
+  }
+  public CompressedFacesT UnPack() {
+    var _o = new CompressedFacesT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(CompressedFacesT _o) {
+    _o.Encoding = this.Encoding;
+    _o.FaceVertexCount = this.FaceVertexCount;
+    _o.FaceCount = this.FaceCount;
+    _o.Data = new List<byte>();
+    for (var _j = 0; _j < this.DataLength; ++_j) {_o.Data.Add(this.Data(_j));}
+  }
+  public static Offset<GSP.FB.CompressedFaces> Pack(FlatBufferBuilder builder, CompressedFacesT _o) {
+    if (_o == null) return default(Offset<GSP.FB.CompressedFaces>);
+    var _data = default(VectorOffset);
+    if (_o.Data != null) {
+      var __data = _o.Data.ToArray();
+      _data = CreateDataVector(builder, __data);
+    }
+    return CreateCompressedFaces(
+      builder,
+      _o.Encoding,
+      _o.FaceVertexCount,
+      _o.FaceCount,
+      _data);
+  }
+}
+
+public class CompressedFacesT
+{
+  public GSP.FB.IndexEncoding Encoding { get; set; }
+  public byte FaceVertexCount { get; set; }
+  public uint FaceCount { get; set; }
+  public List<byte> Data { get; set; }
+
+  public CompressedFacesT() {
+    this.Encoding = GSP.FB.IndexEncoding.U16;
+    this.FaceVertexCount = 3;
+    this.FaceCount = 0;
+    this.Data = null;
+  }
+}
+
+
+static public class CompressedFacesVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyField(tablePos, 4 /*Encoding*/, 1 /*GSP.FB.IndexEncoding*/, 1, false)
+      && verifier.VerifyField(tablePos, 6 /*FaceVertexCount*/, 1 /*byte*/, 1, false)
+      && verifier.VerifyField(tablePos, 8 /*FaceCount*/, 4 /*uint*/, 4, false)
+      && verifier.VerifyVectorOfData(tablePos, 10 /*Data*/, 1 /*byte*/, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+public enum AttributeDomain : byte
+{
+  Vertex = 0,
+  Face = 1,
+};
+
+
+public struct MeshAttribute : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static MeshAttribute GetRootAsMeshAttribute(ByteBuffer _bb) { return GetRootAsMeshAttribute(_bb, new MeshAttribute()); }
+  public static MeshAttribute GetRootAsMeshAttribute(ByteBuffer _bb, MeshAttribute obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyMeshAttribute(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, MeshAttributeVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public MeshAttribute __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public string Name { get { int o = __p.__offset(4); return o != 0 ? __p.__string(o + __p.bb_pos) : null; } }
+#if ENABLE_SPAN_T
+  public Span<byte> GetNameBytes() { return __p.__vector_as_span<byte>(4, 1); }
+#else
+  public ArraySegment<byte>? GetNameBytes() { return __p.__vector_as_arraysegment(4); }
+#endif
+  public byte[] GetNameArray() { return __p.__vector_as_array<byte>(4); }
+  public GSP.FB.AttributeDomain Domain { get { int o = __p.__offset(6); return o != 0 ? (GSP.FB.AttributeDomain)__p.bb.Get(o + __p.bb_pos) : GSP.FB.AttributeDomain.Vertex; } }
+  public byte Dimension { get { int o = __p.__offset(8); return o != 0 ? __p.bb.Get(o + __p.bb_pos) : (byte)1; } }
+  public float F32(int j) { int o = __p.__offset(10); return o != 0 ? __p.bb.GetFloat(__p.__vector(o) + j * 4) : (float)0; }
+  public int F32Length { get { int o = __p.__offset(10); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<float> GetF32Bytes() { return __p.__vector_as_span<float>(10, 4); }
+#else
+  public ArraySegment<byte>? GetF32Bytes() { return __p.__vector_as_arraysegment(10); }
+#endif
+  public float[] GetF32Array() { return __p.__vector_as_array<float>(10); }
+  public double F64(int j) { int o = __p.__offset(12); return o != 0 ? __p.bb.GetDouble(__p.__vector(o) + j * 8) : (double)0; }
+  public int F64Length { get { int o = __p.__offset(12); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<double> GetF64Bytes() { return __p.__vector_as_span<double>(12, 8); }
+#else
+  public ArraySegment<byte>? GetF64Bytes() { return __p.__vector_as_arraysegment(12); }
+#endif
+  public double[] GetF64Array() { return __p.__vector_as_array<double>(12); }
+  public int I32(int j) { int o = __p.__offset(14); return o != 0 ? __p.bb.GetInt(__p.__vector(o) + j * 4) : (int)0; }
+  public int I32Length { get { int o = __p.__offset(14); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<int> GetI32Bytes() { return __p.__vector_as_span<int>(14, 4); }
+#else
+  public ArraySegment<byte>? GetI32Bytes() { return __p.__vector_as_arraysegment(14); }
+#endif
+  public int[] GetI32Array() { return __p.__vector_as_array<int>(14); }
+  public byte U8(int j) { int o = __p.__offset(16); return o != 0 ? __p.bb.Get(__p.__vector(o) + j * 1) : (byte)0; }
+  public int U8Length { get { int o = __p.__offset(16); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<byte> GetU8Bytes() { return __p.__vector_as_span<byte>(16, 1); }
+#else
+  public ArraySegment<byte>? GetU8Bytes() { return __p.__vector_as_arraysegment(16); }
+#endif
+  public byte[] GetU8Array() { return __p.__vector_as_array<byte>(16); }
+
+  public static Offset<GSP.FB.MeshAttribute> CreateMeshAttribute(FlatBufferBuilder builder,
+      StringOffset nameOffset = default(StringOffset),
+      GSP.FB.AttributeDomain domain = GSP.FB.AttributeDomain.Vertex,
+      byte dimension = 1,
+      VectorOffset f32Offset = default(VectorOffset),
+      VectorOffset f64Offset = default(VectorOffset),
+      VectorOffset i32Offset = default(VectorOffset),
+      VectorOffset u8Offset = default(VectorOffset)) {
+    builder.StartTable(7);
+    MeshAttribute.AddU8(builder, u8Offset);
+    MeshAttribute.AddI32(builder, i32Offset);
+    MeshAttribute.AddF64(builder, f64Offset);
+    MeshAttribute.AddF32(builder, f32Offset);
+    MeshAttribute.AddName(builder, nameOffset);
+    MeshAttribute.AddDimension(builder, dimension);
+    MeshAttribute.AddDomain(builder, domain);
+    return MeshAttribute.EndMeshAttribute(builder);
+  }
+
+  public static void StartMeshAttribute(FlatBufferBuilder builder) { builder.StartTable(7); }
+  public static void AddName(FlatBufferBuilder builder, StringOffset nameOffset) { builder.AddOffset(0, nameOffset.Value, 0); }
+  public static void AddDomain(FlatBufferBuilder builder, GSP.FB.AttributeDomain domain) { builder.AddByte(1, (byte)domain, 0); }
+  public static void AddDimension(FlatBufferBuilder builder, byte dimension) { builder.AddByte(2, dimension, 1); }
+  public static void AddF32(FlatBufferBuilder builder, VectorOffset f32Offset) { builder.AddOffset(3, f32Offset.Value, 0); }
+  public static VectorOffset CreateF32Vector(FlatBufferBuilder builder, float[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddFloat(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateF32VectorBlock(FlatBufferBuilder builder, float[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateF32VectorBlock(FlatBufferBuilder builder, ArraySegment<float> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateF32VectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<float>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartF32Vector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddF64(FlatBufferBuilder builder, VectorOffset f64Offset) { builder.AddOffset(4, f64Offset.Value, 0); }
+  public static VectorOffset CreateF64Vector(FlatBufferBuilder builder, double[] data) { builder.StartVector(8, data.Length, 8); for (int i = data.Length - 1; i >= 0; i--) builder.AddDouble(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateF64VectorBlock(FlatBufferBuilder builder, double[] data) { builder.StartVector(8, data.Length, 8); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateF64VectorBlock(FlatBufferBuilder builder, ArraySegment<double> data) { builder.StartVector(8, data.Count, 8); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateF64VectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<double>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartF64Vector(FlatBufferBuilder builder, int numElems) { builder.StartVector(8, numElems, 8); }
+  public static void AddI32(FlatBufferBuilder builder, VectorOffset i32Offset) { builder.AddOffset(5, i32Offset.Value, 0); }
+  public static VectorOffset CreateI32Vector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateI32VectorBlock(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateI32VectorBlock(FlatBufferBuilder builder, ArraySegment<int> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateI32VectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<int>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartI32Vector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddU8(FlatBufferBuilder builder, VectorOffset u8Offset) { builder.AddOffset(6, u8Offset.Value, 0); }
+  public static VectorOffset CreateU8Vector(FlatBufferBuilder builder, byte[] data) { builder.StartVector(1, data.Length, 1); for (int i = data.Length - 1; i >= 0; i--) builder.AddByte(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateU8VectorBlock(FlatBufferBuilder builder, byte[] data) { builder.StartVector(1, data.Length, 1); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateU8VectorBlock(FlatBufferBuilder builder, ArraySegment<byte> data) { builder.StartVector(1, data.Count, 1); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateU8VectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<byte>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartU8Vector(FlatBufferBuilder builder, int numElems) { builder.StartVector(1, numElems, 1); }
+  public static Offset<GSP.FB.MeshAttribute> EndMeshAttribute(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.MeshAttribute>(o);
+  }
+  public MeshAttributeT UnPack() {
+    var _o = new MeshAttributeT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(MeshAttributeT _o) {
+    _o.Name = this.Name;
+    _o.Domain = this.Domain;
+    _o.Dimension = this.Dimension;
+    _o.F32 = new List<float>();
+    for (var _j = 0; _j < this.F32Length; ++_j) {_o.F32.Add(this.F32(_j));}
+    _o.F64 = new List<double>();
+    for (var _j = 0; _j < this.F64Length; ++_j) {_o.F64.Add(this.F64(_j));}
+    _o.I32 = new List<int>();
+    for (var _j = 0; _j < this.I32Length; ++_j) {_o.I32.Add(this.I32(_j));}
+    _o.U8 = new List<byte>();
+    for (var _j = 0; _j < this.U8Length; ++_j) {_o.U8.Add(this.U8(_j));}
+  }
+  public static Offset<GSP.FB.MeshAttribute> Pack(FlatBufferBuilder builder, MeshAttributeT _o) {
+    if (_o == null) return default(Offset<GSP.FB.MeshAttribute>);
+    var _name = _o.Name == null ? default(StringOffset) : builder.CreateString(_o.Name);
+    var _f32 = default(VectorOffset);
+    if (_o.F32 != null) {
+      var __f32 = _o.F32.ToArray();
+      _f32 = CreateF32Vector(builder, __f32);
+    }
+    var _f64 = default(VectorOffset);
+    if (_o.F64 != null) {
+      var __f64 = _o.F64.ToArray();
+      _f64 = CreateF64Vector(builder, __f64);
+    }
+    var _i32 = default(VectorOffset);
+    if (_o.I32 != null) {
+      var __i32 = _o.I32.ToArray();
+      _i32 = CreateI32Vector(builder, __i32);
+    }
+    var _u8 = default(VectorOffset);
+    if (_o.U8 != null) {
+      var __u8 = _o.U8.ToArray();
+      _u8 = CreateU8Vector(builder, __u8);
+    }
+    return CreateMeshAttribute(
+      builder,
+      _name,
+      _o.Domain,
+      _o.Dimension,
+      _f32,
+      _f64,
+      _i32,
+      _u8);
+  }
+}
+
+public class MeshAttributeT
+{
+  public string Name { get; set; }
+  public GSP.FB.AttributeDomain Domain { get; set; }
+  public byte Dimension { get; set; }
+  public List<float> F32 { get; set; }
+  public List<double> F64 { get; set; }
+  public List<int> I32 { get; set; }
+  public List<byte> U8 { get; set; }
+
+  public MeshAttributeT() {
+    this.Name = null;
+    this.Domain = GSP.FB.AttributeDomain.Vertex;
+    this.Dimension = 1;
+    this.F32 = null;
+    this.F64 = null;
+    this.I32 = null;
+    this.U8 = null;
+  }
+}
+
+
+static public class MeshAttributeVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyString(tablePos, 4 /*Name*/, false)
+      && verifier.VerifyField(tablePos, 6 /*Domain*/, 1 /*GSP.FB.AttributeDomain*/, 1, false)
+      && verifier.VerifyField(tablePos, 8 /*Dimension*/, 1 /*byte*/, 1, false)
+      && verifier.VerifyVectorOfData(tablePos, 10 /*F32*/, 4 /*float*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 12 /*F64*/, 8 /*double*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 14 /*I32*/, 4 /*int*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 16 /*U8*/, 1 /*byte*/, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
 public struct MeshData : IFlatbufferObject
 {
   private Table __p;
@@ -26,25 +343,81 @@ public struct MeshData : IFlatbufferObject
   public int FacesLength { get { int o = __p.__offset(6); return o != 0 ? __p.__vector_len(o) : 0; } }
   public GSP.FB.Vec4i? QuadFaces(int j) { int o = __p.__offset(8); return o != 0 ? (GSP.FB.Vec4i?)(new GSP.FB.Vec4i()).__assign(__p.__vector(o) + j * 16, __p.bb) : null; }
   public int QuadFacesLength { get { int o = __p.__offset(8); return o != 0 ? __p.__vector_len(o) : 0; } }
+  public GSP.FB.Vec3f? VerticesF(int j) { int o = __p.__offset(10); return o != 0 ? (GSP.FB.Vec3f?)(new GSP.FB.Vec3f()).__assign(__p.__vector(o) + j * 12, __p.bb) : null; }
+  public int VerticesFLength { get { int o = __p.__offset(10); return o != 0 ? __p.__vector_len(o) : 0; } }
+  public GSP.FB.QuantizedPositions? VerticesQ { get { int o = __p.__offset(12); return o != 0 ? (GSP.FB.QuantizedPositions?)(new GSP.FB.QuantizedPositions()).__assign(__p.__indirect(o + __p.bb_pos), __p.bb) : null; } }
+  public GSP.FB.CompressedFaces? FacesC { get { int o = __p.__offset(14); return o != 0 ? (GSP.FB.CompressedFaces?)(new GSP.FB.CompressedFaces()).__assign(__p.__indirect(o + __p.bb_pos), __p.bb) : null; } }
+  public int FaceOffsets(int j) { int o = __p.__offset(16); return o != 0 ? __p.bb.GetInt(__p.__vector(o) + j * 4) : (int)0; }
+  public int FaceOffsetsLength { get { int o = __p.__offset(16); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<int> GetFaceOffsetsBytes() { return __p.__vector_as_span<int>(16, 4); }
+#else
+  public ArraySegment<byte>? GetFaceOffsetsBytes() { return __p.__vector_as_arraysegment(16); }
+#endif
+  public int[] GetFaceOffsetsArray() { return __p.__vector_as_array<int>(16); }
+  public int FaceIndices(int j) { int o = __p.__offset(18); return o != 0 ? __p.bb.GetInt(__p.__vector(o) + j * 4) : (int)0; }
+  public int FaceIndicesLength { get { int o = __p.__offset(18); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<int> GetFaceIndicesBytes() { return __p.__vector_as_span<int>(18, 4); }
+#else
+  public ArraySegment<byte>? GetFaceIndicesBytes() { return __p.__vector_as_arraysegment(18); }
+#endif
+  public int[] GetFaceIndicesArray() { return __p.__vector_as_array<int>(18); }
+  public GSP.FB.MeshAttribute? Attributes(int j) { int o = __p.__offset(20); return o != 0 ? (GSP.FB.MeshAttribute?)(new GSP.FB.MeshAttribute()).__assign(__p.__indirect(__p.__vector(o) + j * 4), __p.bb) : null; }
+  public int AttributesLength { get { int o = __p.__offset(20); return o != 0 ? __p.__vector_len(o) : 0; } }
 
   public static Offset<GSP.FB.MeshData> CreateMeshData(FlatBufferBuilder builder,
       VectorOffset verticesOffset = default(VectorOffset),
       VectorOffset facesOffset = default(VectorOffset),
-      VectorOffset quad_facesOffset = default(VectorOffset)) {
-    builder.StartTable(3);
+      VectorOffset quad_facesOffset = default(VectorOffset),
+      VectorOffset vertices_fOffset = default(VectorOffset),
+      Offset<GSP.FB.QuantizedPositions> verticesQOffset = default(Offset<GSP.FB.QuantizedPositions>),
+      Offset<GSP.FB.CompressedFaces> facesCOffset = default(Offset<GSP.FB.CompressedFaces>),
+      VectorOffset face_offsetsOffset = default(VectorOffset),
+      VectorOffset face_indicesOffset = default(VectorOffset),
+      VectorOffset attributesOffset = default(VectorOffset)) {
+    builder.StartTable(9);
+    MeshData.AddAttributes(builder, attributesOffset);
+    MeshData.AddFaceIndices(builder, face_indicesOffset);
+    MeshData.AddFaceOffsets(builder, face_offsetsOffset);
+    MeshData.AddFacesC(builder, facesCOffset);
+    MeshData.AddVerticesQ(builder, verticesQOffset);
+    MeshData.AddVerticesF(builder, vertices_fOffset);
     MeshData.AddQuadFaces(builder, quad_facesOffset);
     MeshData.AddFaces(builder, facesOffset);
     MeshData.AddVertices(builder, verticesOffset);
     return MeshData.EndMeshData(builder);
   }
 
-  public static void StartMeshData(FlatBufferBuilder builder) { builder.StartTable(3); }
+  public static void StartMeshData(FlatBufferBuilder builder) { builder.StartTable(9); }
   public static void AddVertices(FlatBufferBuilder builder, VectorOffset verticesOffset) { builder.AddOffset(0, verticesOffset.Value, 0); }
   public static void StartVerticesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(24, numElems, 8); }
   public static void AddFaces(FlatBufferBuilder builder, VectorOffset facesOffset) { builder.AddOffset(1, facesOffset.Value, 0); }
   public static void StartFacesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(12, numElems, 4); }
   public static void AddQuadFaces(FlatBufferBuilder builder, VectorOffset quadFacesOffset) { builder.AddOffset(2, quadFacesOffset.Value, 0); }
   public static void StartQuadFacesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(16, numElems, 4); }
+  public static void AddVerticesF(FlatBufferBuilder builder, VectorOffset verticesFOffset) { builder.AddOffset(3, verticesFOffset.Value, 0); }
+  public static void StartVerticesFVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(12, numElems, 4); }
+  public static void AddVerticesQ(FlatBufferBuilder builder, Offset<GSP.FB.QuantizedPositions> verticesQOffset) { builder.AddOffset(4, verticesQOffset.Value, 0); }
+  public static void AddFacesC(FlatBufferBuilder builder, Offset<GSP.FB.CompressedFaces> facesCOffset) { builder.AddOffset(5, facesCOffset.Value, 0); }
+  public static void AddFaceOffsets(FlatBufferBuilder builder, VectorOffset faceOffsetsOffset) { builder.AddOffset(6, faceOffsetsOffset.Value, 0); }
+  public static VectorOffset CreateFaceOffsetsVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateFaceOffsetsVectorBlock(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateFaceOffsetsVectorBlock(FlatBufferBuilder builder, ArraySegment<int> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateFaceOffsetsVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<int>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartFaceOffsetsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddFaceIndices(FlatBufferBuilder builder, VectorOffset faceIndicesOffset) { builder.AddOffset(7, faceIndicesOffset.Value, 0); }
+  public static VectorOffset CreateFaceIndicesVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateFaceIndicesVectorBlock(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateFaceIndicesVectorBlock(FlatBufferBuilder builder, ArraySegment<int> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateFaceIndicesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<int>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartFaceIndicesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddAttributes(FlatBufferBuilder builder, VectorOffset attributesOffset) { builder.AddOffset(8, attributesOffset.Value, 0); }
+  public static VectorOffset CreateAttributesVector(FlatBufferBuilder builder, Offset<GSP.FB.MeshAttribute>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
+  public static VectorOffset CreateAttributesVectorBlock(FlatBufferBuilder builder, Offset<GSP.FB.MeshAttribute>[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateAttributesVectorBlock(FlatBufferBuilder builder, ArraySegment<Offset<GSP.FB.MeshAttribute>> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateAttributesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<Offset<GSP.FB.MeshAttribute>>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartAttributesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
   public static Offset<GSP.FB.MeshData> EndMeshData(FlatBufferBuilder builder) {
     int o = builder.EndTable();
     return new Offset<GSP.FB.MeshData>(o);
@@ -63,6 +436,16 @@ public struct MeshData : IFlatbufferObject
     for (var _j = 0; _j < this.FacesLength; ++_j) {_o.Faces.Add(this.Faces(_j).HasValue ? this.Faces(_j).Value.UnPack() : null);}
     _o.QuadFaces = new List<GSP.FB.Vec4iT>();
     for (var _j = 0; _j < this.QuadFacesLength; ++_j) {_o.QuadFaces.Add(this.QuadFaces(_j).HasValue ? this.QuadFaces(_j).Value.UnPack() : null);}
+    _o.VerticesF = new List<GSP.FB.Vec3fT>();
+    for (var _j = 0; _j < this.VerticesFLength; ++_j) {_o.VerticesF.Add(this.VerticesF(_j).HasValue ? this.VerticesF(_j).Value.UnPack() : null);}
+    _o.VerticesQ = this.VerticesQ.HasValue ? this.VerticesQ.Value.UnPack() : null;
+    _o.FacesC = this.FacesC.HasValue ? this.FacesC.Value.UnPack() : null;
+    _o.FaceOffsets = new List<int>();
+    for (var _j = 0; _j < this.FaceOffsetsLength; ++_j) {_o.FaceOffsets.Add(this.FaceOffsets(_j));}
+    _o.FaceIndices = new List<int>();
+    for (var _j = 0; _j < this.FaceIndicesLength; ++_j) {_o.FaceIndices.Add(this.FaceIndices(_j));}
+    _o.Attributes = new List<GSP.FB.MeshAttributeT>();
+    for (var _j = 0; _j < this.AttributesLength; ++_j) {_o.Attributes.Add(this.Attributes(_j).HasValue ? this.Attributes(_j).Value.UnPack() : null);}
   }
   public static Offset<GSP.FB.MeshData> Pack(FlatBufferBuilder builder, MeshDataT _o) {
     if (_o == null) return default(Offset<GSP.FB.MeshData>);
@@ -84,11 +467,41 @@ public struct MeshData : IFlatbufferObject
       for (var _j = _o.QuadFaces.Count - 1; _j >= 0; --_j) { GSP.FB.Vec4i.Pack(builder, _o.QuadFaces[_j]); }
       _quad_faces = builder.EndVector();
     }
+    var _vertices_f = default(VectorOffset);
+    if (_o.VerticesF != null) {
+      StartVerticesFVector(builder, _o.VerticesF.Count);
+      for (var _j = _o.VerticesF.Count - 1; _j >= 0; --_j) { GSP.FB.Vec3f.Pack(builder, _o.VerticesF[_j]); }
+      _vertices_f = builder.EndVector();
+    }
+    var _vertices_q = _o.VerticesQ == null ? default(Offset<GSP.FB.QuantizedPositions>) : GSP.FB.QuantizedPositions.Pack(builder, _o.VerticesQ);
+    var _faces_c = _o.FacesC == null ? default(Offset<GSP.FB.CompressedFaces>) : GSP.FB.CompressedFaces.Pack(builder, _o.FacesC);
+    var _face_offsets = default(VectorOffset);
+    if (_o.FaceOffsets != null) {
+      var __face_offsets = _o.FaceOffsets.ToArray();
+      _face_offsets = CreateFaceOffsetsVector(builder, __face_offsets);
+    }
+    var _face_indices = default(VectorOffset);
+    if (_o.FaceIndices != null) {
+      var __face_indices = _o.FaceIndices.ToArray();
+      _face_indices = CreateFaceIndicesVector(builder, __face_indices);
+    }
+    var _attributes = default(VectorOffset);
+    if (_o.Attributes != null) {
+      var __attributes = new Offset<GSP.FB.MeshAttribute>[_o.Attributes.Count];
+      for (var _j = 0; _j < __attributes.Length; ++_j) { __attributes[_j] = GSP.FB.MeshAttribute.Pack(builder, _o.Attributes[_j]); }
+      _attributes = CreateAttributesVector(builder, __attributes);
+    }
     return CreateMeshData(
       builder,
       _vertices,
       _faces,
-      _quad_faces);
+      _quad_faces,
+      _vertices_f,
+      _vertices_q,
+      _faces_c,
+      _face_offsets,
+      _face_indices,
+      _attributes);
   }
 }
 
@@ -97,11 +510,23 @@ public class MeshDataT
   public List<GSP.FB.Vec3T> Vertices { get; set; }
   public List<GSP.FB.Vec3iT> Faces { get; set; }
   public List<GSP.FB.Vec4iT> QuadFaces { get; set; }
+  public List<GSP.FB.Vec3fT> VerticesF { get; set; }
+  public GSP.FB.QuantizedPositionsT VerticesQ { get; set; }
+  public GSP.FB.CompressedFacesT FacesC { get; set; }
+  public List<int> FaceOffsets { get; set; }
+  public List<int> FaceIndices { get; set; }
+  public List<GSP.FB.MeshAttributeT> Attributes { get; set; }
 
   public MeshDataT() {
     this.Vertices = null;
     this.Faces = null;
     this.QuadFaces = null;
+    this.VerticesF = null;
+    this.VerticesQ = null;
+    this.FacesC = null;
+    this.FaceOffsets = null;
+    this.FaceIndices = null;
+    this.Attributes = null;
   }
   public static MeshDataT DeserializeFromBinary(byte[] fbBuffer) {
     return MeshData.GetRootAsMeshData(new ByteBuffer(fbBuffer)).UnPack();
@@ -122,6 +547,12 @@ static public class MeshDataVerify
       && verifier.VerifyVectorOfData(tablePos, 4 /*Vertices*/, 24 /*GSP.FB.Vec3*/, false)
       && verifier.VerifyVectorOfData(tablePos, 6 /*Faces*/, 12 /*GSP.FB.Vec3i*/, false)
       && verifier.VerifyVectorOfData(tablePos, 8 /*QuadFaces*/, 16 /*GSP.FB.Vec4i*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 10 /*VerticesF*/, 12 /*GSP.FB.Vec3f*/, false)
+      && verifier.VerifyTable(tablePos, 12 /*VerticesQ*/, GSP.FB.QuantizedPositionsVerify.Verify, false)
+      && verifier.VerifyTable(tablePos, 14 /*FacesC*/, GSP.FB.CompressedFacesVerify.Verify, false)
+      && verifier.VerifyVectorOfData(tablePos, 16 /*FaceOffsets*/, 4 /*int*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 18 /*FaceIndices*/, 4 /*int*/, false)
+      && verifier.VerifyVectorOfTables(tablePos, 20 /*Attributes*/, GSP.FB.MeshAttributeVerify.Verify, false)
       && verifier.VerifyTableEnd(tablePos);
   }
 }
@@ -0,0 +1,97 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace GSP.FB
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct PointArrayBatch : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static PointArrayBatch GetRootAsPointArrayBatch(ByteBuffer _bb) { return GetRootAsPointArrayBatch(_bb, new PointArrayBatch()); }
+  public static PointArrayBatch GetRootAsPointArrayBatch(ByteBuffer _bb, PointArrayBatch obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyPointArrayBatch(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, PointArrayBatchVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public PointArrayBatch __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public GSP.FB.PointArrayData? PointArrays(int j) { int o = __p.__offset(4); return o != 0 ? (GSP.FB.PointArrayData?)(new GSP.FB.PointArrayData()).__assign(__p.__indirect(__p.__vector(o) + j * 4), __p.bb) : null; }
+  public int PointArraysLength { get { int o = __p.__offset(4); return o != 0 ? __p.__vector_len(o) : 0; } }
+
+  public static Offset<GSP.FB.PointArrayBatch> CreatePointArrayBatch(FlatBufferBuilder builder,
+      VectorOffset point_arraysOffset = default(VectorOffset)) {
+    builder.StartTable(1);
+    PointArrayBatch.AddPointArrays(builder, point_arraysOffset);
+    return PointArrayBatch.EndPointArrayBatch(builder);
+  }
+
+  public static void StartPointArrayBatch(FlatBufferBuilder builder) { builder.StartTable(1); }
+  public static void AddPointArrays(FlatBufferBuilder builder, VectorOffset pointArraysOffset) { builder.AddOffset(0, pointArraysOffset.Value, 0); }
+  public static VectorOffset CreatePointArraysVector(FlatBufferBuilder builder, Offset<GSP.FB.PointArrayData>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
+  public static VectorOffset CreatePointArraysVectorBlock(FlatBufferBuilder builder, Offset<GSP.FB.PointArrayData>[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreatePointArraysVectorBlock(FlatBufferBuilder builder, ArraySegment<Offset<GSP.FB.PointArrayData>> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreatePointArraysVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<Offset<GSP.FB.PointArrayData>>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartPointArraysVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static Offset<GSP.FB.PointArrayBatch> EndPointArrayBatch(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.PointArrayBatch>(o);
+  }
+  public static void FinishPointArrayBatchBuffer(FlatBufferBuilder builder, Offset<GSP.FB.PointArrayBatch> offset) { builder.Finish(offset.Value); }
+  public static void FinishSizePrefixedPointArrayBatchBuffer(FlatBufferBuilder builder, Offset<GSP.FB.PointArrayBatch> offset) { builder.FinishSizePrefixed(offset.Value); }
+  public PointArrayBatchT UnPack() {
+    var _o = new PointArrayBatchT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(PointArrayBatchT _o) {
+    _o.PointArrays = new List<GSP.FB.PointArrayDataT>();
+    for (var _j = 0; _j < this.PointArraysLength; ++_j) {_o.PointArrays.Add(this.PointArrays(_j).HasValue ? this.PointArrays(_j).Value.UnPack() : null);}
+  }
+  public static Offset<GSP.FB.PointArrayBatch> Pack(FlatBufferBuilder builder, PointArrayBatchT _o) {
+    if (_o == null) return default(Offset<GSP.FB.PointArrayBatch>);
+    var _point_arrays = default(VectorOffset);
+    if (_o.PointArrays != null) {
+      var __point_arrays = new Offset<GSP.FB.PointArrayData>[_o.PointArrays.Count];
+      for (var _j = 0; _j < __point_arrays.Length; ++_j) { __point_arrays[_j] = GSP.FB.PointArrayData.Pack(builder, _o.PointArrays[_j]); }
+      _point_arrays = CreatePointArraysVector(builder, __point_arrays);
+    }
+    return CreatePointArrayBatch(
+      builder,
+      _point_arrays);
+  }
+}
+
+public class PointArrayBatchT
+{
+  public List<GSP.FB.PointArrayDataT> PointArrays { get; set; }
+
+  public PointArrayBatchT() {
+    this.PointArrays = null;
+  }
+  public static PointArrayBatchT DeserializeFromBinary(byte[] fbBuffer) {
+    return PointArrayBatch.GetRootAsPointArrayBatch(new ByteBuffer(fbBuffer)).UnPack();
+  }
+  public byte[] SerializeToBinary() {
+    var fbb = new FlatBufferBuilder(0x10000);
+    PointArrayBatch.FinishPointArrayBatchBuffer(fbb, PointArrayBatch.Pack(fbb, this));
+    return fbb.DataBuffer.ToSizedArray();
+  }
+}
+
+
+static public class PointArrayBatchVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyVectorOfTables(tablePos, 4 /*PointArrays*/, GSP.FB.PointArrayDataVerify.Verify, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
@@ -22,17 +22,27 @@ public struct PointArrayData : IFlatbufferObject
 
   public GSP.FB.Vec3? Points(int j) { int o = __p.__offset(4); return o != 0 ? (GSP.FB.Vec3?)(new GSP.FB.Vec3()).__assign(__p.__vector(o) + j * 24, __p.bb) : null; }
   public int PointsLength { get { int o = __p.__offset(4); return o != 0 ? __p.__vector_len(o) : 0; } }
+  public GSP.FB.Vec3f? PointsF(int j) { int o = __p.__offset(6); return o != 0 ? (GSP.FB.Vec3f?)(new GSP.FB.Vec3f()).__assign(__p.__vector(o) + j * 12, __p.bb) : null; }
+  public int PointsFLength { get { int o = __p.__offset(6); return o != 0 ? __p.__vector_len(o) : 0; } }
+  public GSP.FB.QuantizedPositions? PointsQ { get { int o = __p.__offset(8); return o != 0 ? (GSP.FB.QuantizedPositions?)(new GSP.FB.QuantizedPositions()).__assign(__p.__indirect(o + __p.bb_pos), __p.bb) : null; } }
 
   public static Offset<GSP.FB.PointArrayData> CreatePointArrayData(FlatBufferBuilder builder,
-      VectorOffset pointsOffset = default(VectorOffset)) {
-    builder.StartTable(1);
+      VectorOffset pointsOffset = default(VectorOffset),
+      VectorOffset points_fOffset = default(VectorOffset),
+      Offset<GSP.FB.QuantizedPositions> pointsQOffset = default(Offset<GSP.FB.QuantizedPositions>)) {
+    builder.StartTable(3);
+    PointArrayData.AddPointsQ(builder, pointsQOffset);
+    PointArrayData.AddPointsF(builder, points_fOffset);
     PointArrayData.AddPoints(builder, pointsOffset);
     return PointArrayData.EndPointArrayData(builder);
   }
 
-  public static void StartPointArrayData(FlatBufferBuilder builder) { builder.StartTable(1); }
+  public static void StartPointArrayData(FlatBufferBuilder builder) { builder.StartTable(3); }
   public static void AddPoints(FlatBufferBuilder builder, VectorOffset pointsOffset) { builder.AddOffset(0, pointsOffset.Value, 0); }
   public static void StartPointsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(24, numElems, 8); }
+  public static void AddPointsF(FlatBufferBuilder builder, VectorOffset pointsFOffset) { builder.AddOffset(1, pointsFOffset.Value, 0); }
+  public static void StartPointsFVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(12, numElems, 4); }
+  public static void AddPointsQ(FlatBufferBuilder builder, Offset<GSP.FB.QuantizedPositions> pointsQOffset) { builder.AddOffset(2, pointsQOffset.Value, 0); }
   public static Offset<GSP.FB.PointArrayData> EndPointArrayData(FlatBufferBuilder builder) {
     int o = builder.EndTable();
     return new Offset<GSP.FB.PointArrayData>(o);
@@ -47,6 +57,9 @@ public struct PointArrayData : IFlatbufferObject
   public void UnPackTo(PointArrayDataT _o) {
     _o.Points = new List<GSP.FB.Vec3T>();
     for (var _j = 0; _j < this.PointsLength; ++_j) {_o.Points.Add(this.Points(_j).HasValue ? this.Points(_j).Value.UnPack() : null);}
+    _o.PointsF = new List<GSP.FB.Vec3fT>();
+    for (var _j = 0; _j < this.PointsFLength; ++_j) {_o.PointsF.Add(this.PointsF(_j).HasValue ? this.PointsF(_j).Value.UnPack() : null);}
+    _o.PointsQ = this.PointsQ.HasValue ? this.PointsQ.Value.UnPack() : null;
   }
   public static Offset<GSP.FB.PointArrayData> Pack(FlatBufferBuilder builder, PointArrayDataT _o) {
     if (_o == null) return default(Offset<GSP.FB.PointArrayData>);
@@ -56,18 +69,31 @@ public struct PointArrayData : IFlatbufferObject
       for (var _j = _o.Points.Count - 1; _j >= 0; --_j) { GSP.FB.Vec3.Pack(builder, _o.Points[_j]); }
       _points = builder.EndVector();
     }
+    var _points_f = default(VectorOffset);
+    if (_o.PointsF != null) {
+      StartPointsFVector(builder, _o.PointsF.Count);
+      for (var _j = _o.PointsF.Count - 1; _j >= 0; --_j) { GSP.FB.Vec3f.Pack(builder, _o.PointsF[_j]); }
+      _points_f = builder.EndVector();
+    }
+    var _points_q = _o.PointsQ == null ? default(Offset<GSP.FB.QuantizedPositions>) : GSP.FB.QuantizedPositions.Pack(builder, _o.PointsQ);
     return CreatePointArrayData(
       builder,
-      _points);
+      _points,
+      _points_f,
+      _points_q);
   }
 }
 
 public class PointArrayDataT
 {
   public List<GSP.FB.Vec3T> Points { get; set; }
+  public List<GSP.FB.Vec3fT> PointsF { get; set; }
+  public GSP.FB.QuantizedPositionsT PointsQ { get; set; }
 
   public PointArrayDataT() {
     this.Points = null;
+    this.PointsF = null;
+    this.PointsQ = null;
   }
   public static PointArrayDataT DeserializeFromBinary(byte[] fbBuffer) {
     return PointArrayData.GetRootAsPointArrayData(new ByteBuffer(fbBuffer)).UnPack();
@@ -86,6 +112,8 @@ static public class PointArrayDataVerify
   {
     return verifier.VerifyTableStart(tablePos)
       && verifier.VerifyVectorOfData(tablePos, 4 /*Points*/, 24 /*GSP.FB.Vec3*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 6 /*PointsF*/, 12 /*GSP.FB.Vec3f*/, false)
+      && verifier.VerifyTable(tablePos, 8 /*PointsQ*/, GSP.FB.QuantizedPositionsVerify.Verify, false)
       && verifier.VerifyTableEnd(tablePos);
   }
 }
@@ -0,0 +1,378 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace GSP.FB
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public enum StatsPhase : byte
+{
+  Call = 0,
+  Deserialize = 1,
+  Verify = 2,
+  Compute = 3,
+  Serialize = 4,
+  Allocate = 5,
+};
+
+
+public struct PhaseStats : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static PhaseStats GetRootAsPhaseStats(ByteBuffer _bb) { return GetRootAsPhaseStats(_bb, new PhaseStats()); }
+  public static PhaseStats GetRootAsPhaseStats(ByteBuffer _bb, PhaseStats obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyPhaseStats(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, PhaseStatsVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public PhaseStats __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public GSP.FB.StatsPhase Phase { get { int o = __p.__offset(4); return o != 0 ? (GSP.FB.StatsPhase)__p.bb.Get(o + __p.bb_pos) : GSP.FB.StatsPhase.Call; } }
+  public ulong Count { get { int o = __p.__offset(6); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong TotalNs { get { int o = __p.__offset(8); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong MaxNs { get { int o = __p.__offset(10); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong P50Ns { get { int o = __p.__offset(12); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong P90Ns { get { int o = __p.__offset(14); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong P99Ns { get { int o = __p.__offset(16); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong Buckets(int j) { int o = __p.__offset(18); return o != 0 ? __p.bb.GetUlong(__p.__vector(o) + j * 8) : (ulong)0; }
+  public int BucketsLength { get { int o = __p.__offset(18); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<ulong> GetBucketsBytes() { return __p.__vector_as_span<ulong>(18, 8); }
+#else
+  public ArraySegment<byte>? GetBucketsBytes() { return __p.__vector_as_arraysegment(18); }
+#endif
+  public ulong[] GetBucketsArray() { return __p.__vector_as_array<ulong>(18); }
+
+  public static Offset<GSP.FB.PhaseStats> CreatePhaseStats(FlatBufferBuilder builder,
+      GSP.FB.StatsPhase phase = GSP.FB.StatsPhase.Call,
+      ulong count = 0,
+      ulong totalNs = 0,
+      ulong maxNs = 0,
+      ulong p50Ns = 0,
+      ulong p90Ns = 0,
+      ulong p99Ns = 0,
+      VectorOffset bucketsOffset = default(VectorOffset)) {
+    builder.StartTable(8);
+    PhaseStats.AddP99Ns(builder, p99Ns);
+    PhaseStats.AddP90Ns(builder, p90Ns);
+    PhaseStats.AddP50Ns(builder, p50Ns);
+    PhaseStats.AddMaxNs(builder, maxNs);
+    PhaseStats.AddTotalNs(builder, totalNs);
+    PhaseStats.AddCount(builder, count);
+    PhaseStats.AddBuckets(builder, bucketsOffset);
+    PhaseStats.AddPhase(builder, phase);
+    return PhaseStats.EndPhaseStats(builder);
+  }
+
+  public static void StartPhaseStats(FlatBufferBuilder builder) { builder.StartTable(8); }
+  public static void AddPhase(FlatBufferBuilder builder, GSP.FB.StatsPhase phase) { builder.AddByte(0, (byte)phase, 0); }
+  public static void AddCount(FlatBufferBuilder builder, ulong count) { builder.AddUlong(1, count, 0); }
+  public static void AddTotalNs(FlatBufferBuilder builder, ulong totalNs) { builder.AddUlong(2, totalNs, 0); }
+  public static void AddMaxNs(FlatBufferBuilder builder, ulong maxNs) { builder.AddUlong(3, maxNs, 0); }
+  public static void AddP50Ns(FlatBufferBuilder builder, ulong p50Ns) { builder.AddUlong(4, p50Ns, 0); }
+  public static void AddP90Ns(FlatBufferBuilder builder, ulong p90Ns) { builder.AddUlong(5, p90Ns, 0); }
+  public static void AddP99Ns(FlatBufferBuilder builder, ulong p99Ns) { builder.AddUlong(6, p99Ns, 0); }
+  public static void AddBuckets(FlatBufferBuilder builder, VectorOffset bucketsOffset) { builder.AddOffset(7, bucketsOffset.Value, 0); }
+  public static VectorOffset CreateBucketsVector(FlatBufferBuilder builder, ulong[] data) { builder.StartVector(8, data.Length, 8); for (int i = data.Length - 1; i >= 0; i--) builder.AddUlong(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateBucketsVectorBlock(FlatBufferBuilder builder, ulong[] data) { builder.StartVector(8, data.Length, 8); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateBucketsVectorBlock(FlatBufferBuilder builder, ArraySegment<ulong> data) { builder.StartVector(8, data.Count, 8); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateBucketsVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<ulong>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartBucketsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(8, numElems, 8); }
+  public static Offset<GSP.FB.PhaseStats> EndPhaseStats(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.PhaseStats>(o);
+  }
+  public PhaseStatsT UnPack() {
+    var _o = new PhaseStatsT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(PhaseStatsT _o) {
+    _o.Phase = this.Phase;
+    _o.Count = this.Count;
+    _o.TotalNs = this.TotalNs;
+    _o.MaxNs = this.MaxNs;
+    _o.P50Ns = this.P50Ns;
+    _o.P90Ns = this.P90Ns;
+    _o.P99Ns = this.P99Ns;
+    _o.Buckets = new List<ulong>();
+    for (var _j = 0; _j < this.BucketsLength; ++_j) {_o.Buckets.Add(this.Buckets(_j));}
+  }
+  public static Offset<GSP.FB.PhaseStats> Pack(FlatBufferBuilder builder, PhaseStatsT _o) {
+    if (_o == null) return default(Offset<GSP.FB.PhaseStats>);
+    var _buckets = default(VectorOffset);
+    if (_o.Buckets != null) {
+      var __buckets = _o.Buckets.ToArray();
+      _buckets = CreateBucketsVector(builder, __buckets);
+    }
+    return CreatePhaseStats(
+      builder,
+      _o.Phase,
+      _o.Count,
+      _o.TotalNs,
+      _o.MaxNs,
+      _o.P50Ns,
+      _o.P90Ns,
+      _o.P99Ns,
+      _buckets);
+  }
+}
+
+public class PhaseStatsT
+{
+  public GSP.FB.StatsPhase Phase { get; set; }
+  public ulong Count { get; set; }
+  public ulong TotalNs { get; set; }
+  public ulong MaxNs { get; set; }
+  public ulong P50Ns { get; set; }
+  public ulong P90Ns { get; set; }
+  public ulong P99Ns { get; set; }
+  public List<ulong> Buckets { get; set; }
+
+  public PhaseStatsT() {
+    this.Phase = GSP.FB.StatsPhase.Call;
+    this.Count = 0;
+    this.TotalNs = 0;
+    this.MaxNs = 0;
+    this.P50Ns = 0;
+    this.P90Ns = 0;
+    this.P99Ns = 0;
+    this.Buckets = null;
+  }
+}
+
+
+static public class PhaseStatsVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyField(tablePos, 4 /*Phase*/, 1 /*GSP.FB.StatsPhase*/, 1, false)
+      && verifier.VerifyField(tablePos, 6 /*Count*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 8 /*TotalNs*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 10 /*MaxNs*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 12 /*P50Ns*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 14 /*P90Ns*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 16 /*P99Ns*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyVectorOfData(tablePos, 18 /*Buckets*/, 8 /*ulong*/, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+public struct ExportStats : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static ExportStats GetRootAsExportStats(ByteBuffer _bb) { return GetRootAsExportStats(_bb, new ExportStats()); }
+  public static ExportStats GetRootAsExportStats(ByteBuffer _bb, ExportStats obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyExportStats(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, ExportStatsVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public ExportStats __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public string Name { get { int o = __p.__offset(4); return o != 0 ? __p.__string(o + __p.bb_pos) : null; } }
+#if ENABLE_SPAN_T
+  public Span<byte> GetNameBytes() { return __p.__vector_as_span<byte>(4, 1); }
+#else
+  public ArraySegment<byte>? GetNameBytes() { return __p.__vector_as_arraysegment(4); }
+#endif
+  public byte[] GetNameArray() { return __p.__vector_as_array<byte>(4); }
+  public ulong Calls { get { int o = __p.__offset(6); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong BytesIn { get { int o = __p.__offset(8); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong BytesOut { get { int o = __p.__offset(10); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public GSP.FB.PhaseStats? Phases(int j) { int o = __p.__offset(12); return o != 0 ? (GSP.FB.PhaseStats?)(new GSP.FB.PhaseStats()).__assign(__p.__indirect(__p.__vector(o) + j * 4), __p.bb) : null; }
+  public int PhasesLength { get { int o = __p.__offset(12); return o != 0 ? __p.__vector_len(o) : 0; } }
+
+  public static Offset<GSP.FB.ExportStats> CreateExportStats(FlatBufferBuilder builder,
+      StringOffset nameOffset = default(StringOffset),
+      ulong calls = 0,
+      ulong bytesIn = 0,
+      ulong bytesOut = 0,
+      VectorOffset phasesOffset = default(VectorOffset)) {
+    builder.StartTable(5);
+    ExportStats.AddBytesOut(builder, bytesOut);
+    ExportStats.AddBytesIn(builder, bytesIn);
+    ExportStats.AddCalls(builder, calls);
+    ExportStats.AddPhases(builder, phasesOffset);
+    ExportStats.AddName(builder, nameOffset);
+    return ExportStats.EndExportStats(builder);
+  }
+
+  public static void StartExportStats(FlatBufferBuilder builder) { builder.StartTable(5); }
+  public static void AddName(FlatBufferBuilder builder, StringOffset nameOffset) { builder.AddOffset(0, nameOffset.Value, 0); }
+  public static void AddCalls(FlatBufferBuilder builder, ulong calls) { builder.AddUlong(1, calls, 0); }
+  public static void AddBytesIn(FlatBufferBuilder builder, ulong bytesIn) { builder.AddUlong(2, bytesIn, 0); }
+  public static void AddBytesOut(FlatBufferBuilder builder, ulong bytesOut) { builder.AddUlong(3, bytesOut, 0); }
+  public static void AddPhases(FlatBufferBuilder builder, VectorOffset phasesOffset) { builder.AddOffset(4, phasesOffset.Value, 0); }
+  public static VectorOffset CreatePhasesVector(FlatBufferBuilder builder, Offset<GSP.FB.PhaseStats>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
+  public static VectorOffset CreatePhasesVectorBlock(FlatBufferBuilder builder, Offset<GSP.FB.PhaseStats>[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreatePhasesVectorBlock(FlatBufferBuilder builder, ArraySegment<Offset<GSP.FB.PhaseStats>> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreatePhasesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<Offset<GSP.FB.PhaseStats>>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartPhasesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static Offset<GSP.FB.ExportStats> EndExportStats(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.ExportStats>(o);
+  }
+  public ExportStatsT UnPack() {
+    var _o = new ExportStatsT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(ExportStatsT _o) {
+    _o.Name = this.Name;
+    _o.Calls = this.Calls;
+    _o.BytesIn = this.BytesIn;
+    _o.BytesOut = this.BytesOut;
+    _o.Phases = new List<GSP.FB.PhaseStatsT>();
+    for (var _j = 0; _j < this.PhasesLength; ++_j) {_o.Phases.Add(this.Phases(_j).HasValue ? this.Phases(_j).Value.UnPack() : null);}
+  }
+  public static Offset<GSP.FB.ExportStats> Pack(FlatBufferBuilder builder, ExportStatsT _o) {
+    if (_o == null) return default(Offset<GSP.FB.ExportStats>);
+    var _name = _o.Name == null ? default(StringOffset) : builder.CreateString(_o.Name);
+    var _phases = default(VectorOffset);
+    if (_o.Phases != null) {
+      var __phases = new Offset<GSP.FB.PhaseStats>[_o.Phases.Count];
+      for (var _j = 0; _j < __phases.Length; ++_j) { __phases[_j] = GSP.FB.PhaseStats.Pack(builder, _o.Phases[_j]); }
+      _phases = CreatePhasesVector(builder, __phases);
+    }
+    return CreateExportStats(
+      builder,
+      _name,
+      _o.Calls,
+      _o.BytesIn,
+      _o.BytesOut,
+      _phases);
+  }
+}
+
+public class ExportStatsT
+{
+  public string Name { get; set; }
+  public ulong Calls { get; set; }
+  public ulong BytesIn { get; set; }
+  public ulong BytesOut { get; set; }
+  public List<GSP.FB.PhaseStatsT> Phases { get; set; }
+
+  public ExportStatsT() {
+    this.Name = null;
+    this.Calls = 0;
+    this.BytesIn = 0;
+    this.BytesOut = 0;
+    this.Phases = null;
+  }
+}
+
+
+static public class ExportStatsVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyString(tablePos, 4 /*Name*/, false)
+      && verifier.VerifyField(tablePos, 6 /*Calls*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 8 /*BytesIn*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 10 /*BytesOut*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyVectorOfTables(tablePos, 12 /*Phases*/, GSP.FB.PhaseStatsVerify.Verify, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+public struct StatsData : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static StatsData GetRootAsStatsData(ByteBuffer _bb) { return GetRootAsStatsData(_bb, new StatsData()); }
+  public static StatsData GetRootAsStatsData(ByteBuffer _bb, StatsData obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyStatsData(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, StatsDataVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public StatsData __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public bool Enabled { get { int o = __p.__offset(4); return o != 0 ? 0!=__p.bb.Get(o + __p.bb_pos) : (bool)false; } }
+  public GSP.FB.ExportStats? Exports(int j) { int o = __p.__offset(6); return o != 0 ? (GSP.FB.ExportStats?)(new GSP.FB.ExportStats()).__assign(__p.__indirect(__p.__vector(o) + j * 4), __p.bb) : null; }
+  public int ExportsLength { get { int o = __p.__offset(6); return o != 0 ? __p.__vector_len(o) : 0; } }
+
+  public static Offset<GSP.FB.StatsData> CreateStatsData(FlatBufferBuilder builder,
+      bool enabled = false,
+      VectorOffset exportsOffset = default(VectorOffset)) {
+    builder.StartTable(2);
+    StatsData.AddExports(builder, exportsOffset);
+    StatsData.AddEnabled(builder, enabled);
+    return StatsData.EndStatsData(builder);
+  }
+
+  public static void StartStatsData(FlatBufferBuilder builder) { builder.StartTable(2); }
+  public static void AddEnabled(FlatBufferBuilder builder, bool enabled) { builder.AddBool(0, enabled, false); }
+  public static void AddExports(FlatBufferBuilder builder, VectorOffset exportsOffset) { builder.AddOffset(1, exportsOffset.Value, 0); }
+  public static VectorOffset CreateExportsVector(FlatBufferBuilder builder, Offset<GSP.FB.ExportStats>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
+  public static VectorOffset CreateExportsVectorBlock(FlatBufferBuilder builder, Offset<GSP.FB.ExportStats>[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateExportsVectorBlock(FlatBufferBuilder builder, ArraySegment<Offset<GSP.FB.ExportStats>> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateExportsVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<Offset<GSP.FB.ExportStats>>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartExportsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static Offset<GSP.FB.StatsData> EndStatsData(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.StatsData>(o);
+  }
+  public static void FinishStatsDataBuffer(FlatBufferBuilder builder, Offset<GSP.FB.StatsData> offset) { builder.Finish(offset.Value); }
+  public static void FinishSizePrefixedStatsDataBuffer(FlatBufferBuilder builder, Offset<GSP.FB.StatsData> offset) { builder.FinishSizePrefixed(offset.Value); }
+  public StatsDataT UnPack() {
+    var _o = new StatsDataT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(StatsDataT _o) {
+    _o.Enabled = this.Enabled;
+    _o.Exports = new List<GSP.FB.ExportStatsT>();
+    for (var _j = 0; _j < this.ExportsLength; ++_j) {_o.Exports.Add(this.Exports(_j).HasValue ? this.Exports(_j).Value.UnPack() : null);}
+  }
+  public static Offset<GSP.FB.StatsData> Pack(FlatBufferBuilder builder, StatsDataT _o) {
+    if (_o == null) return default(Offset<GSP.FB.StatsData>);
+    var _exports = default(VectorOffset);
+    if (_o.Exports != null) {
+      var __exports = new Offset<GSP.FB.ExportStats>[_o.Exports.Count];
+      for (var _j = 0; _j < __exports.Length; ++_j) { __exports[_j] = GSP.FB.ExportStats.Pack(builder, _o.Exports[_j]); }
+      _exports = CreateExportsVector(builder, __exports);
+    }
+    return CreateStatsData(
+      builder,
+      _o.Enabled,
+      _exports);
+  }
+}
+
+public class StatsDataT
+{
+  public bool Enabled { get; set; }
+  public List<GSP.FB.ExportStatsT> Exports { get; set; }
+
+  public StatsDataT() {
+    this.Enabled = false;
+    this.Exports = null;
+  }
+  public static StatsDataT DeserializeFromBinary(byte[] fbBuffer) {
+    return StatsData.GetRootAsStatsData(new ByteBuffer(fbBuffer)).UnPack();
+  }
+  public byte[] SerializeToBinary() {
+    var fbb = new FlatBufferBuilder(0x10000);
+    StatsData.FinishStatsDataBuffer(fbb, StatsData.Pack(fbb, this));
+    return fbb.DataBuffer.ToSizedArray();
+  }
+}
+
+
+static public class StatsDataVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyField(tablePos, 4 /*Enabled*/, 1 /*bool*/, 1, false)
+      && verifier.VerifyVectorOfTables(tablePos, 6 /*Exports*/, GSP.FB.ExportStatsVerify.Verify, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
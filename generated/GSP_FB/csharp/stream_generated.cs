@@ -0,0 +1,136 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace GSP.FB
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public enum StreamPayload : byte
+{
+  PointArray = 0,
+  Mesh = 1,
+};
+
+
+public struct StreamHeader : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static StreamHeader GetRootAsStreamHeader(ByteBuffer _bb) { return GetRootAsStreamHeader(_bb, new StreamHeader()); }
+  public static StreamHeader GetRootAsStreamHeader(ByteBuffer _bb, StreamHeader obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyStreamHeader(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, StreamHeaderVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public StreamHeader __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public GSP.FB.StreamPayload Payload { get { int o = __p.__offset(4); return o != 0 ? (GSP.FB.StreamPayload)__p.bb.Get(o + __p.bb_pos) : GSP.FB.StreamPayload.PointArray; } }
+  public ulong PointCount { get { int o = __p.__offset(6); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong FaceCount { get { int o = __p.__offset(8); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public byte FaceVertexCount { get { int o = __p.__offset(10); return o != 0 ? __p.bb.Get(o + __p.bb_pos) : (byte)3; } }
+  public ulong PointChunks { get { int o = __p.__offset(12); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong FaceChunks { get { int o = __p.__offset(14); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+
+  public static Offset<GSP.FB.StreamHeader> CreateStreamHeader(FlatBufferBuilder builder,
+      GSP.FB.StreamPayload payload = GSP.FB.StreamPayload.PointArray,
+      ulong pointCount = 0,
+      ulong faceCount = 0,
+      byte faceVertexCount = 3,
+      ulong pointChunks = 0,
+      ulong faceChunks = 0) {
+    builder.StartTable(6);
+    StreamHeader.AddFaceChunks(builder, faceChunks);
+    StreamHeader.AddPointChunks(builder, pointChunks);
+    StreamHeader.AddFaceCount(builder, faceCount);
+    StreamHeader.AddPointCount(builder, pointCount);
+    StreamHeader.AddFaceVertexCount(builder, faceVertexCount);
+    StreamHeader.AddPayload(builder, payload);
+    return StreamHeader.EndStreamHeader(builder);
+  }
+
+  public static void StartStreamHeader(FlatBufferBuilder builder) { builder.StartTable(6); }
+  public static void AddPayload(FlatBufferBuilder builder, GSP.FB.StreamPayload payload) { builder.AddByte(0, (byte)payload, 0); }
+  public static void AddPointCount(FlatBufferBuilder builder, ulong pointCount) { builder.AddUlong(1, pointCount, 0); }
+  public static void AddFaceCount(FlatBufferBuilder builder, ulong faceCount) { builder.AddUlong(2, faceCount, 0); }
+  public static void AddFaceVertexCount(FlatBufferBuilder builder, byte faceVertexCount) { builder.AddByte(3, faceVertexCount, 3); }
+  public static void AddPointChunks(FlatBufferBuilder builder, ulong pointChunks) { builder.AddUlong(4, pointChunks, 0); }
+  public static void AddFaceChunks(FlatBufferBuilder builder, ulong faceChunks) { builder.AddUlong(5, faceChunks, 0); }
+  public static Offset<GSP.FB.StreamHeader> EndStreamHeader(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.StreamHeader>(o);
+  }
+  public static void FinishStreamHeaderBuffer(FlatBufferBuilder builder, Offset<GSP.FB.StreamHeader> offset) { builder.Finish(offset.Value); }
+  public static void FinishSizePrefixedStreamHeaderBuffer(FlatBufferBuilder builder, Offset<GSP.FB.StreamHeader> offset) { builder.FinishSizePrefixed(offset.Value); }
+  public StreamHeaderT UnPack() {
+    var _o = new StreamHeaderT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(StreamHeaderT _o) {
+    _o.Payload = this.Payload;
+    _o.PointCount = this.PointCount;
+    _o.FaceCount = this.FaceCount;
+    _o.FaceVertexCount = this.FaceVertexCount;
+    _o.PointChunks = this.PointChunks;
+    _o.FaceChunks = this.FaceChunks;
+  }
+  public static Offset<GSP.FB.StreamHeader> Pack(FlatBufferBuilder builder, StreamHeaderT _o) {
+    if (_o == null) return default(Offset<GSP.FB.StreamHeader>);
+    return CreateStreamHeader(
+      builder,
+      _o.Payload,
+      _o.PointCount,
+      _o.FaceCount,
+      _o.FaceVertexCount,
+      _o.PointChunks,
+      _o.FaceChunks);
+  }
+}
+
+public class StreamHeaderT
+{
+  public GSP.FB.StreamPayload Payload { get; set; }
+  public ulong PointCount { get; set; }
+  public ulong FaceCount { get; set; }
+  public byte FaceVertexCount { get; set; }
+  public ulong PointChunks { get; set; }
+  public ulong FaceChunks { get; set; }
+
+  public StreamHeaderT() {
+    this.Payload = GSP.FB.StreamPayload.PointArray;
+    this.PointCount = 0;
+    this.FaceCount = 0;
+    this.FaceVertexCount = 3;
+    this.PointChunks = 0;
+    this.FaceChunks = 0;
+  }
+  public static StreamHeaderT DeserializeFromBinary(byte[] fbBuffer) {
+    return StreamHeader.GetRootAsStreamHeader(new ByteBuffer(fbBuffer)).UnPack();
+  }
+  public byte[] SerializeToBinary() {
+    var fbb = new FlatBufferBuilder(0x10000);
+    StreamHeader.FinishStreamHeaderBuffer(fbb, StreamHeader.Pack(fbb, this));
+    return fbb.DataBuffer.ToSizedArray();
+  }
+}
+
+
+static public class StreamHeaderVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyField(tablePos, 4 /*Payload*/, 1 /*GSP.FB.StreamPayload*/, 1, false)
+      && verifier.VerifyField(tablePos, 6 /*PointCount*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 8 /*FaceCount*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 10 /*FaceVertexCount*/, 1 /*byte*/, 1, false)
+      && verifier.VerifyField(tablePos, 12 /*PointChunks*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 14 /*FaceChunks*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
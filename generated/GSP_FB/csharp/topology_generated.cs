@@ -0,0 +1,309 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace GSP.FB
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct TopologyReport : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static TopologyReport GetRootAsTopologyReport(ByteBuffer _bb) { return GetRootAsTopologyReport(_bb, new TopologyReport()); }
+  public static TopologyReport GetRootAsTopologyReport(ByteBuffer _bb, TopologyReport obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyTopologyReport(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, TopologyReportVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public TopologyReport __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public long VertexCount { get { int o = __p.__offset(4); return o != 0 ? __p.bb.GetLong(o + __p.bb_pos) : (long)0; } }
+  public long FaceCount { get { int o = __p.__offset(6); return o != 0 ? __p.bb.GetLong(o + __p.bb_pos) : (long)0; } }
+  public long EdgeCount { get { int o = __p.__offset(8); return o != 0 ? __p.bb.GetLong(o + __p.bb_pos) : (long)0; } }
+  public long BoundaryEdgeCount { get { int o = __p.__offset(10); return o != 0 ? __p.bb.GetLong(o + __p.bb_pos) : (long)0; } }
+  public int DegenerateFaces(int j) { int o = __p.__offset(12); return o != 0 ? __p.bb.GetInt(__p.__vector(o) + j * 4) : (int)0; }
+  public int DegenerateFacesLength { get { int o = __p.__offset(12); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<int> GetDegenerateFacesBytes() { return __p.__vector_as_span<int>(12, 4); }
+#else
+  public ArraySegment<byte>? GetDegenerateFacesBytes() { return __p.__vector_as_arraysegment(12); }
+#endif
+  public int[] GetDegenerateFacesArray() { return __p.__vector_as_array<int>(12); }
+  public int DuplicateFaces(int j) { int o = __p.__offset(14); return o != 0 ? __p.bb.GetInt(__p.__vector(o) + j * 4) : (int)0; }
+  public int DuplicateFacesLength { get { int o = __p.__offset(14); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<int> GetDuplicateFacesBytes() { return __p.__vector_as_span<int>(14, 4); }
+#else
+  public ArraySegment<byte>? GetDuplicateFacesBytes() { return __p.__vector_as_arraysegment(14); }
+#endif
+  public int[] GetDuplicateFacesArray() { return __p.__vector_as_array<int>(14); }
+  public GSP.FB.Vec2i? NonManifoldEdges(int j) { int o = __p.__offset(16); return o != 0 ? (GSP.FB.Vec2i?)(new GSP.FB.Vec2i()).__assign(__p.__vector(o) + j * 8, __p.bb) : null; }
+  public int NonManifoldEdgesLength { get { int o = __p.__offset(16); return o != 0 ? __p.__vector_len(o) : 0; } }
+  public int NonManifoldVertices(int j) { int o = __p.__offset(18); return o != 0 ? __p.bb.GetInt(__p.__vector(o) + j * 4) : (int)0; }
+  public int NonManifoldVerticesLength { get { int o = __p.__offset(18); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<int> GetNonManifoldVerticesBytes() { return __p.__vector_as_span<int>(18, 4); }
+#else
+  public ArraySegment<byte>? GetNonManifoldVerticesBytes() { return __p.__vector_as_arraysegment(18); }
+#endif
+  public int[] GetNonManifoldVerticesArray() { return __p.__vector_as_array<int>(18); }
+  public int UnreferencedVertices(int j) { int o = __p.__offset(20); return o != 0 ? __p.bb.GetInt(__p.__vector(o) + j * 4) : (int)0; }
+  public int UnreferencedVerticesLength { get { int o = __p.__offset(20); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<int> GetUnreferencedVerticesBytes() { return __p.__vector_as_span<int>(20, 4); }
+#else
+  public ArraySegment<byte>? GetUnreferencedVerticesBytes() { return __p.__vector_as_arraysegment(20); }
+#endif
+  public int[] GetUnreferencedVerticesArray() { return __p.__vector_as_array<int>(20); }
+  public GSP.FB.Vec2i? InconsistentEdges(int j) { int o = __p.__offset(22); return o != 0 ? (GSP.FB.Vec2i?)(new GSP.FB.Vec2i()).__assign(__p.__vector(o) + j * 8, __p.bb) : null; }
+  public int InconsistentEdgesLength { get { int o = __p.__offset(22); return o != 0 ? __p.__vector_len(o) : 0; } }
+  public int BoundaryLoopVertices(int j) { int o = __p.__offset(24); return o != 0 ? __p.bb.GetInt(__p.__vector(o) + j * 4) : (int)0; }
+  public int BoundaryLoopVerticesLength { get { int o = __p.__offset(24); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<int> GetBoundaryLoopVerticesBytes() { return __p.__vector_as_span<int>(24, 4); }
+#else
+  public ArraySegment<byte>? GetBoundaryLoopVerticesBytes() { return __p.__vector_as_arraysegment(24); }
+#endif
+  public int[] GetBoundaryLoopVerticesArray() { return __p.__vector_as_array<int>(24); }
+  public int BoundaryLoopSizes(int j) { int o = __p.__offset(26); return o != 0 ? __p.bb.GetInt(__p.__vector(o) + j * 4) : (int)0; }
+  public int BoundaryLoopSizesLength { get { int o = __p.__offset(26); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<int> GetBoundaryLoopSizesBytes() { return __p.__vector_as_span<int>(26, 4); }
+#else
+  public ArraySegment<byte>? GetBoundaryLoopSizesBytes() { return __p.__vector_as_arraysegment(26); }
+#endif
+  public int[] GetBoundaryLoopSizesArray() { return __p.__vector_as_array<int>(26); }
+
+  public static Offset<GSP.FB.TopologyReport> CreateTopologyReport(FlatBufferBuilder builder,
+      long vertexCount = 0,
+      long faceCount = 0,
+      long edgeCount = 0,
+      long boundaryEdgeCount = 0,
+      VectorOffset degenerate_facesOffset = default(VectorOffset),
+      VectorOffset duplicate_facesOffset = default(VectorOffset),
+      VectorOffset non_manifold_edgesOffset = default(VectorOffset),
+      VectorOffset non_manifold_verticesOffset = default(VectorOffset),
+      VectorOffset unreferenced_verticesOffset = default(VectorOffset),
+      VectorOffset inconsistent_edgesOffset = default(VectorOffset),
+      VectorOffset boundary_loop_verticesOffset = default(VectorOffset),
+      VectorOffset boundary_loop_sizesOffset = default(VectorOffset)) {
+    builder.StartTable(12);
+    TopologyReport.AddBoundaryEdgeCount(builder, boundaryEdgeCount);
+    TopologyReport.AddEdgeCount(builder, edgeCount);
+    TopologyReport.AddFaceCount(builder, faceCount);
+    TopologyReport.AddVertexCount(builder, vertexCount);
+    TopologyReport.AddBoundaryLoopSizes(builder, boundary_loop_sizesOffset);
+    TopologyReport.AddBoundaryLoopVertices(builder, boundary_loop_verticesOffset);
+    TopologyReport.AddInconsistentEdges(builder, inconsistent_edgesOffset);
+    TopologyReport.AddUnreferencedVertices(builder, unreferenced_verticesOffset);
+    TopologyReport.AddNonManifoldVertices(builder, non_manifold_verticesOffset);
+    TopologyReport.AddNonManifoldEdges(builder, non_manifold_edgesOffset);
+    TopologyReport.AddDuplicateFaces(builder, duplicate_facesOffset);
+    TopologyReport.AddDegenerateFaces(builder, degenerate_facesOffset);
+    return TopologyReport.EndTopologyReport(builder);
+  }
+
+  public static void StartTopologyReport(FlatBufferBuilder builder) { builder.StartTable(12); }
+  public static void AddVertexCount(FlatBufferBuilder builder, long vertexCount) { builder.AddLong(0, vertexCount, 0); }
+  public static void AddFaceCount(FlatBufferBuilder builder, long faceCount) { builder.AddLong(1, faceCount, 0); }
+  public static void AddEdgeCount(FlatBufferBuilder builder, long edgeCount) { builder.AddLong(2, edgeCount, 0); }
+  public static void AddBoundaryEdgeCount(FlatBufferBuilder builder, long boundaryEdgeCount) { builder.AddLong(3, boundaryEdgeCount, 0); }
+  public static void AddDegenerateFaces(FlatBufferBuilder builder, VectorOffset degenerateFacesOffset) { builder.AddOffset(4, degenerateFacesOffset.Value, 0); }
+  public static VectorOffset CreateDegenerateFacesVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateDegenerateFacesVectorBlock(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateDegenerateFacesVectorBlock(FlatBufferBuilder builder, ArraySegment<int> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateDegenerateFacesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<int>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartDegenerateFacesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddDuplicateFaces(FlatBufferBuilder builder, VectorOffset duplicateFacesOffset) { builder.AddOffset(5, duplicateFacesOffset.Value, 0); }
+  public static VectorOffset CreateDuplicateFacesVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateDuplicateFacesVectorBlock(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateDuplicateFacesVectorBlock(FlatBufferBuilder builder, ArraySegment<int> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateDuplicateFacesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<int>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartDuplicateFacesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddNonManifoldEdges(FlatBufferBuilder builder, VectorOffset nonManifoldEdgesOffset) { builder.AddOffset(6, nonManifoldEdgesOffset.Value, 0); }
+  public static void StartNonManifoldEdgesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(8, numElems, 4); }
+  public static void AddNonManifoldVertices(FlatBufferBuilder builder, VectorOffset nonManifoldVerticesOffset) { builder.AddOffset(7, nonManifoldVerticesOffset.Value, 0); }
+  public static VectorOffset CreateNonManifoldVerticesVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateNonManifoldVerticesVectorBlock(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateNonManifoldVerticesVectorBlock(FlatBufferBuilder builder, ArraySegment<int> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateNonManifoldVerticesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<int>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartNonManifoldVerticesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddUnreferencedVertices(FlatBufferBuilder builder, VectorOffset unreferencedVerticesOffset) { builder.AddOffset(8, unreferencedVerticesOffset.Value, 0); }
+  public static VectorOffset CreateUnreferencedVerticesVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateUnreferencedVerticesVectorBlock(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateUnreferencedVerticesVectorBlock(FlatBufferBuilder builder, ArraySegment<int> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateUnreferencedVerticesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<int>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartUnreferencedVerticesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddInconsistentEdges(FlatBufferBuilder builder, VectorOffset inconsistentEdgesOffset) { builder.AddOffset(9, inconsistentEdgesOffset.Value, 0); }
+  public static void StartInconsistentEdgesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(8, numElems, 4); }
+  public static void AddBoundaryLoopVertices(FlatBufferBuilder builder, VectorOffset boundaryLoopVerticesOffset) { builder.AddOffset(10, boundaryLoopVerticesOffset.Value, 0); }
+  public static VectorOffset CreateBoundaryLoopVerticesVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateBoundaryLoopVerticesVectorBlock(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateBoundaryLoopVerticesVectorBlock(FlatBufferBuilder builder, ArraySegment<int> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateBoundaryLoopVerticesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<int>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartBoundaryLoopVerticesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddBoundaryLoopSizes(FlatBufferBuilder builder, VectorOffset boundaryLoopSizesOffset) { builder.AddOffset(11, boundaryLoopSizesOffset.Value, 0); }
+  public static VectorOffset CreateBoundaryLoopSizesVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateBoundaryLoopSizesVectorBlock(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateBoundaryLoopSizesVectorBlock(FlatBufferBuilder builder, ArraySegment<int> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateBoundaryLoopSizesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<int>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartBoundaryLoopSizesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static Offset<GSP.FB.TopologyReport> EndTopologyReport(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.TopologyReport>(o);
+  }
+  public static void FinishTopologyReportBuffer(FlatBufferBuilder builder, Offset<GSP.FB.TopologyReport> offset) { builder.Finish(offset.Value); }
+  public static void FinishSizePrefixedTopologyReportBuffer(FlatBufferBuilder builder, Offset<GSP.FB.TopologyReport> offset) { builder.FinishSizePrefixed(offset.Value); }
+  public TopologyReportT UnPack() {
+    var _o = new TopologyReportT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(TopologyReportT _o) {
+    _o.VertexCount = this.VertexCount;
+    _o.FaceCount = this.FaceCount;
+    _o.EdgeCount = this.EdgeCount;
+    _o.BoundaryEdgeCount = this.BoundaryEdgeCount;
+    _o.DegenerateFaces = new List<int>();
+    for (var _j = 0; _j < this.DegenerateFacesLength; ++_j) {_o.DegenerateFaces.Add(this.DegenerateFaces(_j));}
+    _o.DuplicateFaces = new List<int>();
+    for (var _j = 0; _j < this.DuplicateFacesLength; ++_j) {_o.DuplicateFaces.Add(this.DuplicateFaces(_j));}
+    _o.NonManifoldEdges = new List<GSP.FB.Vec2iT>();
+    for (var _j = 0; _j < this.NonManifoldEdgesLength; ++_j) {_o.NonManifoldEdges.Add(this.NonManifoldEdges(_j).HasValue ? this.NonManifoldEdges(_j).Value.UnPack() : null);}
+    _o.NonManifoldVertices = new List<int>();
+    for (var _j = 0; _j < this.NonManifoldVerticesLength; ++_j) {_o.NonManifoldVertices.Add(this.NonManifoldVertices(_j));}
+    _o.UnreferencedVertices = new List<int>();
+    for (var _j = 0; _j < this.UnreferencedVerticesLength; ++_j) {_o.UnreferencedVertices.Add(this.UnreferencedVertices(_j));}
+    _o.InconsistentEdges = new List<GSP.FB.Vec2iT>();
+    for (var _j = 0; _j < this.InconsistentEdgesLength; ++_j) {_o.InconsistentEdges.Add(this.InconsistentEdges(_j).HasValue ? this.InconsistentEdges(_j).Value.UnPack() : null);}
+    _o.BoundaryLoopVertices = new List<int>();
+    for (var _j = 0; _j < this.BoundaryLoopVerticesLength; ++_j) {_o.BoundaryLoopVertices.Add(this.BoundaryLoopVertices(_j));}
+    _o.BoundaryLoopSizes = new List<int>();
+    for (var _j = 0; _j < this.BoundaryLoopSizesLength; ++_j) {_o.BoundaryLoopSizes.Add(this.BoundaryLoopSizes(_j));}
+  }
+  public static Offset<GSP.FB.TopologyReport> Pack(FlatBufferBuilder builder, TopologyReportT _o) {
+    if (_o == null) return default(Offset<GSP.FB.TopologyReport>);
+    var _degenerate_faces = default(VectorOffset);
+    if (_o.DegenerateFaces != null) {
+      var __degenerate_faces = _o.DegenerateFaces.ToArray();
+      _degenerate_faces = CreateDegenerateFacesVector(builder, __degenerate_faces);
+    }
+    var _duplicate_faces = default(VectorOffset);
+    if (_o.DuplicateFaces != null) {
+      var __duplicate_faces = _o.DuplicateFaces.ToArray();
+      _duplicate_faces = CreateDuplicateFacesVector(builder, __duplicate_faces);
+    }
+    var _non_manifold_edges = default(VectorOffset);
+    if (_o.NonManifoldEdges != null) {
+      StartNonManifoldEdgesVector(builder, _o.NonManifoldEdges.Count);
+      for (var _j = _o.NonManifoldEdges.Count - 1; _j >= 0; --_j) { GSP.FB.Vec2i.Pack(builder, _o.NonManifoldEdges[_j]); }
+      _non_manifold_edges = builder.EndVector();
+    }
+    var _non_manifold_vertices = default(VectorOffset);
+    if (_o.NonManifoldVertices != null) {
+      var __non_manifold_vertices = _o.NonManifoldVertices.ToArray();
+      _non_manifold_vertices = CreateNonManifoldVerticesVector(builder, __non_manifold_vertices);
+    }
+    var _unreferenced_vertices = default(VectorOffset);
+    if (_o.UnreferencedVertices != null) {
+      var __unreferenced_vertices = _o.UnreferencedVertices.ToArray();
+      _unreferenced_vertices = CreateUnreferencedVerticesVector(builder, __unreferenced_vertices);
+    }
+    var _inconsistent_edges = default(VectorOffset);
+    if (_o.InconsistentEdges != null) {
+      StartInconsistentEdgesVector(builder, _o.InconsistentEdges.Count);
+      for (var _j = _o.InconsistentEdges.Count - 1; _j >= 0; --_j) { GSP.FB.Vec2i.Pack(builder, _o.InconsistentEdges[_j]); }
+      _inconsistent_edges = builder.EndVector();
+    }
+    var _boundary_loop_vertices = default(VectorOffset);
+    if (_o.BoundaryLoopVertices != null) {
+      var __boundary_loop_vertices = _o.BoundaryLoopVertices.ToArray();
+      _boundary_loop_vertices = CreateBoundaryLoopVerticesVector(builder, __boundary_loop_vertices);
+    }
+    var _boundary_loop_sizes = default(VectorOffset);
+    if (_o.BoundaryLoopSizes != null) {
+      var __boundary_loop_sizes = _o.BoundaryLoopSizes.ToArray();
+      _boundary_loop_sizes = CreateBoundaryLoopSizesVector(builder, __boundary_loop_sizes);
+    }
+    return CreateTopologyReport(
+      builder,
+      _o.VertexCount,
+      _o.FaceCount,
+      _o.EdgeCount,
+      _o.BoundaryEdgeCount,
+      _degenerate_faces,
+      _duplicate_faces,
+      _non_manifold_edges,
+      _non_manifold_vertices,
+      _unreferenced_vertices,
+      _inconsistent_edges,
+      _boundary_loop_vertices,
+      _boundary_loop_sizes);
+  }
+}
+
+public class TopologyReportT
+{
+  public long VertexCount { get; set; }
+  public long FaceCount { get; set; }
+  public long EdgeCount { get; set; }
+  public long BoundaryEdgeCount { get; set; }
+  public List<int> DegenerateFaces { get; set; }
+  public List<int> DuplicateFaces { get; set; }
+  public List<GSP.FB.Vec2iT> NonManifoldEdges { get; set; }
+  public List<int> NonManifoldVertices { get; set; }
+  public List<int> UnreferencedVertices { get; set; }
+  public List<GSP.FB.Vec2iT> InconsistentEdges { get; set; }
+  public List<int> BoundaryLoopVertices { get; set; }
+  public List<int> BoundaryLoopSizes { get; set; }
+
+  public TopologyReportT() {
+    this.VertexCount = 0;
+    this.FaceCount = 0;
+    this.EdgeCount = 0;
+    this.BoundaryEdgeCount = 0;
+    this.DegenerateFaces = null;
+    this.DuplicateFaces = null;
+    this.NonManifoldEdges = null;
+    this.NonManifoldVertices = null;
+    this.UnreferencedVertices = null;
+    this.InconsistentEdges = null;
+    this.BoundaryLoopVertices = null;
+    this.BoundaryLoopSizes = null;
+  }
+  public static TopologyReportT DeserializeFromBinary(byte[] fbBuffer) {
+    return TopologyReport.GetRootAsTopologyReport(new ByteBuffer(fbBuffer)).UnPack();
+  }
+  public byte[] SerializeToBinary() {
+    var fbb = new FlatBufferBuilder(0x10000);
+    TopologyReport.FinishTopologyReportBuffer(fbb, TopologyReport.Pack(fbb, this));
+    return fbb.DataBuffer.ToSizedArray();
+  }
+}
+
+
+static public class TopologyReportVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyField(tablePos, 4 /*VertexCount*/, 8 /*long*/, 8, false)
+      && verifier.VerifyField(tablePos, 6 /*FaceCount*/, 8 /*long*/, 8, false)
+      && verifier.VerifyField(tablePos, 8 /*EdgeCount*/, 8 /*long*/, 8, false)
+      && verifier.VerifyField(tablePos, 10 /*BoundaryEdgeCount*/, 8 /*long*/, 8, false)
+      && verifier.VerifyVectorOfData(tablePos, 12 /*DegenerateFaces*/, 4 /*int*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 14 /*DuplicateFaces*/, 4 /*int*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 16 /*NonManifoldEdges*/, 8 /*GSP.FB.Vec2i*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 18 /*NonManifoldVertices*/, 4 /*int*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 20 /*UnreferencedVertices*/, 4 /*int*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 22 /*InconsistentEdges*/, 8 /*GSP.FB.Vec2i*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 24 /*BoundaryLoopVertices*/, 4 /*int*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 26 /*BoundaryLoopSizes*/, 4 /*int*/, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
@@ -17,15 +17,48 @@ $ErrorActionPreference = "Stop"
 $UpstreamFiles = @(
     # C++ Core Headers
     "GeoSharPlusCPP/include/GeoSharPlusCPP/API/BridgeAPI.h",
+    "GeoSharPlusCPP/include/GeoSharPlusCPP/Core/BoundingBox.h",
+    "GeoSharPlusCPP/include/GeoSharPlusCPP/Core/Exports.h",
     "GeoSharPlusCPP/include/GeoSharPlusCPP/Core/Geometry.h",
+    "GeoSharPlusCPP/include/GeoSharPlusCPP/Core/JobQueue.h",
     "GeoSharPlusCPP/include/GeoSharPlusCPP/Core/Macro.h",
+    "GeoSharPlusCPP/include/GeoSharPlusCPP/Core/MassProperties.h",
     "GeoSharPlusCPP/include/GeoSharPlusCPP/Core/MathTypes.h",
+    "GeoSharPlusCPP/include/GeoSharPlusCPP/Core/MeshBvh.h",
+    "GeoSharPlusCPP/include/GeoSharPlusCPP/Core/MeshRegistry.h",
+    "GeoSharPlusCPP/include/GeoSharPlusCPP/Core/MeshTopology.h",
+    "GeoSharPlusCPP/include/GeoSharPlusCPP/Core/Parallel.h",
+    "GeoSharPlusCPP/include/GeoSharPlusCPP/Core/ResultCache.h",
+    "GeoSharPlusCPP/include/GeoSharPlusCPP/Core/Stats.h",
+    "GeoSharPlusCPP/include/GeoSharPlusCPP/Core/Trace.h",
+    "GeoSharPlusCPP/include/GeoSharPlusCPP/Serialization/ChunkedStream.h",
+    "GeoSharPlusCPP/include/GeoSharPlusCPP/Serialization/FbCodec.h",
+    "GeoSharPlusCPP/include/GeoSharPlusCPP/Serialization/IndexCodec.h",
+    "GeoSharPlusCPP/include/GeoSharPlusCPP/Serialization/InteropAccounting.h",
+    "GeoSharPlusCPP/include/GeoSharPlusCPP/Serialization/InteropMemory.h",
     "GeoSharPlusCPP/include/GeoSharPlusCPP/Serialization/Serializer.h",
+    "GeoSharPlusCPP/include/GeoSharPlusCPP/Serialization/VerifyPolicy.h",
     
     # C++ Core Sources
     "GeoSharPlusCPP/src/API/BridgeAPI.cpp",
+    "GeoSharPlusCPP/src/Core/BoundingBox.cpp",
+    "GeoSharPlusCPP/src/Core/Exports.cpp",
     "GeoSharPlusCPP/src/Core/Geometry.cpp",
+    "GeoSharPlusCPP/src/Core/JobQueue.cpp",
+    "GeoSharPlusCPP/src/Core/MassProperties.cpp",
+    "GeoSharPlusCPP/src/Core/MeshBvh.cpp",
+    "GeoSharPlusCPP/src/Core/MeshRegistry.cpp",
+    "GeoSharPlusCPP/src/Core/MeshTopology.cpp",
+    "GeoSharPlusCPP/src/Core/Parallel.cpp",
+    "GeoSharPlusCPP/src/Core/ResultCache.cpp",
+    "GeoSharPlusCPP/src/Core/Stats.cpp",
+    "GeoSharPlusCPP/src/Core/Trace.cpp",
+    "GeoSharPlusCPP/src/Serialization/ChunkedStream.cpp",
+    "GeoSharPlusCPP/src/Serialization/IndexCodec.cpp",
+    "GeoSharPlusCPP/src/Serialization/InteropAccounting.cpp",
+    "GeoSharPlusCPP/src/Serialization/InteropMemory.cpp",
     "GeoSharPlusCPP/src/Serialization/Serializer.cpp",
+    "GeoSharPlusCPP/src/Serialization/VerifyPolicy.cpp",
     
     # C++ Build Configuration
     "GeoSharPlusCPP/CMakeLists.txt",
@@ -34,14 +67,23 @@ $UpstreamFiles = @(
     
     # Core Schemas
     "GeoSharPlusCPP/schema/base.fbs",
+    "GeoSharPlusCPP/schema/boundingBox.fbs",
     "GeoSharPlusCPP/schema/doubleArray.fbs",
     "GeoSharPlusCPP/schema/doublePairArray.fbs",
     "GeoSharPlusCPP/schema/intArray.fbs",
     "GeoSharPlusCPP/schema/intNestedArray.fbs",
     "GeoSharPlusCPP/schema/intPairArray.fbs",
+    "GeoSharPlusCPP/schema/massProperties.fbs",
+    "GeoSharPlusCPP/schema/memory.fbs",
     "GeoSharPlusCPP/schema/mesh.fbs",
+    "GeoSharPlusCPP/schema/meshBatch.fbs",
+    "GeoSharPlusCPP/schema/meshQuery.fbs",
     "GeoSharPlusCPP/schema/point.fbs",
     "GeoSharPlusCPP/schema/pointArray.fbs",
+    "GeoSharPlusCPP/schema/pointArrayBatch.fbs",
+    "GeoSharPlusCPP/schema/stats.fbs",
+    "GeoSharPlusCPP/schema/stream.fbs",
+    "GeoSharPlusCPP/schema/topology.fbs",
     
     # C# Core Files
     "GeoSharPlusNET/NativeBridge.cs",